@@ -0,0 +1,53 @@
+#include "bench.h"
+#include "esp_timer.h"
+
+static void bench_register(void *ctx, sensor_bench_result_t *r) {
+    iis2mdc_handle_t *sensor = ctx;
+    uint8_t status;
+    iis2mdc_raw_magnetometer_t mag;
+
+    int64_t t0 = esp_timer_get_time();
+    esp_err_t ret = iis2mdc_read_status(sensor, &status);
+    int64_t poll_us = sensor_bench_timed(r, t0, ret == ESP_OK);
+    if (ret != ESP_OK || !(status & IIS2MDC_STATUS_ZYXDA)) return;
+    if (status & IIS2MDC_STATUS_ZYXOR) r->overruns++;
+
+    t0 = esp_timer_get_time();
+    ret = iis2mdc_read_magnetic_raw(sensor, &mag);
+    int64_t data_us = sensor_bench_timed(r, t0, ret == ESP_OK);
+    if (ret != ESP_OK) return;
+    r->samples++;
+    r->read_us += poll_us + data_us;
+}
+
+static void bench_burst(void *ctx, sensor_bench_result_t *r) {
+    iis2mdc_handle_t *sensor = ctx;
+    uint8_t status;
+    iis2mdc_raw_magnetometer_t mag;
+
+    int64_t t0 = esp_timer_get_time();
+    esp_err_t ret = iis2mdc_read_status_and_magnetic(sensor, &status, &mag);
+    int64_t us = sensor_bench_timed(r, t0, ret == ESP_OK);
+    if (ret != ESP_OK || !(status & IIS2MDC_STATUS_ZYXDA)) return;
+    if (status & IIS2MDC_STATUS_ZYXOR) r->overruns++;
+    r->samples++;
+    r->read_us += us;
+}
+
+static const sensor_bench_mode_t bench_modes[BENCH_MODES] = {
+    { .name = "register", .step = bench_register },
+    { .name = "burst",    .step = bench_burst },
+};
+
+size_t bench_run(iis2mdc_handle_t *sensor, sensor_bench_result_t *results) {
+    const sensor_bench_t bench = {
+        .sensor = "IIS2MDC",
+        .odr_hz = BENCH_ODR_HZ,
+        .duration_ms = BENCH_DURATION_MS,
+        .bus_bytes = &sensor->bus_bytes,
+        .ctx = sensor,
+        .modes = bench_modes,
+        .mode_count = BENCH_MODES,
+    };
+    return sensor_bench_run(&bench, results);
+}
@@ -0,0 +1,23 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "iis2mdc.h"
+#include "sensor_bench.h"
+
+// Throughput benchmark of the IIS2MDC driver on components/sensor_bench, built
+// instead of the print loop when BENCH_MODE is 1 in main.c. Modes:
+//   register  poll STATUS_REG, read OUTX..OUTZ when ZYXDA is set
+//   burst     read STATUS_REG and OUTX..OUTZ in one transaction, keep it when ZYXDA is set
+// The sensor has no FIFO; "ovr" counts ZYXOR flags and bytes include I2C address bytes.
+#ifndef BENCH_DURATION_MS
+#define BENCH_DURATION_MS       2000    // Per mode; stays under the task watchdog timeout
+#endif
+#define BENCH_ODR_HZ            100     // CFG_REG_A set by iis2mdc_init()
+#define BENCH_MODES             2
+
+// Bench API
+// Runs every mode on an initialized sensor into results[BENCH_MODES] and prints the
+// table. Returns the number of modes that ran.
+size_t bench_run(iis2mdc_handle_t *sensor, sensor_bench_result_t *results);
+
+#endif // BENCH_H
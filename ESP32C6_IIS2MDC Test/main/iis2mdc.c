@@ -6,16 +6,19 @@ static const char *TAG = "IIS2MDC";
 
 static esp_err_t iis2mdc_write_reg(iis2mdc_handle_t *sensor, uint8_t reg, uint8_t data) {
     uint8_t buf[2] = { reg, data };
+    sensor->bus_bytes += 1 + 2;
     return i2c_master_transmit(sensor->dev_handle, buf, 2, -1);
 }
 
 static esp_err_t iis2mdc_read_reg(iis2mdc_handle_t *sensor, uint8_t reg, uint8_t *data, size_t len) {
+    sensor->bus_bytes += (1 + 1) + (1 + len);
     esp_err_t ret = i2c_master_transmit(sensor->dev_handle, &reg, 1, -1);
     if (ret != ESP_OK) return ret;
     return i2c_master_receive(sensor->dev_handle, data, len, -1);
 }
 
 esp_err_t iis2mdc_init(iis2mdc_handle_t *sensor, i2c_port_t port, gpio_num_t sda, gpio_num_t scl, uint32_t clk_speed_hz) {
+    sensor->bus_bytes = 0;
     i2c_master_bus_config_t bus_cfg = {
         .i2c_port = port,
         .sda_io_num = sda,
@@ -60,6 +63,21 @@ esp_err_t iis2mdc_read_magnetic_raw(iis2mdc_handle_t *sensor, iis2mdc_raw_magnet
     return ESP_OK;
 }
 
+esp_err_t iis2mdc_read_status(iis2mdc_handle_t *sensor, uint8_t *status) {
+    return iis2mdc_read_reg(sensor, IIS2MDC_REG_STATUS, status, 1);
+}
+
+esp_err_t iis2mdc_read_status_and_magnetic(iis2mdc_handle_t *sensor, uint8_t *status, iis2mdc_raw_magnetometer_t *mag) {
+    uint8_t buf[7];
+    ESP_RETURN_ON_ERROR(iis2mdc_read_reg(sensor, IIS2MDC_REG_STATUS, buf, 7), TAG, "Failed to read status and mag data");
+
+    *status = buf[0];
+    mag->x = (int16_t)((buf[2] << 8) | buf[1]);
+    mag->y = (int16_t)((buf[4] << 8) | buf[3]);
+    mag->z = (int16_t)((buf[6] << 8) | buf[5]);
+    return ESP_OK;
+}
+
 esp_err_t iis2mdc_convert_magnetic_raw_to_mg(iis2mdc_raw_magnetometer_t *raw, float *x_mg, float *y_mg, float *z_mg) {
 
     // Conversion factor for IIS2MDC is 1.5 mG/LSB
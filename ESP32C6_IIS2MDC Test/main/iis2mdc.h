@@ -23,6 +23,10 @@
 #define IIS2MDC_REG_TEMP_OUT_L   0x6E
 #define IIS2MDC_REG_TEMP_OUT_H   0x6F
 
+// STATUS_REG bits
+#define IIS2MDC_STATUS_ZYXDA     0x08  // New x, y, z data
+#define IIS2MDC_STATUS_ZYXOR     0x80  // x, y, z data overwritten before it was read
+
 typedef struct {
     int16_t x;
     int16_t y;
@@ -32,6 +36,7 @@ typedef struct {
 typedef struct {
     i2c_master_bus_handle_t bus_handle;
     i2c_master_dev_handle_t dev_handle;
+    uint32_t bus_bytes;                 // Bytes on I2C, address bytes included
 } iis2mdc_handle_t;
 
 // API
@@ -39,6 +44,9 @@ esp_err_t iis2mdc_init(iis2mdc_handle_t *sensor, i2c_port_t port, gpio_num_t sda
 esp_err_t iis2mdc_read_who_am_i(iis2mdc_handle_t *sensor, uint8_t *id);
 esp_err_t iis2mdc_config(iis2mdc_handle_t *sensor, uint8_t cfg_a, uint8_t cfg_b, uint8_t cfg_c);
 esp_err_t iis2mdc_read_magnetic_raw(iis2mdc_handle_t *sensor, iis2mdc_raw_magnetometer_t *mag);
+esp_err_t iis2mdc_read_status(iis2mdc_handle_t *sensor, uint8_t *status);
+// STATUS_REG and OUTX..OUTZ in one transaction
+esp_err_t iis2mdc_read_status_and_magnetic(iis2mdc_handle_t *sensor, uint8_t *status, iis2mdc_raw_magnetometer_t *mag);
 esp_err_t iis2mdc_convert_magnetic_raw_to_mg(iis2mdc_raw_magnetometer_t *raw, float *x_mg, float *y_mg, float *z_mg);
 esp_err_t iis2mdc_read_temperature_raw(iis2mdc_handle_t *sensor, int16_t *temp);
 esp_err_t iis2mdc_convert_temperature_raw_to_celsius(int16_t raw_temp, float *temp_celsius);
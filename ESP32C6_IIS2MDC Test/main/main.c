@@ -1,4 +1,5 @@
 #include "iis2mdc.h"
+#include "bench.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -8,6 +9,9 @@
 #define I2C_MASTER_SCL          22
 #define I2C_MASTER_CLK_SPEED    400000
 
+// 1: run the throughput benchmark (bench.h) instead of the print loop
+#define BENCH_MODE              0
+
 static const char *TAG = "MAIN";
 
 
@@ -20,6 +24,12 @@ void app_main() {
     iis2mdc_read_who_am_i(&mag, &id);
     ESP_LOGI("TEST", "WHO_AM_I = 0x%02X", id);
 
+#if BENCH_MODE
+    sensor_bench_result_t results[BENCH_MODES];
+    bench_run(&mag, results);
+    return;
+#endif
+
     iis2mdc_raw_magnetometer_t raw_data;
     float x_mg, y_mg, z_mg;
 
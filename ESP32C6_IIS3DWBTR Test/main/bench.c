@@ -0,0 +1,109 @@
+#include "bench.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+#include <stdbool.h>
+
+#define FIFO_WORD_BYTES     7
+#define FIFO_TAG_XL         0x02
+#define FIFO_MODE_BYPASS    0x00
+#define FIFO_MODE_CONTINUOUS 0x06
+
+static uint8_t fifo_buf[BENCH_FIFO_CHUNK * FIFO_WORD_BYTES];
+
+// Times the read into busy_us and stores its duration in *us
+static esp_err_t timed_read(sensor_bench_result_t *r, iis3dwb_handle_t *dev, uint8_t reg, uint8_t *data, size_t len, int64_t *us) {
+    int64_t t0 = esp_timer_get_time();
+    esp_err_t ret = iis3dwb_read_reg(dev, reg, data, len);
+    *us = sensor_bench_timed(r, t0, ret == ESP_OK);
+    return ret;
+}
+
+static void bench_register(void *ctx, sensor_bench_result_t *r) {
+    iis3dwb_handle_t *dev = ctx;
+    uint8_t status, out[6];
+    int64_t poll_us, data_us;
+    if (timed_read(r, dev, IIS3DWB_STATUS_REG, &status, 1, &poll_us) != ESP_OK) return;
+    if (!(status & IIS3DWB_STATUS_XLDA)) return;
+    if (timed_read(r, dev, IIS3DWB_OUTX_L_A, out, sizeof(out), &data_us) != ESP_OK) return;
+    r->samples++;
+    r->read_us += poll_us + data_us;
+}
+
+// Returns the FIFO level, or -1 if FIFO_STATUS could not be read
+static int fifo_level(sensor_bench_result_t *r, iis3dwb_handle_t *dev, int64_t *us) {
+    uint8_t st[2];
+    if (timed_read(r, dev, IIS3DWB_FIFO_STATUS1, st, 2, us) != ESP_OK) return -1;
+    if (st[1] & IIS3DWB_FIFO_OVR_LATCHED) r->overruns++;
+    return ((st[1] & 0x03) << 8) | st[0];
+}
+
+static esp_err_t fifo_restart(void *ctx) {
+    iis3dwb_handle_t *dev = ctx;
+    uint8_t bdr = IIS3DWB_BDR_XL_26K7HZ;
+    esp_err_t ret = iis3dwb_write_reg(dev, IIS3DWB_FIFO_CTRL3, &bdr, 1);
+    if (ret == ESP_OK) ret = iis3dwb_fifo_config(dev, BENCH_FIFO_CHUNK, FIFO_MODE_BYPASS);
+    if (ret == ESP_OK) ret = iis3dwb_fifo_config(dev, BENCH_FIFO_CHUNK, FIFO_MODE_CONTINUOUS);
+    return ret;
+}
+
+static void bench_fifo(iis3dwb_handle_t *dev, sensor_bench_result_t *r, bool burst) {
+    int64_t poll_us, data_us;
+    int level = fifo_level(r, dev, &poll_us);
+    if (level < 0) return;
+    if (level < BENCH_FIFO_CHUNK) {
+        // Wait off the bus for the rest of the chunk instead of polling FIFO_STATUS
+        esp_rom_delay_us((BENCH_FIFO_CHUNK - level) * 1000000 / BENCH_ODR_HZ + 1);
+        return;
+    }
+
+    size_t words = 0;
+    r->read_us += poll_us;
+    if (burst) {
+        int64_t t0 = esp_timer_get_time();
+        esp_err_t ret = iis3dwb_fifo_read_burst(dev, fifo_buf, BENCH_FIFO_CHUNK);
+        r->read_us += sensor_bench_timed(r, t0, ret == ESP_OK);
+        if (ret == ESP_OK) words = BENCH_FIFO_CHUNK;
+    } else {
+        while (words < BENCH_FIFO_CHUNK &&
+               timed_read(r, dev, IIS3DWB_FIFO_DATA_OUT_TAG, &fifo_buf[words * FIFO_WORD_BYTES], FIFO_WORD_BYTES, &data_us) == ESP_OK) {
+            r->read_us += data_us;
+            words++;
+        }
+    }
+    for (size_t i = 0; i < words; i++) {
+        if ((fifo_buf[i * FIFO_WORD_BYTES] >> 3) == FIFO_TAG_XL) r->samples++;
+    }
+}
+
+static void bench_fifo_word(void *ctx, sensor_bench_result_t *r) {
+    bench_fifo(ctx, r, false);
+}
+
+static void bench_fifo_burst(void *ctx, sensor_bench_result_t *r) {
+    bench_fifo(ctx, r, true);
+}
+
+static uint32_t fifo_queued(void *ctx, sensor_bench_result_t *r) {
+    int64_t us;
+    int level = fifo_level(r, ctx, &us);
+    return (level > 0) ? (uint32_t)level : 0;
+}
+
+static const sensor_bench_mode_t bench_modes[BENCH_MODES] = {
+    { .name = "register",   .step = bench_register },
+    { .name = "fifo_word",  .setup = fifo_restart, .step = bench_fifo_word,  .queued = fifo_queued },
+    { .name = "fifo_burst", .setup = fifo_restart, .step = bench_fifo_burst, .queued = fifo_queued },
+};
+
+size_t bench_run(iis3dwb_handle_t *dev, sensor_bench_result_t *results) {
+    const sensor_bench_t bench = {
+        .sensor = "IIS3DWB",
+        .odr_hz = BENCH_ODR_HZ,
+        .duration_ms = BENCH_DURATION_MS,
+        .bus_bytes = &dev->bus_bytes,
+        .ctx = dev,
+        .modes = bench_modes,
+        .mode_count = BENCH_MODES,
+    };
+    return sensor_bench_run(&bench, results);
+}
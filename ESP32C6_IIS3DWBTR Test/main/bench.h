@@ -0,0 +1,28 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "iis3dwb.h"
+#include "sensor_bench.h"
+
+// Throughput benchmark of the IIS3DWB driver on components/sensor_bench, built
+// instead of the velocity demo when BENCH_MODE is 1 in main.c. Modes:
+//   register    poll STATUS_REG, read OUTX..OUTZ when XLDA is set
+//   fifo_word   poll FIFO_STATUS, read the FIFO one 7-byte word per transaction
+//   fifo_burst  poll FIFO_STATUS, read BENCH_FIFO_CHUNK words in one transaction
+// The read time of a sample covers the status read that found it and the data read;
+// busy time includes every poll. "ovr" counts FIFO_OVR_LATCHED flags.
+#ifndef BENCH_DURATION_MS
+#define BENCH_DURATION_MS       2000    // Per mode; stays under the task watchdog timeout
+#endif
+#define BENCH_ODR_HZ            26667
+#define BENCH_FIFO_CHUNK        64      // Words per fifo_burst transaction
+#define BENCH_MAX_TRANSFER      ((BENCH_FIFO_CHUNK * 7) + 1)
+#define BENCH_MODES             3
+
+// Bench API
+// Runs every mode on a configured device into results[BENCH_MODES] and prints the
+// table. Returns the number of modes that ran. The SPI bus needs max_transfer_sz >=
+// BENCH_MAX_TRANSFER. Leaves the FIFO in continuous mode.
+size_t bench_run(iis3dwb_handle_t *dev, sensor_bench_result_t *results);
+
+#endif // BENCH_H
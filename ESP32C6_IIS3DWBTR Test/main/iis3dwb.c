@@ -10,6 +10,7 @@ static esp_err_t spi_transfer(iis3dwb_handle_t *dev, const uint8_t *tx, uint8_t
         .tx_buffer = tx,
         .rx_buffer = rx
     };
+    dev->bus_bytes += len;
     return spi_device_transmit(dev->spi, &t);
 }
 
@@ -20,6 +21,7 @@ esp_err_t iis3dwb_init_spi(iis3dwb_handle_t *dev, spi_host_device_t host, gpio_n
         .spics_io_num = cs_pin,
         .queue_size = 1
     };
+    dev->bus_bytes = 0;
     return spi_bus_add_device(host, &devcfg, &dev->spi);
 }
 
@@ -53,7 +55,7 @@ esp_err_t iis3dwb_device_init(iis3dwb_handle_t *dev) {
 }
 
 esp_err_t iis3dwb_configure(iis3dwb_handle_t *dev, iis3dwb_fs_t fs, iis3dwb_odr_t odr) {
-    uint8_t ctrl1 = (uint8_t)fs | (uint8_t)odr | 0x05; // XL_EN=101
+    uint8_t ctrl1 = (uint8_t)fs | (uint8_t)odr; // ODR field [7:5] is XL_EN; bits [1:0] must stay 0
     return iis3dwb_write_reg(dev, IIS3DWB_CTRL1_XL, &ctrl1, 1);
 }
 
@@ -20,19 +20,24 @@
 #define IIS3DWB_FIFO_CTRL1      0x07
 #define IIS3DWB_FIFO_CTRL2      0x08
 #define IIS3DWB_FIFO_CTRL3      0x09
+#define IIS3DWB_BDR_XL_26K7HZ   0x0A    // FIFO_CTRL3: batch accel at full ODR
 #define IIS3DWB_FIFO_CTRL4      0x0A
 #define IIS3DWB_FIFO_STATUS1    0x3A
 #define IIS3DWB_FIFO_STATUS2    0x3B
+#define IIS3DWB_FIFO_OVR_LATCHED 0x08   // FIFO_STATUS2, cleared on read
 #define IIS3DWB_FIFO_DATA_OUT_X_L 0x79
 #define IIS3DWB_FIFO_DATA_OUT_TAG 0x78
 
 // Data registers
+#define IIS3DWB_STATUS_REG      0x1E
+#define IIS3DWB_STATUS_XLDA     0x01
 #define IIS3DWB_OUTX_L_A        0x28
 #define IIS3DWB_OUTY_L_A        0x2A
 #define IIS3DWB_OUTZ_L_A        0x2C
 
 typedef struct {
     spi_device_handle_t spi;
+    uint32_t bus_bytes;         // Bytes clocked on SPI, address byte included
 } iis3dwb_handle_t;
 
 typedef enum {
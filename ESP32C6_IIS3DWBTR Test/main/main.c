@@ -6,6 +6,7 @@
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "iis3dwb.h"
+#include "bench.h"
 
 #define PIN_NUM_MISO  2
 #define PIN_NUM_MOSI  7
@@ -19,6 +20,9 @@ static const char *TAG = "APP_MAIN";
 #define DELTA_T_S (1.0f / ODR_HZ)
 #define FIFO_WATERMARK 32
 
+// 1: chạy benchmark throughput (bench.h) thay cho demo vận tốc
+#define BENCH_MODE 0
+
 void app_main(void)
 {
     spi_bus_config_t buscfg = {
@@ -27,7 +31,11 @@ void app_main(void)
         .sclk_io_num = PIN_NUM_CLK,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
+#if BENCH_MODE
+        .max_transfer_sz = BENCH_MAX_TRANSFER,
+#else
         .max_transfer_sz = (FIFO_WATERMARK * 7) + 1, // Tăng kích thước truyền tối đa
+#endif
     };
     ESP_ERROR_CHECK(spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO));
 
@@ -41,6 +49,12 @@ void app_main(void)
     uint16_t watermark = FIFO_WATERMARK;
     ESP_ERROR_CHECK(iis3dwb_fifo_config(&dev, watermark, mode));
 
+#if BENCH_MODE
+    sensor_bench_result_t results[BENCH_MODES];
+    bench_run(&dev, results);
+    return;
+#endif
+
     float vx = 0, vy = 0, vz = 0;
     
     uint8_t fifo_buf[FIFO_WATERMARK * 7];
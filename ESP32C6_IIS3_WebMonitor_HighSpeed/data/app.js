@@ -348,6 +348,7 @@ function pushValues(payload) {
 // WebSocket
 let ws = null;
 let wsUrl = '';
+const LATENCY_ECHO_EVERY = 10; // Frames per latency echo (see /api/stats "latency")
 
 function getDeviceIp() {
   return fetch('/api/stats')
@@ -382,11 +383,17 @@ function connectWebSocket(ip) {
   };
   
   ws.onmessage = (event) => {
+    const receivedAt = performance.now();
     try {
       console.log('DEBUG: WebSocket message received, length:', event.data.length);
       const data = JSON.parse(event.data);
       console.log('DEBUG: Parsed JSON data:', data);
       pushValues(data);
+      // Return every Nth frame id so the device can measure sensor-to-client latency
+      if (typeof data.seq === 'number' && data.seq % LATENCY_ECHO_EVERY === 0 && ws.readyState === WebSocket.OPEN) {
+        const holdUs = Math.round((performance.now() - receivedAt) * 1000);
+        ws.send(JSON.stringify({ echo: data.seq, hold: holdUs }));
+      }
     } catch (err) {
       addLog('Parse error: ' + err.message);
       console.error('DEBUG: Parse error:', err, 'Raw data:', event.data);
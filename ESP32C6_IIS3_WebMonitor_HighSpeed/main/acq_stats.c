@@ -0,0 +1,108 @@
+#include "acq_stats.h"
+#include "imu_manager.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef struct {
+    const char *name;
+    const char *unit;
+} acq_stat_def_t;
+
+static const acq_stat_def_t stat_defs[ACQ_STAT_COUNT] = {
+    [ACQ_STAT_WAKE_JITTER]     = { "wake_jitter", "us" },
+    [ACQ_STAT_DRAIN]           = { "drain", "us" },
+    [ACQ_STAT_FIFO_LEVEL]      = { "fifo_level", "entries" },
+    [ACQ_STAT_OVERFLOW_MARGIN] = { "overflow_margin", "us" },
+};
+
+// Held only for an increment or a struct copy
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static hist_t hists[ACQ_STAT_COUNT];
+static uint32_t period_us = 0;
+static uint64_t since_us = 0;
+static bool initialized = false;
+
+static void reset_locked(void)
+{
+    for (int i = 0; i < ACQ_STAT_COUNT; i++) {
+        hist_reset(&hists[i]);
+    }
+    since_us = esp_timer_get_time();
+    initialized = true;
+}
+
+static void record(acq_stat_id_t id, uint32_t value)
+{
+    taskENTER_CRITICAL(&stats_lock);
+    if (!initialized) {
+        reset_locked();
+    }
+    hist_record(&hists[id], value);
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+void acq_stats_record_wakeup(uint32_t interval_us, uint32_t period)
+{
+    period_us = period;
+    record(ACQ_STAT_WAKE_JITTER, (interval_us > period) ? interval_us - period : period - interval_us);
+}
+
+void acq_stats_record_drain(uint32_t drain_us, uint16_t fifo_level, bool overflowed, float odr_hz)
+{
+    uint32_t margin_us = 0;
+    if (!overflowed && fifo_level < IMU_MANAGER_FIFO_DEPTH && odr_hz > 0.0f) {
+        margin_us = (uint32_t)((float)(IMU_MANAGER_FIFO_DEPTH - fifo_level) * 1e6f / odr_hz);
+    }
+
+    taskENTER_CRITICAL(&stats_lock);
+    if (!initialized) {
+        reset_locked();
+    }
+    hist_record(&hists[ACQ_STAT_DRAIN], drain_us);
+    hist_record(&hists[ACQ_STAT_FIFO_LEVEL], fifo_level);
+    hist_record(&hists[ACQ_STAT_OVERFLOW_MARGIN], margin_us);
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+esp_err_t acq_stats_get(acq_stat_id_t id, hist_t *out)
+{
+    if (id >= ACQ_STAT_COUNT || out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    taskENTER_CRITICAL(&stats_lock);
+    if (!initialized) {
+        reset_locked();
+    }
+    *out = hists[id];
+    taskEXIT_CRITICAL(&stats_lock);
+    return ESP_OK;
+}
+
+uint32_t acq_stats_get_period_us(void)
+{
+    return period_us;
+}
+
+uint64_t acq_stats_get_since_us(void)
+{
+    return since_us;
+}
+
+void acq_stats_reset(void)
+{
+    taskENTER_CRITICAL(&stats_lock);
+    reset_locked();
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+const char *acq_stats_name(acq_stat_id_t id)
+{
+    return (id < ACQ_STAT_COUNT) ? stat_defs[id].name : "unknown";
+}
+
+const char *acq_stats_unit(acq_stat_id_t id)
+{
+    return (id < ACQ_STAT_COUNT) ? stat_defs[id].unit : "";
+}
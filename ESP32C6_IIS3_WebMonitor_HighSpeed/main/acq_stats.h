@@ -0,0 +1,36 @@
+#ifndef ACQ_STATS_H
+#define ACQ_STATS_H
+
+#include "esp_err.h"
+#include "hist.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Timing of the acquisition loop, one histogram sample per sensor drain:
+//   wake jitter      |time between wakeups - programmed period|
+//   drain duration   time spent in imu_manager_read_all()
+//   FIFO level       entries waiting when the drain started
+//   overflow margin  time the FIFO could have kept filling before it overflowed,
+//                    (IMU_MANAGER_FIFO_DEPTH - level) / ODR; 0 when it did overflow
+// Only the acquisition task records; readers get a copy.
+typedef enum {
+    ACQ_STAT_WAKE_JITTER = 0,
+    ACQ_STAT_DRAIN,
+    ACQ_STAT_FIFO_LEVEL,
+    ACQ_STAT_OVERFLOW_MARGIN,
+    ACQ_STAT_COUNT
+} acq_stat_id_t;
+
+// Acquisition stats API
+void acq_stats_record_wakeup(uint32_t interval_us, uint32_t period_us);
+void acq_stats_record_drain(uint32_t drain_us, uint16_t fifo_level, bool overflowed, float odr_hz);
+esp_err_t acq_stats_get(acq_stat_id_t id, hist_t *out);
+// Period programmed at the last wakeup, us
+uint32_t acq_stats_get_period_us(void);
+// Time of the last reset (or boot), esp_timer us
+uint64_t acq_stats_get_since_us(void);
+void acq_stats_reset(void);
+const char *acq_stats_name(acq_stat_id_t id);
+const char *acq_stats_unit(acq_stat_id_t id);
+
+#endif // ACQ_STATS_H
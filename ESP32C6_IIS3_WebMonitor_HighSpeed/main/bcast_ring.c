@@ -0,0 +1,272 @@
+#include "bcast_ring.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "BCAST_RING";
+
+// Stream indices are free-running uint32; all comparisons go through differences
+static inline bool index_before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+static portMUX_TYPE attach_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t bcast_ring_init(bcast_ring_t *ring, const char *name, uint32_t capacity,
+                          uint32_t meta_slots, mem_subsys_t subsys)
+{
+    if (ring == NULL || name == NULL || capacity == 0 || meta_slots == 0 ||
+        (capacity & (capacity - 1)) != 0 || (meta_slots & (meta_slots - 1)) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    strncpy(ring->name, name, BCAST_RING_NAME_LEN - 1);
+    ring->xyz = mem_arena_alloc(subsys, (size_t)capacity * 3 * sizeof(int16_t));
+    ring->meta = mem_arena_alloc(subsys, (size_t)meta_slots * sizeof(bcast_meta_t));
+    ring->capacity = capacity;
+    ring->meta_slots = meta_slots;
+    if (ring->xyz == NULL || ring->meta == NULL) {
+        ESP_LOGE(TAG, "%s: failed to allocate %lu samples", name, (unsigned long)capacity);
+        bcast_ring_deinit(ring, subsys);
+        return ESP_ERR_NO_MEM;
+    }
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->reserve, 0);
+    atomic_init(&ring->meta_head, 0);
+    atomic_init(&ring->meta_reserve, 0);
+    return ESP_OK;
+}
+
+void bcast_ring_deinit(bcast_ring_t *ring, mem_subsys_t subsys)
+{
+    if (ring == NULL) {
+        return;
+    }
+    // Reverse allocation order, so the arena takes both blocks back
+    mem_arena_free(subsys, ring->meta, (size_t)ring->meta_slots * sizeof(bcast_meta_t));
+    mem_arena_free(subsys, ring->xyz, (size_t)ring->capacity * 3 * sizeof(int16_t));
+    ring->meta = NULL;
+    ring->xyz = NULL;
+    ring->capacity = 0;
+    ring->meta_slots = 0;
+}
+
+void bcast_ring_write(bcast_ring_t *ring, const int16_t *xyz, uint16_t count,
+                      imu_manager_full_scale_t scale, float odr_hz, uint64_t timestamp_us)
+{
+    if (ring == NULL || ring->xyz == NULL || xyz == NULL || count == 0) {
+        return;
+    }
+
+    // A write larger than the ring keeps only its newest samples
+    if (count > ring->capacity) {
+        xyz += (size_t)(count - ring->capacity) * 3;
+        count = (uint16_t)ring->capacity;
+    }
+
+    const uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    const uint32_t meta_head = atomic_load_explicit(&ring->meta_head, memory_order_relaxed);
+
+    // Announce the overwrite before touching slots so readers can detect it
+    atomic_store_explicit(&ring->reserve, head + count, memory_order_relaxed);
+    atomic_store_explicit(&ring->meta_reserve, meta_head + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    const uint32_t mask = ring->capacity - 1;
+    uint32_t slot = head & mask;
+    uint32_t done = 0;
+    while (done < count) {
+        uint32_t run = ring->capacity - slot;
+        if (run > count - done) {
+            run = count - done;
+        }
+        memcpy(&ring->xyz[slot * 3], &xyz[done * 3], run * 3 * sizeof(int16_t));
+        done += run;
+        slot = 0;
+    }
+
+    bcast_meta_t *meta = &ring->meta[meta_head & (ring->meta_slots - 1)];
+    meta->start = head;
+    meta->count = count;
+    meta->scale = (uint8_t)scale;
+    meta->odr_hz = odr_hz;
+    meta->timestamp_us = timestamp_us;
+
+    atomic_store_explicit(&ring->meta_head, meta_head + 1, memory_order_release);
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);
+}
+
+esp_err_t bcast_ring_attach(bcast_ring_t *ring, const char *name, bcast_consumer_id_t *id)
+{
+    if (ring == NULL || name == NULL || id == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    taskENTER_CRITICAL(&attach_lock);
+    if (ring->consumer_count < BCAST_RING_MAX_CONSUMERS) {
+        bcast_consumer_t *c = &ring->consumers[ring->consumer_count];
+        memset(c, 0, sizeof(*c));
+        strncpy(c->name, name, BCAST_RING_NAME_LEN - 1);
+        c->cursor = atomic_load_explicit(&ring->head, memory_order_acquire);
+        c->meta_hint = atomic_load_explicit(&ring->meta_head, memory_order_acquire);
+        c->attached = true;
+        *id = (bcast_consumer_id_t)ring->consumer_count;
+        ring->consumer_count++;
+        ret = ESP_OK;
+    }
+    taskEXIT_CRITICAL(&attach_lock);
+    return ret;
+}
+
+// Oldest meta entry the producer is not (re)writing; may lie "before" entry 0 at start-up
+static inline uint32_t oldest_meta(const bcast_ring_t *ring, uint32_t meta_reserve)
+{
+    return meta_reserve - ring->meta_slots;
+}
+
+uint16_t bcast_ring_read(bcast_ring_t *ring, bcast_consumer_id_t id, int16_t *xyz,
+                         uint16_t max_samples, bcast_read_info_t *info)
+{
+    if (ring == NULL || ring->xyz == NULL || id < 0 || id >= ring->consumer_count ||
+        xyz == NULL || max_samples == 0) {
+        return 0;
+    }
+
+    bcast_consumer_t *c = &ring->consumers[id];
+    const uint32_t meta_mask = ring->meta_slots - 1;
+
+    // Optimistic copy: nothing is committed to the consumer until the producer's
+    // reservations show the copied samples and meta were not reclaimed meanwhile
+    for (int attempt = 0; attempt < BCAST_RING_MAX_RETRIES; attempt++) {
+        const uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        const uint32_t meta_head = atomic_load_explicit(&ring->meta_head, memory_order_acquire);
+        if (c->cursor == head) {
+            break;
+        }
+
+        // Skip whatever the producer has already overwritten (or is overwriting)
+        const uint32_t reserve = atomic_load_explicit(&ring->reserve, memory_order_relaxed);
+        const uint32_t meta_reserve = atomic_load_explicit(&ring->meta_reserve, memory_order_relaxed);
+        uint32_t m = c->meta_hint;
+        if (index_before(m, oldest_meta(ring, meta_reserve))) {
+            m = oldest_meta(ring, meta_reserve);
+        }
+        if (!index_before(m, meta_head)) {
+            break;
+        }
+        const uint32_t m_first = m;
+        uint32_t cursor = c->cursor;
+        uint32_t missed = 0;
+        uint32_t oldest = ring->meta[m & meta_mask].start;
+        if (index_before(oldest, reserve - ring->capacity)) {
+            oldest = reserve - ring->capacity;
+        }
+        if (index_before(cursor, oldest)) {
+            missed = oldest - cursor;
+            cursor = oldest;
+        }
+
+        // Meta entry holding the cursor
+        bcast_meta_t meta = ring->meta[m & meta_mask];
+        while (!index_before(cursor, meta.start + meta.count) && index_before(m + 1, meta_head)) {
+            m++;
+            meta = ring->meta[m & meta_mask];
+        }
+        if (index_before(cursor, meta.start) || !index_before(cursor, meta.start + meta.count)) {
+            continue;   // Meta moved under us, re-evaluate
+        }
+
+        // One run of consecutive samples with the same format
+        const uint32_t start = cursor;
+        uint32_t end = meta.start + meta.count;
+        uint32_t last_m = m;
+        bcast_meta_t last = meta;
+        while ((end - start) < max_samples && index_before(last_m + 1, meta_head)) {
+            const bcast_meta_t next = ring->meta[(last_m + 1) & meta_mask];
+            if (next.scale != meta.scale || next.odr_hz != meta.odr_hz || next.start != end) {
+                break;
+            }
+            last_m++;
+            last = next;
+            end = next.start + next.count;
+        }
+        uint32_t n = end - start;
+        if (n > max_samples) {
+            n = max_samples;
+        }
+
+        const uint32_t mask = ring->capacity - 1;
+        uint32_t slot = start & mask;
+        uint32_t done = 0;
+        while (done < n) {
+            uint32_t run = ring->capacity - slot;
+            if (run > n - done) {
+                run = n - done;
+            }
+            memcpy(&xyz[done * 3], &ring->xyz[slot * 3], run * 3 * sizeof(int16_t));
+            done += run;
+            slot = 0;
+        }
+
+        atomic_thread_fence(memory_order_seq_cst);
+        const uint32_t reserve_after = atomic_load_explicit(&ring->reserve, memory_order_relaxed);
+        const uint32_t meta_reserve_after = atomic_load_explicit(&ring->meta_reserve, memory_order_relaxed);
+        if (index_before(start, reserve_after - ring->capacity) ||
+            index_before(m_first, oldest_meta(ring, meta_reserve_after))) {
+            continue;
+        }
+
+        c->cursor = start + n;
+        c->meta_hint = (c->cursor == end) ? last_m + 1 : last_m;
+        c->read_total += n;
+        c->missed_total += missed;
+        if (info != NULL) {
+            const uint32_t last_index = start + n - 1;
+            const uint32_t behind = (last.start + last.count - 1) - last_index;
+            info->scale = (imu_manager_full_scale_t)meta.scale;
+            info->odr_hz = meta.odr_hz;
+            info->timestamp_us = last.timestamp_us -
+                                 (meta.odr_hz > 0.0f ? (uint64_t)(behind * 1e6f / meta.odr_hz) : 0);
+            info->first_index = start;
+            info->missed = missed;
+        }
+        return (uint16_t)n;
+    }
+
+    if (info != NULL) {
+        memset(info, 0, sizeof(*info));
+        info->first_index = c->cursor;
+    }
+    return 0;
+}
+
+uint32_t bcast_ring_available(const bcast_ring_t *ring, bcast_consumer_id_t id)
+{
+    if (ring == NULL || id < 0 || id >= ring->consumer_count) {
+        return 0;
+    }
+    const uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - ring->consumers[id].cursor;
+}
+
+esp_err_t bcast_ring_get_consumer_stats(const bcast_ring_t *ring, bcast_consumer_id_t id,
+                                        bcast_consumer_stats_t *stats)
+{
+    if (ring == NULL || stats == NULL || id < 0 || id >= ring->consumer_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const bcast_consumer_t *c = &ring->consumers[id];
+    memcpy(stats->name, c->name, BCAST_RING_NAME_LEN);
+    stats->lag = atomic_load_explicit(&ring->head, memory_order_acquire) - c->cursor;
+    if (stats->lag > ring->capacity) {
+        stats->lag = ring->capacity;
+    }
+    stats->read_total = c->read_total;
+    stats->missed_total = c->missed_total;
+    return ESP_OK;
+}
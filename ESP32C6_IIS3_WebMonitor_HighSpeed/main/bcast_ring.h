@@ -0,0 +1,88 @@
+#ifndef BCAST_RING_H
+#define BCAST_RING_H
+
+#include "esp_err.h"
+#include "imu_manager.h"
+#include "mem_arena.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Single-producer broadcast ring of raw x,y,z samples. The producer never waits:
+// it overwrites the oldest samples. Each consumer owns a cursor into the stream
+// and is told how many samples were overwritten before it got to them.
+#define BCAST_RING_MAX_CONSUMERS    6
+#define BCAST_RING_NAME_LEN         16
+#define BCAST_RING_MAX_RETRIES      4       // Reads lapped by the producer mid-copy
+
+// Format and timing of one producer write; consecutive entries tile the stream
+typedef struct {
+    uint32_t start;             // Stream index of the first sample
+    uint16_t count;
+    uint8_t scale;              // imu_manager_full_scale_t
+    float odr_hz;
+    uint64_t timestamp_us;      // Device time of the last sample
+} bcast_meta_t;
+
+typedef struct {
+    char name[BCAST_RING_NAME_LEN];
+    uint32_t cursor;            // Next stream index to read
+    uint32_t meta_hint;         // Meta entry the cursor was last found in
+    uint32_t read_total;
+    uint32_t missed_total;
+    bool attached;
+} bcast_consumer_t;
+
+typedef struct {
+    char name[BCAST_RING_NAME_LEN];
+    int16_t *xyz;               // capacity * 3
+    bcast_meta_t *meta;
+    uint32_t capacity;          // Samples, power of two
+    uint32_t meta_slots;        // Power of two
+    atomic_uint head;           // Samples published
+    atomic_uint reserve;        // Samples being written (>= head)
+    atomic_uint meta_head;      // Meta entries published
+    atomic_uint meta_reserve;
+    bcast_consumer_t consumers[BCAST_RING_MAX_CONSUMERS];
+    uint8_t consumer_count;
+} bcast_ring_t;
+
+typedef int8_t bcast_consumer_id_t;
+
+typedef struct {
+    imu_manager_full_scale_t scale;
+    float odr_hz;
+    uint64_t timestamp_us;      // Device time of the last sample returned
+    uint32_t first_index;       // Stream index of the first sample returned
+    uint32_t missed;            // Samples skipped by this read because they were overwritten
+} bcast_read_info_t;
+
+typedef struct {
+    char name[BCAST_RING_NAME_LEN];
+    uint32_t lag;               // Samples published but not yet read
+    uint32_t read_total;
+    uint32_t missed_total;
+} bcast_consumer_stats_t;
+
+// Broadcast ring API
+// Storage comes from the boot arena; capacity and meta_slots must be powers of two.
+// meta_slots bounds how many producer writes the ring remembers: size it as
+// capacity / (smallest expected write).
+esp_err_t bcast_ring_init(bcast_ring_t *ring, const char *name, uint32_t capacity,
+                          uint32_t meta_slots, mem_subsys_t subsys);
+// Return the storage of a ring that was never published to the producer or consumers
+void bcast_ring_deinit(bcast_ring_t *ring, mem_subsys_t subsys);
+// Producer only
+void bcast_ring_write(bcast_ring_t *ring, const int16_t *xyz, uint16_t count,
+                      imu_manager_full_scale_t scale, float odr_hz, uint64_t timestamp_us);
+// Consumers start at the live head
+esp_err_t bcast_ring_attach(bcast_ring_t *ring, const char *name, bcast_consumer_id_t *id);
+// Copy up to max_samples samples of one format (scale/ODR) into xyz; each consumer
+// is read by one task only. Returns the number of samples copied.
+uint16_t bcast_ring_read(bcast_ring_t *ring, bcast_consumer_id_t id, int16_t *xyz,
+                         uint16_t max_samples, bcast_read_info_t *info);
+uint32_t bcast_ring_available(const bcast_ring_t *ring, bcast_consumer_id_t id);
+esp_err_t bcast_ring_get_consumer_stats(const bcast_ring_t *ring, bcast_consumer_id_t id,
+                                        bcast_consumer_stats_t *stats);
+
+#endif // BCAST_RING_H
@@ -0,0 +1,280 @@
+#include "bench.h"
+#include "convert.h"
+#include "imu_manager.h"
+#include "data_buffer.h"
+#include "pipeline.h"
+#include "ws_frame.h"
+#include "sensors/iis3dwb_reg.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_rom_sys.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "BENCH";
+
+#define BENCH_FIFO_ENTRIES      IMU_MANAGER_MAX_SAMPLES
+#define BENCH_FIFO_OTHER_EVERY  8       // Every 8th FIFO word carries a non-accel tag
+#define BENCH_CONVERT_SAMPLES   IMU_MANAGER_MAX_SAMPLES
+#define BENCH_RANGE_SAMPLES     64
+#define BENCH_COLUMN_SAMPLES    256
+#define BENCH_EXPORT_SAMPLES    32
+#define BENCH_TEXT_SIZE         8192
+
+typedef struct {
+    const char *name;
+    uint32_t samples;
+    bool live_buffer;           // Reads data_buffer; needs `samples` buffered samples
+    size_t (*run)(void);        // One iteration; returns the bytes it processed
+    // Output hashed into the checksum; NULL when it is not deterministic
+    const void *(*output)(size_t *len);
+} bench_case_t;
+
+// Corpora and outputs live on the heap only for the duration of a run
+static uint8_t *fifo_corpus;
+static int16_t *xyz_corpus;
+static int16_t *xyz_out;
+static float *g_out;
+static char *text_out;
+static imu_data_t *range_out;
+static size_t text_len;
+
+static atomic_flag running = ATOMIC_FLAG_INIT;
+
+static uint32_t lcg_next(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+static void build_corpora(void)
+{
+    uint32_t state = BENCH_CORPUS_SEED;
+    for (uint32_t i = 0; i < BENCH_FIFO_ENTRIES; i++) {
+        uint8_t *entry = &fifo_corpus[i * IMU_MANAGER_FIFO_ENTRY_BYTES];
+        const uint8_t tag = ((i % BENCH_FIFO_OTHER_EVERY) == BENCH_FIFO_OTHER_EVERY - 1)
+                                ? IIS3DWB_TIMESTAMP_TAG
+                                : IIS3DWB_XL_TAG;
+        entry[0] = (uint8_t)((tag << 3) | ((i & 0x3u) << 1));
+        for (int b = 1; b < IMU_MANAGER_FIFO_ENTRY_BYTES; b++) {
+            entry[b] = (uint8_t)lcg_next(&state);
+        }
+    }
+    for (uint32_t i = 0; i < WS_FRAME_MAX_SAMPLES * 3; i++) {
+        xyz_corpus[i] = (int16_t)lcg_next(&state);
+    }
+}
+
+static size_t run_raw_to_g(void)
+{
+    for (uint32_t i = 0; i < BENCH_CONVERT_SAMPLES * 3; i++) {
+        g_out[i] = imu_manager_raw_to_g(xyz_corpus[i], IMU_MANAGER_FS_16G);
+    }
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(int16_t);
+}
+
+static size_t run_raw_to_g_kernel(void)
+{
+    // Looked up per iteration, as the read path does per full-scale change
+    convert_get_kernel(IMU_MANAGER_FS_16G)(xyz_corpus, g_out, BENCH_CONVERT_SAMPLES * 3);
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(int16_t);
+}
+
+static size_t run_lsb_scale(void)
+{
+    const float lsb_to_g = pipeline_lsb_to_g(IMU_MANAGER_FS_16G);
+    for (uint32_t i = 0; i < BENCH_CONVERT_SAMPLES * 3; i++) {
+        g_out[i] = xyz_corpus[i] * lsb_to_g;
+    }
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(int16_t);
+}
+
+static size_t run_fifo_decode(void)
+{
+    imu_manager_decode_fifo(fifo_corpus, BENCH_FIFO_ENTRIES, xyz_out, BENCH_FIFO_ENTRIES);
+    return BENCH_FIFO_ENTRIES * IMU_MANAGER_FIFO_ENTRY_BYTES;
+}
+
+static size_t run_ws_frame(void)
+{
+    const ws_frame_t frame = {
+        .seq = 4242,
+        .timestamp_us = 123456789ULL,
+        .xyz = xyz_corpus,
+        .count = WS_FRAME_MAX_SAMPLES,
+        .lsb_to_g = pipeline_lsb_to_g(IMU_MANAGER_FS_16G),
+        .full_scale_g = IMU_MANAGER_FS_16G,
+        .fifo_level = 120,
+        .batch = 64,
+        .sensor_sps = 26667.0f,
+        .points_per_s = 6700.0f,
+        .msgs_per_s = 67.0f,
+        .missed = 0,
+    };
+    const int n = ws_frame_encode(text_out, WS_FRAME_BUFFER_SIZE, &frame);
+    text_len = (n > 0) ? (size_t)n : 0;
+    return text_len;
+}
+
+static size_t run_buffer_range(void)
+{
+    return (data_buffer_get_range(range_out, 0, BENCH_RANGE_SAMPLES) == ESP_OK)
+               ? BENCH_RANGE_SAMPLES * sizeof(imu_data_t)
+               : 0;
+}
+
+static size_t run_buffer_columns(void)
+{
+    const uint32_t n = data_buffer_get_accel_columns(&xyz_out[0], &xyz_out[BENCH_COLUMN_SAMPLES],
+                                                     &xyz_out[BENCH_COLUMN_SAMPLES * 2], 0,
+                                                     BENCH_COLUMN_SAMPLES);
+    return n * 3 * sizeof(int16_t);
+}
+
+static size_t run_buffer_export(void)
+{
+    if (data_buffer_export_json(text_out, BENCH_TEXT_SIZE, BENCH_EXPORT_SAMPLES) != ESP_OK) {
+        return 0;
+    }
+    return strlen(text_out);
+}
+
+static const void *output_g(size_t *len)
+{
+    *len = BENCH_CONVERT_SAMPLES * 3 * sizeof(float);
+    return g_out;
+}
+
+static const void *output_xyz(size_t *len)
+{
+    *len = BENCH_FIFO_ENTRIES * 3 * sizeof(int16_t);
+    return xyz_out;
+}
+
+static const void *output_text(size_t *len)
+{
+    *len = text_len;
+    return text_out;
+}
+
+static const bench_case_t cases[] = {
+    { "raw_to_g",           BENCH_CONVERT_SAMPLES, false, run_raw_to_g,        output_g },
+    { "raw_to_g_kernel",    BENCH_CONVERT_SAMPLES, false, run_raw_to_g_kernel, output_g },
+    { "lsb_scale",          BENCH_CONVERT_SAMPLES, false, run_lsb_scale,       output_g },
+    { "fifo_decode",        BENCH_FIFO_ENTRIES,    false, run_fifo_decode,     output_xyz },
+    { "ws_frame_encode",    WS_FRAME_MAX_SAMPLES,  false, run_ws_frame,        output_text },
+    { "buffer_get_range",   BENCH_RANGE_SAMPLES,   true,  run_buffer_range,    NULL },
+    { "buffer_get_columns", BENCH_COLUMN_SAMPLES,  true,  run_buffer_columns,  NULL },
+    { "buffer_export_json", BENCH_EXPORT_SAMPLES,  true,  run_buffer_export,   NULL },
+};
+
+_Static_assert(sizeof(cases) / sizeof(cases[0]) <= BENCH_MAX_RESULTS, "raise BENCH_MAX_RESULTS");
+
+static void run_case(const bench_case_t *c, uint32_t iterations, uint32_t ticks_per_us, bench_result_t *r)
+{
+    memset(r, 0, sizeof(*r));
+    r->name = c->name;
+    r->samples = c->samples;
+
+    if (c->live_buffer) {
+        iterations /= BENCH_BUFFER_ITERATIONS_DIV;
+        if (iterations == 0) {
+            iterations = 1;
+        }
+        if (data_buffer_get_count() < c->samples) {
+            r->skipped = true;
+            return;
+        }
+    }
+
+    uint64_t total_cycles = 0;
+    uint32_t best_cycles = UINT32_MAX;
+    size_t bytes = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        const uint32_t start = esp_cpu_get_cycle_count();
+        bytes = c->run();
+        const uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        total_cycles += cycles;
+        if (cycles < best_cycles) {
+            best_cycles = cycles;
+        }
+    }
+
+    const float ns_per_cycle = 1000.0f / (float)ticks_per_us;
+    const float total_ns = (float)total_cycles * ns_per_cycle;
+    r->iterations = iterations;
+    r->bytes = (uint32_t)bytes;
+    r->ns_per_sample = total_ns / ((float)iterations * (float)c->samples);
+    r->best_ns_per_sample = (float)best_cycles * ns_per_cycle / (float)c->samples;
+    r->bytes_per_s = (total_ns > 0.0f) ? (float)bytes * (float)iterations * 1e9f / total_ns : 0.0f;
+
+    if (c->output != NULL) {
+        size_t len = 0;
+        const void *out = c->output(&len);
+        r->checksum = esp_rom_crc32_le(0, (const uint8_t *)out, (uint32_t)len);
+    }
+}
+
+esp_err_t bench_run(uint32_t iterations, bench_result_t *results, size_t max_results, size_t *count)
+{
+    if (results == NULL || count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (iterations == 0) {
+        iterations = BENCH_DEFAULT_ITERATIONS;
+    }
+    if (iterations > BENCH_MAX_ITERATIONS) {
+        iterations = BENCH_MAX_ITERATIONS;
+    }
+    if (atomic_flag_test_and_set(&running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const size_t xyz_out_len = BENCH_COLUMN_SAMPLES * 3;
+    fifo_corpus = malloc(BENCH_FIFO_ENTRIES * IMU_MANAGER_FIFO_ENTRY_BYTES);
+    xyz_corpus = malloc(WS_FRAME_MAX_SAMPLES * 3 * sizeof(int16_t));
+    xyz_out = calloc(xyz_out_len, sizeof(int16_t));
+    g_out = malloc(BENCH_CONVERT_SAMPLES * 3 * sizeof(float));
+    text_out = malloc(BENCH_TEXT_SIZE);
+    range_out = malloc(BENCH_RANGE_SAMPLES * sizeof(imu_data_t));
+
+    esp_err_t ret = ESP_OK;
+    if (fifo_corpus == NULL || xyz_corpus == NULL || xyz_out == NULL ||
+        g_out == NULL || text_out == NULL || range_out == NULL) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        build_corpora();
+        const uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+        *count = 0;
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]) && *count < max_results; i++) {
+            bench_result_t *r = &results[(*count)++];
+            run_case(&cases[i], iterations, ticks_per_us, r);
+            if (r->skipped) {
+                ESP_LOGI(TAG, "%-20s skipped (buffer holds fewer than %lu samples)", r->name,
+                         (unsigned long)r->samples);
+            } else {
+                ESP_LOGI(TAG, "%-20s %8.1f ns/sample (best %.1f) %10.0f B/s crc=%08lx", r->name,
+                         r->ns_per_sample, r->best_ns_per_sample, r->bytes_per_s,
+                         (unsigned long)r->checksum);
+            }
+        }
+    }
+
+    free(fifo_corpus);
+    free(xyz_corpus);
+    free(xyz_out);
+    free(g_out);
+    free(text_out);
+    free(range_out);
+    fifo_corpus = NULL;
+    xyz_corpus = NULL;
+    xyz_out = NULL;
+    g_out = NULL;
+    text_out = NULL;
+    range_out = NULL;
+    atomic_flag_clear(&running);
+    return ret;
+}
@@ -0,0 +1,37 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// On-target micro-benchmarks of the acquisition and streaming hot paths. Each case
+// runs a fixed, seeded input corpus through the real function, so the reported
+// checksum must not change between builds unless the function's output does; only
+// the timings should move. Cases reading the live sample buffer report 0 as their
+// checksum and are skipped while it holds too few samples.
+#define BENCH_DEFAULT_ITERATIONS    200
+#define BENCH_MAX_ITERATIONS        5000
+#define BENCH_BUFFER_ITERATIONS_DIV 10      // Live-buffer cases take the buffer mutex: run fewer
+#define BENCH_MAX_RESULTS           8
+#define BENCH_CORPUS_SEED           0x1D5A3u
+
+typedef struct {
+    const char *name;
+    uint32_t iterations;
+    uint32_t samples;           // Samples per iteration
+    uint32_t bytes;             // Bytes per iteration: consumed by decoders, produced by encoders
+    float ns_per_sample;        // Mean over all iterations
+    float best_ns_per_sample;   // Fastest single iteration (least preempted)
+    float bytes_per_s;
+    uint32_t checksum;          // CRC32 of the last iteration's output
+    bool skipped;
+} bench_result_t;
+
+// Bench API
+// Runs every case in the calling task; iterations == 0 uses the default.
+// Returns ESP_ERR_INVALID_STATE if a run is already in progress.
+esp_err_t bench_run(uint32_t iterations, bench_result_t *results, size_t max_results, size_t *count);
+
+#endif // BENCH_H
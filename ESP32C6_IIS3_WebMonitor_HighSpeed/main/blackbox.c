@@ -0,0 +1,678 @@
+#include "blackbox.h"
+#include "capture.h"
+#include "mem_arena.h"
+#include "pipeline.h"
+#include "tlog.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <dirent.h>
+
+static const char *TAG = "BLACKBOX";
+
+#define BLACKBOX_TREND_LEN          (BLACKBOX_TREND_HZ * BLACKBOX_TREND_SECONDS)
+// Leave two blocks to the writer so the loop keeps running while a freeze is flushed
+#define BLACKBOX_FREEZE_BLOCKS      (BLACKBOX_FULLRATE_BLOCKS - 2)
+#define BLACKBOX_ARM_TIMEOUT_MS     1000    // Freeze without post-trigger data if the stream stalls
+#define BLACKBOX_NO_SEQ             0
+
+typedef struct {
+    int16_t samples[BLACKBOX_BLOCK_SAMPLES * CAPTURE_CHANNELS];
+    uint64_t start_us;          // Device time of the first sample
+    uint32_t seq;               // Consecutive blocks have consecutive sequence numbers
+    float odr_hz;
+    uint16_t count;
+    uint8_t full_scale_g;
+    volatile bool pinned;       // Part of a frozen segment, not reused until flushed
+} bb_block_t;
+
+_Static_assert(BLACKBOX_FULLRATE_BLOCKS * sizeof(bb_block_t) +
+               BLACKBOX_TREND_LEN * CAPTURE_SAMPLE_BYTES <= MEM_BUDGET_BLACKBOX,
+               "black-box loops exceed MEM_BUDGET_BLACKBOX");
+
+typedef struct {
+    int64_t sum[CAPTURE_CHANNELS];  // Accumulated in raw * full_scale units
+    int32_t min[CAPTURE_CHANNELS];
+    int32_t max[CAPTURE_CHANNELS];
+    uint32_t count;
+    uint32_t target;
+} bb_trend_window_t;
+
+static portMUX_TYPE bb_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t bb_task_handle = NULL;
+
+// Full-rate loop (written by imu_task through the raw listener)
+static bb_block_t *blocks = NULL;
+static uint8_t current_block = 0;
+static uint32_t next_seq = 1;
+static bool seq_gap = false;
+
+// Decimated loop
+static int16_t *trend = NULL;
+static uint32_t trend_total = 0;
+static uint64_t trend_last_us = 0;
+static bb_trend_window_t window;
+
+// Trigger / freeze state, guarded by bb_lock
+static volatile bool bb_enabled = true;
+static volatile uint32_t threshold_mg = BLACKBOX_DEFAULT_THRESHOLD_MG;
+static bool armed = false;
+static bool flushing = false;
+static uint8_t post_blocks_remaining = 0;
+static int64_t armed_at_us = 0;
+static int64_t last_auto_trigger_us = 0;
+static blackbox_trigger_t pending_reason = BLACKBOX_TRIGGER_NONE;
+static uint32_t frozen_trend_total = 0;
+static uint64_t frozen_trend_last_us = 0;
+static blackbox_status_t counters;
+
+// Flush state, only touched by the black-box task
+static bool ids_scanned = false;
+static int16_t flush_buf[BLACKBOX_BLOCK_SAMPLES * CAPTURE_CHANNELS];
+
+const char *blackbox_trigger_name(blackbox_trigger_t reason)
+{
+    switch (reason) {
+        case BLACKBOX_TRIGGER_MANUAL:
+            return "manual";
+        case BLACKBOX_TRIGGER_EVENT:
+            return "event";
+        case BLACKBOX_TRIGGER_ERROR:
+            return "error";
+        default:
+            return "none";
+    }
+}
+
+esp_err_t blackbox_segment_path(uint32_t id, blackbox_part_t part, char *path, size_t path_len)
+{
+    if (path == NULL || path_len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int len = snprintf(path, path_len, BLACKBOX_BASE_PATH "/bb%03lu_%s" CAPTURE_FILE_EXT,
+                       (unsigned long)id, part == BLACKBOX_PART_TREND ? "trend" : "full");
+    return (len > 0 && len < (int)path_len) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+// Pin the contiguous run of completed blocks ending at newest_seq (caller holds bb_lock)
+static void freeze_locked(uint32_t newest_seq)
+{
+    uint32_t pinned = 0;
+    float odr_hz = 0.0f;
+
+    for (uint32_t seq = newest_seq; seq != BLACKBOX_NO_SEQ && pinned < BLACKBOX_FREEZE_BLOCKS; seq--) {
+        bb_block_t *found = NULL;
+        for (uint8_t i = 0; i < BLACKBOX_FULLRATE_BLOCKS; i++) {
+            if (blocks[i].seq == seq && blocks[i].count > 0 && !blocks[i].pinned) {
+                found = &blocks[i];
+                break;
+            }
+        }
+        if (found == NULL || (pinned > 0 && found->odr_hz != odr_hz)) {
+            break;
+        }
+        odr_hz = found->odr_hz;
+        found->pinned = true;
+        pinned++;
+    }
+
+    frozen_trend_total = trend_total;
+    frozen_trend_last_us = trend_last_us;
+    armed = false;
+    flushing = true;
+}
+
+// Move the writer to the next free block; returns false if every block is pinned
+static bool select_free_block(void)
+{
+    bool freeze = false;
+    bool found = false;
+
+    taskENTER_CRITICAL(&bb_lock);
+    if (blocks[current_block].count > 0 && armed && post_blocks_remaining > 0 &&
+        --post_blocks_remaining == 0) {
+        freeze_locked(blocks[current_block].seq);
+        freeze = true;
+    }
+
+    for (uint8_t k = 1; k <= BLACKBOX_FULLRATE_BLOCKS; k++) {
+        const uint8_t idx = (uint8_t)((current_block + k) % BLACKBOX_FULLRATE_BLOCKS);
+        if (!blocks[idx].pinned) {
+            current_block = idx;
+            blocks[idx].count = 0;
+            blocks[idx].seq = BLACKBOX_NO_SEQ;
+            found = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&bb_lock);
+
+    if (freeze && bb_task_handle != NULL) {
+        xTaskNotifyGive(bb_task_handle);
+    }
+    return found;
+}
+
+static void record_fullrate(const int16_t *xyz, uint16_t count, uint8_t full_scale_g,
+                            float odr_hz, uint64_t timestamp_us)
+{
+    uint16_t i = 0;
+    while (i < count) {
+        bb_block_t *blk = &blocks[current_block];
+
+        if (blk->pinned || blk->count >= BLACKBOX_BLOCK_SAMPLES ||
+            (blk->count > 0 && (blk->full_scale_g != full_scale_g || blk->odr_hz != odr_hz))) {
+            if (!select_free_block()) {
+                counters.dropped_samples += count - i;
+                seq_gap = true;
+                return;
+            }
+            continue;
+        }
+
+        if (blk->count == 0) {
+            if (seq_gap) {
+                next_seq++;     // Keep dropped stretches out of a frozen run
+                seq_gap = false;
+            }
+            if (next_seq == BLACKBOX_NO_SEQ) {
+                next_seq++;
+            }
+            blk->seq = next_seq++;
+            blk->odr_hz = odr_hz;
+            blk->full_scale_g = full_scale_g;
+            blk->start_us = timestamp_us - (uint64_t)((float)(count - 1 - i) * 1e6f / odr_hz);
+        }
+
+        uint16_t n = count - i;
+        if (n > BLACKBOX_BLOCK_SAMPLES - blk->count) {
+            n = BLACKBOX_BLOCK_SAMPLES - blk->count;
+        }
+        memcpy(&blk->samples[blk->count * CAPTURE_CHANNELS], &xyz[i * CAPTURE_CHANNELS],
+               n * CAPTURE_SAMPLE_BYTES);
+        blk->count += n;
+        i += n;
+    }
+}
+
+static void trend_window_reset(float odr_hz)
+{
+    memset(&window, 0, sizeof(window));
+    for (int axis = 0; axis < CAPTURE_CHANNELS; axis++) {
+        window.min[axis] = INT32_MAX;
+        window.max[axis] = INT32_MIN;
+    }
+    window.target = (uint32_t)(odr_hz / BLACKBOX_TREND_HZ);
+    if (window.target == 0) {
+        window.target = 1;
+    }
+}
+
+static esp_err_t blackbox_arm(blackbox_trigger_t reason);
+
+static void record_trend(const int16_t *xyz, uint16_t count, uint8_t full_scale_g,
+                         float odr_hz, uint64_t timestamp_us)
+{
+    for (uint16_t i = 0; i < count; i++) {
+        if (window.target == 0) {
+            trend_window_reset(odr_hz);
+        }
+
+        for (int axis = 0; axis < CAPTURE_CHANNELS; axis++) {
+            const int32_t v = (int32_t)xyz[i * CAPTURE_CHANNELS + axis] * full_scale_g;
+            window.sum[axis] += v;
+            if (v < window.min[axis]) {
+                window.min[axis] = v;
+            }
+            if (v > window.max[axis]) {
+                window.max[axis] = v;
+            }
+        }
+
+        if (++window.count < window.target) {
+            continue;
+        }
+
+        int16_t entry[CAPTURE_CHANNELS];
+        int32_t peak_to_peak = 0;
+        for (int axis = 0; axis < CAPTURE_CHANNELS; axis++) {
+            entry[axis] = (int16_t)(window.sum[axis] / (int64_t)window.count / BLACKBOX_TREND_FULL_SCALE_G);
+            if (window.max[axis] - window.min[axis] > peak_to_peak) {
+                peak_to_peak = window.max[axis] - window.min[axis];
+            }
+        }
+        const float p2p_mg = (float)peak_to_peak * 1000.0f / 32768.0f;
+        const uint64_t sample_us = timestamp_us - (uint64_t)((float)(count - 1 - i) * 1e6f / odr_hz);
+
+        taskENTER_CRITICAL(&bb_lock);
+        memcpy(&trend[(trend_total % BLACKBOX_TREND_LEN) * CAPTURE_CHANNELS], entry, sizeof(entry));
+        trend_total++;
+        trend_last_us = sample_us;
+        counters.last_peak_to_peak_mg = p2p_mg;
+        taskEXIT_CRITICAL(&bb_lock);
+
+        if (threshold_mg > 0 && p2p_mg > (float)threshold_mg) {
+            blackbox_arm(BLACKBOX_TRIGGER_EVENT);
+        }
+        trend_window_reset(odr_hz);
+    }
+}
+
+static void blackbox_sink(const pipeline_block_t *block, void *ctx)
+{
+    (void)ctx;
+    if (!bb_enabled || blocks == NULL || block->count == 0 || block->odr_hz <= 0.0f) {
+        return;
+    }
+
+    record_fullrate(block->xyz, block->count, (uint8_t)block->scale, block->odr_hz, block->timestamp_us);
+    record_trend(block->xyz, block->count, (uint8_t)block->scale, block->odr_hz, block->timestamp_us);
+    counters.recorded_samples += block->count;
+}
+
+static esp_err_t blackbox_arm(blackbox_trigger_t reason)
+{
+    const int64_t now_us = esp_timer_get_time();
+    esp_err_t ret = ESP_OK;
+
+    taskENTER_CRITICAL(&bb_lock);
+    if (!bb_enabled || armed || flushing) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else if (reason != BLACKBOX_TRIGGER_MANUAL && last_auto_trigger_us != 0 &&
+               now_us - last_auto_trigger_us < (int64_t)BLACKBOX_AUTO_HOLDOFF_MS * 1000) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else {
+        armed = true;
+        armed_at_us = now_us;
+        post_blocks_remaining = BLACKBOX_POST_TRIGGER_BLOCKS;
+        pending_reason = reason;
+        counters.triggers++;
+        counters.last_trigger = reason;
+        if (reason != BLACKBOX_TRIGGER_MANUAL) {
+            last_auto_trigger_us = now_us;
+        }
+    }
+    if (ret != ESP_OK) {
+        counters.triggers_ignored++;
+    }
+    taskEXIT_CRITICAL(&bb_lock);
+
+    if (ret == ESP_OK) {
+        TLOG_I(TAG, "Trigger (%s), freezing after %u more blocks",
+               blackbox_trigger_name(reason), (unsigned int)BLACKBOX_POST_TRIGGER_BLOCKS);
+    }
+    return ret;
+}
+
+static int find_oldest_pinned_after(uint32_t after_seq)
+{
+    int best = -1;
+    for (int i = 0; i < BLACKBOX_FULLRATE_BLOCKS; i++) {
+        if (blocks[i].pinned && blocks[i].seq > after_seq &&
+            (best < 0 || blocks[i].seq < blocks[best].seq)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void unpin_block(int idx)
+{
+    taskENTER_CRITICAL(&bb_lock);
+    blocks[idx].pinned = false;
+    taskEXIT_CRITICAL(&bb_lock);
+}
+
+// Write the pinned blocks oldest first, releasing each to the writer once on flash
+static uint32_t write_fullrate(FILE *file, blackbox_trigger_t reason)
+{
+    capture_header_t hdr;
+    uint32_t written = 0;
+    bool ok = (file != NULL);
+    uint32_t last_seq = BLACKBOX_NO_SEQ;
+    int idx;
+
+    while ((idx = find_oldest_pinned_after(last_seq)) >= 0) {
+        bb_block_t *blk = &blocks[idx];
+        last_seq = blk->seq;
+
+        if (ok && written == 0) {
+            capture_header_init(&hdr, blk->odr_hz, blk->full_scale_g, blk->start_us);
+            hdr.tag = (uint16_t)reason;
+            ok = (capture_write_header(file, &hdr) == ESP_OK);
+        }
+
+        if (ok) {
+            const int16_t *src = blk->samples;
+            if (blk->full_scale_g != hdr.full_scale_g) {
+                // Full scale changed inside the window: rescale to the header's scale
+                for (uint32_t i = 0; i < (uint32_t)blk->count * CAPTURE_CHANNELS; i++) {
+                    int32_t v = (int32_t)blk->samples[i] * blk->full_scale_g / hdr.full_scale_g;
+                    flush_buf[i] = (int16_t)(v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v));
+                }
+                src = flush_buf;
+            }
+            ok = (fwrite(src, CAPTURE_SAMPLE_BYTES, blk->count, file) == blk->count);
+            if (ok) {
+                written += blk->count;
+            }
+        }
+
+        unpin_block(idx);
+    }
+
+    if (ok && written > 0) {
+        hdr.sample_count = written;
+        ok = (capture_write_header(file, &hdr) == ESP_OK);
+    }
+    return ok ? written : 0;
+}
+
+static uint32_t write_trend(FILE *file, blackbox_trigger_t reason)
+{
+    const uint32_t total = frozen_trend_total;
+    const uint32_t count = total < BLACKBOX_TREND_LEN ? total : BLACKBOX_TREND_LEN;
+    if (file == NULL || count == 0) {
+        return 0;
+    }
+
+    capture_header_t hdr;
+    const uint64_t span_us = (uint64_t)(count - 1) * (1000000 / BLACKBOX_TREND_HZ);
+    capture_header_init(&hdr, (float)BLACKBOX_TREND_HZ, BLACKBOX_TREND_FULL_SCALE_G,
+                        frozen_trend_last_us > span_us ? frozen_trend_last_us - span_us : 0);
+    hdr.sample_count = count;
+    hdr.tag = (uint16_t)reason;
+    if (capture_write_header(file, &hdr) != ESP_OK) {
+        return 0;
+    }
+
+    // The loop keeps advancing; copy in chunks that it cannot lap during the write
+    uint32_t pos = total - count;
+    while (pos < total) {
+        uint32_t n = total - pos;
+        if (n > BLACKBOX_BLOCK_SAMPLES) {
+            n = BLACKBOX_BLOCK_SAMPLES;
+        }
+        const uint32_t start = pos % BLACKBOX_TREND_LEN;
+        if (n > BLACKBOX_TREND_LEN - start) {
+            n = BLACKBOX_TREND_LEN - start;
+        }
+
+        taskENTER_CRITICAL(&bb_lock);
+        memcpy(flush_buf, &trend[start * CAPTURE_CHANNELS], n * CAPTURE_SAMPLE_BYTES);
+        taskEXIT_CRITICAL(&bb_lock);
+
+        if (fwrite(flush_buf, CAPTURE_SAMPLE_BYTES, n, file) != n) {
+            return 0;
+        }
+        pos += n;
+    }
+    return count;
+}
+
+static void delete_segment(uint32_t id)
+{
+    char path[BLACKBOX_MAX_PATH_LEN];
+    if (blackbox_segment_path(id, BLACKBOX_PART_FULL, path, sizeof(path)) == ESP_OK) {
+        remove(path);
+    }
+    if (blackbox_segment_path(id, BLACKBOX_PART_TREND, path, sizeof(path)) == ESP_OK) {
+        remove(path);
+    }
+}
+
+static void write_segment(void)
+{
+    blackbox_segment_t existing[BLACKBOX_MAX_SEGMENTS + 1];
+
+    // SPIFFS is mounted by the web server task, so look for old segments on first use
+    if (!ids_scanned) {
+        size_t n = blackbox_list_segments(existing, BLACKBOX_MAX_SEGMENTS + 1);
+        if (n > 0) {
+            counters.next_segment_id = existing[n - 1].id + 1;
+        }
+        ids_scanned = true;
+    }
+
+    const uint32_t id = counters.next_segment_id;
+    const blackbox_trigger_t reason = pending_reason;
+    char path[BLACKBOX_MAX_PATH_LEN];
+
+    blackbox_segment_path(id, BLACKBOX_PART_FULL, path, sizeof(path));
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        ESP_LOGE(TAG, "Cannot create %s", path);
+    }
+    const uint32_t full_samples = write_fullrate(file, reason);
+    if (file != NULL) {
+        fclose(file);
+    }
+
+    blackbox_segment_path(id, BLACKBOX_PART_TREND, path, sizeof(path));
+    file = fopen(path, "wb");
+    const uint32_t trend_samples = write_trend(file, reason);
+    if (file != NULL) {
+        fclose(file);
+        if (trend_samples == 0) {
+            remove(path);
+        }
+    }
+
+    if (full_samples == 0 && trend_samples == 0) {
+        ESP_LOGE(TAG, "Segment %lu could not be written", (unsigned long)id);
+        delete_segment(id);
+        return;
+    }
+
+    counters.next_segment_id = id + 1;
+    counters.segments_written++;
+    ESP_LOGI(TAG, "Segment %lu (%s): %lu full-rate + %lu trend samples",
+             (unsigned long)id, blackbox_trigger_name(reason),
+             (unsigned long)full_samples, (unsigned long)trend_samples);
+
+    // Rotate: keep the newest BLACKBOX_MAX_SEGMENTS on flash
+    size_t n = blackbox_list_segments(existing, BLACKBOX_MAX_SEGMENTS + 1);
+    for (size_t i = 0; n > BLACKBOX_MAX_SEGMENTS && i < n - BLACKBOX_MAX_SEGMENTS; i++) {
+        ESP_LOGI(TAG, "Deleting old segment %lu", (unsigned long)existing[i].id);
+        delete_segment(existing[i].id);
+    }
+}
+
+static void blackbox_task(void *arg)
+{
+    metrics_register_task(NULL);
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BLACKBOX_ARM_TIMEOUT_MS / 2));
+
+        // An error trigger may stop the stream before the post-trigger blocks arrive
+        taskENTER_CRITICAL(&bb_lock);
+        if (armed && esp_timer_get_time() - armed_at_us > (int64_t)BLACKBOX_ARM_TIMEOUT_MS * 1000) {
+            // The block being filled is excluded; next_seq - 1 is the last block handed out
+            const uint32_t newest = blocks[current_block].count > 0 ? blocks[current_block].seq - 1
+                                                                    : next_seq - 1;
+            freeze_locked(newest);
+        }
+        const bool do_flush = flushing;
+        taskEXIT_CRITICAL(&bb_lock);
+
+        if (do_flush) {
+            write_segment();
+
+            // Release anything left pinned after a failed write
+            for (int i = 0; i < BLACKBOX_FULLRATE_BLOCKS; i++) {
+                if (blocks[i].pinned) {
+                    unpin_block(i);
+                }
+            }
+            taskENTER_CRITICAL(&bb_lock);
+            flushing = false;
+            taskEXIT_CRITICAL(&bb_lock);
+        }
+    }
+}
+
+esp_err_t blackbox_init(void)
+{
+    if (blocks != NULL) {
+        return ESP_OK;
+    }
+
+    blocks = mem_arena_alloc(MEM_SUBSYS_BLACKBOX, BLACKBOX_FULLRATE_BLOCKS * sizeof(bb_block_t));
+    trend = mem_arena_alloc(MEM_SUBSYS_BLACKBOX, BLACKBOX_TREND_LEN * CAPTURE_SAMPLE_BYTES);
+    if (blocks == NULL || trend == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate black-box buffers");
+        blocks = NULL;
+        trend = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    memset(&counters, 0, sizeof(counters));
+    window.target = 0;
+
+    if (xTaskCreate(blackbox_task, "blackbox", BLACKBOX_TASK_STACK_SIZE, NULL,
+                    BLACKBOX_TASK_PRIORITY, &bb_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create black-box task");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = pipeline_add_sink(BLACKBOX_SINK_NAME, blackbox_sink, NULL, NULL);
+    if (ret == ESP_OK) {
+        ret = pipeline_connect_sources(BLACKBOX_SINK_NAME);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to attach to the pipeline: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Black box ready: %u x %u full-rate blocks, %u s trend at %u Hz",
+             (unsigned int)BLACKBOX_FULLRATE_BLOCKS, (unsigned int)BLACKBOX_BLOCK_SAMPLES,
+             (unsigned int)BLACKBOX_TREND_SECONDS, (unsigned int)BLACKBOX_TREND_HZ);
+    return ESP_OK;
+}
+
+esp_err_t blackbox_trigger(blackbox_trigger_t reason)
+{
+    if (blocks == NULL || reason == BLACKBOX_TRIGGER_NONE) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return blackbox_arm(reason);
+}
+
+esp_err_t blackbox_set_threshold(uint32_t new_threshold_mg)
+{
+    threshold_mg = new_threshold_mg;
+    ESP_LOGI(TAG, "Event threshold %lu mg%s", (unsigned long)new_threshold_mg,
+             new_threshold_mg == 0 ? " (disabled)" : "");
+    return ESP_OK;
+}
+
+esp_err_t blackbox_set_enabled(bool enabled)
+{
+    taskENTER_CRITICAL(&bb_lock);
+    bb_enabled = enabled;
+    if (!enabled) {
+        armed = false;
+    }
+    taskEXIT_CRITICAL(&bb_lock);
+    return ESP_OK;
+}
+
+esp_err_t blackbox_get_status(blackbox_status_t *status)
+{
+    if (status == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    taskENTER_CRITICAL(&bb_lock);
+    *status = counters;
+    status->enabled = bb_enabled;
+    status->armed = armed;
+    status->flushing = flushing;
+    status->trend_samples = trend_total < BLACKBOX_TREND_LEN ? trend_total : BLACKBOX_TREND_LEN;
+    taskEXIT_CRITICAL(&bb_lock);
+
+    status->threshold_mg = threshold_mg;
+    const float odr_hz = imu_manager_get_configured_odr();
+    status->fullrate_seconds = odr_hz > 0.0f
+                                   ? (float)(BLACKBOX_FREEZE_BLOCKS * BLACKBOX_BLOCK_SAMPLES) / odr_hz
+                                   : 0.0f;
+    return ESP_OK;
+}
+
+static bool read_segment_header(uint32_t id, blackbox_part_t part, capture_header_t *hdr)
+{
+    char path[BLACKBOX_MAX_PATH_LEN];
+    if (blackbox_segment_path(id, part, path, sizeof(path)) != ESP_OK) {
+        return false;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool ok = (capture_read_header(file, hdr) == ESP_OK);
+    fclose(file);
+    return ok;
+}
+
+size_t blackbox_list_segments(blackbox_segment_t *segments, size_t max_segments)
+{
+    if (segments == NULL || max_segments == 0) {
+        return 0;
+    }
+
+    DIR *dir = opendir(BLACKBOX_BASE_PATH);
+    if (dir == NULL) {
+        return 0;
+    }
+
+    size_t count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        unsigned long id = 0;
+        int consumed = 0;
+        if (sscanf(entry->d_name, "bb%lu_full%n", &id, &consumed) != 1 || consumed == 0 ||
+            strcmp(entry->d_name + consumed, CAPTURE_FILE_EXT) != 0) {
+            continue;
+        }
+
+        blackbox_segment_t seg = {0};
+        capture_header_t hdr;
+        seg.id = (uint32_t)id;
+        if (read_segment_header(seg.id, BLACKBOX_PART_FULL, &hdr)) {
+            seg.trigger = (blackbox_trigger_t)hdr.tag;
+            seg.start_timestamp_us = hdr.start_timestamp_us;
+            seg.full_samples = hdr.sample_count;
+            seg.full_odr_hz = hdr.odr_hz;
+        }
+        if (read_segment_header(seg.id, BLACKBOX_PART_TREND, &hdr)) {
+            seg.trigger = (blackbox_trigger_t)hdr.tag;
+            seg.trend_samples = hdr.sample_count;
+        }
+
+        // Insert sorted by id; when full, keep the newest
+        size_t pos = count;
+        while (pos > 0 && segments[pos - 1].id > seg.id) {
+            pos--;
+        }
+        if (count == max_segments) {
+            if (pos == 0) {
+                continue;
+            }
+            memmove(&segments[0], &segments[1], (pos - 1) * sizeof(seg));
+            segments[pos - 1] = seg;
+        } else {
+            memmove(&segments[pos + 1], &segments[pos], (count - pos) * sizeof(seg));
+            segments[pos] = seg;
+            count++;
+        }
+    }
+    closedir(dir);
+    return count;
+}
@@ -0,0 +1,78 @@
+#ifndef BLACKBOX_H
+#define BLACKBOX_H
+
+#include "esp_err.h"
+#include "imu_manager.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Black-box configuration
+#define BLACKBOX_BASE_PATH              "/spiffs"
+#define BLACKBOX_MAX_PATH_LEN           64
+#define BLACKBOX_SINK_NAME              "blackbox"     // Pipeline sink, fed by every source
+// The full-rate window is sub-second on purpose. At 26.7 kHz, 3 axes cost 160 KB
+// per second: 2 s would need 320 KB of the C6's 512 KB SRAM, and a SPIFFS loop
+// would have to sustain 160 KB/s of writes and wear the partition out in about a
+// week. The decimated trend loop below covers the seconds to minutes before a trigger.
+#define BLACKBOX_BLOCK_SAMPLES          512     // Full-rate samples per RAM block (~19 ms at 26.7 kHz)
+#define BLACKBOX_FULLRATE_BLOCKS        16      // 48 KB RAM; a freeze keeps 14 blocks, ~0.27 s
+#define BLACKBOX_POST_TRIGGER_BLOCKS    4       // Blocks still recorded after a trigger before freezing
+#define BLACKBOX_TREND_HZ               10      // Decimated loop rate (mean of each window)
+#define BLACKBOX_TREND_SECONDS          300     // Decimated loop length
+#define BLACKBOX_TREND_FULL_SCALE_G     16      // Trend samples are stored at a fixed scale
+#define BLACKBOX_MAX_SEGMENTS           8       // Frozen segments kept on SPIFFS, oldest deleted first
+#define BLACKBOX_AUTO_HOLDOFF_MS        30000   // Minimum spacing of event/error triggers
+#define BLACKBOX_DEFAULT_THRESHOLD_MG   0       // Peak-to-peak event threshold, 0 = disabled
+#define BLACKBOX_TASK_STACK_SIZE        4096
+#define BLACKBOX_TASK_PRIORITY          2
+
+typedef enum {
+    BLACKBOX_TRIGGER_NONE = 0,
+    BLACKBOX_TRIGGER_MANUAL,        // API request
+    BLACKBOX_TRIGGER_EVENT,         // Vibration threshold exceeded
+    BLACKBOX_TRIGGER_ERROR,         // Sensor read failure or FIFO overflow
+} blackbox_trigger_t;
+
+typedef enum {
+    BLACKBOX_PART_FULL = 0,         // Full-rate samples around the trigger
+    BLACKBOX_PART_TREND,            // Decimated history leading up to the trigger
+} blackbox_part_t;
+
+typedef struct {
+    bool enabled;
+    bool armed;                     // Trigger received, post-trigger blocks still recording
+    bool flushing;                  // Frozen blocks being written to SPIFFS
+    uint32_t threshold_mg;
+    blackbox_trigger_t last_trigger;
+    uint32_t triggers;
+    uint32_t triggers_ignored;      // Triggers during holdoff or an ongoing freeze
+    uint32_t segments_written;
+    uint32_t next_segment_id;
+    uint64_t recorded_samples;
+    uint32_t dropped_samples;       // Samples lost while every block was pinned
+    float fullrate_seconds;         // Full-rate history held at the current ODR
+    uint32_t trend_samples;         // Valid decimated entries in the loop
+    float last_peak_to_peak_mg;
+} blackbox_status_t;
+
+typedef struct {
+    uint32_t id;
+    blackbox_trigger_t trigger;
+    uint64_t start_timestamp_us;
+    uint32_t full_samples;
+    float full_odr_hz;
+    uint32_t trend_samples;
+} blackbox_segment_t;
+
+// Black-box API
+esp_err_t blackbox_init(void);
+esp_err_t blackbox_trigger(blackbox_trigger_t reason);
+esp_err_t blackbox_set_threshold(uint32_t threshold_mg);
+esp_err_t blackbox_set_enabled(bool enabled);
+esp_err_t blackbox_get_status(blackbox_status_t *status);
+size_t blackbox_list_segments(blackbox_segment_t *segments, size_t max_segments);
+esp_err_t blackbox_segment_path(uint32_t id, blackbox_part_t part, char *path, size_t path_len);
+const char *blackbox_trigger_name(blackbox_trigger_t reason);
+
+#endif // BLACKBOX_H
@@ -0,0 +1,64 @@
+#include "capture.h"
+#include <string.h>
+
+void capture_header_init(capture_header_t *hdr, float odr_hz, uint8_t full_scale_g, uint64_t start_timestamp_us)
+{
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->magic = CAPTURE_MAGIC;
+    hdr->version = CAPTURE_VERSION;
+    hdr->header_size = sizeof(capture_header_t);
+    hdr->start_timestamp_us = start_timestamp_us;
+    hdr->odr_hz = odr_hz;
+    hdr->full_scale_g = full_scale_g;
+    hdr->channels = CAPTURE_CHANNELS;
+}
+
+esp_err_t capture_write_header(FILE *file, const capture_header_t *hdr)
+{
+    if (file == NULL || hdr == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (fseek(file, 0, SEEK_SET) != 0 ||
+        fwrite(hdr, sizeof(*hdr), 1, file) != 1) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t capture_read_header(FILE *file, capture_header_t *hdr)
+{
+    if (file == NULL || hdr == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (fseek(file, 0, SEEK_SET) != 0 ||
+        fread(hdr, sizeof(*hdr), 1, file) != 1) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (hdr->magic != CAPTURE_MAGIC) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    if (hdr->version != CAPTURE_VERSION || hdr->header_size < sizeof(*hdr)) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (hdr->channels != CAPTURE_CHANNELS || hdr->odr_hz <= 0.0f) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    switch (hdr->full_scale_g) {
+        case 2:
+        case 4:
+        case 8:
+        case 16:
+            break;
+        default:
+            return ESP_ERR_INVALID_ARG;
+    }
+
+    // Skip any header extension written by a newer minor revision
+    if (fseek(file, hdr->header_size, SEEK_SET) != 0) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
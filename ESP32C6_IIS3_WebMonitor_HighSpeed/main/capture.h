@@ -0,0 +1,32 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdio.h>
+
+// Capture file format (.cap): fixed little-endian header followed by
+// interleaved int16 x,y,z samples in sensor LSB at the recorded full scale.
+#define CAPTURE_MAGIC           0x43554D49u  // "IMUC"
+#define CAPTURE_VERSION         1
+#define CAPTURE_CHANNELS        3
+#define CAPTURE_SAMPLE_BYTES    (CAPTURE_CHANNELS * sizeof(int16_t))
+#define CAPTURE_FILE_EXT        ".cap"
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;           // Offset of the first sample
+    uint64_t start_timestamp_us;    // Device time of the first sample
+    float odr_hz;
+    uint32_t sample_count;          // 0 = unknown, read until end of file
+    uint8_t full_scale_g;
+    uint8_t channels;
+    uint16_t tag;                   // Producer-defined (e.g. black-box trigger reason)
+} capture_header_t;
+
+void capture_header_init(capture_header_t *hdr, float odr_hz, uint8_t full_scale_g, uint64_t start_timestamp_us);
+esp_err_t capture_write_header(FILE *file, const capture_header_t *hdr);
+esp_err_t capture_read_header(FILE *file, capture_header_t *hdr);
+
+#endif // CAPTURE_H
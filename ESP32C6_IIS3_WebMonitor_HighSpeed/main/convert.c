@@ -0,0 +1,47 @@
+#include "convert.h"
+
+// Datasheet sensitivities in mg/LSB, as in iis3dwb_from_fsXg_to_mg()
+#define CONVERT_FS2G_MG_PER_LSB     0.061f
+#define CONVERT_FS4G_MG_PER_LSB     0.122f
+#define CONVERT_FS8G_MG_PER_LSB     0.244f
+#define CONVERT_FS16G_MG_PER_LSB    0.488f
+
+#define CONVERT_G_PER_LSB(fs)       (CONVERT_FS##fs##G_MG_PER_LSB / 1000.0f)
+
+#define CONVERT_KERNEL(fs)                                                  \
+    static void convert_fs##fs##g(const int16_t *raw, float *g, size_t n)   \
+    {                                                                       \
+        for (size_t i = 0; i < n; i++) {                                    \
+            g[i] = (float)raw[i] * CONVERT_G_PER_LSB(fs);                   \
+        }                                                                   \
+    }
+
+CONVERT_KERNEL(2)
+CONVERT_KERNEL(4)
+CONVERT_KERNEL(8)
+CONVERT_KERNEL(16)
+
+// Indexed by full scale in g; unsupported entries stay NULL / 0
+static const convert_kernel_t kernels[CONVERT_MAX_FULL_SCALE_G + 1] = {
+    [2]  = convert_fs2g,
+    [4]  = convert_fs4g,
+    [8]  = convert_fs8g,
+    [16] = convert_fs16g,
+};
+
+static const float sensitivities[CONVERT_MAX_FULL_SCALE_G + 1] = {
+    [2]  = CONVERT_G_PER_LSB(2),
+    [4]  = CONVERT_G_PER_LSB(4),
+    [8]  = CONVERT_G_PER_LSB(8),
+    [16] = CONVERT_G_PER_LSB(16),
+};
+
+convert_kernel_t convert_get_kernel(uint8_t full_scale_g)
+{
+    return (full_scale_g <= CONVERT_MAX_FULL_SCALE_G) ? kernels[full_scale_g] : NULL;
+}
+
+float convert_sensitivity_g(uint8_t full_scale_g)
+{
+    return (full_scale_g <= CONVERT_MAX_FULL_SCALE_G) ? sensitivities[full_scale_g] : 0.0f;
+}
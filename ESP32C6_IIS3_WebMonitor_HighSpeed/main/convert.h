@@ -0,0 +1,22 @@
+#ifndef CONVERT_H
+#define CONVERT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Raw-to-g conversion kernels, one per IIS3DWB full scale. Each kernel is
+// generated with its datasheet sensitivity as a literal, so its loop is a single
+// multiply by a constant with no per-sample branch. Look the kernel up once when
+// the full scale changes and call it through the pointer. Plain C with no IDF
+// dependencies, so tools/convert_bench.c can build it on the host.
+#define CONVERT_MAX_FULL_SCALE_G    16
+
+typedef void (*convert_kernel_t)(const int16_t *raw, float *g, size_t n);
+
+// Convert API
+// full_scale_g is 2, 4, 8 or 16 (imu_manager_full_scale_t values); any other value
+// returns NULL from convert_get_kernel() and 0 from convert_sensitivity_g()
+convert_kernel_t convert_get_kernel(uint8_t full_scale_g);
+float convert_sensitivity_g(uint8_t full_scale_g);
+
+#endif // CONVERT_H
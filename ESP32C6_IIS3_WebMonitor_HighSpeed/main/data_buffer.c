@@ -1,4 +1,5 @@
 #include "data_buffer.h"
+#include "mem_arena.h"
 #include "esp_log.h"
 #include "cJSON.h"
 #include "freertos/FreeRTOS.h"
@@ -6,27 +7,253 @@
 #include "freertos/semphr.h"
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
+#include <stdatomic.h>
 #include "esp_timer.h"
 
 static const char *TAG = "DATA_BUFFER";
 
-// Circular buffer structure
+// Columnar circular buffer. Each entry costs ~12.1 bytes instead of sizeof(imu_data_t):
+// accel is stored as int16 at DATA_BUFFER_ACCEL_LSB_PER_G, timestamps as uint16 deltas
+// from the previous entry with periodic/forced absolute keyframes, validity as a bitmap.
+// Magnitude, batch interval and sample rate are derived when an entry is decoded.
+#define DATA_BUFFER_KEYFRAMES   (DATA_BUFFER_SIZE / DATA_BUFFER_KEYFRAME_INTERVAL + DATA_BUFFER_EXTRA_KEYFRAMES)
+#define DATA_BUFFER_BITMAP_WORDS ((DATA_BUFFER_SIZE + 31) / 32)
+
+typedef struct {
+    uint64_t timestamp_us;      // Absolute timestamp of entry `seq`
+    uint32_t seq;
+    float odr_hz;               // ODR for this entry and the deltas that follow
+} keyframe_t;
+
 typedef struct {
-    imu_data_t data[DATA_BUFFER_SIZE];
-    uint32_t head;
-    uint32_t tail;
-    uint32_t count;
-    bool full;
+    int16_t accel_x[DATA_BUFFER_SIZE];
+    int16_t accel_y[DATA_BUFFER_SIZE];
+    int16_t accel_z[DATA_BUFFER_SIZE];
+    uint16_t ts_delta_us[DATA_BUFFER_SIZE];
+    uint16_t fifo_level[DATA_BUFFER_SIZE];
+    uint16_t samples_read[DATA_BUFFER_SIZE];
+    uint32_t valid_bits[DATA_BUFFER_BITMAP_WORDS];
+    uint32_t keyframe_bits[DATA_BUFFER_BITMAP_WORDS];
+    keyframe_t keyframes[DATA_BUFFER_KEYFRAMES];
+    uint32_t kf_head;           // Oldest keyframe
+    uint32_t kf_count;
+    uint32_t head_seq;          // Sequence number of the next entry
+    uint32_t tail_seq;          // Sequence number of the oldest entry
+    uint32_t tail_slot;
+    uint64_t tail_ts;           // Decode base while the oldest keyframe is newer than the tail
+    float tail_odr;
+    uint64_t last_ts;
+    float last_odr;
+    uint32_t since_keyframe;
     buffer_stats_t stats;
 } data_buffer_t;
 
-static data_buffer_t buffer;
+// Sequential decoder positioned on one entry
+typedef struct {
+    uint32_t seq;
+    uint32_t slot;
+    uint64_t ts;
+    uint64_t prev_ts;
+    bool has_prev;
+    float odr;
+    uint32_t kf_next;           // Logical index of the next keyframe to meet
+} cursor_t;
+
+static data_buffer_t *buffer = NULL;     // Carved from the boot arena
 static SemaphoreHandle_t buffer_mutex = NULL;
 
+// Latest-sample publication. The writer (serialized by buffer_mutex) fills the slot
+// readers are not pointed at, then flips latest_index; each slot carries a sequence
+// counter that is odd while it is being written. A reader copies the current slot and
+// retries only if the writer reused that slot meanwhile. Unlike a single-slot seqlock,
+// a reader that preempts the writer on this single core still finds a stable slot.
+#define LATEST_INDEX_VALID 0x2u
+
+typedef struct {
+    atomic_uint seq;
+    imu_data_t data;
+} latest_slot_t;
+
+static latest_slot_t latest_slots[2];
+static atomic_uint latest_index;            // Slot number | LATEST_INDEX_VALID, 0 when empty
+static atomic_uint latest_reads;
+static atomic_uint latest_read_retries;
+static atomic_uint latest_read_fallbacks;
+
+static inline bool bit_get(const uint32_t *bits, uint32_t idx)
+{
+    return (bits[idx >> 5] >> (idx & 31)) & 1u;
+}
+
+static inline void bit_put(uint32_t *bits, uint32_t idx, bool value)
+{
+    if (value) {
+        bits[idx >> 5] |= 1u << (idx & 31);
+    } else {
+        bits[idx >> 5] &= ~(1u << (idx & 31));
+    }
+}
+
+static inline uint32_t buffer_count(void)
+{
+    return buffer->head_seq - buffer->tail_seq;
+}
+
+static inline const keyframe_t *keyframe_at(uint32_t logical)
+{
+    return &buffer->keyframes[(buffer->kf_head + logical) % DATA_BUFFER_KEYFRAMES];
+}
+
+static inline int16_t g_to_lsb(float g)
+{
+    float v = g * DATA_BUFFER_ACCEL_LSB_PER_G;
+    v += (v >= 0.0f) ? 0.5f : -0.5f;
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+// Caller holds buffer_mutex (single writer)
+static void publish_latest_locked(const imu_data_t *data)
+{
+    if (data == NULL) {
+        atomic_store_explicit(&latest_index, 0, memory_order_release);
+        return;
+    }
+
+    const unsigned int current = atomic_load_explicit(&latest_index, memory_order_relaxed);
+    const unsigned int next = (current & LATEST_INDEX_VALID) ? ((current & 1u) ^ 1u) : 0u;
+    latest_slot_t *slot = &latest_slots[next];
+
+    const unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->data = *data;
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+    atomic_store_explicit(&latest_index, next | LATEST_INDEX_VALID, memory_order_release);
+}
+
+static void advance_tail_locked(void)
+{
+    buffer->tail_seq++;
+    buffer->tail_slot = (buffer->tail_slot + 1) % DATA_BUFFER_SIZE;
+
+    while (buffer->kf_count > 0 && (int32_t)(keyframe_at(0)->seq - buffer->tail_seq) < 0) {
+        buffer->kf_head = (buffer->kf_head + 1) % DATA_BUFFER_KEYFRAMES;
+        buffer->kf_count--;
+    }
+
+    if (buffer->tail_seq == buffer->head_seq) {
+        return;
+    }
+
+    if (bit_get(buffer->keyframe_bits, buffer->tail_slot)) {
+        buffer->tail_ts = keyframe_at(0)->timestamp_us;
+        buffer->tail_odr = keyframe_at(0)->odr_hz;
+    } else {
+        buffer->tail_ts += buffer->ts_delta_us[buffer->tail_slot];
+    }
+}
+
+static void cursor_step_locked(cursor_t *c)
+{
+    c->prev_ts = c->ts;
+    c->has_prev = true;
+    c->seq++;
+    c->slot = (c->slot + 1) % DATA_BUFFER_SIZE;
+
+    if (bit_get(buffer->keyframe_bits, c->slot)) {
+        const keyframe_t *kf = keyframe_at(c->kf_next++);
+        c->ts = kf->timestamp_us;
+        c->odr = kf->odr_hz;
+    } else {
+        c->ts += buffer->ts_delta_us[c->slot];
+    }
+}
+
+// Position on entry `seq` (tail-relative offset must be < count)
+static void cursor_seek_locked(cursor_t *c, uint32_t seq)
+{
+    const uint32_t target = seq - buffer->tail_seq;
+    int32_t lo = 0;
+    int32_t hi = (int32_t)buffer->kf_count - 1;
+    int32_t found = -1;
+    while (lo <= hi) {
+        const int32_t mid = (lo + hi) / 2;
+        if (keyframe_at((uint32_t)mid)->seq - buffer->tail_seq <= target) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    if (found >= 0) {
+        const keyframe_t *kf = keyframe_at((uint32_t)found);
+        c->seq = kf->seq;
+        c->ts = kf->timestamp_us;
+        c->odr = kf->odr_hz;
+        c->kf_next = (uint32_t)found + 1;
+    } else {
+        c->seq = buffer->tail_seq;
+        c->ts = buffer->tail_ts;
+        c->odr = buffer->tail_odr;
+        c->kf_next = 0;
+    }
+    c->slot = (buffer->tail_slot + (c->seq - buffer->tail_seq)) % DATA_BUFFER_SIZE;
+    c->has_prev = false;
+
+    while (c->seq != seq) {
+        cursor_step_locked(c);
+    }
+}
+
+static void cursor_read_locked(const cursor_t *c, imu_data_t *data)
+{
+    const uint32_t slot = c->slot;
+    const float scale = 1.0f / DATA_BUFFER_ACCEL_LSB_PER_G;
+
+    memset(data, 0, sizeof(*data));
+    data->timestamp_us = c->ts;
+    data->accelerometer.valid = bit_get(buffer->valid_bits, slot);
+    if (data->accelerometer.valid) {
+        const float x = buffer->accel_x[slot] * scale;
+        const float y = buffer->accel_y[slot] * scale;
+        const float z = buffer->accel_z[slot] * scale;
+        data->accelerometer.x_g = x;
+        data->accelerometer.y_g = y;
+        data->accelerometer.z_g = z;
+        data->accelerometer.magnitude_g = sqrtf(x * x + y * y + z * z);
+    }
+
+    data->stats.fifo_level = buffer->fifo_level[slot];
+    data->stats.samples_read = buffer->samples_read[slot];
+    data->stats.odr_hz = c->odr;
+    if (c->has_prev && c->ts > c->prev_ts) {
+        data->stats.batch_interval_us = (float)(c->ts - c->prev_ts);
+    } else if (c->odr > 0.0f) {
+        data->stats.batch_interval_us = data->stats.samples_read * 1e6f / c->odr;
+    }
+    if (data->stats.batch_interval_us > 0.0f) {
+        data->stats.samples_per_second = data->stats.samples_read * 1e6f / data->stats.batch_interval_us;
+    }
+}
+
 esp_err_t data_buffer_init(void)
 {
     ESP_LOGI(TAG, "Initializing data buffer...");
     
+    buffer = mem_arena_alloc(MEM_SUBSYS_DATA_BUFFER, sizeof(*buffer));
+    if (buffer == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate buffer (%u bytes)", (unsigned int)sizeof(*buffer));
+        return ESP_ERR_NO_MEM;
+    }
+    
     // Create mutex
     buffer_mutex = xSemaphoreCreateMutex();
     if (buffer_mutex == NULL) {
@@ -34,21 +261,12 @@ esp_err_t data_buffer_init(void)
         return ESP_FAIL;
     }
     
-    // Initialize buffer
-    memset(&buffer, 0, sizeof(buffer));
-    buffer.head = 0;
-    buffer.tail = 0;
-    buffer.count = 0;
-    buffer.full = false;
+    // Initialize buffer and statistics
+    memset(buffer, 0, sizeof(*buffer));
+    atomic_store(&latest_index, 0);
     
-    // Initialize statistics
-    buffer.stats.total_samples = 0;
-    buffer.stats.dropped_samples = 0;
-    buffer.stats.buffer_overflows = 0;
-    buffer.stats.last_timestamp_us = 0;
-    buffer.stats.avg_processing_time_us = 0.0f;
-    
-    ESP_LOGI(TAG, "Data buffer initialized with size %d", DATA_BUFFER_SIZE);
+    ESP_LOGI(TAG, "Data buffer initialized with size %d (%u bytes)", DATA_BUFFER_SIZE,
+             (unsigned int)sizeof(*buffer));
     return ESP_OK;
 }
 
@@ -59,40 +277,74 @@ esp_err_t data_buffer_add(const imu_data_t *data)
     }
     
     if (xSemaphoreTake(buffer_mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
-        buffer.stats.dropped_samples++;
+        buffer->stats.dropped_samples++;
         return ESP_ERR_TIMEOUT;
     }
     
     int64_t start_time = esp_timer_get_time();
     
     // Check if buffer is full
-    if (buffer.full && !DATA_BUFFER_OVERWRITE) {
-        buffer.stats.dropped_samples++;
-        xSemaphoreGive(buffer_mutex);
-        return ESP_ERR_NO_MEM;
+    if (buffer_count() == DATA_BUFFER_SIZE) {
+        if (!DATA_BUFFER_OVERWRITE) {
+            buffer->stats.dropped_samples++;
+            xSemaphoreGive(buffer_mutex);
+            return ESP_ERR_NO_MEM;
+        }
+        advance_tail_locked();
+        buffer->stats.buffer_overflows++;
     }
-    
-    // Add data to buffer
-    buffer.data[buffer.head] = *data;
-    buffer.head = (buffer.head + 1) % DATA_BUFFER_SIZE;
-    
-    if (buffer.full) {
-        buffer.tail = (buffer.tail + 1) % DATA_BUFFER_SIZE;
-        buffer.stats.buffer_overflows++;
-    } else {
-        buffer.count++;
-        if (buffer.head == buffer.tail) {
-            buffer.full = true;
+
+    const uint64_t ts = data->timestamp_us;
+    const float odr = data->stats.odr_hz;
+    const bool empty = (buffer_count() == 0);
+    const bool keyframe = empty ||
+                          buffer->since_keyframe >= DATA_BUFFER_KEYFRAME_INTERVAL ||
+                          ts < buffer->last_ts ||
+                          ts - buffer->last_ts > UINT16_MAX ||
+                          odr != buffer->last_odr;
+
+    if (keyframe) {
+        // Out of keyframe slots (many gaps in a row): give up the oldest entries
+        while (buffer->kf_count == DATA_BUFFER_KEYFRAMES) {
+            advance_tail_locked();
+            buffer->stats.buffer_overflows++;
         }
+        keyframe_t *kf = &buffer->keyframes[(buffer->kf_head + buffer->kf_count) % DATA_BUFFER_KEYFRAMES];
+        kf->timestamp_us = ts;
+        kf->seq = buffer->head_seq;
+        kf->odr_hz = odr;
+        buffer->kf_count++;
+        buffer->since_keyframe = 0;
+    }
+
+    // Add data to buffer
+    const uint32_t slot = (buffer->tail_slot + buffer_count()) % DATA_BUFFER_SIZE;
+    buffer->accel_x[slot] = g_to_lsb(data->accelerometer.x_g);
+    buffer->accel_y[slot] = g_to_lsb(data->accelerometer.y_g);
+    buffer->accel_z[slot] = g_to_lsb(data->accelerometer.z_g);
+    buffer->ts_delta_us[slot] = keyframe ? 0 : (uint16_t)(ts - buffer->last_ts);
+    buffer->fifo_level[slot] = data->stats.fifo_level;
+    buffer->samples_read[slot] = data->stats.samples_read;
+    bit_put(buffer->valid_bits, slot, data->accelerometer.valid);
+    bit_put(buffer->keyframe_bits, slot, keyframe);
+
+    if (buffer_count() == 0) {
+        buffer->tail_ts = ts;
+        buffer->tail_odr = odr;
     }
+    buffer->head_seq++;
+    buffer->since_keyframe++;
+    buffer->last_ts = ts;
+    buffer->last_odr = odr;
     
     // Update statistics
-    buffer.stats.total_samples++;
-    buffer.stats.last_timestamp_us = data->timestamp_us;
+    buffer->stats.total_samples++;
+    buffer->stats.last_timestamp_us = data->timestamp_us;
+    publish_latest_locked(data);
     
     int64_t end_time = esp_timer_get_time();
     float processing_time = (float)(end_time - start_time);
-    buffer.stats.avg_processing_time_us = (buffer.stats.avg_processing_time_us * 0.9f) + (processing_time * 0.1f);
+    buffer->stats.avg_processing_time_us = (buffer->stats.avg_processing_time_us * 0.9f) + (processing_time * 0.1f);
     
     xSemaphoreGive(buffer_mutex);
     return ESP_OK;
@@ -108,15 +360,18 @@ esp_err_t data_buffer_get(imu_data_t *data)
         return ESP_ERR_TIMEOUT;
     }
     
-    if (buffer.count == 0 && !buffer.full) {
+    if (buffer_count() == 0) {
         xSemaphoreGive(buffer_mutex);
         return ESP_ERR_NOT_FOUND;
     }
     
-    *data = buffer.data[buffer.tail];
-    buffer.tail = (buffer.tail + 1) % DATA_BUFFER_SIZE;
-    buffer.count--;
-    buffer.full = false;
+    cursor_t cursor;
+    cursor_seek_locked(&cursor, buffer->tail_seq);
+    cursor_read_locked(&cursor, data);
+    advance_tail_locked();
+    if (buffer_count() == 0) {
+        publish_latest_locked(NULL);
+    }
     
     xSemaphoreGive(buffer_mutex);
     return ESP_OK;
@@ -128,25 +383,40 @@ esp_err_t data_buffer_get_latest(imu_data_t *data)
         return ESP_ERR_INVALID_ARG;
     }
     
+    for (int attempt = 0; attempt < DATA_BUFFER_LATEST_MAX_RETRIES; attempt++) {
+        const unsigned int index = atomic_load_explicit(&latest_index, memory_order_acquire);
+        if (!(index & LATEST_INDEX_VALID)) {
+            return ESP_ERR_NOT_FOUND;
+        }
+
+        latest_slot_t *slot = &latest_slots[index & 1u];
+        const unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if ((seq & 1u) == 0) {
+            *data = slot->data;
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&slot->seq, memory_order_relaxed) == seq) {
+                atomic_fetch_add_explicit(&latest_reads, 1, memory_order_relaxed);
+                return ESP_OK;
+            }
+        }
+        atomic_fetch_add_explicit(&latest_read_retries, 1, memory_order_relaxed);
+    }
+    
+    // Reader was preempted across several publications: the mutex excludes the writer
+    atomic_fetch_add_explicit(&latest_read_fallbacks, 1, memory_order_relaxed);
     if (xSemaphoreTake(buffer_mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
         return ESP_ERR_TIMEOUT;
     }
     
-    // Buffer is empty only when count is 0 AND not full
-    // If full=true, buffer has DATA_BUFFER_SIZE valid samples
-    if (buffer.count == 0 && !buffer.full) {
-        xSemaphoreGive(buffer_mutex);
-        return ESP_ERR_NOT_FOUND;
+    const unsigned int index = atomic_load_explicit(&latest_index, memory_order_relaxed);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    if (index & LATEST_INDEX_VALID) {
+        *data = latest_slots[index & 1u].data;
+        ret = ESP_OK;
     }
     
-    // Get the most recent data
-    // When full, head points to next write position, so last valid is head-1
-    // When not full, head-1 is also the last written
-    uint32_t latest_idx = (buffer.head - 1 + DATA_BUFFER_SIZE) % DATA_BUFFER_SIZE;
-    *data = buffer.data[latest_idx];
-    
     xSemaphoreGive(buffer_mutex);
-    return ESP_OK;
+    return ret;
 }
 
 esp_err_t data_buffer_get_range(imu_data_t *data, uint32_t start_idx, uint32_t count)
@@ -159,7 +429,7 @@ esp_err_t data_buffer_get_range(imu_data_t *data, uint32_t start_idx, uint32_t c
         return ESP_ERR_TIMEOUT;
     }
     
-    uint32_t available_count = buffer.full ? DATA_BUFFER_SIZE : buffer.count;
+    uint32_t available_count = buffer_count();
     if (start_idx >= available_count) {
         xSemaphoreGive(buffer_mutex);
         return ESP_ERR_INVALID_ARG;
@@ -168,15 +438,57 @@ esp_err_t data_buffer_get_range(imu_data_t *data, uint32_t start_idx, uint32_t c
     uint32_t actual_count = (start_idx + count > available_count) ? 
                            (available_count - start_idx) : count;
     
+    cursor_t cursor;
+    cursor_seek_locked(&cursor, buffer->tail_seq + start_idx);
     for (uint32_t i = 0; i < actual_count; i++) {
-        uint32_t idx = (buffer.tail + start_idx + i) % DATA_BUFFER_SIZE;
-        data[i] = buffer.data[idx];
+        if (i > 0) {
+            cursor_step_locked(&cursor);
+        }
+        cursor_read_locked(&cursor, &data[i]);
     }
     
     xSemaphoreGive(buffer_mutex);
     return ESP_OK;
 }
 
+uint32_t data_buffer_get_accel_columns(int16_t *x, int16_t *y, int16_t *z, uint32_t start_idx, uint32_t count)
+{
+    if (x == NULL || y == NULL || z == NULL || count == 0) {
+        return 0;
+    }
+
+    if (xSemaphoreTake(buffer_mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return 0;
+    }
+
+    uint32_t available_count = buffer_count();
+    if (start_idx >= available_count) {
+        xSemaphoreGive(buffer_mutex);
+        return 0;
+    }
+    if (count > available_count - start_idx) {
+        count = available_count - start_idx;
+    }
+
+    // At most two contiguous runs per column
+    uint32_t slot = (buffer->tail_slot + start_idx) % DATA_BUFFER_SIZE;
+    uint32_t done = 0;
+    while (done < count) {
+        uint32_t run = DATA_BUFFER_SIZE - slot;
+        if (run > count - done) {
+            run = count - done;
+        }
+        memcpy(&x[done], &buffer->accel_x[slot], run * sizeof(int16_t));
+        memcpy(&y[done], &buffer->accel_y[slot], run * sizeof(int16_t));
+        memcpy(&z[done], &buffer->accel_z[slot], run * sizeof(int16_t));
+        done += run;
+        slot = 0;
+    }
+
+    xSemaphoreGive(buffer_mutex);
+    return count;
+}
+
 esp_err_t data_buffer_get_stats(buffer_stats_t *stats)
 {
     if (stats == NULL) {
@@ -187,9 +499,13 @@ esp_err_t data_buffer_get_stats(buffer_stats_t *stats)
         return ESP_ERR_TIMEOUT;
     }
     
-    *stats = buffer.stats;
+    *stats = buffer->stats;
     
     xSemaphoreGive(buffer_mutex);
+    
+    stats->latest_reads = atomic_load_explicit(&latest_reads, memory_order_relaxed);
+    stats->latest_read_retries = atomic_load_explicit(&latest_read_retries, memory_order_relaxed);
+    stats->latest_read_fallbacks = atomic_load_explicit(&latest_read_fallbacks, memory_order_relaxed);
     return ESP_OK;
 }
 
@@ -199,10 +515,12 @@ esp_err_t data_buffer_clear(void)
         return ESP_ERR_TIMEOUT;
     }
     
-    buffer.head = 0;
-    buffer.tail = 0;
-    buffer.count = 0;
-    buffer.full = false;
+    buffer->tail_seq = buffer->head_seq;
+    buffer->tail_slot = 0;
+    buffer->kf_head = 0;
+    buffer->kf_count = 0;
+    buffer->since_keyframe = 0;
+    publish_latest_locked(NULL);
     
     xSemaphoreGive(buffer_mutex);
     return ESP_OK;
@@ -214,7 +532,7 @@ uint32_t data_buffer_get_count(void)
         return 0;
     }
     
-    uint32_t count = buffer.full ? DATA_BUFFER_SIZE : buffer.count;
+    uint32_t count = buffer_count();
     xSemaphoreGive(buffer_mutex);
     return count;
 }
@@ -225,7 +543,7 @@ bool data_buffer_is_full(void)
         return false;
     }
     
-    bool full = buffer.full;
+    bool full = (buffer_count() == DATA_BUFFER_SIZE);
     xSemaphoreGive(buffer_mutex);
     return full;
 }
@@ -236,7 +554,7 @@ bool data_buffer_is_empty(void)
         return true;
     }
     
-    bool empty = (buffer.count == 0 && !buffer.full);
+    bool empty = (buffer_count() == 0);
     xSemaphoreGive(buffer_mutex);
     return empty;
 }
@@ -256,21 +574,29 @@ esp_err_t data_buffer_export_json(char *json_buffer, size_t buffer_size, uint32_
     cJSON *stats = cJSON_CreateObject();
     
     // Add statistics
-    cJSON_AddNumberToObject(stats, "total_samples", buffer.stats.total_samples);
-    cJSON_AddNumberToObject(stats, "dropped_samples", buffer.stats.dropped_samples);
-    cJSON_AddNumberToObject(stats, "buffer_overflows", buffer.stats.buffer_overflows);
-    cJSON_AddNumberToObject(stats, "last_timestamp_us", buffer.stats.last_timestamp_us);
-    cJSON_AddNumberToObject(stats, "avg_processing_time_us", buffer.stats.avg_processing_time_us);
+    cJSON_AddNumberToObject(stats, "total_samples", buffer->stats.total_samples);
+    cJSON_AddNumberToObject(stats, "dropped_samples", buffer->stats.dropped_samples);
+    cJSON_AddNumberToObject(stats, "buffer_overflows", buffer->stats.buffer_overflows);
+    cJSON_AddNumberToObject(stats, "last_timestamp_us", buffer->stats.last_timestamp_us);
+    cJSON_AddNumberToObject(stats, "avg_processing_time_us", buffer->stats.avg_processing_time_us);
     cJSON_AddItemToObject(root, "statistics", stats);
     
     // Add samples
-    uint32_t available_count = buffer.full ? DATA_BUFFER_SIZE : buffer.count;
+    uint32_t available_count = buffer_count();
     uint32_t export_count = (max_samples > 0 && max_samples < available_count) ? 
                            max_samples : available_count;
     
+    cursor_t cursor;
+    imu_data_t decoded;
+    imu_data_t *data = &decoded;
+    if (export_count > 0) {
+        cursor_seek_locked(&cursor, buffer->tail_seq);
+    }
     for (uint32_t i = 0; i < export_count; i++) {
-        uint32_t idx = (buffer.tail + i) % DATA_BUFFER_SIZE;
-        imu_data_t *data = &buffer.data[idx];
+        if (i > 0) {
+            cursor_step_locked(&cursor);
+        }
+        cursor_read_locked(&cursor, &decoded);
 
         cJSON *sample = cJSON_CreateObject();
         cJSON_AddNumberToObject(sample, "timestamp_us", data->timestamp_us);
@@ -340,13 +666,21 @@ esp_err_t data_buffer_export_csv(char *csv_buffer, size_t buffer_size, uint32_t
     }
     
     // Add data rows
-    uint32_t available_count = buffer.full ? DATA_BUFFER_SIZE : buffer.count;
+    uint32_t available_count = buffer_count();
     uint32_t export_count = (max_samples > 0 && max_samples < available_count) ? 
                            max_samples : available_count;
     
+    cursor_t cursor;
+    imu_data_t decoded;
+    const imu_data_t *data = &decoded;
+    if (export_count > 0) {
+        cursor_seek_locked(&cursor, buffer->tail_seq);
+    }
     for (uint32_t i = 0; i < export_count; i++) {
-        uint32_t idx = (buffer.tail + i) % DATA_BUFFER_SIZE;
-        imu_data_t *data = &buffer.data[idx];
+        if (i > 0) {
+            cursor_step_locked(&cursor);
+        }
+        cursor_read_locked(&cursor, &decoded);
         
         float ax_g = data->accelerometer.valid ? data->accelerometer.x_g : 0.0f;
         float ay_g = data->accelerometer.valid ? data->accelerometer.y_g : 0.0f;
@@ -7,8 +7,12 @@
 #include <stdbool.h>
 
 // Buffer configuration
-#define DATA_BUFFER_SIZE 1000  // Number of samples to keep in buffer
+#define DATA_BUFFER_SIZE 3840  // Number of samples to keep in buffer (~48 KB, columnar)
 #define DATA_BUFFER_OVERWRITE true  // Overwrite oldest data when full
+#define DATA_BUFFER_ACCEL_LSB_PER_G 2048  // Stored accel resolution (int16, +/-16 g)
+#define DATA_BUFFER_KEYFRAME_INTERVAL 64  // Absolute timestamp at least every N entries
+#define DATA_BUFFER_EXTRA_KEYFRAMES 32  // Headroom for gaps/ODR changes between periodic keyframes
+#define DATA_BUFFER_LATEST_MAX_RETRIES 4  // Lock-free latest reads before falling back to the mutex
 
 // Statistics structure
 typedef struct {
@@ -17,14 +21,20 @@ typedef struct {
     uint32_t buffer_overflows;
     uint64_t last_timestamp_us;
     float avg_processing_time_us;
+    uint32_t latest_reads;          // data_buffer_get_latest() calls served lock-free
+    uint32_t latest_read_retries;   // Snapshot copies discarded because the writer reused the slot
+    uint32_t latest_read_fallbacks; // Reads that gave up retrying and took the mutex
 } buffer_stats_t;
 
 // Data buffer API
 esp_err_t data_buffer_init(void);
 esp_err_t data_buffer_add(const imu_data_t *data);
 esp_err_t data_buffer_get(imu_data_t *data);
+// Lock-free: never blocks data_buffer_add(), returns the last sample added at full precision
 esp_err_t data_buffer_get_latest(imu_data_t *data);
 esp_err_t data_buffer_get_range(imu_data_t *data, uint32_t start_idx, uint32_t count);
+// Native columnar read: raw accel columns (DATA_BUFFER_ACCEL_LSB_PER_G) without decoding
+uint32_t data_buffer_get_accel_columns(int16_t *x, int16_t *y, int16_t *z, uint32_t start_idx, uint32_t count);
 esp_err_t data_buffer_get_stats(buffer_stats_t *stats);
 esp_err_t data_buffer_clear(void);
 uint32_t data_buffer_get_count(void);
@@ -0,0 +1,379 @@
+#include "duty_cycle.h"
+#include "imu_manager.h"
+#include "capture.h"
+#include "mem_arena.h"
+#include "pipeline.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+static const char *TAG = "DUTY";
+
+// Window accumulator, filled by the raw listener while capturing
+typedef struct {
+    int64_t sum[3];
+    int64_t sum_sq[3];
+    int16_t min[3];
+    int16_t max[3];
+    uint32_t samples;
+    uint32_t skipped;           // Samples at a different full scale than the window start
+    uint8_t full_scale_g;
+    float odr_hz;
+    uint64_t first_us;
+    uint64_t last_us;
+} duty_window_t;
+
+static portMUX_TYPE duty_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t duty_mutex = NULL;
+static TaskHandle_t duty_task_handle = NULL;
+
+static duty_config_t config = {
+    .enabled = false,
+    .interval_s = DUTY_DEFAULT_INTERVAL_S,
+    .window_ms = DUTY_DEFAULT_WINDOW_MS,
+    .store_raw = false,
+};
+static volatile bool capturing = false;
+static duty_window_t window;
+static int16_t *raw_buf = NULL;
+static uint32_t raw_count = 0;
+
+static duty_status_t metrics;
+static int64_t enabled_at_us = 0;
+static int64_t sensor_on_us = 0;
+static duty_result_t results[DUTY_RESULT_HISTORY];
+static uint32_t result_total = 0;
+
+static void duty_sink(const pipeline_block_t *block, void *ctx)
+{
+    (void)ctx;
+    if (!capturing) {
+        return;
+    }
+
+    const int16_t *xyz = block->xyz;
+    const uint16_t count = block->count;
+    const imu_manager_full_scale_t scale = block->scale;
+    const float odr_hz = block->odr_hz;
+    const uint64_t timestamp_us = block->timestamp_us;
+
+    if (window.samples == 0 && window.skipped == 0) {
+        window.full_scale_g = (uint8_t)scale;
+        window.odr_hz = odr_hz;
+        window.first_us = timestamp_us - (uint64_t)((float)(count - 1) * 1e6f / odr_hz);
+    }
+    if ((uint8_t)scale != window.full_scale_g) {
+        window.skipped += count;
+        return;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        for (int axis = 0; axis < 3; axis++) {
+            const int16_t v = xyz[i * 3 + axis];
+            window.sum[axis] += v;
+            window.sum_sq[axis] += (int32_t)v * v;
+            if (v < window.min[axis]) {
+                window.min[axis] = v;
+            }
+            if (v > window.max[axis]) {
+                window.max[axis] = v;
+            }
+        }
+    }
+
+    if (raw_buf != NULL && raw_count < DUTY_RAW_MAX_SAMPLES) {
+        uint32_t n = DUTY_RAW_MAX_SAMPLES - raw_count;
+        if (n > count) {
+            n = count;
+        }
+        memcpy(&raw_buf[raw_count * 3], xyz, n * CAPTURE_SAMPLE_BYTES);
+        raw_count += n;
+    }
+
+    window.samples += count;
+    window.last_us = timestamp_us;
+}
+
+static void window_reset(void)
+{
+    memset(&window, 0, sizeof(window));
+    for (int axis = 0; axis < 3; axis++) {
+        window.min[axis] = INT16_MAX;
+        window.max[axis] = INT16_MIN;
+    }
+    raw_count = 0;
+}
+
+static void compute_features(const duty_window_t *w, duty_result_t *result)
+{
+    const float lsb_to_g = (float)w->full_scale_g / 32768.0f;
+
+    for (int axis = 0; axis < 3; axis++) {
+        duty_axis_features_t *f = &result->axis[axis];
+        if (w->samples == 0) {
+            memset(f, 0, sizeof(*f));
+            continue;
+        }
+
+        const double mean = (double)w->sum[axis] / w->samples;
+        const double var = (double)w->sum_sq[axis] / w->samples - mean * mean;
+        const double peak = fmax(w->max[axis] - mean, mean - w->min[axis]);
+
+        f->mean_g = (float)mean * lsb_to_g;
+        f->rms_g = (float)sqrt(var > 0.0 ? var : 0.0) * lsb_to_g;
+        f->peak_g = (float)peak * lsb_to_g;
+        f->p2p_g = (float)(w->max[axis] - w->min[axis]) * lsb_to_g;
+        f->crest = f->rms_g > 0.0f ? f->peak_g / f->rms_g : 0.0f;
+    }
+}
+
+static bool store_raw_window(const duty_window_t *w, uint32_t slot, duty_result_t *result)
+{
+    snprintf(result->raw_file, sizeof(result->raw_file), "duty_%lu.cap",
+             (unsigned long)(slot % DUTY_RAW_FILES));
+    char path[48];
+    snprintf(path, sizeof(path), DUTY_BASE_PATH "/%s", result->raw_file);
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        ESP_LOGW(TAG, "Cannot create %s", path);
+        return false;
+    }
+
+    capture_header_t hdr;
+    capture_header_init(&hdr, w->odr_hz, w->full_scale_g, w->first_us);
+    hdr.sample_count = raw_count;
+    bool ok = capture_write_header(file, &hdr) == ESP_OK &&
+              fwrite(raw_buf, CAPTURE_SAMPLE_BYTES, raw_count, file) == raw_count;
+    fclose(file);
+
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to write %s", path);
+        remove(path);
+    }
+    return ok;
+}
+
+static void run_slot(uint32_t slot, const duty_config_t *cfg)
+{
+    if (cfg->store_raw && raw_buf == NULL) {
+        raw_buf = malloc(DUTY_RAW_MAX_SAMPLES * CAPTURE_SAMPLE_BYTES);
+        if (raw_buf == NULL) {
+            ESP_LOGW(TAG, "No memory for the raw window, storing features only");
+        } else {
+            mem_arena_note_heap(MEM_SUBSYS_DUTY, DUTY_RAW_MAX_SAMPLES * CAPTURE_SAMPLE_BYTES);
+        }
+    }
+
+    const int64_t on_start = esp_timer_get_time();
+    imu_manager_set_power(true);
+    vTaskDelay(pdMS_TO_TICKS(DUTY_SETTLE_MS));
+
+    taskENTER_CRITICAL(&duty_lock);
+    window_reset();
+    capturing = true;
+    taskEXIT_CRITICAL(&duty_lock);
+
+    vTaskDelay(pdMS_TO_TICKS(cfg->window_ms));
+
+    taskENTER_CRITICAL(&duty_lock);
+    capturing = false;
+    const duty_window_t snapshot = window;
+    taskEXIT_CRITICAL(&duty_lock);
+
+    imu_manager_set_power(false);
+    const int64_t on_us = esp_timer_get_time() - on_start;
+
+    duty_result_t result = {0};
+    result.slot = slot;
+    result.timestamp_us = snapshot.first_us;
+    result.samples = snapshot.samples;
+    result.odr_hz = snapshot.odr_hz;
+    result.full_scale_g = snapshot.full_scale_g;
+    result.duration_s = snapshot.samples > 0 && snapshot.odr_hz > 0.0f
+                            ? (float)snapshot.samples / snapshot.odr_hz
+                            : 0.0f;
+    compute_features(&snapshot, &result);
+
+    if (cfg->store_raw && raw_buf != NULL && raw_count > 0) {
+        result.raw_stored = store_raw_window(&snapshot, slot, &result);
+    }
+    if (!result.raw_stored) {
+        result.raw_file[0] = '\0';
+    }
+
+    xSemaphoreTake(duty_mutex, portMAX_DELAY);
+    results[result_total % DUTY_RESULT_HISTORY] = result;
+    result_total++;
+    sensor_on_us += on_us;
+    metrics.slots_completed++;
+    if (result.raw_stored) {
+        metrics.raw_files_written++;
+    }
+    xSemaphoreGive(duty_mutex);
+
+    ESP_LOGI(TAG, "Slot %lu: %lu samples, rms x/y/z = %.4f/%.4f/%.4f g%s",
+             (unsigned long)slot, (unsigned long)result.samples,
+             result.axis[0].rms_g, result.axis[1].rms_g, result.axis[2].rms_g,
+             result.raw_stored ? ", raw stored" : "");
+}
+
+static void apply_idle_policy(bool enabled)
+{
+    // Between slots the sensor is powered down and the radio drops to max modem sleep
+    imu_manager_set_power(!enabled);
+    esp_err_t ret = esp_wifi_set_ps(enabled ? WIFI_PS_MAX_MODEM : WIFI_PS_MIN_MODEM);
+    metrics.radio_power_save = enabled && ret == ESP_OK;
+}
+
+static void duty_task(void *arg)
+{
+    uint32_t slot = 0;
+    int64_t next_slot_us = 0;
+    bool was_enabled = false;
+    metrics_register_task(NULL);
+
+    while (1) {
+        xSemaphoreTake(duty_mutex, portMAX_DELAY);
+        const duty_config_t cfg = config;
+        xSemaphoreGive(duty_mutex);
+
+        if (cfg.enabled != was_enabled) {
+            apply_idle_policy(cfg.enabled);
+            was_enabled = cfg.enabled;
+            next_slot_us = esp_timer_get_time();    // First slot right away
+        }
+
+        if (!cfg.enabled) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        const int64_t now = esp_timer_get_time();
+        if (now < next_slot_us) {
+            int64_t wait_ms = (next_slot_us - now) / 1000;
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms > 1000 ? 1000 : (wait_ms > 0 ? wait_ms : 1)));
+            continue;
+        }
+
+        metrics.capturing = true;
+        run_slot(slot++, &cfg);
+        metrics.capturing = false;
+
+        next_slot_us += (int64_t)cfg.interval_s * 1000000;
+        const int64_t done = esp_timer_get_time();
+        if (next_slot_us <= done) {
+            metrics.slots_late++;
+            next_slot_us = done + (int64_t)cfg.interval_s * 1000000;
+        }
+        metrics.next_slot_us = (uint64_t)next_slot_us;
+    }
+}
+
+esp_err_t duty_cycle_init(void)
+{
+    if (duty_mutex != NULL) {
+        return ESP_OK;
+    }
+
+    duty_mutex = xSemaphoreCreateMutex();
+    if (duty_mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to create duty-cycle mutex");
+        return ESP_FAIL;
+    }
+
+    memset(&metrics, 0, sizeof(metrics));
+    window_reset();
+
+    if (xTaskCreate(duty_task, "duty_cycle", DUTY_TASK_STACK_SIZE, NULL,
+                    DUTY_TASK_PRIORITY, &duty_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create duty-cycle task");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = pipeline_add_sink(DUTY_SINK_NAME, duty_sink, NULL, NULL);
+    if (ret == ESP_OK) {
+        ret = pipeline_connect(PIPELINE_SOURCE_IMU, DUTY_SINK_NAME);
+    }
+    return ret;
+}
+
+esp_err_t duty_cycle_configure(const duty_config_t *new_config)
+{
+    if (new_config == NULL || new_config->interval_s < DUTY_MIN_INTERVAL_S ||
+        new_config->interval_s > DUTY_MAX_INTERVAL_S ||
+        new_config->window_ms == 0 || new_config->window_ms > DUTY_MAX_WINDOW_MS ||
+        new_config->window_ms + DUTY_SETTLE_MS >= new_config->interval_s * 1000) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (duty_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(duty_mutex, portMAX_DELAY);
+    if (new_config->enabled && !config.enabled) {
+        enabled_at_us = esp_timer_get_time();
+        sensor_on_us = 0;
+        metrics.slots_completed = 0;
+        metrics.slots_late = 0;
+    }
+    config = *new_config;
+    xSemaphoreGive(duty_mutex);
+
+    ESP_LOGI(TAG, "Schedule %s: %lu ms every %lu s%s",
+             new_config->enabled ? "enabled" : "disabled",
+             (unsigned long)new_config->window_ms, (unsigned long)new_config->interval_s,
+             new_config->store_raw ? ", raw stored" : "");
+    xTaskNotifyGive(duty_task_handle);
+    return ESP_OK;
+}
+
+esp_err_t duty_cycle_get_status(duty_status_t *status)
+{
+    if (status == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (duty_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(duty_mutex, portMAX_DELAY);
+    *status = metrics;
+    status->config = config;
+    if (config.enabled) {
+        const float elapsed_s = (float)(esp_timer_get_time() - enabled_at_us) / 1e6f;
+        status->sensor_on_s = (float)sensor_on_us / 1e6f;
+        status->sensor_off_s = elapsed_s > status->sensor_on_s ? elapsed_s - status->sensor_on_s : 0.0f;
+        status->duty_pct = elapsed_s > 0.0f ? 100.0f * status->sensor_on_s / elapsed_s : 0.0f;
+        status->sensor_charge_mah = (status->sensor_on_s * DUTY_SENSOR_ACTIVE_UA +
+                                     status->sensor_off_s * DUTY_SENSOR_POWERDOWN_UA) / 3.6e6f;
+    }
+    xSemaphoreGive(duty_mutex);
+    return ESP_OK;
+}
+
+size_t duty_cycle_get_results(duty_result_t *out, size_t max_results)
+{
+    if (out == NULL || duty_mutex == NULL) {
+        return 0;
+    }
+
+    xSemaphoreTake(duty_mutex, portMAX_DELAY);
+    const uint32_t available = result_total < DUTY_RESULT_HISTORY ? result_total : DUTY_RESULT_HISTORY;
+    const uint32_t n = available < max_results ? available : (uint32_t)max_results;
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = results[(result_total - n + i) % DUTY_RESULT_HISTORY];
+    }
+    xSemaphoreGive(duty_mutex);
+    return n;
+}
@@ -0,0 +1,76 @@
+#ifndef DUTY_CYCLE_H
+#define DUTY_CYCLE_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Duty-cycled capture configuration
+#define DUTY_DEFAULT_INTERVAL_S     300
+#define DUTY_DEFAULT_WINDOW_MS      1000
+#define DUTY_MIN_INTERVAL_S         10
+#define DUTY_MAX_INTERVAL_S         86400   // One slot a day; keeps interval_s * 1000 in 32 bits
+#define DUTY_MAX_WINDOW_MS          5000
+#define DUTY_SETTLE_MS              100     // Sensor turn-on and filter settling, discarded
+#define DUTY_RESULT_HISTORY         24      // Slot results kept in RAM
+#define DUTY_RAW_MAX_SAMPLES        8192    // Raw window stored per slot (48 KB, ~0.3 s at 26.7 kHz)
+#define DUTY_RAW_FILES              4       // duty_0.cap .. duty_3.cap, reused round-robin
+#define DUTY_BASE_PATH              "/spiffs"
+#define DUTY_SINK_NAME              "duty_cycle"    // Pipeline sink, fed by the sensor only
+#define DUTY_TASK_STACK_SIZE        4096
+#define DUTY_TASK_PRIORITY          3
+
+// IIS3DWB supply current (datasheet typical) for the charge estimate
+#define DUTY_SENSOR_ACTIVE_UA       1100.0f
+#define DUTY_SENSOR_POWERDOWN_UA    5.0f
+
+typedef struct {
+    bool enabled;
+    uint32_t interval_s;
+    uint32_t window_ms;
+    bool store_raw;
+} duty_config_t;
+
+typedef struct {
+    float mean_g;
+    float rms_g;                // AC RMS (mean removed)
+    float peak_g;               // Largest deviation from the mean
+    float p2p_g;
+    float crest;                // peak / rms
+} duty_axis_features_t;
+
+typedef struct {
+    uint32_t slot;
+    uint64_t timestamp_us;      // Device time the window started
+    float duration_s;
+    uint32_t samples;
+    float odr_hz;
+    uint8_t full_scale_g;
+    duty_axis_features_t axis[3];
+    bool raw_stored;
+    char raw_file[16];
+} duty_result_t;
+
+typedef struct {
+    duty_config_t config;
+    bool capturing;
+    uint32_t slots_completed;
+    uint32_t slots_late;        // Slots started after the next one was already due
+    uint64_t next_slot_us;
+    float sensor_on_s;          // Since the schedule was enabled
+    float sensor_off_s;
+    float duty_pct;
+    float sensor_charge_mah;    // Estimated from DUTY_SENSOR_*_UA
+    bool radio_power_save;
+    uint32_t raw_files_written;
+} duty_status_t;
+
+// Duty-cycle API
+esp_err_t duty_cycle_init(void);
+esp_err_t duty_cycle_configure(const duty_config_t *config);
+esp_err_t duty_cycle_get_status(duty_status_t *status);
+// Copy up to max_results results, oldest first
+size_t duty_cycle_get_results(duty_result_t *results, size_t max_results);
+
+#endif // DUTY_CYCLE_H
@@ -0,0 +1,363 @@
+#include "golden.h"
+#include "convert.h"
+#include "imu_manager.h"
+#include "pipeline.h"
+#include "ws_frame.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "cJSON.h"
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "GOLDEN";
+
+extern const uint8_t golden_iis3dwb_start[] asm("_binary_iis3dwb_gld_start");
+extern const uint8_t golden_iis3dwb_end[] asm("_binary_iis3dwb_gld_end");
+
+// One case of the embedded file; the arrays point into flash and are unaligned
+typedef struct {
+    golden_case_header_t hdr;
+    const uint8_t *fifo;
+    const uint8_t *raw;
+    const uint8_t *dc;
+    const uint8_t *dec;
+} golden_case_t;
+
+typedef struct {
+    golden_result_t *results;
+    size_t max_results;
+    size_t count;
+    bool passed;
+    float ns_per_cycle;
+} golden_run_t;
+
+// Working buffers live on the heap only for the duration of a run
+static int16_t *decoded;
+static int16_t *stage_out;
+static char *text;
+static pipeline_block_t block_in;
+static pipeline_block_t block_out;
+
+static atomic_flag running = ATOMIC_FLAG_INIT;
+
+static inline int16_t get_i16(const uint8_t *p, size_t index)
+{
+    return (int16_t)(p[index * 2] | (p[index * 2 + 1] << 8));
+}
+
+static esp_err_t parse_case(const uint8_t **pos, const uint8_t *end, golden_case_t *c)
+{
+    if ((size_t)(end - *pos) < sizeof(c->hdr)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(&c->hdr, *pos, sizeof(c->hdr));
+    *pos += sizeof(c->hdr);
+
+    const golden_case_header_t *h = &c->hdr;
+    const size_t fifo_bytes = (size_t)h->fifo_entries * IMU_MANAGER_FIFO_ENTRY_BYTES;
+    const size_t xyz_bytes = (size_t)h->samples * 3 * sizeof(int16_t);
+    const size_t dec_bytes = (size_t)h->decimated * 3 * sizeof(int16_t);
+    if (h->samples > GOLDEN_MAX_SAMPLES || h->decimated > h->samples ||
+        (size_t)(end - *pos) < fifo_bytes + 2 * xyz_bytes + dec_bytes) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    c->fifo = *pos;
+    c->raw = c->fifo + fifo_bytes;
+    c->dc = c->raw + xyz_bytes;
+    c->dec = c->dc + xyz_bytes;
+    *pos = c->dec + dec_bytes;
+    return ESP_OK;
+}
+
+static golden_result_t *begin_result(golden_run_t *run, const golden_case_t *c, const char *stage)
+{
+    if (run->count >= run->max_results) {
+        return NULL;
+    }
+    golden_result_t *r = &run->results[run->count++];
+    memset(r, 0, sizeof(*r));
+    snprintf(r->name, sizeof(r->name), "%.*s/%s", GOLDEN_NAME_LEN, c->hdr.name, stage);
+    return r;
+}
+
+static void end_result(golden_run_t *run, golden_result_t *r, uint64_t cycles)
+{
+    r->ns_per_sample = (r->samples > 0) ? (float)cycles * run->ns_per_cycle / (float)r->samples : 0.0f;
+    r->passed = (r->mismatches == 0);
+    if (!r->passed) {
+        run->passed = false;
+        ESP_LOGW(TAG, "%s: %lu of %lu values differ (max error %g)", r->name,
+                 (unsigned long)r->mismatches, (unsigned long)r->samples, r->max_error);
+    }
+}
+
+// Exact comparison of an int16 stage output; a count mismatch fails every sample
+static void compare_xyz(golden_result_t *r, const int16_t *actual, uint32_t actual_count,
+                        const uint8_t *expected, uint32_t expected_count)
+{
+    r->samples = expected_count;
+    if (actual_count != expected_count) {
+        r->mismatches = (expected_count > 0) ? expected_count : 1;
+        r->max_error = INFINITY;
+        return;
+    }
+    for (uint32_t i = 0; i < expected_count * 3; i++) {
+        const float err = fabsf((float)actual[i] - (float)get_i16(expected, i));
+        if (err > 0.0f) {
+            r->mismatches++;
+        }
+        if (err > r->max_error) {
+            r->max_error = err;
+        }
+    }
+}
+
+static void check_decode(golden_run_t *run, const golden_case_t *c)
+{
+    golden_result_t *r = begin_result(run, c, "fifo_decode");
+    if (r == NULL) {
+        return;
+    }
+    const uint32_t start = esp_cpu_get_cycle_count();
+    const uint16_t n = imu_manager_decode_fifo(c->fifo, c->hdr.fifo_entries, decoded, GOLDEN_MAX_SAMPLES);
+    const uint32_t cycles = esp_cpu_get_cycle_count() - start;
+    compare_xyz(r, decoded, n, c->raw, c->hdr.samples);
+    end_result(run, r, cycles);
+}
+
+static void check_raw_to_g(golden_run_t *run, const golden_case_t *c)
+{
+    golden_result_t *r = begin_result(run, c, "raw_to_g");
+    if (r == NULL) {
+        return;
+    }
+    const convert_kernel_t to_g = convert_get_kernel(c->hdr.full_scale_g);
+    float g[PIPELINE_BLOCK_SAMPLES * 3];
+    uint64_t cycles = 0;
+
+    r->samples = c->hdr.samples;
+    if (to_g == NULL) {
+        // The file claims a full scale the sensor does not have
+        r->mismatches = c->hdr.samples;
+        end_result(run, r, 0);
+        return;
+    }
+
+    for (uint32_t offset = 0; offset < c->hdr.samples; offset += PIPELINE_BLOCK_SAMPLES) {
+        const uint32_t left = c->hdr.samples - offset;
+        const uint32_t n = (left > PIPELINE_BLOCK_SAMPLES ? PIPELINE_BLOCK_SAMPLES : left) * 3;
+        int16_t raw[PIPELINE_BLOCK_SAMPLES * 3];
+        for (uint32_t i = 0; i < n; i++) {
+            raw[i] = get_i16(c->raw, offset * 3 + i);
+        }
+
+        const uint32_t start = esp_cpu_get_cycle_count();
+        to_g(raw, g, n);
+        cycles += esp_cpu_get_cycle_count() - start;
+
+        for (uint32_t i = 0; i < n; i++) {
+            const float expected = (float)raw[i] * c->hdr.sensitivity_g;
+            const float err = fabsf(g[i] - expected);
+            if (err > GOLDEN_G_TOLERANCE + GOLDEN_G_REL_TOLERANCE * fabsf(expected)) {
+                r->mismatches++;
+            }
+            if (err > r->max_error) {
+                r->max_error = err;
+            }
+        }
+    }
+    end_result(run, r, cycles);
+}
+
+// Feeds `count` samples from `input` through a stage in PIPELINE_BLOCK_SAMPLES
+// blocks, as the acquisition task does; returns the samples collected in stage_out
+static uint32_t run_stage(const char *stage, int32_t param, imu_manager_full_scale_t scale,
+                          const uint8_t *input, uint32_t count, uint64_t *cycles)
+{
+    uint32_t produced = 0;
+    *cycles = 0;
+    block_in.scale = scale;
+    block_in.odr_hz = imu_manager_get_configured_odr();
+
+    for (uint32_t offset = 0; offset < count; offset += PIPELINE_BLOCK_SAMPLES) {
+        const uint32_t left = count - offset;
+        block_in.count = (uint16_t)(left > PIPELINE_BLOCK_SAMPLES ? PIPELINE_BLOCK_SAMPLES : left);
+        for (uint32_t i = 0; i < block_in.count * 3u; i++) {
+            block_in.xyz[i] = get_i16(input, offset * 3 + i);
+        }
+
+        const uint32_t start = esp_cpu_get_cycle_count();
+        const esp_err_t ret = pipeline_stage_run(stage, param, offset == 0, &block_in, &block_out);
+        *cycles += esp_cpu_get_cycle_count() - start;
+        if (ret != ESP_OK) {
+            return UINT32_MAX;
+        }
+        if (produced + block_out.count <= GOLDEN_MAX_SAMPLES) {
+            memcpy(&stage_out[produced * 3], block_out.xyz, block_out.count * 3 * sizeof(int16_t));
+        }
+        produced += block_out.count;
+    }
+    return produced;
+}
+
+static void check_stage(golden_run_t *run, const golden_case_t *c, const char *stage, int32_t param,
+                        const uint8_t *input, uint32_t input_count,
+                        const uint8_t *expected, uint32_t expected_count)
+{
+    golden_result_t *r = begin_result(run, c, stage);
+    if (r == NULL) {
+        return;
+    }
+    uint64_t cycles = 0;
+    const uint32_t produced = run_stage(stage, param, (imu_manager_full_scale_t)c->hdr.full_scale_g,
+                                        input, input_count, &cycles);
+    compare_xyz(r, stage_out, produced, expected, expected_count);
+    r->samples = input_count;
+    end_result(run, r, cycles);
+}
+
+// Compare one "[...]" column of an encoded frame with the expected LSB values
+static void compare_column(golden_result_t *r, const cJSON *column, const uint8_t *expected,
+                           uint32_t first, uint16_t count, int axis, float sensitivity_g)
+{
+    if (!cJSON_IsArray(column) || cJSON_GetArraySize(column) != count) {
+        r->mismatches += count;
+        r->max_error = INFINITY;
+        return;
+    }
+    uint16_t i = 0;
+    const cJSON *item = NULL;
+    cJSON_ArrayForEach(item, column) {
+        const float want = (float)get_i16(expected, (first + i) * 3 + axis) * sensitivity_g;
+        const float err = cJSON_IsNumber(item) ? fabsf((float)item->valuedouble - want) : INFINITY;
+        if (err > GOLDEN_FRAME_TOLERANCE) {
+            r->mismatches++;
+        }
+        if (err > r->max_error) {
+            r->max_error = err;
+        }
+        i++;
+    }
+}
+
+static void check_ws_frame(golden_run_t *run, const golden_case_t *c)
+{
+    golden_result_t *r = begin_result(run, c, "ws_frame");
+    if (r == NULL) {
+        return;
+    }
+    const imu_manager_full_scale_t scale = (imu_manager_full_scale_t)c->hdr.full_scale_g;
+    uint64_t cycles = 0;
+    int16_t xyz[WS_FRAME_MAX_SAMPLES * 3];
+
+    for (uint32_t first = 0; first < c->hdr.decimated; first += WS_FRAME_MAX_SAMPLES) {
+        const uint32_t left = c->hdr.decimated - first;
+        const uint16_t count = (uint16_t)(left > WS_FRAME_MAX_SAMPLES ? WS_FRAME_MAX_SAMPLES : left);
+        for (uint32_t i = 0; i < count * 3u; i++) {
+            xyz[i] = get_i16(c->dec, first * 3 + i);
+        }
+        const ws_frame_t frame = {
+            .seq = first,
+            .timestamp_us = first,
+            .xyz = xyz,
+            .count = count,
+            .lsb_to_g = pipeline_lsb_to_g(scale),
+            .full_scale_g = c->hdr.full_scale_g,
+        };
+
+        const uint32_t start = esp_cpu_get_cycle_count();
+        const int len = ws_frame_encode(text, WS_FRAME_BUFFER_SIZE, &frame);
+        cycles += esp_cpu_get_cycle_count() - start;
+
+        cJSON *json = (len > 0) ? cJSON_ParseWithLength(text, (size_t)len) : NULL;
+        const cJSON *chunks = cJSON_GetObjectItem(json, "chunks");
+        const cJSON *fs = cJSON_GetObjectItem(json, "fs");
+        if (!cJSON_IsNumber(fs) || fs->valueint != c->hdr.full_scale_g) {
+            r->mismatches++;
+        }
+        static const char *const axes[3] = { "x", "y", "z" };
+        for (int axis = 0; axis < 3; axis++) {
+            compare_column(r, cJSON_GetObjectItem(chunks, axes[axis]), c->dec, first, count, axis,
+                           c->hdr.sensitivity_g);
+        }
+        cJSON_Delete(json);
+    }
+    r->samples = c->hdr.decimated;
+    end_result(run, r, cycles);
+}
+
+esp_err_t golden_run(golden_result_t *results, size_t max_results, size_t *count, bool *passed)
+{
+    if (results == NULL || count == NULL || passed == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (atomic_flag_test_and_set(&running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    golden_run_t run = {
+        .results = results,
+        .max_results = max_results,
+        .count = 0,
+        .passed = true,
+        .ns_per_cycle = 1000.0f / (float)esp_rom_get_cpu_ticks_per_us(),
+    };
+
+    decoded = malloc(GOLDEN_MAX_SAMPLES * 3 * sizeof(int16_t));
+    stage_out = malloc(GOLDEN_MAX_SAMPLES * 3 * sizeof(int16_t));
+    text = malloc(WS_FRAME_BUFFER_SIZE);
+
+    esp_err_t ret = ESP_OK;
+    golden_file_header_t file = {0};
+    const uint8_t *pos = golden_iis3dwb_start;
+    const uint8_t *end = golden_iis3dwb_end;
+    if (decoded == NULL || stage_out == NULL || text == NULL) {
+        ret = ESP_ERR_NO_MEM;
+    } else if ((size_t)(end - pos) < sizeof(file)) {
+        ret = ESP_ERR_INVALID_SIZE;
+    } else {
+        memcpy(&file, pos, sizeof(file));
+        pos += sizeof(file);
+        if (file.magic != GOLDEN_MAGIC || file.version != GOLDEN_VERSION) {
+            ret = ESP_ERR_INVALID_VERSION;
+        }
+    }
+
+    for (uint16_t i = 0; ret == ESP_OK && i < file.case_count; i++) {
+        golden_case_t c;
+        ret = parse_case(&pos, end, &c);
+        if (ret != ESP_OK) {
+            break;
+        }
+        check_decode(&run, &c);
+        check_raw_to_g(&run, &c);
+        check_stage(&run, &c, PIPELINE_STAGE_DC_BLOCK, c.hdr.dc_shift, c.raw, c.hdr.samples,
+                    c.dc, c.hdr.samples);
+        check_stage(&run, &c, PIPELINE_STAGE_DECIMATE, c.hdr.decimate, c.dc, c.hdr.samples,
+                    c.dec, c.hdr.decimated);
+        check_ws_frame(&run, &c);
+    }
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "%u cases, %u checks: %s", (unsigned int)file.case_count, (unsigned int)run.count,
+                 run.passed ? "all match" : "MISMATCH");
+    } else {
+        ESP_LOGE(TAG, "Golden run failed: %s", esp_err_to_name(ret));
+    }
+    *count = run.count;
+    *passed = run.passed && ret == ESP_OK;
+
+    free(decoded);
+    free(stage_out);
+    free(text);
+    decoded = NULL;
+    stage_out = NULL;
+    text = NULL;
+    atomic_flag_clear(&running);
+    return ret;
+}
@@ -0,0 +1,66 @@
+#ifndef GOLDEN_H
+#define GOLDEN_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Golden-data regression check of the signal path. Recorded (or generated) IIS3DWB
+// FIFO streams embedded in the firmware go through the real FIFO decoder, raw-to-g
+// conversion, dc_block and decimate stages and the WebSocket frame encoder; every
+// output is compared against the expected values stored next to the input, which
+// tools/golden_gen.py computes with an independent reference model. Integer stages
+// must match exactly; float outputs within the tolerances below.
+//
+// File format (.gld), little-endian, no alignment:
+//   golden_file_header_t
+//   case_count x { golden_case_header_t,
+//                  fifo_entries x IMU_MANAGER_FIFO_ENTRY_BYTES FIFO words,
+//                  samples x 3 int16     decoded x,y,z,
+//                  samples x 3 int16     dc_block output,
+//                  decimated x 3 int16   decimate output (fed by dc_block) }
+#define GOLDEN_MAGIC            0x4E444C47u     // "GLDN"
+#define GOLDEN_VERSION          1
+#define GOLDEN_NAME_LEN         16
+#define GOLDEN_MAX_SAMPLES      2048            // Per case
+#define GOLDEN_MAX_RESULTS      30              // 5 checks per case
+#define GOLDEN_G_TOLERANCE      1e-6f           // Absolute, g; float rounding of lsb * sensitivity
+#define GOLDEN_G_REL_TOLERANCE  1e-5f           // Relative, on top of the absolute tolerance
+#define GOLDEN_FRAME_TOLERANCE  1.1e-5f         // g; frames print %.5f
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t case_count;
+} golden_file_header_t;
+
+typedef struct __attribute__((packed)) {
+    char name[GOLDEN_NAME_LEN];
+    uint8_t full_scale_g;
+    uint8_t dc_shift;           // dc_block parameter
+    uint8_t decimate;           // decimate parameter
+    uint8_t reserved;
+    uint16_t fifo_entries;
+    uint16_t samples;           // Accelerometer words among the FIFO entries
+    uint16_t decimated;
+    uint16_t reserved2;
+    float sensitivity_g;        // Datasheet g/LSB at full_scale_g
+} golden_case_header_t;
+
+typedef struct {
+    char name[GOLDEN_NAME_LEN + 12];    // "<case>/<stage>"
+    uint32_t samples;
+    uint32_t mismatches;
+    float max_error;            // LSB for integer stages, g for float stages
+    float ns_per_sample;
+    bool passed;
+} golden_result_t;
+
+// Golden API
+// Runs every embedded case in the calling task. Returns ESP_ERR_INVALID_STATE if a
+// run is already in progress and ESP_ERR_INVALID_SIZE if the embedded file is
+// malformed; a failed comparison still returns ESP_OK with *passed false.
+esp_err_t golden_run(golden_result_t *results, size_t max_results, size_t *count, bool *passed);
+
+#endif // GOLDEN_H
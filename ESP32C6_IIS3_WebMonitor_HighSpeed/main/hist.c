@@ -0,0 +1,85 @@
+#include "hist.h"
+#include <string.h>
+
+#define HIST_SUB_COUNT      (1U << HIST_SUB_BITS)
+
+void hist_reset(hist_t *h)
+{
+    memset(h, 0, sizeof(*h));
+    h->min = UINT32_MAX;
+}
+
+size_t hist_bucket_index(uint32_t value)
+{
+    if (value > HIST_VALUE_MAX) {
+        value = HIST_VALUE_MAX;
+    }
+    if (value < HIST_SUB_COUNT) {
+        return value;
+    }
+    // value >> shift keeps the top HIST_SUB_BITS + 1 bits, in [SUB_COUNT, 2 * SUB_COUNT)
+    const uint32_t shift = (uint32_t)(31 - __builtin_clz(value)) - HIST_SUB_BITS;
+    return (size_t)(shift * HIST_SUB_COUNT + (value >> shift));
+}
+
+uint32_t hist_bucket_low(size_t index)
+{
+    if (index < HIST_SUB_COUNT) {
+        return (uint32_t)index;
+    }
+    const uint32_t shift = (uint32_t)(index / HIST_SUB_COUNT) - 1;
+    const uint32_t mantissa = (uint32_t)(index % HIST_SUB_COUNT) + HIST_SUB_COUNT;
+    return mantissa << shift;
+}
+
+uint32_t hist_bucket_high(size_t index)
+{
+    if (index + 1 >= HIST_BUCKETS) {
+        return UINT32_MAX;
+    }
+    return hist_bucket_low(index + 1) - 1;
+}
+
+void hist_record(hist_t *h, uint32_t value)
+{
+    h->counts[hist_bucket_index(value)]++;
+    h->total++;
+    h->sum += value;
+    if (value < h->min) {
+        h->min = value;
+    }
+    if (value > h->max) {
+        h->max = value;
+    }
+}
+
+uint32_t hist_percentile(const hist_t *h, float pct)
+{
+    if (h->total == 0) {
+        return 0;
+    }
+    if (pct >= 100.0f) {
+        return h->max;
+    }
+
+    // Rank of the wanted value, 1-based: p50 of 4 values is the 2nd
+    uint32_t rank = (uint32_t)((pct / 100.0f) * (float)h->total + 0.999f);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (size_t i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->counts[i];
+        if (seen >= rank) {
+            const uint32_t high = hist_bucket_high(i);
+            return (high < h->max) ? high : h->max;
+        }
+    }
+    return h->max;
+}
+
+float hist_mean(const hist_t *h)
+{
+    return (h->total > 0) ? (float)h->sum / (float)h->total : 0.0f;
+}
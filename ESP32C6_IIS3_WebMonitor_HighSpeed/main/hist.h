@@ -0,0 +1,37 @@
+#ifndef HIST_H
+#define HIST_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Log-linear (HDR-style) histogram of unsigned values. Values below
+// 2^HIST_SUB_BITS get one bucket each; above that every power of two is split into
+// 2^HIST_SUB_BITS equal buckets, so a bucket never spans more than 12.5% of its
+// lower bound. Recording is a count-leading-zeros and two increments; there is no
+// locking, callers serialise writers and copy the struct to read a snapshot.
+#define HIST_SUB_BITS       3
+#define HIST_MAX_BITS       24      // Values >= 2^24 (16.7 s in us) land in the last bucket
+#define HIST_BUCKETS        ((HIST_MAX_BITS - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+#define HIST_VALUE_MAX      ((1UL << HIST_MAX_BITS) - 1)
+
+typedef struct {
+    uint32_t counts[HIST_BUCKETS];
+    uint32_t total;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} hist_t;
+
+// Histogram API
+void hist_reset(hist_t *h);
+void hist_record(hist_t *h, uint32_t value);
+// Smallest bucket upper bound at or below which pct percent of the values fall,
+// clamped to the recorded max; 0 when empty
+uint32_t hist_percentile(const hist_t *h, float pct);
+float hist_mean(const hist_t *h);
+size_t hist_bucket_index(uint32_t value);
+// Inclusive value range of a bucket
+uint32_t hist_bucket_low(size_t index);
+uint32_t hist_bucket_high(size_t index);
+
+#endif // HIST_H
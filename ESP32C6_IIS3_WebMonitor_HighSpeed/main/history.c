@@ -0,0 +1,466 @@
+#include "history.h"
+#include "mem_arena.h"
+#include "pipeline.h"
+#include "metrics.h"
+#include "imu_manager.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_spiffs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+static const char *TAG = "HISTORY";
+
+#define HISTORY_FILE_MAGIC      0x54534948u  // "HIST"
+#define HISTORY_FILE_VERSION    1
+#define HISTORY_TMP_PATH        "/spiffs/history.tmp"
+#define HISTORY_IO_ENTRIES      256
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t tier_count;
+    uint32_t count[HISTORY_TIER_COUNT];     // Entries stored per tier, oldest first
+} history_file_header_t;
+
+// Running aggregate of raw samples for one base period (units: raw LSB * full scale)
+typedef struct {
+    uint64_t period;
+    uint64_t sum;
+    uint64_t sum_sq;
+    uint32_t min;
+    uint32_t max;
+    uint32_t count;
+} history_sample_acc_t;
+
+// Running aggregate of child entries for one upper-tier period
+typedef struct {
+    uint64_t sum_mean;
+    uint64_t sum_rms_sq;
+    uint16_t min;
+    uint16_t max;
+    uint16_t valid;
+    uint16_t children;
+} history_entry_acc_t;
+
+typedef struct {
+    history_entry_t *ring;
+    uint32_t capacity;
+    uint32_t period_s;
+    uint32_t ratio;             // Children per entry (tier 0: none)
+    uint32_t total;
+    uint64_t last_end_us;
+    history_entry_acc_t acc;
+} history_tier_t;
+
+static history_tier_t tiers[HISTORY_TIER_COUNT];
+static history_sample_acc_t sample_acc;
+static portMUX_TYPE history_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t checkpoint_mutex = NULL;
+static volatile bool history_ready = false;
+static history_status_t status;
+static history_entry_t io_buf[HISTORY_IO_ENTRIES];
+
+static const history_entry_t gap_entry = {
+    .min_mg = HISTORY_GAP, .max_mg = 0, .mean_mg = 0, .rms_mg = 0
+};
+
+static inline uint32_t isqrt32(uint32_t v)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static inline uint16_t scaled_to_mg(double scaled)
+{
+    const double mg = scaled * 1000.0 / 32768.0;
+    return mg >= (double)(HISTORY_GAP - 1) ? (uint16_t)(HISTORY_GAP - 1) : (uint16_t)(mg + 0.5);
+}
+
+static void entry_acc_reset(history_entry_acc_t *acc)
+{
+    memset(acc, 0, sizeof(*acc));
+    acc->min = HISTORY_GAP;
+}
+
+static void tier_push(uint8_t t, const history_entry_t *entry, uint64_t end_us)
+{
+    history_tier_t *tier = &tiers[t];
+
+    taskENTER_CRITICAL(&history_lock);
+    tier->ring[tier->total % tier->capacity] = *entry;
+    tier->total++;
+    tier->last_end_us = end_us;
+    taskEXIT_CRITICAL(&history_lock);
+
+    if (t + 1 >= HISTORY_TIER_COUNT) {
+        return;
+    }
+
+    history_tier_t *parent = &tiers[t + 1];
+    history_entry_acc_t *acc = &parent->acc;
+    if (entry->min_mg != HISTORY_GAP) {
+        if (entry->min_mg < acc->min) {
+            acc->min = entry->min_mg;
+        }
+        if (entry->max_mg > acc->max) {
+            acc->max = entry->max_mg;
+        }
+        acc->sum_mean += entry->mean_mg;
+        acc->sum_rms_sq += (uint64_t)entry->rms_mg * entry->rms_mg;
+        acc->valid++;
+    }
+
+    if (++acc->children < parent->ratio) {
+        return;
+    }
+
+    history_entry_t up = gap_entry;
+    if (acc->valid > 0) {
+        up.min_mg = acc->min;
+        up.max_mg = acc->max;
+        up.mean_mg = (uint16_t)(acc->sum_mean / acc->valid);
+        up.rms_mg = (uint16_t)sqrt((double)acc->sum_rms_sq / acc->valid);
+    }
+    entry_acc_reset(acc);
+    tier_push(t + 1, &up, end_us);
+}
+
+static void close_base_period(uint64_t next_period, uint64_t end_us)
+{
+    history_entry_t entry = gap_entry;
+    if (sample_acc.count > 0) {
+        entry.min_mg = scaled_to_mg(sample_acc.min);
+        entry.max_mg = scaled_to_mg(sample_acc.max);
+        entry.mean_mg = scaled_to_mg((double)sample_acc.sum / sample_acc.count);
+        entry.rms_mg = scaled_to_mg(sqrt((double)sample_acc.sum_sq / sample_acc.count));
+    }
+    tier_push(0, &entry, end_us);
+
+    // Periods without any sample (sensor stalled, replay paused) become gaps
+    uint64_t missing = next_period - sample_acc.period - 1;
+    if (missing > tiers[0].capacity) {
+        missing = tiers[0].capacity;
+    }
+    for (uint64_t i = 0; i < missing; i++) {
+        tier_push(0, &gap_entry, end_us);
+    }
+
+    memset(&sample_acc, 0, sizeof(sample_acc));
+    sample_acc.min = UINT32_MAX;
+    sample_acc.period = next_period;
+}
+
+static void history_sink(const pipeline_block_t *block, void *ctx)
+{
+    (void)ctx;
+    if (!history_ready || block->count == 0) {
+        return;
+    }
+
+    const int16_t *xyz = block->xyz;
+    const uint16_t count = block->count;
+    const uint64_t timestamp_us = block->timestamp_us;
+
+    const uint64_t period = timestamp_us / (HISTORY_TIER0_PERIOD_S * 1000000ULL);
+    if (period > sample_acc.period) {
+        close_base_period(period, timestamp_us);
+    }
+
+    const uint32_t fs = (uint32_t)block->scale;
+    for (uint16_t i = 0; i < count; i++) {
+        const int32_t x = xyz[i * 3 + 0];
+        const int32_t y = xyz[i * 3 + 1];
+        const int32_t z = xyz[i * 3 + 2];
+        const uint32_t mag = isqrt32((uint32_t)(x * x) + (uint32_t)(y * y) + (uint32_t)(z * z)) * fs;
+
+        sample_acc.sum += mag;
+        sample_acc.sum_sq += (uint64_t)mag * mag;
+        if (mag < sample_acc.min) {
+            sample_acc.min = mag;
+        }
+        if (mag > sample_acc.max) {
+            sample_acc.max = mag;
+        }
+    }
+    sample_acc.count += count;
+}
+
+static esp_err_t history_restore_from(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    history_file_header_t hdr;
+    esp_err_t ret = ESP_OK;
+    if (fread(&hdr, sizeof(hdr), 1, file) != 1 || hdr.magic != HISTORY_FILE_MAGIC ||
+        hdr.version != HISTORY_FILE_VERSION || hdr.tier_count != HISTORY_TIER_COUNT) {
+        ret = ESP_ERR_INVALID_VERSION;
+    }
+
+    for (uint8_t t = 0; ret == ESP_OK && t < HISTORY_TIER_COUNT; t++) {
+        // A resized tier keeps its newest entries
+        uint32_t stored = hdr.count[t];
+        uint32_t keep = stored < tiers[t].capacity ? stored : tiers[t].capacity;
+        if (fseek(file, (long)(stored - keep) * (long)sizeof(history_entry_t), SEEK_CUR) != 0 ||
+            fread(tiers[t].ring, sizeof(history_entry_t), keep, file) != keep) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        tiers[t].total = keep;
+    }
+    fclose(file);
+
+    if (ret != ESP_OK) {
+        for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) {
+            tiers[t].total = 0;
+        }
+        return ret;
+    }
+
+    // Mark the reboot so dashboards do not join the two runs
+    for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) {
+        if (tiers[t].total > 0) {
+            tiers[t].ring[tiers[t].total % tiers[t].capacity] = gap_entry;
+            tiers[t].total++;
+        }
+    }
+    return ESP_OK;
+}
+
+// A checkpoint replaces history.bin by remove() then rename(). Power lost between
+// the two leaves only the complete temp file, so fall back to it and put it back
+// in place before the next checkpoint overwrites it.
+static esp_err_t history_restore(const char **restored_from)
+{
+    *restored_from = HISTORY_CHECKPOINT_PATH;
+    esp_err_t ret = history_restore_from(HISTORY_CHECKPOINT_PATH);
+    if (ret != ESP_ERR_NOT_FOUND) {
+        return ret;
+    }
+
+    *restored_from = HISTORY_TMP_PATH;
+    ret = history_restore_from(HISTORY_TMP_PATH);
+    if (ret == ESP_OK && rename(HISTORY_TMP_PATH, HISTORY_CHECKPOINT_PATH) != 0) {
+        ESP_LOGW(TAG, "Restored from %s but could not rename it", HISTORY_TMP_PATH);
+    }
+    return ret;
+}
+
+esp_err_t history_checkpoint(void)
+{
+    if (checkpoint_mutex == NULL || !history_ready) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (xSemaphoreTake(checkpoint_mutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    history_file_header_t hdr = {
+        .magic = HISTORY_FILE_MAGIC,
+        .version = HISTORY_FILE_VERSION,
+        .tier_count = HISTORY_TIER_COUNT,
+    };
+    uint32_t first[HISTORY_TIER_COUNT];
+    taskENTER_CRITICAL(&history_lock);
+    for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) {
+        hdr.count[t] = tiers[t].total < tiers[t].capacity ? tiers[t].total : tiers[t].capacity;
+        first[t] = tiers[t].total - hdr.count[t];
+    }
+    taskEXIT_CRITICAL(&history_lock);
+
+    esp_err_t ret = ESP_OK;
+    FILE *file = fopen(HISTORY_TMP_PATH, "wb");
+    if (file == NULL || fwrite(&hdr, sizeof(hdr), 1, file) != 1) {
+        ret = ESP_FAIL;
+    }
+
+    for (uint8_t t = 0; ret == ESP_OK && t < HISTORY_TIER_COUNT; t++) {
+        uint32_t done = 0;
+        while (done < hdr.count[t]) {
+            uint32_t n = hdr.count[t] - done;
+            if (n > HISTORY_IO_ENTRIES) {
+                n = HISTORY_IO_ENTRIES;
+            }
+            history_read(t, first[t] + done, io_buf, n);
+            if (fwrite(io_buf, sizeof(history_entry_t), n, file) != n) {
+                ret = ESP_FAIL;
+                break;
+            }
+            done += n;
+        }
+    }
+
+    if (file != NULL) {
+        fclose(file);
+    }
+    // SPIFFS rename does not replace an existing target
+    if (ret == ESP_OK) {
+        remove(HISTORY_CHECKPOINT_PATH);
+        if (rename(HISTORY_TMP_PATH, HISTORY_CHECKPOINT_PATH) != 0) {
+            ret = ESP_FAIL;
+        }
+    } else {
+        remove(HISTORY_TMP_PATH);
+    }
+
+    if (ret == ESP_OK) {
+        status.checkpoints++;
+        status.last_checkpoint_us = esp_timer_get_time();
+    } else {
+        status.checkpoint_failures++;
+        ESP_LOGW(TAG, "Checkpoint to %s failed", HISTORY_CHECKPOINT_PATH);
+    }
+
+    xSemaphoreGive(checkpoint_mutex);
+    return ret;
+}
+
+static void history_task(void *arg)
+{
+    metrics_register_task(NULL);
+    // SPIFFS is mounted by the web server task once Wi-Fi is up
+    while (!esp_spiffs_mounted(NULL)) {
+        vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+
+    const char *restored_from = NULL;
+    esp_err_t ret = history_restore(&restored_from);
+    status.restored = (ret == ESP_OK);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Restored %lu/%lu/%lu entries from %s",
+                 (unsigned long)tiers[0].total, (unsigned long)tiers[1].total,
+                 (unsigned long)tiers[2].total, restored_from);
+    } else if (ret != ESP_ERR_NOT_FOUND) {
+        ESP_LOGW(TAG, "Ignoring checkpoint %s: %s", restored_from, esp_err_to_name(ret));
+    }
+
+    sample_acc.min = UINT32_MAX;
+    sample_acc.period = esp_timer_get_time() / (HISTORY_TIER0_PERIOD_S * 1000000ULL);
+    status.ready = true;
+    history_ready = true;
+
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(HISTORY_CHECKPOINT_INTERVAL_S * 1000));
+        history_checkpoint();
+    }
+}
+
+esp_err_t history_init(void)
+{
+    if (checkpoint_mutex != NULL) {
+        return ESP_OK;
+    }
+
+    static const uint32_t capacity[HISTORY_TIER_COUNT] = {
+        HISTORY_TIER0_LEN, HISTORY_TIER1_LEN, HISTORY_TIER2_LEN
+    };
+    static const uint32_t ratio[HISTORY_TIER_COUNT] = {
+        1, HISTORY_TIER1_RATIO, HISTORY_TIER2_RATIO
+    };
+
+    uint32_t period_s = HISTORY_TIER0_PERIOD_S;
+    for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) {
+        period_s *= ratio[t];
+        tiers[t].ring = mem_arena_alloc(MEM_SUBSYS_HISTORY, capacity[t] * sizeof(history_entry_t));
+        if (tiers[t].ring == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate tier %u (%lu entries)", t, (unsigned long)capacity[t]);
+            return ESP_ERR_NO_MEM;
+        }
+        tiers[t].capacity = capacity[t];
+        tiers[t].period_s = period_s;
+        tiers[t].ratio = ratio[t];
+        tiers[t].total = 0;
+        entry_acc_reset(&tiers[t].acc);
+    }
+
+    checkpoint_mutex = xSemaphoreCreateMutex();
+    if (checkpoint_mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to create checkpoint mutex");
+        return ESP_FAIL;
+    }
+
+    if (xTaskCreate(history_task, "history", HISTORY_TASK_STACK_SIZE, NULL,
+                    HISTORY_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create history task");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = pipeline_add_sink(HISTORY_SINK_NAME, history_sink, NULL, NULL);
+    if (ret == ESP_OK) {
+        ret = pipeline_connect_sources(HISTORY_SINK_NAME);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to attach to the pipeline: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "History pyramid: %lus x %lu, %lus x %lu, %lus x %lu",
+             (unsigned long)tiers[0].period_s, (unsigned long)tiers[0].capacity,
+             (unsigned long)tiers[1].period_s, (unsigned long)tiers[1].capacity,
+             (unsigned long)tiers[2].period_s, (unsigned long)tiers[2].capacity);
+    return ESP_OK;
+}
+
+esp_err_t history_get_tier_info(uint8_t tier, history_tier_info_t *info)
+{
+    if (tier >= HISTORY_TIER_COUNT || info == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    taskENTER_CRITICAL(&history_lock);
+    info->period_s = tiers[tier].period_s;
+    info->capacity = tiers[tier].capacity;
+    info->total = tiers[tier].total;
+    info->last_end_us = tiers[tier].last_end_us;
+    taskEXIT_CRITICAL(&history_lock);
+    return ESP_OK;
+}
+
+size_t history_read(uint8_t tier, uint32_t first_seq, history_entry_t *entries, size_t max_entries)
+{
+    if (tier >= HISTORY_TIER_COUNT || entries == NULL || tiers[tier].ring == NULL) {
+        return 0;
+    }
+
+    const history_tier_t *t = &tiers[tier];
+    size_t n = 0;
+
+    taskENTER_CRITICAL(&history_lock);
+    const uint32_t oldest = t->total > t->capacity ? t->total - t->capacity : 0;
+    for (uint32_t seq = first_seq; n < max_entries && seq < t->total; seq++, n++) {
+        entries[n] = (seq >= oldest) ? t->ring[seq % t->capacity] : gap_entry;
+    }
+    taskEXIT_CRITICAL(&history_lock);
+    return n;
+}
+
+esp_err_t history_get_status(history_status_t *out)
+{
+    if (out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out = status;
+    return ESP_OK;
+}
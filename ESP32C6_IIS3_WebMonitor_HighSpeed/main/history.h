@@ -0,0 +1,56 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// History pyramid configuration: each tier aggregates HISTORY_TIERn_RATIO entries of the tier below
+#define HISTORY_TIER_COUNT              3
+#define HISTORY_TIER0_PERIOD_S          1
+#define HISTORY_TIER0_LEN               3600    // 1 s resolution for an hour
+#define HISTORY_TIER1_RATIO             60
+#define HISTORY_TIER1_LEN               1440    // 1 min resolution for a day
+#define HISTORY_TIER2_RATIO             15
+#define HISTORY_TIER2_LEN               2880    // 15 min resolution for 30 days
+#define HISTORY_CHECKPOINT_PATH         "/spiffs/history.bin"
+#define HISTORY_CHECKPOINT_INTERVAL_S   600
+#define HISTORY_SINK_NAME               "history"
+#define HISTORY_TASK_STACK_SIZE         4096
+#define HISTORY_TASK_PRIORITY           2
+#define HISTORY_GAP                     0xFFFF  // min_mg of an entry without data
+
+// Aggregates of the acceleration magnitude |a| over one period
+typedef struct {
+    uint16_t min_mg;
+    uint16_t max_mg;
+    uint16_t mean_mg;
+    uint16_t rms_mg;
+} history_entry_t;
+
+typedef struct {
+    uint32_t period_s;
+    uint32_t capacity;
+    uint32_t total;             // Entries pushed since the store was (re)loaded
+    uint64_t last_end_us;       // Device time at which the newest entry closed
+} history_tier_info_t;
+
+typedef struct {
+    bool ready;                 // Checkpoint restored, aggregation running
+    bool restored;              // Entries from before this boot were loaded
+    uint32_t checkpoints;
+    uint32_t checkpoint_failures;
+    uint64_t last_checkpoint_us;
+} history_status_t;
+
+// History API
+esp_err_t history_init(void);
+esp_err_t history_get_tier_info(uint8_t tier, history_tier_info_t *info);
+// Copy entries by absolute sequence number (0 = oldest ever pushed); entries that
+// have already been overwritten are returned as gaps.
+size_t history_read(uint8_t tier, uint32_t first_seq, history_entry_t *entries, size_t max_entries);
+esp_err_t history_checkpoint(void);
+esp_err_t history_get_status(history_status_t *status);
+
+#endif // HISTORY_H
@@ -0,0 +1,30 @@
+#include "imu_manager.h"
+#include "convert.h"
+#include "sensors/iis3dwb_reg.h"
+
+// Pure read-path helpers from imu_manager.h, kept apart from the sensor and IDF code
+// so tools/host_bench.c and the fuzz harnesses can build them on the host
+
+float imu_manager_raw_to_g(int16_t raw, imu_manager_full_scale_t scale)
+{
+    return (float)raw * convert_sensitivity_g((uint8_t)scale);
+}
+
+uint16_t imu_manager_decode_fifo(const uint8_t *fifo, uint16_t entries, int16_t *xyz, uint16_t max_samples)
+{
+    uint16_t accel_count = 0;
+    for (uint16_t i = 0; i < entries && accel_count < max_samples; i++) {
+        const uint8_t *entry = &fifo[i * IMU_MANAGER_FIFO_ENTRY_BYTES];
+        const iis3dwb_fifo_tag_t tag = (iis3dwb_fifo_tag_t)(entry[0] >> 3);
+
+        if (tag != IIS3DWB_XL_TAG) {
+            continue;
+        }
+
+        xyz[accel_count * 3 + 0] = (int16_t)(entry[2] << 8 | entry[1]);
+        xyz[accel_count * 3 + 1] = (int16_t)(entry[4] << 8 | entry[3]);
+        xyz[accel_count * 3 + 2] = (int16_t)(entry[6] << 8 | entry[5]);
+        accel_count++;
+    }
+    return accel_count;
+}
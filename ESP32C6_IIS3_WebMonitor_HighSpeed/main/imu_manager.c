@@ -1,6 +1,12 @@
 #include "imu_manager.h"
 #include "sensors/iis3dwb_hal.h"
 #include "esp_log.h"
+#include "tlog.h"
+#include "trace.h"
+#include "metrics.h"
+#include "convert.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
 #include "esp_timer.h"
 #include "driver/spi_master.h"
 #include "freertos/FreeRTOS.h"
@@ -26,50 +32,26 @@ static uint64_t last_batch_timestamp_us = 0;
 static stmdev_ctx_t accel_ctx = {0};
 static iis3dwb_fs_xl_t current_full_scale = IIS3DWB_2g;
 static imu_manager_full_scale_t current_full_scale_g = IMU_MANAGER_FS_2G;
+// Kernel for current_full_scale_g; reselected whenever it changes, set by init
+static convert_kernel_t raw_to_g_kernel = NULL;
 static bool sensor_initialized = false;
 static volatile bool pending_scale_change = false;
 static volatile imu_manager_full_scale_t pending_scale = IMU_MANAGER_FS_2G;
+static volatile bool pending_power_change = false;
+static volatile bool pending_power_active = true;
+static volatile bool sensor_active = true;
 _Static_assert(IMU_MANAGER_MAX_SAMPLES == IIS3DWB_MAX_SAMPLES_BATCH, "IMU manager sample configuration mismatch");
-static float recent_ax[IIS3DWB_MAX_SAMPLES_BATCH];
-static float recent_ay[IIS3DWB_MAX_SAMPLES_BATCH];
-static float recent_az[IIS3DWB_MAX_SAMPLES_BATCH];
-static uint16_t recent_samples = 0;
-static uint16_t recent_fifo_level = 0;
-static uint64_t recent_timestamp_us = 0;
-static uint32_t recent_sequence = 0;
+static uint32_t cpu_ticks_per_us = 1;
+static imu_manager_raw_listener_t raw_listeners[IMU_MANAGER_MAX_RAW_LISTENERS];
+static uint8_t raw_listener_count = 0;
 
-#define IIS3DWB_FIFO_SAMPLE_BYTES 7
+#define IIS3DWB_FIFO_SAMPLE_BYTES IMU_MANAGER_FIFO_ENTRY_BYTES
 
 static inline esp_err_t st_to_esp_err(int32_t ret)
 {
     return (ret == 0) ? ESP_OK : ESP_FAIL;
 }
 
-static float convert_raw_to_g(int16_t raw)
-{
-    float mg = 0.0f;
-
-    switch (current_full_scale) {
-        case IIS3DWB_2g:
-            mg = iis3dwb_from_fs2g_to_mg(raw);
-            break;
-        case IIS3DWB_4g:
-            mg = iis3dwb_from_fs4g_to_mg(raw);
-            break;
-        case IIS3DWB_8g:
-            mg = iis3dwb_from_fs8g_to_mg(raw);
-            break;
-        case IIS3DWB_16g:
-            mg = iis3dwb_from_fs16g_to_mg(raw);
-            break;
-        default:
-            mg = 0.0f;
-            break;
-    }
-
-    return mg / 1000.0f;
-}
-
 static imu_manager_full_scale_t iis3dwb_to_manager_fs(iis3dwb_fs_xl_t fs)
 {
     switch (fs) {
@@ -110,6 +92,14 @@ static iis3dwb_fs_xl_t manager_to_iis3dwb_fs(imu_manager_full_scale_t scale)
     }
 }
 
+// Called wherever the full scale changes, so the read path never switches on it
+static void set_full_scale_state(imu_manager_full_scale_t scale)
+{
+    current_full_scale_g = scale;
+    current_full_scale = manager_to_iis3dwb_fs(scale);
+    raw_to_g_kernel = convert_get_kernel((uint8_t)scale);
+}
+
 static esp_err_t iis3dwb_get_fifo_level(uint16_t *level, bool *overflowed)
 {
     iis3dwb_fifo_status_t status;
@@ -128,6 +118,63 @@ static esp_err_t iis3dwb_get_fifo_level(uint16_t *level, bool *overflowed)
     return ESP_OK;
 }
 
+static void notify_raw_listeners(const int16_t *xyz, uint16_t count, imu_manager_full_scale_t scale,
+                                 float odr_hz, uint64_t timestamp_us)
+{
+    TRACE_BEGIN(TRACE_PIPELINE);
+    for (uint8_t i = 0; i < raw_listener_count; i++) {
+        raw_listeners[i](xyz, count, scale, odr_hz, timestamp_us);
+    }
+    TRACE_END(TRACE_PIPELINE, count);
+}
+
+// Fill the per-batch summary shared by the sensor and injected (replay) paths
+static void finish_batch(imu_data_t *data, uint32_t total_samples, uint16_t fifo_level, float odr_hz,
+                         float last_ax, float last_ay, float last_az)
+{
+    data->accelerometer.x_g = last_ax;
+    data->accelerometer.y_g = last_ay;
+    data->accelerometer.z_g = last_az;
+    data->accelerometer.magnitude_g = sqrtf(last_ax * last_ax + last_ay * last_ay + last_az * last_az);
+    data->accelerometer.valid = true;
+
+    const uint64_t now_us = data->timestamp_us;
+    float samples_per_second = odr_hz;
+    if (last_batch_timestamp_us != 0 && now_us > last_batch_timestamp_us) {
+        const float elapsed_us = (float)(now_us - last_batch_timestamp_us);
+        samples_per_second = (total_samples * 1e6f) / elapsed_us;
+    }
+    last_batch_timestamp_us = now_us;
+    metrics_inc(METRIC_IMU_BATCHES);
+    metrics_add(METRIC_IMU_SAMPLES, total_samples);
+
+    data->stats.fifo_level = fifo_level;
+    data->stats.samples_read = (total_samples > UINT16_MAX) ? UINT16_MAX : (uint16_t)total_samples;
+    data->stats.odr_hz = odr_hz;
+    data->stats.batch_interval_us = (total_samples * 1e6f) / odr_hz;
+    data->stats.samples_per_second = samples_per_second;
+}
+
+esp_err_t imu_manager_add_raw_listener(imu_manager_raw_listener_t listener)
+{
+    if (listener == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (raw_listener_count >= IMU_MANAGER_MAX_RAW_LISTENERS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    raw_listeners[raw_listener_count] = listener;
+    raw_listener_count++;
+    return ESP_OK;
+}
+
+uint32_t imu_manager_get_fifo_overflow_count(void)
+{
+    return metrics_get(METRIC_IMU_FIFO_OVERFLOWS);
+}
+
 float imu_manager_get_configured_odr(void)
 {
     return configured_odr_hz;
@@ -295,23 +342,34 @@ esp_err_t imu_manager_init(void)
     ret = st_to_esp_err(iis3dwb_xl_full_scale_get(&accel_ctx, &current_full_scale));
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "Unable to read back accelerometer full-scale setting, defaulting to configured value");
-        current_full_scale = cfg.fs;
-        current_full_scale_g = iis3dwb_to_manager_fs(current_full_scale);
+        set_full_scale_state(iis3dwb_to_manager_fs(cfg.fs));
     } else {
-        current_full_scale_g = iis3dwb_to_manager_fs(current_full_scale);
+        set_full_scale_state(iis3dwb_to_manager_fs(current_full_scale));
     }
 
-    recent_samples = 0;
-    recent_fifo_level = 0;
-    recent_timestamp_us = 0;
-    recent_sequence = 0;
     configured_odr_hz = IIS3DWB_MAX_ODR_HZ;
     ESP_LOGI(TAG, "IIS3DWB initialized at %.2f Hz ODR (watermark=%u)", configured_odr_hz, fifo_watermark);
     last_batch_timestamp_us = esp_timer_get_time();
+    cpu_ticks_per_us = esp_rom_get_cpu_ticks_per_us();
     sensor_initialized = true;
     return ESP_OK;
 }
 
+// Power-down stops the ODR clock; power-up flushes stale FIFO content through bypass mode
+static esp_err_t apply_power_state(bool active)
+{
+    esp_err_t ret = st_to_esp_err(iis3dwb_fifo_mode_set(&accel_ctx, IIS3DWB_BYPASS_MODE));
+    if (ret == ESP_OK) {
+        ret = st_to_esp_err(iis3dwb_xl_data_rate_set(&accel_ctx,
+                                                     active ? IIS3DWB_XL_ODR_26k7Hz : IIS3DWB_XL_ODR_OFF));
+    }
+    if (ret == ESP_OK && active) {
+        ret = st_to_esp_err(iis3dwb_fifo_mode_set(&accel_ctx, IIS3DWB_STREAM_MODE));
+        last_batch_timestamp_us = esp_timer_get_time();
+    }
+    return ret;
+}
+
 esp_err_t imu_manager_read_all(imu_data_t *data)
 {
     if (data == NULL) {
@@ -327,16 +385,32 @@ esp_err_t imu_manager_read_all(imu_data_t *data)
         iis3dwb_fs_xl_t desired_fs = manager_to_iis3dwb_fs(pending_scale);
         esp_err_t scale_ret = st_to_esp_err(iis3dwb_xl_full_scale_set(&accel_ctx, desired_fs));
         if (scale_ret == ESP_OK) {
-            current_full_scale = desired_fs;
-            current_full_scale_g = pending_scale;
+            set_full_scale_state(pending_scale);
             ESP_LOGI(TAG, "Full scale updated to +/- %dg", (int)pending_scale);
         } else {
             ESP_LOGE(TAG, "Failed to update full scale: %s", esp_err_to_name(scale_ret));
         }
         pending_scale_change = false;
     }
+
+    // Apply pending power state (duty-cycled capture) from the same task
+    if (pending_power_change) {
+        const bool active = pending_power_active;
+        esp_err_t power_ret = apply_power_state(active);
+        if (power_ret == ESP_OK) {
+            sensor_active = active;
+            ESP_LOGI(TAG, "Sensor %s", active ? "powered up" : "powered down");
+        } else {
+            ESP_LOGE(TAG, "Failed to change sensor power state: %s", esp_err_to_name(power_ret));
+        }
+        pending_power_change = false;
+    }
+
+    if (!sensor_active) {
+        data->accelerometer.valid = false;
+        return ESP_ERR_NOT_FOUND;
+    }
     
-    // Don't lock mutex for entire FIFO read - only lock when updating recent_ arrays
     esp_err_t ret;
     data->timestamp_us = esp_timer_get_time();
     ret = imu_manager_read_accelerometer(data);
@@ -368,21 +442,26 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
     }
 
     if (overflow) {
+        metrics_inc(METRIC_IMU_FIFO_OVERFLOWS);
         static uint32_t overflow_log_count = 0;
         if ((overflow_log_count++ % 100) == 0) {
-            ESP_LOGW(TAG, "IIS3DWB FIFO overflow detected (level=%u)", fifo_level);
+            TLOG_W(TAG, "IIS3DWB FIFO overflow detected (level=%u)", fifo_level);
         }
     }
 
     const uint16_t fifo_level_before = fifo_level;
+    metrics_set(METRIC_IMU_FIFO_LEVEL, fifo_level_before);
+    metrics_max(METRIC_IMU_FIFO_LEVEL_MAX, fifo_level_before);
     if (fifo_level_before == 0) {
         // No samples waiting, fall back to direct read
         int16_t raw[3] = {0};
         ret = st_to_esp_err(iis3dwb_acceleration_raw_get(&accel_ctx, raw));
         if (ret == ESP_OK) {
-            const float ax = convert_raw_to_g(raw[0]);
-            const float ay = convert_raw_to_g(raw[1]);
-            const float az = convert_raw_to_g(raw[2]);
+            float g[3];
+            raw_to_g_kernel(raw, g, 3);
+            const float ax = g[0];
+            const float ay = g[1];
+            const float az = g[2];
 
             data->accelerometer.x_g = ax;
             data->accelerometer.y_g = ay;
@@ -394,15 +473,9 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
             data->stats.odr_hz = configured_odr_hz;
             data->stats.batch_interval_us = 1e6f / configured_odr_hz;
             data->stats.samples_per_second = configured_odr_hz;
-
-            recent_ax[0] = ax;
-            recent_ay[0] = ay;
-            recent_az[0] = az;
-            recent_samples = 1;
-            recent_fifo_level = 0;
-            recent_timestamp_us = data->timestamp_us;
             last_batch_timestamp_us = data->timestamp_us;
-            recent_sequence++;
+            metrics_inc(METRIC_IMU_BATCHES);
+            metrics_inc(METRIC_IMU_SAMPLES);
         } else {
             data->accelerometer.valid = false;
         }
@@ -412,22 +485,17 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
     if (fifo_level_before > IIS3DWB_MAX_SAMPLES_BATCH) {
         static uint32_t high_fifo_log_count = 0;
         if ((high_fifo_log_count++ % 1000) == 0) {
-            ESP_LOGI(TAG,
-                     "High FIFO level detected (%u > %u), draining without dropping samples",
-                     fifo_level_before, IIS3DWB_MAX_SAMPLES_BATCH);
+            TLOG_I(TAG,
+                   "High FIFO level detected (%u > %u), draining without dropping samples",
+                   fifo_level_before, IIS3DWB_MAX_SAMPLES_BATCH);
         }
     }
 
     uint8_t fifo_raw[IIS3DWB_MAX_SAMPLES_BATCH * IIS3DWB_FIFO_SAMPLE_BYTES];
-    float ax_buf[IIS3DWB_MAX_SAMPLES_BATCH];
-    float ay_buf[IIS3DWB_MAX_SAMPLES_BATCH];
-    float az_buf[IIS3DWB_MAX_SAMPLES_BATCH];
+    int16_t raw_buf[IIS3DWB_MAX_SAMPLES_BATCH * 3];
 
     uint32_t total_accel_count = 0;
-    float last_ax = 0.0f;
-    float last_ay = 0.0f;
-    float last_az = 0.0f;
-    uint16_t last_chunk_count = 0;
+    float last_g[3] = {0.0f, 0.0f, 0.0f};
 
     uint16_t remaining_entries = fifo_level_before;
     while (remaining_entries > 0) {
@@ -438,55 +506,32 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
                                 ? (uint16_t)(remaining_entries - chunk_entries)
                                 : 0;
 
+        TRACE_BEGIN(TRACE_FIFO_READ);
+        const uint32_t spi_start = esp_cpu_get_cycle_count();
         ret = st_to_esp_err(iis3dwb_read_reg(&accel_ctx, IIS3DWB_FIFO_DATA_OUT_TAG,
                                              fifo_raw, chunk_entries * IIS3DWB_FIFO_SAMPLE_BYTES));
+        metrics_add(METRIC_SPI_FIFO_BUSY_US, (esp_cpu_get_cycle_count() - spi_start) / cpu_ticks_per_us);
+        metrics_add(METRIC_SPI_FIFO_BYTES, chunk_entries * IIS3DWB_FIFO_SAMPLE_BYTES);
+        TRACE_END(TRACE_FIFO_READ, chunk_entries);
         if (ret != ESP_OK) {
             data->accelerometer.valid = false;
             return ret;
         }
 
-        size_t accel_count = 0;
-        for (uint16_t i = 0; i < chunk_entries; i++) {
-            const size_t offset = i * IIS3DWB_FIFO_SAMPLE_BYTES;
-            const uint8_t tag_raw = fifo_raw[offset];
-            const iis3dwb_fifo_tag_t tag = (iis3dwb_fifo_tag_t)(tag_raw >> 3);
-
-            if (tag != IIS3DWB_XL_TAG) {
-                continue;
-            }
-
-            const int16_t raw_x = (int16_t)(fifo_raw[offset + 2] << 8 | fifo_raw[offset + 1]);
-            const int16_t raw_y = (int16_t)(fifo_raw[offset + 4] << 8 | fifo_raw[offset + 3]);
-            const int16_t raw_z = (int16_t)(fifo_raw[offset + 6] << 8 | fifo_raw[offset + 5]);
-
-            if (accel_count < IIS3DWB_MAX_SAMPLES_BATCH) {
-                ax_buf[accel_count] = convert_raw_to_g(raw_x);
-                ay_buf[accel_count] = convert_raw_to_g(raw_y);
-                az_buf[accel_count] = convert_raw_to_g(raw_z);
-                accel_count++;
-            }
-        }
+        const uint16_t accel_count = imu_manager_decode_fifo(fifo_raw, chunk_entries, raw_buf,
+                                                             IIS3DWB_MAX_SAMPLES_BATCH);
 
         if (accel_count == 0) {
             continue;
         }
 
         total_accel_count += accel_count;
-        const uint16_t last_index = (uint16_t)(accel_count - 1);
-        last_ax = ax_buf[last_index];
-        last_ay = ay_buf[last_index];
-        last_az = az_buf[last_index];
-        last_chunk_count = (uint16_t)accel_count;
-
-        // Lock mutex only when updating recent_ arrays (minimize lock time)
-        if (xSemaphoreTake(sensor_mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-            recent_sequence++;
-            memcpy(recent_ax, ax_buf, accel_count * sizeof(float));
-            memcpy(recent_ay, ay_buf, accel_count * sizeof(float));
-            memcpy(recent_az, az_buf, accel_count * sizeof(float));
-            recent_samples = (uint16_t)accel_count;
-            xSemaphoreGive(sensor_mutex);
-        }
+        // Consumers take raw samples from the listeners; only the batch summary needs g
+        const int16_t *last_raw = &raw_buf[(accel_count - 1) * 3];
+        raw_to_g_kernel(last_raw, last_g, 3);
+
+        notify_raw_listeners(raw_buf, accel_count, current_full_scale_g,
+                             configured_odr_hz, data->timestamp_us);
     }
 
     if (total_accel_count == 0) {
@@ -494,33 +539,39 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
         return ESP_ERR_INVALID_RESPONSE;
     }
 
-    data->accelerometer.x_g = last_ax;
-    data->accelerometer.y_g = last_ay;
-    data->accelerometer.z_g = last_az;
-    data->accelerometer.magnitude_g = sqrtf(last_ax * last_ax + last_ay * last_ay + last_az * last_az);
-    data->accelerometer.valid = true;
+    finish_batch(data, total_accel_count, fifo_level_before, configured_odr_hz,
+                 last_g[0], last_g[1], last_g[2]);
 
-    const uint64_t now_us = data->timestamp_us;
-    float samples_per_second = configured_odr_hz;
-    if (last_batch_timestamp_us != 0 && now_us > last_batch_timestamp_us) {
-        const float elapsed_us = (float)(now_us - last_batch_timestamp_us);
-        samples_per_second = (total_accel_count * 1e6f) / elapsed_us;
+    if (data->stats.samples_per_second > configured_odr_hz * 1.1f ||
+        data->stats.samples_per_second < configured_odr_hz * 0.1f) {
+        TLOG_W(TAG, "Unexpected sample throughput: %.1f sps (expected %.1f)",
+               data->stats.samples_per_second, configured_odr_hz);
     }
-    last_batch_timestamp_us = now_us;
 
-    data->stats.fifo_level = fifo_level_before;
-    data->stats.samples_read = (total_accel_count > UINT16_MAX) ? UINT16_MAX : (uint16_t)total_accel_count;
-    data->stats.odr_hz = configured_odr_hz;
-    data->stats.batch_interval_us = (total_accel_count * 1e6f) / configured_odr_hz;
-    data->stats.samples_per_second = samples_per_second;
+    return ESP_OK;
+}
 
-    if (samples_per_second > configured_odr_hz * 1.1f || samples_per_second < configured_odr_hz * 0.1f) {
-        ESP_LOGW(TAG, "Unexpected sample throughput: %.1f sps (expected %.1f)", samples_per_second, configured_odr_hz);
+esp_err_t imu_manager_inject_raw(const int16_t *xyz, uint32_t count, imu_manager_full_scale_t scale,
+                                 float odr_hz, uint16_t backlog, imu_data_t *data)
+{
+    if (xyz == NULL || data == NULL || count == 0 || odr_hz <= 0.0f || !manager_fs_is_valid(scale)) {
+        return ESP_ERR_INVALID_ARG;
     }
 
-    recent_fifo_level = fifo_level_before;
-    recent_timestamp_us = data->timestamp_us;
+    data->timestamp_us = esp_timer_get_time();
+
+    uint32_t offset = 0;
+    while (offset < count) {
+        const uint32_t left = count - offset;
+        const uint16_t chunk = left > IIS3DWB_MAX_SAMPLES_BATCH ? IIS3DWB_MAX_SAMPLES_BATCH : (uint16_t)left;
+        const int16_t *src = &xyz[offset * 3];
+        notify_raw_listeners(src, chunk, scale, odr_hz, data->timestamp_us);
+        offset += chunk;
+    }
 
+    float last_g[3];
+    convert_get_kernel((uint8_t)scale)(&xyz[(count - 1) * 3], last_g, 3);
+    finish_batch(data, count, backlog, odr_hz, last_g[0], last_g[1], last_g[2]);
     return ESP_OK;
 }
 
@@ -541,9 +592,7 @@ esp_err_t imu_manager_set_full_scale(imu_manager_full_scale_t scale)
     }
 
     if (!sensor_initialized) {
-        iis3dwb_fs_xl_t desired_fs = manager_to_iis3dwb_fs(scale);
-        current_full_scale = desired_fs;
-        current_full_scale_g = scale;
+        set_full_scale_state(scale);
         return ESP_OK;
     }
 
@@ -556,6 +605,23 @@ esp_err_t imu_manager_set_full_scale(imu_manager_full_scale_t scale)
     return ESP_OK;
 }
 
+esp_err_t imu_manager_set_power(bool active)
+{
+    if (!sensor_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Deferred like the full-scale change: applied by the acquisition task
+    pending_power_active = active;
+    pending_power_change = true;
+    return ESP_OK;
+}
+
+bool imu_manager_is_active(void)
+{
+    return sensor_active;
+}
+
 esp_err_t imu_manager_deinit(void)
 {
     if (sensor_initialized) {
@@ -570,53 +636,7 @@ esp_err_t imu_manager_deinit(void)
     }
     
     last_batch_timestamp_us = 0;
-    recent_samples = 0;
-    recent_fifo_level = 0;
-    recent_timestamp_us = 0;
-    recent_sequence = 0;
     
     ESP_LOGI(TAG, "IMU Manager deinitialized");
     return ESP_OK;
 }
-
-uint16_t imu_manager_copy_recent_samples(float *x_g, float *y_g, float *z_g,
-                                         uint16_t max_samples, uint64_t *timestamp_us,
-                                         uint16_t *fifo_level, uint32_t *sequence_id)
-{
-    if (x_g == NULL || y_g == NULL || z_g == NULL || max_samples == 0) {
-        return 0;
-    }
-
-    if (sensor_mutex == NULL) {
-        return 0;
-    }
-
-    if (xSemaphoreTake(sensor_mutex, pdMS_TO_TICKS(50)) != pdTRUE) {
-        ESP_LOGW(TAG, "Failed to take mutex in copy_recent_samples (timeout)");
-        return 0;
-    }
-
-    uint16_t count = recent_samples;
-    if (count > max_samples) {
-        count = max_samples;
-    }
-
-    if (count > 0) {
-        memcpy(x_g, recent_ax, count * sizeof(float));
-        memcpy(y_g, recent_ay, count * sizeof(float));
-        memcpy(z_g, recent_az, count * sizeof(float));
-    }
-
-    if (timestamp_us) {
-        *timestamp_us = recent_timestamp_us;
-    }
-    if (fifo_level) {
-        *fifo_level = recent_fifo_level;
-    }
-    if (sequence_id) {
-        *sequence_id = recent_sequence;
-    }
-
-    xSemaphoreGive(sensor_mutex);
-    return count;
-}
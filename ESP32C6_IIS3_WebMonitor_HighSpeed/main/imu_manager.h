@@ -31,6 +31,15 @@ typedef struct {
 } imu_data_t;
 
 #define IMU_MANAGER_MAX_SAMPLES 64
+#define IMU_MANAGER_MAX_RAW_LISTENERS 4
+#define IMU_MANAGER_FIFO_ENTRY_BYTES 7     // IIS3DWB FIFO word: tag + x,y,z little-endian
+#define IMU_MANAGER_FIFO_DEPTH 512         // IIS3DWB FIFO words (3 KB of samples)
+
+// Called from the acquisition task for every decoded chunk (interleaved x,y,z LSB).
+// Must be non-blocking; the sensor FIFO keeps filling while listeners run.
+typedef void (*imu_manager_raw_listener_t)(const int16_t *xyz, uint16_t count,
+                                           imu_manager_full_scale_t scale, float odr_hz,
+                                           uint64_t timestamp_us);
 
 // IMU Manager API
 esp_err_t imu_manager_init(void);
@@ -42,8 +51,20 @@ uint16_t imu_manager_get_fifo_watermark(void);
 imu_manager_full_scale_t imu_manager_get_full_scale(void);
 uint8_t imu_manager_get_full_scale_g(void);
 esp_err_t imu_manager_set_full_scale(imu_manager_full_scale_t scale);
-uint16_t imu_manager_copy_recent_samples(float *x_g, float *y_g, float *z_g,
-                                         uint16_t max_samples, uint64_t *timestamp_us,
-                                         uint16_t *fifo_level, uint32_t *sequence_id);
+// Power the sensor up/down (ODR off); applied on the next imu_manager_read_all(),
+// which returns ESP_ERR_NOT_FOUND while the sensor is powered down.
+esp_err_t imu_manager_set_power(bool active);
+bool imu_manager_is_active(void);
+esp_err_t imu_manager_add_raw_listener(imu_manager_raw_listener_t listener);
+uint32_t imu_manager_get_fifo_overflow_count(void);
+// Push raw interleaved x,y,z samples (LSB at the given full scale) through the same
+// listener path as the sensor FIFO. Used by the replay source.
+esp_err_t imu_manager_inject_raw(const int16_t *xyz, uint32_t count, imu_manager_full_scale_t scale,
+                                 float odr_hz, uint16_t backlog, imu_data_t *data);
+// Sensor-side helpers used by the read path; pure, no sensor access
+float imu_manager_raw_to_g(int16_t raw, imu_manager_full_scale_t scale);
+// Unpack up to max_samples accelerometer words from a FIFO dump of `entries`
+// IMU_MANAGER_FIFO_ENTRY_BYTES-byte words, skipping other tags. Returns the count.
+uint16_t imu_manager_decode_fifo(const uint8_t *fifo, uint16_t entries, int16_t *xyz, uint16_t max_samples);
 
 #endif // IMU_MANAGER_H
@@ -0,0 +1,155 @@
+#include "latency.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef struct {
+    uint32_t seq;
+    uint64_t acquired_us;
+    uint64_t sent_us;           // 0: slot unused
+} tracked_frame_t;
+
+typedef struct {
+    tracked_frame_t frames[LATENCY_TRACK_FRAMES];
+    hist_t total[LATENCY_STAT_COUNT];
+    hist_t clients[LATENCY_MAX_CLIENTS][LATENCY_STAT_COUNT];
+    uint32_t rejected;
+} transport_state_t;
+
+static const char *const transport_names[LATENCY_TRANSPORT_COUNT] = {
+    [LATENCY_TRANSPORT_WS] = "ws",
+};
+
+static const char *const stat_names[LATENCY_STAT_COUNT] = {
+    [LATENCY_STAT_AGE_AT_SEND]      = "age_at_send",
+    [LATENCY_STAT_ROUND_TRIP]       = "round_trip",
+    [LATENCY_STAT_SENSOR_TO_CLIENT] = "sensor_to_client",
+};
+
+// Held only for a table update, a few increments or a struct copy
+static portMUX_TYPE latency_lock = portMUX_INITIALIZER_UNLOCKED;
+static transport_state_t transports[LATENCY_TRANSPORT_COUNT];
+
+static void reset_stats(hist_t *stats)
+{
+    for (int i = 0; i < LATENCY_STAT_COUNT; i++) {
+        hist_reset(&stats[i]);
+    }
+}
+
+static uint32_t clamp_us(uint64_t us)
+{
+    return (us > HIST_VALUE_MAX) ? HIST_VALUE_MAX : (uint32_t)us;
+}
+
+void latency_frame_sent(latency_transport_t transport, uint32_t seq, uint64_t acquired_us, uint64_t sent_us)
+{
+    if (transport >= LATENCY_TRANSPORT_COUNT || sent_us == 0) {
+        return;
+    }
+    transport_state_t *t = &transports[transport];
+    const uint32_t age_us = clamp_us((sent_us > acquired_us) ? sent_us - acquired_us : 0);
+
+    taskENTER_CRITICAL(&latency_lock);
+    t->frames[seq % LATENCY_TRACK_FRAMES] = (tracked_frame_t){
+        .seq = seq,
+        .acquired_us = acquired_us,
+        .sent_us = sent_us,
+    };
+    hist_record(&t->total[LATENCY_STAT_AGE_AT_SEND], age_us);
+    taskEXIT_CRITICAL(&latency_lock);
+}
+
+esp_err_t latency_record_echo(latency_transport_t transport, int client, uint32_t seq, uint32_t hold_us)
+{
+    if (transport >= LATENCY_TRANSPORT_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    transport_state_t *t = &transports[transport];
+    const uint64_t now_us = esp_timer_get_time();
+    esp_err_t ret = ESP_OK;
+
+    taskENTER_CRITICAL(&latency_lock);
+    const tracked_frame_t frame = t->frames[seq % LATENCY_TRACK_FRAMES];
+    if (client < 0 || client >= LATENCY_MAX_CLIENTS || hold_us > LATENCY_MAX_HOLD_US) {
+        ret = ESP_ERR_INVALID_ARG;
+    } else if (frame.sent_us == 0 || frame.seq != seq) {
+        ret = ESP_ERR_NOT_FOUND;
+    } else if (now_us < frame.sent_us + hold_us) {
+        // The client claims to have held the frame longer than it has existed
+        ret = ESP_ERR_INVALID_ARG;
+    }
+
+    if (ret == ESP_OK) {
+        const uint64_t rtt_us = now_us - frame.sent_us - hold_us;
+        const uint64_t age_us = (frame.sent_us > frame.acquired_us) ? frame.sent_us - frame.acquired_us : 0;
+        const uint32_t values[LATENCY_STAT_COUNT] = {
+            [LATENCY_STAT_AGE_AT_SEND]      = clamp_us(age_us),
+            [LATENCY_STAT_ROUND_TRIP]       = clamp_us(rtt_us),
+            [LATENCY_STAT_SENSOR_TO_CLIENT] = clamp_us(age_us + rtt_us / 2),
+        };
+        for (int i = 0; i < LATENCY_STAT_COUNT; i++) {
+            if (i != LATENCY_STAT_AGE_AT_SEND) {
+                hist_record(&t->total[i], values[i]);    // Age is recorded per frame sent
+            }
+            hist_record(&t->clients[client][i], values[i]);
+        }
+    } else {
+        t->rejected++;
+    }
+    taskEXIT_CRITICAL(&latency_lock);
+    return ret;
+}
+
+void latency_client_reset(latency_transport_t transport, int client)
+{
+    if (transport >= LATENCY_TRANSPORT_COUNT || client < 0 || client >= LATENCY_MAX_CLIENTS) {
+        return;
+    }
+    taskENTER_CRITICAL(&latency_lock);
+    reset_stats(transports[transport].clients[client]);
+    taskEXIT_CRITICAL(&latency_lock);
+}
+
+esp_err_t latency_get(latency_transport_t transport, int client, latency_stat_id_t id, hist_t *out)
+{
+    if (transport >= LATENCY_TRANSPORT_COUNT || client >= LATENCY_MAX_CLIENTS ||
+        id >= LATENCY_STAT_COUNT || out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const transport_state_t *t = &transports[transport];
+
+    taskENTER_CRITICAL(&latency_lock);
+    *out = (client < 0) ? t->total[id] : t->clients[client][id];
+    taskEXIT_CRITICAL(&latency_lock);
+    return ESP_OK;
+}
+
+uint32_t latency_get_rejected(latency_transport_t transport)
+{
+    return (transport < LATENCY_TRANSPORT_COUNT) ? transports[transport].rejected : 0;
+}
+
+void latency_reset(void)
+{
+    taskENTER_CRITICAL(&latency_lock);
+    for (int i = 0; i < LATENCY_TRANSPORT_COUNT; i++) {
+        transport_state_t *t = &transports[i];
+        reset_stats(t->total);
+        for (int c = 0; c < LATENCY_MAX_CLIENTS; c++) {
+            reset_stats(t->clients[c]);
+        }
+        t->rejected = 0;
+    }
+    taskEXIT_CRITICAL(&latency_lock);
+}
+
+const char *latency_transport_name(latency_transport_t transport)
+{
+    return (transport < LATENCY_TRANSPORT_COUNT) ? transport_names[transport] : "unknown";
+}
+
+const char *latency_stat_name(latency_stat_id_t id)
+{
+    return (id < LATENCY_STAT_COUNT) ? stat_names[id] : "unknown";
+}
@@ -0,0 +1,54 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include "esp_err.h"
+#include "hist.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Sensor-to-client latency of the live stream, measured with client echoes. Every
+// frame carries the device time of its newest sample ("t") and the device time it
+// was sent ("tx"). A client that wants to be measured returns the frame's "seq"
+// together with how long it held the frame before replying:
+//   {"echo":<seq>,"hold":<us between receipt and this reply>}
+// Only device-clock differences are used, so clients need no clock sync:
+//   age at send       tx - t
+//   round trip        echo arrival - tx - hold
+//   sensor to client  age at send + round trip / 2   (network assumed symmetric)
+// The transport totals record age at send for every frame sent to at least one
+// client and the other two stats for every echo; each client slot records all
+// three for the frames it echoed. Echoes for frames older than the last
+// LATENCY_TRACK_FRAMES sent are ignored.
+#define LATENCY_TRACK_FRAMES    64      // ~0.6 s of frames at the 10 ms broadcast period
+#define LATENCY_MAX_CLIENTS     4       // Per transport; WEBSOCKET_MAX_CONNECTIONS
+#define LATENCY_MAX_HOLD_US     1000000 // Echoes held longer than this are rejected
+
+// Streaming transports of this firmware
+typedef enum {
+    LATENCY_TRANSPORT_WS = 0,
+    LATENCY_TRANSPORT_COUNT
+} latency_transport_t;
+
+typedef enum {
+    LATENCY_STAT_AGE_AT_SEND = 0,
+    LATENCY_STAT_ROUND_TRIP,
+    LATENCY_STAT_SENSOR_TO_CLIENT,
+    LATENCY_STAT_COUNT
+} latency_stat_id_t;
+
+// Latency API
+void latency_frame_sent(latency_transport_t transport, uint32_t seq, uint64_t acquired_us, uint64_t sent_us);
+// Returns ESP_ERR_NOT_FOUND when seq is no longer tracked and ESP_ERR_INVALID_ARG
+// for an out-of-range client, hold or round trip
+esp_err_t latency_record_echo(latency_transport_t transport, int client, uint32_t seq, uint32_t hold_us);
+// Clears a client slot's histograms when a new client takes it
+void latency_client_reset(latency_transport_t transport, int client);
+// client < 0 reads the transport total
+esp_err_t latency_get(latency_transport_t transport, int client, latency_stat_id_t id, hist_t *out);
+// Echoes rejected since the last reset (stale seq or implausible timing)
+uint32_t latency_get_rejected(latency_transport_t transport);
+void latency_reset(void);
+const char *latency_transport_name(latency_transport_t transport);
+const char *latency_stat_name(latency_stat_id_t id);
+
+#endif // LATENCY_H
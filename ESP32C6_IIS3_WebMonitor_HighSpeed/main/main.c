@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -8,6 +9,7 @@
 #include "esp_system.h"
 #include "esp_wifi.h"
 #include "esp_event.h"
+#include "esp_heap_caps.h"
 #include "nvs_flash.h"
 #include "esp_netif.h"
 #include "esp_spiffs.h"
@@ -19,6 +21,17 @@
 #include "data_buffer.h"
 #include "led_status.h"
 #include "udp.h"
+#include "replay.h"
+#include "blackbox.h"
+#include "history.h"
+#include "duty_cycle.h"
+#include "mem_arena.h"
+#include "pipeline.h"
+#include "tlog.h"
+#include "trace.h"
+#include "metrics.h"
+#include "sys_monitor.h"
+#include "acq_stats.h"
 
 static const char *TAG = "MAIN";
 
@@ -149,11 +162,12 @@ void wifi_init_sta(void)
 static void imu_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "IMU task started");
+    metrics_register_task(NULL);
     
-    if (imu_manager_init() != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize IMU manager");
-        vTaskDelete(NULL);
-        return;
+    // Keep the task alive without a sensor so captures can still be replayed
+    bool sensor_ready = (imu_manager_init() == ESP_OK);
+    if (!sensor_ready) {
+        ESP_LOGE(TAG, "Failed to initialize IMU manager, only replay input available");
     }
     
     imu_data_t sensor_data = {0};
@@ -168,10 +182,46 @@ static void imu_task(void *pvParameters)
     uint32_t batch_count = 0;
     uint32_t sample_accumulator = 0;
     uint64_t stats_window_start = esp_timer_get_time();
+    uint32_t last_overflow_count = 0;
+    int64_t last_wake_us = 0;          // 0 after an off-schedule delay: skip one jitter sample
     
     while (1) {
-        if (imu_manager_read_all(&sensor_data) == ESP_OK) {
+        esp_err_t read_ret;
+        bool sensor_drain = false;
+        uint32_t drain_us = 0;
+        TRACE_BEGIN(TRACE_ACQUIRE);
+        if (replay_is_active()) {
+            read_ret = replay_read(&sensor_data);
+        } else if (sensor_ready) {
+            const int64_t drain_start_us = esp_timer_get_time();
+            read_ret = imu_manager_read_all(&sensor_data);
+            drain_us = (uint32_t)(esp_timer_get_time() - drain_start_us);
+            sensor_drain = true;
+        } else {
+            TRACE_END(TRACE_ACQUIRE, 0);
+            vTaskDelay(pdMS_TO_TICKS(100));
+            last_wake_time = xTaskGetTickCount();
+            last_wake_us = 0;
+            continue;
+        }
+        TRACE_END(TRACE_ACQUIRE, read_ret == ESP_OK ? sensor_data.stats.samples_read : 0);
+
+        if (read_ret == ESP_OK) {
+            TRACE_BEGIN(TRACE_BUFFER_ADD);
             data_buffer_add(&sensor_data);
+            TRACE_END(TRACE_BUFFER_ADD, 1);
+
+            // FIFO overflows mean lost samples: freeze the black box around them
+            const uint32_t overflow_count = imu_manager_get_fifo_overflow_count();
+            const bool overflowed = (overflow_count != last_overflow_count);
+            if (overflowed) {
+                last_overflow_count = overflow_count;
+                blackbox_trigger(BLACKBOX_TRIGGER_ERROR);
+            }
+            if (sensor_drain) {
+                acq_stats_record_drain(drain_us, sensor_data.stats.fifo_level, overflowed,
+                                       imu_manager_get_configured_odr());
+            }
             batch_count++;
             sample_accumulator += sensor_data.stats.samples_read;
 
@@ -180,20 +230,29 @@ static void imu_task(void *pvParameters)
                 float elapsed_s = (now - stats_window_start) / 1000000.0f;
                 float msg_per_sec = batch_count / elapsed_s;
                 float samples_per_sec = sample_accumulator / elapsed_s;
-                ESP_LOGI(TAG,
-                         "IMU %.1f msg/s, %.1f samples/s, |g|=%.3f (fifo=%u, batch=%u)",
-                         msg_per_sec,
-                         samples_per_sec,
-                         sensor_data.accelerometer.magnitude_g,
-                         (unsigned int)sensor_data.stats.fifo_level,
-                         (unsigned int)sensor_data.stats.samples_read);
+                TLOG_I(TAG,
+                       "IMU %.1f msg/s, %.1f samples/s, |g|=%.3f (fifo=%u, batch=%u)",
+                       msg_per_sec,
+                       samples_per_sec,
+                       sensor_data.accelerometer.magnitude_g,
+                       (unsigned int)sensor_data.stats.fifo_level,
+                       (unsigned int)sensor_data.stats.samples_read);
             batch_count = 0;
             sample_accumulator = 0;
             stats_window_start = now;
         }
-        } else {
-            ESP_LOGW(TAG, "Failed to read IMU data");
+        } else if (read_ret == ESP_ERR_NOT_FOUND && !replay_is_active() && !imu_manager_is_active()) {
+            // Sensor powered down between duty-cycle slots: poll slowly
+            vTaskDelay(pdMS_TO_TICKS(20));
+            last_wake_time = xTaskGetTickCount();
+            last_wake_us = 0;
+        } else if (read_ret != ESP_ERR_NOT_FOUND) {
+            // ESP_ERR_NOT_FOUND: realtime replay has no sample due yet
+            metrics_inc(METRIC_IMU_READ_ERRORS);
+            TLOG_W(TAG, "Failed to read IMU data");
+            blackbox_trigger(BLACKBOX_TRIGGER_ERROR);
             vTaskDelay(pdMS_TO_TICKS(5));
+            last_wake_us = 0;
         }
         
         if (sensor_data.accelerometer.valid) {
@@ -213,6 +272,13 @@ static void imu_task(void *pvParameters)
         }
 
         vTaskDelayUntil(&last_wake_time, tick_delay);
+
+        const int64_t wake_us = esp_timer_get_time();
+        if (last_wake_us != 0) {
+            acq_stats_record_wakeup((uint32_t)(wake_us - last_wake_us),
+                                    (uint32_t)tick_delay * portTICK_PERIOD_MS * 1000U);
+        }
+        last_wake_us = wake_us;
     }
 }
 
@@ -250,6 +316,7 @@ static void web_server_task(void *pvParameters)
     }
     
     ESP_LOGI(TAG, "Web server started successfully");
+    metrics_register_task(NULL);
     
     // Keep task alive
     while (1) {
@@ -257,10 +324,29 @@ static void web_server_task(void *pvParameters)
     }
 }
 
+// Reserve the pipeline arena, or stop at boot if it would leave less than
+// MEM_ARENA_MIN_FREE_HEAP for the tasks and network buffers that follow
+static void reserve_arena(void)
+{
+    const size_t heap_free = heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    ESP_LOGI(TAG, "Internal heap after WiFi init: %u bytes free", (unsigned int)heap_free);
+    if (heap_free < MEM_ARENA_SIZE + MEM_ARENA_MIN_FREE_HEAP) {
+        ESP_LOGE(TAG, "A %u byte arena would leave under %u bytes free; lower the MEM_BUDGET_* sizes",
+                 (unsigned int)MEM_ARENA_SIZE, (unsigned int)MEM_ARENA_MIN_FREE_HEAP);
+        abort();
+    }
+    mem_arena_init();
+}
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "ESP32-C6 IMU Web Monitor Starting...");
     
+    tlog_init();
+    if (sys_monitor_init() != ESP_OK) {
+        ESP_LOGW(TAG, "System monitor unavailable");
+    }
+    
     // Initialize NVS
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -273,11 +359,26 @@ void app_main(void)
     ESP_ERROR_CHECK(led_status_init(18));  // GPIO 18 default
     led_status_set_state(LED_STATUS_NO_WIFI);
 
+    // Connect to WiFi before reserving the arena, so the headroom check sees
+    // what the WiFi driver and lwIP leave
+    wifi_init_sta();
+    reserve_arena();
+
     // Initialize data buffer
     data_buffer_init();
-    
-    // Connect to WiFi
-    wifi_init_sta();
+    replay_init();
+    if (pipeline_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Sample pipeline unavailable");
+    }
+    if (blackbox_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Black box unavailable");
+    }
+    if (history_init() != ESP_OK) {
+        ESP_LOGW(TAG, "History store unavailable");
+    }
+    if (duty_cycle_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Duty-cycle scheduler unavailable");
+    }
     
     // Create tasks
     // ESP32-C6 is single-core, use core 0 or tskNO_AFFINITY
@@ -292,10 +393,18 @@ void app_main(void)
     
     ESP_LOGI(TAG, "All tasks created successfully");
     
-    // Main loop - just monitor system health
+    // Main loop - console summary of the system monitor; details via /api/system
     while (1) {
-        ESP_LOGI(TAG, "Free heap: %lu bytes", esp_get_free_heap_size());
-        ESP_LOGI(TAG, "Min free heap: %lu bytes", esp_get_minimum_free_heap_size());
         vTaskDelay(pdMS_TO_TICKS(30000)); // Log every 30 seconds
+        static sys_snapshot_t snap;    // ~1 KB, kept off the main task stack
+        if (sys_monitor_get_snapshot(&snap) == ESP_OK) {
+            ESP_LOGI(TAG, "CPU %.1f%%, free heap %lu bytes (min %lu, largest block %lu)",
+                     snap.cpu_busy_pct, (unsigned long)snap.heap[SYS_HEAP_INTERNAL].free,
+                     (unsigned long)snap.heap[SYS_HEAP_INTERNAL].min_free,
+                     (unsigned long)snap.heap[SYS_HEAP_INTERNAL].largest_block);
+        } else {
+            ESP_LOGI(TAG, "Free heap: %lu bytes", esp_get_free_heap_size());
+            ESP_LOGI(TAG, "Min free heap: %lu bytes", esp_get_minimum_free_heap_size());
+        }
     }
 }
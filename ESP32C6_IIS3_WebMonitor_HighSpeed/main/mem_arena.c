@@ -0,0 +1,177 @@
+#include "mem_arena.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "MEM_ARENA";
+
+static const uint32_t budgets[MEM_SUBSYS_COUNT] = {
+    [MEM_SUBSYS_DATA_BUFFER] = MEM_BUDGET_DATA_BUFFER,
+    [MEM_SUBSYS_WS_PLOT]     = MEM_BUDGET_WS_PLOT,
+    [MEM_SUBSYS_BLACKBOX]    = MEM_BUDGET_BLACKBOX,
+    [MEM_SUBSYS_HISTORY]     = MEM_BUDGET_HISTORY,
+    [MEM_SUBSYS_HTTP]        = MEM_BUDGET_HTTP,
+    [MEM_SUBSYS_DUTY]        = MEM_BUDGET_DUTY,
+    [MEM_SUBSYS_PIPELINE]    = MEM_BUDGET_PIPELINE,
+};
+
+static const char *const names[MEM_SUBSYS_COUNT] = {
+    [MEM_SUBSYS_DATA_BUFFER] = "data_buffer",
+    [MEM_SUBSYS_WS_PLOT]     = "ws_plot",
+    [MEM_SUBSYS_BLACKBOX]    = "blackbox",
+    [MEM_SUBSYS_HISTORY]     = "history",
+    [MEM_SUBSYS_HTTP]        = "http",
+    [MEM_SUBSYS_DUTY]        = "duty_cycle",
+    [MEM_SUBSYS_PIPELINE]    = "pipeline",
+};
+
+static portMUX_TYPE arena_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t *arena = NULL;
+static size_t arena_used = 0;
+static bool arena_init_done = false;
+static mem_subsys_usage_t usage[MEM_SUBSYS_COUNT];
+
+esp_err_t mem_arena_init(void)
+{
+    if (arena_init_done) {
+        return arena != NULL ? ESP_OK : ESP_ERR_NO_MEM;
+    }
+    arena_init_done = true;
+
+    for (int i = 0; i < MEM_SUBSYS_COUNT; i++) {
+        usage[i].budget = budgets[i];
+    }
+
+    // main.c reserves after WiFi init and before the HTTP server starts
+    arena = heap_caps_malloc(MEM_ARENA_SIZE, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    if (arena == NULL) {
+        ESP_LOGW(TAG, "Could not reserve %u byte arena (largest block %u), using the heap",
+                 (unsigned int)MEM_ARENA_SIZE,
+                 (unsigned int)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Arena reserved: %u bytes", (unsigned int)MEM_ARENA_SIZE);
+    return ESP_OK;
+}
+
+void *mem_arena_alloc(mem_subsys_t subsys, size_t size)
+{
+    if (subsys >= MEM_SUBSYS_COUNT || size == 0) {
+        return NULL;
+    }
+
+    const size_t padded = (size + MEM_ARENA_ALIGN - 1) & ~(size_t)(MEM_ARENA_ALIGN - 1);
+    void *ptr = NULL;
+    bool over_budget = false;
+
+    taskENTER_CRITICAL(&arena_lock);
+    mem_subsys_usage_t *u = &usage[subsys];
+    if (u->arena_bytes + u->heap_bytes + padded > u->budget) {
+        u->failures++;
+        over_budget = true;
+    } else if (arena != NULL && arena_used + padded <= MEM_ARENA_SIZE) {
+        ptr = arena + arena_used;
+        arena_used += padded;
+        u->arena_bytes += padded;
+        u->allocations++;
+    }
+    taskEXIT_CRITICAL(&arena_lock);
+
+    if (over_budget) {
+        ESP_LOGE(TAG, "%s: %u bytes exceeds budget (%u of %u used)", names[subsys],
+                 (unsigned int)size, (unsigned int)(u->arena_bytes + u->heap_bytes),
+                 (unsigned int)u->budget);
+        return NULL;
+    }
+
+    if (ptr != NULL) {
+        memset(ptr, 0, size);
+        return ptr;
+    }
+
+    // No arena: keep the budget accounting, but take the block from the heap
+    ptr = heap_caps_calloc(1, size, MALLOC_CAP_8BIT);
+    if (ptr != NULL) {
+        mem_arena_note_heap(subsys, padded);
+    } else {
+        ESP_LOGE(TAG, "%s: heap allocation of %u bytes failed", names[subsys], (unsigned int)size);
+    }
+    return ptr;
+}
+
+void mem_arena_free(mem_subsys_t subsys, void *ptr, size_t size)
+{
+    if (subsys >= MEM_SUBSYS_COUNT || ptr == NULL || size == 0) {
+        return;
+    }
+
+    const size_t padded = (size + MEM_ARENA_ALIGN - 1) & ~(size_t)(MEM_ARENA_ALIGN - 1);
+    const bool in_arena = arena != NULL && (uint8_t *)ptr >= arena && (uint8_t *)ptr < arena + MEM_ARENA_SIZE;
+
+    taskENTER_CRITICAL(&arena_lock);
+    mem_subsys_usage_t *u = &usage[subsys];
+    if (in_arena) {
+        if ((uint8_t *)ptr + padded == arena + arena_used) {
+            arena_used -= padded;
+        }
+        u->arena_bytes = (u->arena_bytes > padded) ? u->arena_bytes - padded : 0;
+    } else {
+        u->heap_bytes = (u->heap_bytes > padded) ? u->heap_bytes - padded : 0;
+    }
+    if (u->allocations > 0) {
+        u->allocations--;
+    }
+    taskEXIT_CRITICAL(&arena_lock);
+
+    if (!in_arena) {
+        heap_caps_free(ptr);
+    }
+}
+
+void mem_arena_note_heap(mem_subsys_t subsys, size_t size)
+{
+    if (subsys >= MEM_SUBSYS_COUNT) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&arena_lock);
+    usage[subsys].heap_bytes += size;
+    usage[subsys].allocations++;
+    taskEXIT_CRITICAL(&arena_lock);
+}
+
+esp_err_t mem_arena_get_report(mem_report_t *report)
+{
+    if (report == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(report, 0, sizeof(*report));
+    taskENTER_CRITICAL(&arena_lock);
+    report->arena_size = (arena != NULL) ? MEM_ARENA_SIZE : 0;
+    report->arena_used = arena_used;
+    memcpy(report->subsys, usage, sizeof(usage));
+    taskEXIT_CRITICAL(&arena_lock);
+
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+    report->heap_total = heap_caps_get_total_size(MALLOC_CAP_8BIT);
+    report->heap_free = info.total_free_bytes;
+    report->heap_min_free = info.minimum_free_bytes;
+    report->heap_largest_block = info.largest_free_block;
+    report->heap_allocated_blocks = info.allocated_blocks;
+    report->heap_free_blocks = info.free_blocks;
+    if (info.total_free_bytes > 0) {
+        report->heap_fragmentation_pct =
+            100.0f * (1.0f - (float)info.largest_free_block / (float)info.total_free_bytes);
+    }
+    return ESP_OK;
+}
+
+const char *mem_arena_subsys_name(mem_subsys_t subsys)
+{
+    return (subsys < MEM_SUBSYS_COUNT) ? names[subsys] : "unknown";
+}
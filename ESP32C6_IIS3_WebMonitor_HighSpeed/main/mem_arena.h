@@ -0,0 +1,76 @@
+#ifndef MEM_ARENA_H
+#define MEM_ARENA_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Boot-time arena: one contiguous region, carved into long-lived pipeline buffers.
+// Budgets are the upper bound per subsystem; raise a budget together with the
+// matching buffer size (DATA_BUFFER_SIZE, BLACKBOX_FULLRATE_BLOCKS, ...) after
+// checking heap headroom in /api/memory.
+#define MEM_BUDGET_DATA_BUFFER      (49 * 1024)     // Columnar sample ring
+#define MEM_BUDGET_WS_PLOT          (8 * 1024)      // WebSocket frame scratch + JSON buffer
+#define MEM_BUDGET_BLACKBOX         (68 * 1024)     // Full-rate blocks + trend loop
+#define MEM_BUDGET_HISTORY          (62 * 1024)     // History pyramid tiers
+#define MEM_BUDGET_HTTP             (8 * 1024)      // CSV/JSON export scratch
+#define MEM_BUDGET_DUTY             0               // Raw window is heap-allocated on demand
+#define MEM_BUDGET_PIPELINE         (32 * 1024)     // Ring-sink broadcast rings
+#define MEM_ARENA_SIZE              (MEM_BUDGET_DATA_BUFFER + MEM_BUDGET_WS_PLOT + \
+                                     MEM_BUDGET_BLACKBOX + MEM_BUDGET_HISTORY + \
+                                     MEM_BUDGET_HTTP + MEM_BUDGET_DUTY + \
+                                     MEM_BUDGET_PIPELINE)
+#define MEM_ARENA_ALIGN             8
+// Internal heap that must still be free once the arena is reserved after WiFi init:
+// the imu, web server and UDP task stacks (14 KB), the HTTP server task and its
+// sessions, and lwIP/WiFi RX buffers taken per packet. An estimate, not a board
+// measurement; compare with heap_min_free in /api/memory and adjust.
+#define MEM_ARENA_MIN_FREE_HEAP     (48 * 1024)
+
+typedef enum {
+    MEM_SUBSYS_DATA_BUFFER = 0,
+    MEM_SUBSYS_WS_PLOT,
+    MEM_SUBSYS_BLACKBOX,
+    MEM_SUBSYS_HISTORY,
+    MEM_SUBSYS_HTTP,
+    MEM_SUBSYS_DUTY,
+    MEM_SUBSYS_PIPELINE,
+    MEM_SUBSYS_COUNT
+} mem_subsys_t;
+
+typedef struct {
+    uint32_t budget;
+    uint32_t arena_bytes;       // Carved from the arena
+    uint32_t heap_bytes;        // Long-lived heap allocations reported by the subsystem
+    uint16_t allocations;
+    uint16_t failures;          // Requests refused because they exceeded the budget
+} mem_subsys_usage_t;
+
+typedef struct {
+    uint32_t arena_size;        // 0 if the region could not be reserved at boot
+    uint32_t arena_used;
+    mem_subsys_usage_t subsys[MEM_SUBSYS_COUNT];
+    uint32_t heap_total;
+    uint32_t heap_free;
+    uint32_t heap_min_free;     // Low-water mark since boot
+    uint32_t heap_largest_block;
+    uint32_t heap_allocated_blocks;
+    uint32_t heap_free_blocks;
+    float heap_fragmentation_pct; // 100 * (1 - largest_block / free)
+} mem_report_t;
+
+// Memory arena API
+esp_err_t mem_arena_init(void);
+// Zeroed, MEM_ARENA_ALIGN-aligned block that lives until reboot.
+// Falls back to the heap if the arena could not be reserved; NULL when over budget.
+void *mem_arena_alloc(mem_subsys_t subsys, size_t size);
+// Give a block back to its subsystem's budget when an init step fails after allocating.
+// Arena space is reclaimed only for the most recent block, so unwind in reverse order.
+void mem_arena_free(mem_subsys_t subsys, void *ptr, size_t size);
+// Account a long-lived heap allocation made outside the arena
+void mem_arena_note_heap(mem_subsys_t subsys, size_t size);
+esp_err_t mem_arena_get_report(mem_report_t *report);
+const char *mem_arena_subsys_name(mem_subsys_t subsys);
+
+#endif // MEM_ARENA_H
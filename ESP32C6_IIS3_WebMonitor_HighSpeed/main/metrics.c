@@ -0,0 +1,288 @@
+#include "metrics.h"
+#include "data_buffer.h"
+#include "pipeline.h"
+#include "bcast_ring.h"
+#include "mem_arena.h"
+#include "web_server.h"
+#include "tlog.h"
+#include "trace.h"
+#include "esp_timer.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define METRICS_RENDER_BUF      512
+#define METRICS_LINE_MAX        192
+
+atomic_uint metrics_values[METRIC_COUNT];
+
+typedef struct {
+    const char *name;
+    const char *help;
+    bool gauge;
+    float scale;                // Exported value = raw * scale
+} metric_def_t;
+
+static const metric_def_t metric_defs[METRIC_COUNT] = {
+    [METRIC_IMU_BATCHES]        = { "imu_batches_total", "Acquisition cycles that produced samples", false, 1.0f },
+    [METRIC_IMU_SAMPLES]        = { "imu_samples_total", "Accelerometer samples acquired from the sensor or replay", false, 1.0f },
+    [METRIC_IMU_READ_ERRORS]    = { "imu_read_errors_total", "Failed acquisition cycles", false, 1.0f },
+    [METRIC_IMU_FIFO_OVERFLOWS] = { "imu_fifo_overflows_total", "IIS3DWB FIFO overflows (samples lost inside the sensor)", false, 1.0f },
+    [METRIC_SPI_FIFO_BYTES]     = { "spi_fifo_bytes_total", "Bytes read by FIFO bursts", false, 1.0f },
+    [METRIC_SPI_FIFO_BUSY_US]   = { "spi_fifo_busy_seconds_total", "Time spent in FIFO bursts", false, 1e-6f },
+    [METRIC_WS_FRAMES]          = { "ws_frames_total", "Plot frames delivered to at least one WebSocket client", false, 1.0f },
+    [METRIC_WS_SEND_ERRORS]     = { "ws_send_errors_total", "WebSocket frame sends that failed", false, 1.0f },
+    [METRIC_IMU_FIFO_LEVEL]     = { "imu_fifo_level", "FIFO entries waiting at the last drain", true, 1.0f },
+    [METRIC_IMU_FIFO_LEVEL_MAX] = { "imu_fifo_level_max", "Highest FIFO level seen since boot", true, 1.0f },
+};
+
+static portMUX_TYPE task_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t tasks[METRICS_MAX_TASKS];
+static uint8_t task_count = 0;
+
+void metrics_register_task(TaskHandle_t task)
+{
+    if (task == NULL) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+
+    taskENTER_CRITICAL(&task_lock);
+    bool known = false;
+    for (uint8_t i = 0; i < task_count; i++) {
+        if (tasks[i] == task) {
+            known = true;
+            break;
+        }
+    }
+    if (!known && task_count < METRICS_MAX_TASKS) {
+        tasks[task_count++] = task;
+    }
+    taskEXIT_CRITICAL(&task_lock);
+}
+
+// Output is batched into a small buffer and flushed through the caller's writer;
+// the first write error stops further output
+typedef struct {
+    metrics_write_fn_t write;
+    void *ctx;
+    char buf[METRICS_RENDER_BUF];
+    size_t len;
+    esp_err_t err;
+} render_ctx_t;
+
+static void flush(render_ctx_t *r)
+{
+    if (r->err == ESP_OK && r->len > 0) {
+        r->err = r->write(r->ctx, r->buf, r->len);
+    }
+    r->len = 0;
+}
+
+static void emit(render_ctx_t *r, const char *fmt, ...)
+{
+    char line[METRICS_LINE_MAX];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (n <= 0) {
+        return;
+    }
+    if ((size_t)n >= sizeof(line)) {
+        n = sizeof(line) - 1;
+    }
+    if (r->len + (size_t)n > sizeof(r->buf)) {
+        flush(r);
+    }
+    memcpy(r->buf + r->len, line, (size_t)n);
+    r->len += (size_t)n;
+}
+
+static void emit_header(render_ctx_t *r, const char *name, const char *help, bool gauge)
+{
+    emit(r, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, gauge ? "gauge" : "counter");
+}
+
+static void emit_value(render_ctx_t *r, const char *name, const char *help, bool gauge, double value)
+{
+    emit_header(r, name, help, gauge);
+    emit(r, "%s %.9g\n", name, value);
+}
+
+static void render_counters(render_ctx_t *r)
+{
+    for (int i = 0; i < METRIC_COUNT; i++) {
+        const metric_def_t *def = &metric_defs[i];
+        const uint32_t raw = metrics_get((metric_id_t)i);
+        emit_value(r, def->name, def->help, def->gauge,
+                   def->scale == 1.0f ? (double)raw : (double)raw * def->scale);
+    }
+}
+
+static void render_buffer(render_ctx_t *r)
+{
+    buffer_stats_t stats;
+    if (data_buffer_get_stats(&stats) != ESP_OK) {
+        return;
+    }
+    emit_value(r, "buffer_samples_total", "Samples stored in the sample buffer", false, stats.total_samples);
+    emit_value(r, "buffer_dropped_samples_total", "Samples the sample buffer refused", false, stats.dropped_samples);
+    emit_value(r, "buffer_overflows_total", "Oldest samples overwritten in the sample buffer", false, stats.buffer_overflows);
+    emit_value(r, "buffer_fill_samples", "Samples currently held in the sample buffer", true, data_buffer_get_count());
+}
+
+typedef enum {
+    RING_FIELD_LAG = 0,         // Queue depth of the consumer
+    RING_FIELD_READ,
+    RING_FIELD_MISSED,          // Consumer drops
+} ring_field_t;
+
+// One labelled line per consumer of every ring sink
+static void emit_ring_family(render_ctx_t *r, const char *name, const char *help, bool gauge, ring_field_t field)
+{
+    const size_t node_count = pipeline_get_node_count();
+    pipeline_node_info_t node;
+
+    emit_header(r, name, help, gauge);
+    for (size_t id = 0; id < node_count; id++) {
+        if (pipeline_get_node((pipeline_node_id_t)id, &node) != ESP_OK || node.ring == NULL) {
+            continue;
+        }
+        for (uint8_t c = 0; c < node.ring->consumer_count; c++) {
+            bcast_consumer_stats_t cs;
+            if (bcast_ring_get_consumer_stats(node.ring, (bcast_consumer_id_t)c, &cs) != ESP_OK) {
+                continue;
+            }
+            const uint32_t value = (field == RING_FIELD_LAG) ? cs.lag
+                                 : (field == RING_FIELD_READ) ? cs.read_total : cs.missed_total;
+            emit(r, "%s{ring=\"%s\",consumer=\"%s\"} %lu\n", name, node.name, cs.name, (unsigned long)value);
+        }
+    }
+}
+
+static void render_pipeline(render_ctx_t *r)
+{
+    const size_t edge_count = pipeline_get_edge_count();
+    pipeline_edge_info_t edges[PIPELINE_MAX_EDGES];
+    pipeline_node_info_t from;
+    pipeline_node_info_t to;
+    size_t n = 0;
+
+    for (size_t i = 0; i < edge_count && n < PIPELINE_MAX_EDGES; i++) {
+        if (pipeline_get_edge(i, &edges[n]) == ESP_OK) {
+            n++;
+        }
+    }
+
+    emit_header(r, "pipeline_edge_samples_total", "Samples delivered along a pipeline edge", false);
+    for (size_t i = 0; i < n; i++) {
+        if (pipeline_get_node(edges[i].from, &from) == ESP_OK &&
+            pipeline_get_node(edges[i].to, &to) == ESP_OK) {
+            emit(r, "pipeline_edge_samples_total{from=\"%s\",to=\"%s\"} %lu\n",
+                 from.name, to.name, (unsigned long)edges[i].samples);
+        }
+    }
+
+    emit_ring_family(r, "ring_consumer_lag_samples",
+                     "Samples published to a ring but not yet read by the consumer", true, RING_FIELD_LAG);
+    emit_ring_family(r, "ring_consumer_read_samples_total",
+                     "Samples read from a ring by the consumer", false, RING_FIELD_READ);
+    emit_ring_family(r, "ring_consumer_missed_samples_total",
+                     "Samples overwritten before the consumer read them", false, RING_FIELD_MISSED);
+}
+
+static void render_ws_clients(render_ctx_t *r)
+{
+    web_server_ws_client_t clients[WEBSOCKET_MAX_CONNECTIONS];
+    const size_t n = web_server_get_ws_clients(clients, WEBSOCKET_MAX_CONNECTIONS);
+
+    emit_value(r, "ws_clients", "Connected WebSocket clients", true, (double)n);
+    emit_header(r, "ws_client_bytes_total", "Bytes queued to a WebSocket client since it connected", false);
+    for (size_t i = 0; i < n; i++) {
+        emit(r, "ws_client_bytes_total{slot=\"%u\",fd=\"%d\"} %lu\n",
+             (unsigned int)clients[i].slot, clients[i].fd, (unsigned long)clients[i].bytes_sent);
+    }
+    emit_header(r, "ws_client_frames_total", "Frames queued to a WebSocket client since it connected", false);
+    for (size_t i = 0; i < n; i++) {
+        emit(r, "ws_client_frames_total{slot=\"%u\",fd=\"%d\"} %lu\n",
+             (unsigned int)clients[i].slot, clients[i].fd, (unsigned long)clients[i].frames_sent);
+    }
+    emit_header(r, "ws_client_send_errors_total", "Failed frame sends to a WebSocket client", false);
+    for (size_t i = 0; i < n; i++) {
+        emit(r, "ws_client_send_errors_total{slot=\"%u\",fd=\"%d\"} %lu\n",
+             (unsigned int)clients[i].slot, clients[i].fd, (unsigned long)clients[i].send_errors);
+    }
+}
+
+static void render_memory(render_ctx_t *r)
+{
+    mem_report_t report;
+    if (mem_arena_get_report(&report) != ESP_OK) {
+        return;
+    }
+    emit_value(r, "heap_free_bytes", "Free heap", true, report.heap_free);
+    emit_value(r, "heap_min_free_bytes", "Lowest free heap since boot", true, report.heap_min_free);
+    emit_value(r, "heap_largest_free_block_bytes", "Largest allocatable heap block", true, report.heap_largest_block);
+    emit_value(r, "arena_used_bytes", "Boot arena bytes handed out", true, report.arena_used);
+    emit_header(r, "arena_subsystem_bytes", "Boot arena bytes held by a subsystem", true);
+    for (int i = 0; i < MEM_SUBSYS_COUNT; i++) {
+        emit(r, "arena_subsystem_bytes{subsystem=\"%s\"} %lu\n",
+             mem_arena_subsys_name((mem_subsys_t)i), (unsigned long)report.subsys[i].arena_bytes);
+    }
+}
+
+static void render_tasks(render_ctx_t *r)
+{
+    TaskHandle_t snapshot[METRICS_MAX_TASKS];
+    taskENTER_CRITICAL(&task_lock);
+    const uint8_t n = task_count;
+    memcpy(snapshot, tasks, n * sizeof(snapshot[0]));
+    taskEXIT_CRITICAL(&task_lock);
+
+    // ESP-IDF reports the high-water mark in bytes
+    emit_header(r, "task_stack_high_water_bytes", "Least free stack a task has had since it started", true);
+    for (uint8_t i = 0; i < n; i++) {
+        emit(r, "task_stack_high_water_bytes{task=\"%s\"} %lu\n",
+             pcTaskGetName(snapshot[i]), (unsigned long)uxTaskGetStackHighWaterMark(snapshot[i]));
+    }
+}
+
+static void render_diagnostics(render_ctx_t *r)
+{
+    tlog_stats_t log_stats;
+    trace_stats_t trace_stats;
+    tlog_get_stats(&log_stats);
+    trace_get_stats(&trace_stats);
+
+    emit_value(r, "log_entries_total", "Deferred log entries written", false, log_stats.written);
+    emit_value(r, "log_entries_overwritten_total", "Deferred log entries lost before they were printed", false,
+               log_stats.overwritten);
+    emit_value(r, "trace_events_total", "Trace events recorded", false, trace_stats.recorded);
+    emit_value(r, "trace_events_dropped_total", "Trace events skipped while the ring was exported", false,
+               trace_stats.dropped);
+    emit_value(r, "uptime_seconds", "Time since boot", false, esp_timer_get_time() / 1e6);
+}
+
+esp_err_t metrics_render(metrics_write_fn_t write, void *ctx)
+{
+    if (write == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    render_ctx_t r = {
+        .write = write,
+        .ctx = ctx,
+        .len = 0,
+        .err = ESP_OK,
+    };
+
+    render_counters(&r);
+    render_buffer(&r);
+    render_pipeline(&r);
+    render_ws_clients(&r);
+    render_memory(&r);
+    render_tasks(&r);
+    render_diagnostics(&r);
+    flush(&r);
+    return r.err;
+}
@@ -0,0 +1,72 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Runtime metrics served as Prometheus text on GET /metrics. Hot paths update the
+// values below with one relaxed atomic op; everything else (heap, rings, pipeline
+// edges, arena, task stacks) is read from its owner when the endpoint renders.
+// Counters are 32-bit and wrap; Prometheus rate() treats the wrap as a reset.
+#define METRICS_MAX_TASKS   12
+
+typedef enum {
+    // Counters
+    METRIC_IMU_BATCHES = 0,         // Successful acquisition cycles (sensor or replay)
+    METRIC_IMU_SAMPLES,             // Samples acquired
+    METRIC_IMU_READ_ERRORS,
+    METRIC_IMU_FIFO_OVERFLOWS,
+    METRIC_SPI_FIFO_BYTES,          // Bytes moved by FIFO bursts
+    METRIC_SPI_FIFO_BUSY_US,        // Time spent inside FIFO bursts
+    METRIC_WS_FRAMES,               // Frames handed to at least one client
+    METRIC_WS_SEND_ERRORS,
+    // Gauges
+    METRIC_IMU_FIFO_LEVEL,          // FIFO entries waiting at the last drain
+    METRIC_IMU_FIFO_LEVEL_MAX,      // Highest FIFO level seen since boot
+    METRIC_COUNT,
+} metric_id_t;
+
+extern atomic_uint metrics_values[METRIC_COUNT];
+
+static inline void metrics_add(metric_id_t id, uint32_t n)
+{
+    atomic_fetch_add_explicit(&metrics_values[id], n, memory_order_relaxed);
+}
+
+static inline void metrics_inc(metric_id_t id)
+{
+    metrics_add(id, 1);
+}
+
+static inline void metrics_set(metric_id_t id, uint32_t value)
+{
+    atomic_store_explicit(&metrics_values[id], value, memory_order_relaxed);
+}
+
+static inline void metrics_max(metric_id_t id, uint32_t value)
+{
+    unsigned int current = atomic_load_explicit(&metrics_values[id], memory_order_relaxed);
+    while (value > current &&
+           !atomic_compare_exchange_weak_explicit(&metrics_values[id], &current, value,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static inline uint32_t metrics_get(metric_id_t id)
+{
+    return atomic_load_explicit(&metrics_values[id], memory_order_relaxed);
+}
+
+// Output sink for metrics_render(), e.g. httpd_resp_send_chunk()
+typedef esp_err_t (*metrics_write_fn_t)(void *ctx, const char *data, size_t len);
+
+// Metrics API
+// Tasks whose stack high-water mark is exported; call once after creating the task
+void metrics_register_task(TaskHandle_t task);
+esp_err_t metrics_render(metrics_write_fn_t write, void *ctx);
+
+#endif // METRICS_H
@@ -0,0 +1,620 @@
+#include "pipeline.h"
+#include "mem_arena.h"
+#include "replay.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "PIPELINE";
+
+// Stage transform: returns true when `out` holds samples to forward
+typedef struct pipeline_node pipeline_node_t;
+typedef bool (*pipeline_stage_fn_t)(pipeline_node_t *node, const pipeline_block_t *in, pipeline_block_t *out);
+
+typedef struct {
+    int32_t sum[3];
+    uint16_t n;
+} decimate_state_t;
+
+typedef struct {
+    int32_t prev[3];
+    int32_t acc[3];             // Output in Q8
+    bool primed;
+} dc_block_state_t;
+
+struct pipeline_node {
+    char name[PIPELINE_NAME_LEN];
+    pipeline_node_kind_t kind;
+    uint32_t seq;               // Blocks emitted (sources and stages)
+
+    // Stage
+    pipeline_stage_fn_t transform;
+    int32_t param_min;          // Declared range, from stage_defs
+    int32_t param_max;
+    int32_t param;              // In use; owned by the task running the stage
+    int32_t pending_param;      // Set by pipeline_set_param() under pipeline_lock
+    volatile bool reset;        // Parameter changed, restart the stage state
+    imu_manager_full_scale_t last_scale;
+    float last_odr;
+    union {
+        decimate_state_t decimate;
+        dc_block_state_t dc_block;
+    } state;
+
+    // Sink
+    pipeline_sink_fn_t fn;
+    void *ctx;
+    bcast_ring_t *ring;
+};
+
+// Edges are appended and never removed, so the acquisition task walks them
+// without a lock; disconnect only clears `enabled`.
+typedef struct {
+    pipeline_node_id_t from;
+    pipeline_node_id_t to;
+    volatile bool enabled;
+    volatile uint32_t blocks;
+    volatile uint32_t samples;
+    uint32_t rate_prev_samples; // Throughput window, owned by pipeline_get_edge()
+    int64_t rate_prev_us;
+} pipeline_edge_t;
+
+static portMUX_TYPE pipeline_lock = portMUX_INITIALIZER_UNLOCKED;
+static pipeline_node_t nodes[PIPELINE_MAX_NODES];
+static volatile uint8_t node_count = 0;
+static pipeline_edge_t edges[PIPELINE_MAX_EDGES];
+static volatile uint8_t edge_count = 0;
+static pipeline_node_id_t imu_source = 0;
+static pipeline_node_id_t replay_source = 0;
+static bool pipeline_ready = false;
+// Scratch node for pipeline_stage_run(); never registered, so the live graph
+// does not see it
+static pipeline_node_t offline_node;
+
+static void push_block(pipeline_node_id_t from, const pipeline_block_t *block);
+
+static inline int16_t clamp_i16(int32_t v)
+{
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+// Restart stage state on parameter, scale or rate changes
+static bool stage_needs_reset(pipeline_node_t *node, const pipeline_block_t *in)
+{
+    bool reset = false;
+    if (node->reset) {
+        // Take the new parameter between blocks, never partway through one
+        taskENTER_CRITICAL(&pipeline_lock);
+        node->param = node->pending_param;
+        node->reset = false;
+        taskEXIT_CRITICAL(&pipeline_lock);
+        reset = true;
+    }
+    if (reset || in->scale != node->last_scale || in->odr_hz != node->last_odr) {
+        node->last_scale = in->scale;
+        node->last_odr = in->odr_hz;
+        return true;
+    }
+    return false;
+}
+
+// Boxcar average of `param` samples; carries partial sums across blocks
+static bool stage_decimate(pipeline_node_t *node, const pipeline_block_t *in, pipeline_block_t *out)
+{
+    decimate_state_t *st = &node->state.decimate;
+    if (stage_needs_reset(node, in)) {
+        memset(st, 0, sizeof(*st));
+    }
+
+    const int32_t factor = node->param;
+    uint16_t produced = 0;
+    for (uint16_t i = 0; i < in->count; i++) {
+        st->sum[0] += in->xyz[i * 3 + 0];
+        st->sum[1] += in->xyz[i * 3 + 1];
+        st->sum[2] += in->xyz[i * 3 + 2];
+        if (++st->n >= factor) {
+            for (int axis = 0; axis < 3; axis++) {
+                const int32_t s = st->sum[axis];
+                out->xyz[produced * 3 + axis] = (int16_t)((s >= 0 ? s + factor / 2 : s - factor / 2) / factor);
+                st->sum[axis] = 0;
+            }
+            st->n = 0;
+            produced++;
+        }
+    }
+
+    out->count = produced;
+    out->scale = in->scale;
+    out->odr_hz = in->odr_hz / (float)factor;
+    out->timestamp_us = in->timestamp_us;
+    return produced > 0;
+}
+
+// One-pole DC blocker y[n] = x[n] - x[n-1] + (1 - 2^-param) y[n-1]
+static bool stage_dc_block(pipeline_node_t *node, const pipeline_block_t *in, pipeline_block_t *out)
+{
+    dc_block_state_t *st = &node->state.dc_block;
+    if (stage_needs_reset(node, in)) {
+        memset(st, 0, sizeof(*st));
+    }
+
+    const int32_t shift = node->param;
+    for (uint16_t i = 0; i < in->count; i++) {
+        for (int axis = 0; axis < 3; axis++) {
+            const int32_t x = in->xyz[i * 3 + axis];
+            if (!st->primed) {
+                st->prev[axis] = x;
+            }
+            st->acc[axis] += (x - st->prev[axis]) * 256 - (st->acc[axis] >> shift);
+            st->prev[axis] = x;
+            out->xyz[i * 3 + axis] = clamp_i16(st->acc[axis] >> 8);
+        }
+        st->primed = true;
+    }
+
+    out->count = in->count;
+    out->scale = in->scale;
+    out->odr_hz = in->odr_hz;
+    out->timestamp_us = in->timestamp_us;
+    return in->count > 0;
+}
+
+// Built-in stages with the parameter range each one accepts
+typedef struct {
+    const char *name;
+    pipeline_stage_fn_t transform;
+    int32_t param_min;
+    int32_t param_max;
+    int32_t param_default;
+} stage_def_t;
+
+static const stage_def_t stage_defs[] = {
+    { PIPELINE_STAGE_DC_BLOCK, stage_dc_block, PIPELINE_DC_BLOCK_MIN_SHIFT, PIPELINE_DC_BLOCK_MAX_SHIFT,
+      PIPELINE_DC_BLOCK_DEFAULT_SHIFT },
+    { PIPELINE_STAGE_DECIMATE, stage_decimate, 1, PIPELINE_DECIMATE_MAX, PIPELINE_DECIMATE_DEFAULT },
+};
+
+static const stage_def_t *find_stage_def(const char *name)
+{
+    for (size_t i = 0; i < sizeof(stage_defs) / sizeof(stage_defs[0]); i++) {
+        if (strcmp(stage_defs[i].name, name) == 0) {
+            return &stage_defs[i];
+        }
+    }
+    return NULL;
+}
+
+static void deliver(pipeline_edge_t *edge, const pipeline_block_t *block)
+{
+    pipeline_node_t *node = &nodes[edge->to];
+
+    switch (node->kind) {
+        case PIPELINE_NODE_SINK:
+            if (node->ring != NULL) {
+                bcast_ring_write(node->ring, block->xyz, block->count, block->scale,
+                                 block->odr_hz, block->timestamp_us);
+            } else if (node->fn != NULL) {
+                node->fn(block, node->ctx);
+            }
+            break;
+        case PIPELINE_NODE_STAGE: {
+            pipeline_block_t out;
+            if (node->transform(node, block, &out)) {
+                out.seq = ++node->seq;
+                push_block(edge->to, &out);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void push_block(pipeline_node_id_t from, const pipeline_block_t *block)
+{
+    const uint8_t count = edge_count;
+    for (uint8_t i = 0; i < count; i++) {
+        pipeline_edge_t *edge = &edges[i];
+        if (edge->from != from || !edge->enabled) {
+            continue;
+        }
+        edge->blocks++;
+        edge->samples += block->count;
+        deliver(edge, block);
+    }
+}
+
+// Raw listener on imu_manager: injected chunks come from the replay source
+static void pipeline_raw_listener(const int16_t *xyz, uint16_t count, imu_manager_full_scale_t scale,
+                                  float odr_hz, uint64_t timestamp_us)
+{
+    const pipeline_node_id_t source = replay_is_active() ? replay_source : imu_source;
+    pipeline_block_t block;
+
+    while (count > 0) {
+        const uint16_t chunk = count > PIPELINE_BLOCK_SAMPLES ? PIPELINE_BLOCK_SAMPLES : count;
+        memcpy(block.xyz, xyz, chunk * 3 * sizeof(int16_t));
+        block.count = chunk;
+        block.scale = scale;
+        block.odr_hz = odr_hz;
+        block.timestamp_us = timestamp_us;
+        block.seq = ++nodes[source].seq;
+        push_block(source, &block);
+        xyz += chunk * 3;
+        count -= chunk;
+    }
+}
+
+static int find_node(const char *name)
+{
+    if (name == NULL) {
+        return -1;
+    }
+    for (uint8_t i = 0; i < node_count; i++) {
+        if (strncmp(nodes[i].name, name, PIPELINE_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Copy a fully configured node into the table; it is visible to lookups and edges
+// only once node_count covers it
+static esp_err_t register_node(const pipeline_node_t *tmpl, pipeline_node_id_t *id)
+{
+    if (tmpl->name[0] == '\0') {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    taskENTER_CRITICAL(&pipeline_lock);
+    if (find_node(tmpl->name) >= 0) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else if (node_count >= PIPELINE_MAX_NODES) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        nodes[node_count] = *tmpl;
+        if (id != NULL) {
+            *id = node_count;
+        }
+        node_count++;
+    }
+    taskEXIT_CRITICAL(&pipeline_lock);
+    return ret;
+}
+
+static esp_err_t node_template(pipeline_node_t *tmpl, const char *name, pipeline_node_kind_t kind)
+{
+    if (name == NULL || name[0] == '\0' || strlen(name) >= PIPELINE_NAME_LEN) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(tmpl, 0, sizeof(*tmpl));
+    strncpy(tmpl->name, name, PIPELINE_NAME_LEN - 1);
+    tmpl->kind = kind;
+    return ESP_OK;
+}
+
+static esp_err_t add_source(const char *name, pipeline_node_id_t *id)
+{
+    pipeline_node_t tmpl;
+    esp_err_t ret = node_template(&tmpl, name, PIPELINE_NODE_SOURCE);
+    return (ret == ESP_OK) ? register_node(&tmpl, id) : ret;
+}
+
+static esp_err_t add_stage(const stage_def_t *def)
+{
+    pipeline_node_t tmpl;
+    esp_err_t ret = node_template(&tmpl, def->name, PIPELINE_NODE_STAGE);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    tmpl.transform = def->transform;
+    tmpl.param_min = def->param_min;
+    tmpl.param_max = def->param_max;
+    tmpl.param = def->param_default;
+    tmpl.pending_param = def->param_default;
+    tmpl.reset = true;
+    return register_node(&tmpl, NULL);
+}
+
+esp_err_t pipeline_init(void)
+{
+    if (pipeline_ready) {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = add_source(PIPELINE_SOURCE_IMU, &imu_source);
+    if (ret == ESP_OK) {
+        ret = add_source(PIPELINE_SOURCE_REPLAY, &replay_source);
+    }
+    // Registration order is the allowed stage->stage direction: filter, then decimate
+    for (size_t i = 0; ret == ESP_OK && i < sizeof(stage_defs) / sizeof(stage_defs[0]); i++) {
+        ret = add_stage(&stage_defs[i]);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create built-in nodes: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    pipeline_connect_sources(PIPELINE_STAGE_DECIMATE);
+
+    ret = imu_manager_add_raw_listener(pipeline_raw_listener);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to register raw listener: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    pipeline_ready = true;
+    ESP_LOGI(TAG, "Pipeline ready (%u-sample blocks)", (unsigned int)PIPELINE_BLOCK_SAMPLES);
+    return ESP_OK;
+}
+
+esp_err_t pipeline_add_sink(const char *name, pipeline_sink_fn_t fn, void *ctx, pipeline_node_id_t *id)
+{
+    if (fn == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pipeline_node_t tmpl;
+    esp_err_t ret = node_template(&tmpl, name, PIPELINE_NODE_SINK);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    tmpl.fn = fn;
+    tmpl.ctx = ctx;
+    return register_node(&tmpl, id);
+}
+
+esp_err_t pipeline_add_ring_sink(const char *name, uint32_t capacity, pipeline_node_id_t *id)
+{
+    pipeline_node_t tmpl;
+    esp_err_t ret = node_template(&tmpl, name, PIPELINE_NODE_SINK);
+    if (ret != ESP_OK || capacity < PIPELINE_RING_MIN_WRITE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (find_node(name) >= 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // Checked again by register_node(); this only avoids carving a ring for a full table
+    if (node_count >= PIPELINE_MAX_NODES) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    bcast_ring_t *ring = mem_arena_alloc(MEM_SUBSYS_PIPELINE, sizeof(bcast_ring_t));
+    if (ring == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ret = bcast_ring_init(ring, name, capacity, capacity / PIPELINE_RING_MIN_WRITE, MEM_SUBSYS_PIPELINE);
+    if (ret == ESP_OK) {
+        tmpl.ring = ring;
+        ret = register_node(&tmpl, id);
+        if (ret != ESP_OK) {
+            bcast_ring_deinit(ring, MEM_SUBSYS_PIPELINE);
+        }
+    }
+    if (ret != ESP_OK) {
+        mem_arena_free(MEM_SUBSYS_PIPELINE, ring, sizeof(bcast_ring_t));
+    }
+    return ret;
+}
+
+bcast_ring_t *pipeline_get_ring(pipeline_node_id_t id)
+{
+    return (id < node_count) ? nodes[id].ring : NULL;
+}
+
+esp_err_t pipeline_connect(const char *from, const char *to)
+{
+    const int src = find_node(from);
+    const int dst = find_node(to);
+    if (src < 0 || dst < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // Sources feed, sinks terminate; stage chains follow registration order so
+    // the graph stays acyclic and push_block() recursion stays bounded
+    const pipeline_node_kind_t src_kind = nodes[src].kind;
+    const pipeline_node_kind_t dst_kind = nodes[dst].kind;
+    if (src_kind == PIPELINE_NODE_SINK || dst_kind == PIPELINE_NODE_SOURCE ||
+        (src_kind == PIPELINE_NODE_STAGE && dst_kind == PIPELINE_NODE_STAGE && src >= dst)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    taskENTER_CRITICAL(&pipeline_lock);
+    int existing = -1;
+    for (uint8_t i = 0; i < edge_count; i++) {
+        if (edges[i].from == src && edges[i].to == dst) {
+            existing = i;
+            break;
+        }
+    }
+    if (existing >= 0) {
+        edges[existing].enabled = true;
+    } else if (edge_count >= PIPELINE_MAX_EDGES) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        pipeline_edge_t *edge = &edges[edge_count];
+        memset(edge, 0, sizeof(*edge));
+        edge->from = (pipeline_node_id_t)src;
+        edge->to = (pipeline_node_id_t)dst;
+        edge->enabled = true;
+        edge_count++;
+    }
+    taskEXIT_CRITICAL(&pipeline_lock);
+    return ret;
+}
+
+esp_err_t pipeline_disconnect(const char *from, const char *to)
+{
+    const int src = find_node(from);
+    const int dst = find_node(to);
+    if (src < 0 || dst < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    for (uint8_t i = 0; i < edge_count; i++) {
+        if (edges[i].from == src && edges[i].to == dst) {
+            edges[i].enabled = false;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t pipeline_connect_sources(const char *to)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    for (uint8_t i = 0; i < node_count; i++) {
+        if (nodes[i].kind == PIPELINE_NODE_SOURCE) {
+            ret = pipeline_connect(nodes[i].name, to);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+    return ret;
+}
+
+esp_err_t pipeline_set_param(const char *stage, int32_t value)
+{
+    const int id = find_node(stage);
+    if (id < 0 || nodes[id].kind != PIPELINE_NODE_STAGE) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    pipeline_node_t *node = &nodes[id];
+    if (value < node->param_min || value > node->param_max) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // The acquisition task picks it up at its next block (stage_needs_reset())
+    taskENTER_CRITICAL(&pipeline_lock);
+    node->pending_param = value;
+    node->reset = true;
+    taskEXIT_CRITICAL(&pipeline_lock);
+    ESP_LOGI(TAG, "%s parameter set to %ld", node->name, (long)value);
+    return ESP_OK;
+}
+
+esp_err_t pipeline_stage_run(const char *stage, int32_t param, bool restart,
+                             const pipeline_block_t *in, pipeline_block_t *out)
+{
+    if (stage == NULL || in == NULL || out == NULL || in->count > PIPELINE_BLOCK_SAMPLES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const stage_def_t *def = find_stage_def(stage);
+    if (def == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (param < def->param_min || param > def->param_max) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pipeline_node_t *node = &offline_node;
+    if (restart || node->transform != def->transform || node->param != param) {
+        memset(node, 0, sizeof(*node));
+        strncpy(node->name, stage, PIPELINE_NAME_LEN - 1);
+        node->kind = PIPELINE_NODE_STAGE;
+        node->transform = def->transform;
+        node->param_min = def->param_min;
+        node->param_max = def->param_max;
+        node->param = param;
+        node->pending_param = param;
+        node->reset = true;
+    }
+
+    if (!def->transform(node, in, out)) {
+        out->count = 0;
+    }
+    out->seq = node->seq++;
+    return ESP_OK;
+}
+
+size_t pipeline_get_node_count(void)
+{
+    return node_count;
+}
+
+esp_err_t pipeline_get_node(pipeline_node_id_t id, pipeline_node_info_t *info)
+{
+    if (id >= node_count || info == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const pipeline_node_t *node = &nodes[id];
+    memset(info, 0, sizeof(*info));
+    memcpy(info->name, node->name, PIPELINE_NAME_LEN);
+    info->kind = node->kind;
+    taskENTER_CRITICAL(&pipeline_lock);
+    info->param = node->pending_param;
+    taskEXIT_CRITICAL(&pipeline_lock);
+    info->param_min = node->param_min;
+    info->param_max = node->param_max;
+    if (node->ring != NULL) {
+        info->ring = node->ring;
+        info->ring_capacity = node->ring->capacity;
+        for (uint8_t i = 0; i < node->ring->consumer_count; i++) {
+            bcast_consumer_stats_t stats;
+            if (bcast_ring_get_consumer_stats(node->ring, (bcast_consumer_id_t)i, &stats) != ESP_OK) {
+                continue;
+            }
+            if (stats.lag > info->ring_max_lag) {
+                info->ring_max_lag = stats.lag;
+            }
+            info->ring_missed += stats.missed_total;
+        }
+    }
+    return ESP_OK;
+}
+
+size_t pipeline_get_edge_count(void)
+{
+    return edge_count;
+}
+
+esp_err_t pipeline_get_edge(size_t index, pipeline_edge_info_t *info)
+{
+    if (index >= edge_count || info == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pipeline_edge_t *edge = &edges[index];
+    info->from = edge->from;
+    info->to = edge->to;
+    info->enabled = edge->enabled;
+    info->blocks = edge->blocks;
+    info->samples = edge->samples;
+
+    const int64_t now_us = esp_timer_get_time();
+    info->samples_per_s = 0.0f;
+    if (edge->rate_prev_us != 0 && now_us > edge->rate_prev_us) {
+        info->samples_per_s = (float)(info->samples - edge->rate_prev_samples) * 1e6f /
+                              (float)(now_us - edge->rate_prev_us);
+    }
+    edge->rate_prev_samples = info->samples;
+    edge->rate_prev_us = now_us;
+    return ESP_OK;
+}
+
+const char *pipeline_node_kind_name(pipeline_node_kind_t kind)
+{
+    switch (kind) {
+        case PIPELINE_NODE_SOURCE:
+            return "source";
+        case PIPELINE_NODE_STAGE:
+            return "stage";
+        case PIPELINE_NODE_SINK:
+            return "sink";
+        default:
+            return "unknown";
+    }
+}
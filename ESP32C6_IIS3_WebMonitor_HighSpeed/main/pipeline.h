@@ -0,0 +1,107 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "esp_err.h"
+#include "imu_manager.h"
+#include "bcast_ring.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Sample pipeline: sources -> stages -> sinks connected by runtime-configurable edges.
+// Blocks travel inline through the acquisition task; ring sinks append them to a
+// broadcast ring that any number of consumer tasks read at their own pace, so a
+// slow transport misses samples (and is told how many) instead of stalling the
+// FIFO drain.
+#define PIPELINE_BLOCK_SAMPLES          IMU_MANAGER_MAX_SAMPLES
+#define PIPELINE_MAX_NODES              12
+#define PIPELINE_MAX_EDGES              20
+#define PIPELINE_NAME_LEN               16
+#define PIPELINE_RING_MIN_WRITE         16      // Smallest typical block; sizes ring metadata
+
+// Built-in node names
+#define PIPELINE_SOURCE_IMU             "imu"
+#define PIPELINE_SOURCE_REPLAY          "replay"
+#define PIPELINE_STAGE_DECIMATE         "decimate"
+#define PIPELINE_STAGE_DC_BLOCK         "dc_block"
+
+#define PIPELINE_DECIMATE_DEFAULT       4       // Boxcar average, 26.7 kHz -> 6.7 kHz for plotting
+#define PIPELINE_DECIMATE_MAX           64
+#define PIPELINE_DC_BLOCK_DEFAULT_SHIFT 8       // Pole at 1 - 2^-8: ~17 Hz corner at 26.7 kHz
+#define PIPELINE_DC_BLOCK_MIN_SHIFT     2
+#define PIPELINE_DC_BLOCK_MAX_SHIFT     14
+
+typedef struct {
+    int16_t xyz[PIPELINE_BLOCK_SAMPLES * 3];    // Interleaved x,y,z LSB at `scale`
+    uint16_t count;
+    imu_manager_full_scale_t scale;
+    float odr_hz;
+    uint64_t timestamp_us;                      // Device time of the newest sample
+    uint32_t seq;                               // Per-source block counter
+} pipeline_block_t;
+
+typedef enum {
+    PIPELINE_NODE_SOURCE = 0,
+    PIPELINE_NODE_STAGE,
+    PIPELINE_NODE_SINK,
+} pipeline_node_kind_t;
+
+typedef uint8_t pipeline_node_id_t;
+
+// Inline sinks run in the acquisition task and must not block
+typedef void (*pipeline_sink_fn_t)(const pipeline_block_t *block, void *ctx);
+
+typedef struct {
+    char name[PIPELINE_NAME_LEN];
+    pipeline_node_kind_t kind;
+    bcast_ring_t *ring;         // Ring sinks
+    uint32_t ring_capacity;     // Samples
+    uint32_t ring_max_lag;      // Furthest-behind consumer, samples
+    uint32_t ring_missed;       // Samples overwritten before a consumer read them, all consumers
+    int32_t param;              // Stage parameter (decimation factor, DC-block shift), as last set
+    int32_t param_min;          // Range pipeline_set_param() accepts
+    int32_t param_max;
+} pipeline_node_info_t;
+
+typedef struct {
+    pipeline_node_id_t from;
+    pipeline_node_id_t to;
+    bool enabled;
+    uint32_t blocks;
+    uint32_t samples;
+    float samples_per_s;        // Since the previous pipeline_get_edge() of this edge
+} pipeline_edge_info_t;
+
+// Pipeline API
+esp_err_t pipeline_init(void);
+esp_err_t pipeline_add_sink(const char *name, pipeline_sink_fn_t fn, void *ctx, pipeline_node_id_t *id);
+// Sink backed by a broadcast ring of `capacity` samples (power of two); consumers
+// attach to the ring returned by pipeline_get_ring()
+esp_err_t pipeline_add_ring_sink(const char *name, uint32_t capacity, pipeline_node_id_t *id);
+bcast_ring_t *pipeline_get_ring(pipeline_node_id_t id);
+esp_err_t pipeline_connect(const char *from, const char *to);
+esp_err_t pipeline_disconnect(const char *from, const char *to);
+// Connect every source node to `to` (default wiring for recorders)
+esp_err_t pipeline_connect_sources(const char *to);
+// Takes effect from the stage's next block. ESP_ERR_NOT_FOUND if `stage` is not a
+// stage, ESP_ERR_INVALID_ARG outside its param_min..param_max.
+esp_err_t pipeline_set_param(const char *stage, int32_t value);
+// Run a built-in stage's transform outside the graph (golden checks). State carries
+// over between calls until `restart`, or a different stage or param is given.
+// Single caller at a time; the live nodes are not touched.
+esp_err_t pipeline_stage_run(const char *stage, int32_t param, bool restart,
+                             const pipeline_block_t *in, pipeline_block_t *out);
+
+size_t pipeline_get_node_count(void);
+esp_err_t pipeline_get_node(pipeline_node_id_t id, pipeline_node_info_t *info);
+size_t pipeline_get_edge_count(void);
+esp_err_t pipeline_get_edge(size_t index, pipeline_edge_info_t *info);
+const char *pipeline_node_kind_name(pipeline_node_kind_t kind);
+
+// g per LSB for a block's full scale (IIS3DWB sensitivity)
+static inline float pipeline_lsb_to_g(imu_manager_full_scale_t scale)
+{
+    return (float)scale * 0.0000305f;
+}
+
+#endif // PIPELINE_H
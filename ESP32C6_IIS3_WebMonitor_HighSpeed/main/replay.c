@@ -0,0 +1,227 @@
+#include "replay.h"
+#include "capture.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "REPLAY";
+
+typedef struct {
+    FILE *file;
+    capture_header_t header;
+    replay_status_t status;
+    uint64_t pace_start_us;     // Realtime pacing reference
+    uint32_t pace_start_pos;
+} replay_state_t;
+
+static replay_state_t state;
+static SemaphoreHandle_t replay_mutex = NULL;
+static volatile bool replay_active = false;
+static int16_t replay_samples[REPLAY_MAX_BATCH_SAMPLES * CAPTURE_CHANNELS];
+
+static void replay_close_locked(void)
+{
+    if (state.file != NULL) {
+        fclose(state.file);
+        state.file = NULL;
+    }
+    state.status.active = false;
+    replay_active = false;
+}
+
+esp_err_t replay_init(void)
+{
+    if (replay_mutex != NULL) {
+        return ESP_OK;
+    }
+
+    replay_mutex = xSemaphoreCreateMutex();
+    if (replay_mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to create replay mutex");
+        return ESP_FAIL;
+    }
+
+    memset(&state, 0, sizeof(state));
+    return ESP_OK;
+}
+
+esp_err_t replay_start(const char *path, replay_speed_t speed, bool loop)
+{
+    if (path == NULL || path[0] == '\0' || strlen(path) >= REPLAY_MAX_PATH_LEN) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (replay_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        ESP_LOGW(TAG, "Cannot open capture %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    capture_header_t hdr;
+    esp_err_t ret = capture_read_header(file, &hdr);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Invalid capture header in %s: %s", path, esp_err_to_name(ret));
+        fclose(file);
+        return ret;
+    }
+
+    // Derive the sample count from the file size when the recorder did not finalize it
+    uint32_t total = hdr.sample_count;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long size = ftell(file);
+        uint32_t in_file = (size > (long)hdr.header_size)
+                               ? (uint32_t)((size - hdr.header_size) / CAPTURE_SAMPLE_BYTES)
+                               : 0;
+        if (total == 0 || total > in_file) {
+            total = in_file;
+        }
+    }
+    if (total == 0 || fseek(file, hdr.header_size, SEEK_SET) != 0) {
+        fclose(file);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (xSemaphoreTake(replay_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        fclose(file);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    replay_close_locked();
+    memset(&state.status, 0, sizeof(state.status));
+    state.file = file;
+    state.header = hdr;
+    strncpy(state.status.path, path, sizeof(state.status.path) - 1);
+    state.status.speed = speed;
+    state.status.loop = loop;
+    state.status.odr_hz = hdr.odr_hz;
+    state.status.full_scale_g = hdr.full_scale_g;
+    state.status.total_samples = total;
+    state.status.active = true;
+    state.pace_start_us = esp_timer_get_time();
+    state.pace_start_pos = 0;
+    replay_active = true;
+
+    xSemaphoreGive(replay_mutex);
+
+    ESP_LOGI(TAG, "Replaying %s: %lu samples at %.1f Hz, +/-%ug (%s%s)",
+             path, (unsigned long)total, hdr.odr_hz, (unsigned int)hdr.full_scale_g,
+             speed == REPLAY_SPEED_MAX ? "max speed" : "realtime",
+             loop ? ", looping" : "");
+    return ESP_OK;
+}
+
+esp_err_t replay_stop(void)
+{
+    if (replay_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (xSemaphoreTake(replay_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    bool was_active = state.status.active;
+    replay_close_locked();
+    xSemaphoreGive(replay_mutex);
+
+    if (was_active) {
+        ESP_LOGI(TAG, "Replay stopped");
+    }
+    return ESP_OK;
+}
+
+bool replay_is_active(void)
+{
+    return replay_active;
+}
+
+esp_err_t replay_read(imu_data_t *data)
+{
+    if (data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (replay_mutex == NULL || xSemaphoreTake(replay_mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    if (!state.status.active || state.file == NULL) {
+        xSemaphoreGive(replay_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Work out how many samples are due; in realtime mode the remainder is
+    // reported as backlog so imu_task adapts its polling like a real FIFO.
+    uint32_t due = REPLAY_MAX_BATCH_SAMPLES;
+    uint32_t backlog = 0;
+    if (state.status.speed == REPLAY_SPEED_REALTIME) {
+        const uint64_t elapsed_us = esp_timer_get_time() - state.pace_start_us;
+        const uint64_t target = (uint64_t)((double)elapsed_us * state.header.odr_hz / 1e6);
+        const uint64_t consumed = state.status.position - state.pace_start_pos;
+        due = (target > consumed) ? (uint32_t)(target - consumed) : 0;
+        if (due > REPLAY_MAX_BATCH_SAMPLES) {
+            backlog = due - REPLAY_MAX_BATCH_SAMPLES;
+            due = REPLAY_MAX_BATCH_SAMPLES;
+        }
+    }
+
+    const uint32_t remaining = state.status.total_samples - state.status.position;
+    if (due > remaining) {
+        due = remaining;
+    }
+
+    if (due == 0) {
+        xSemaphoreGive(replay_mutex);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    size_t got = fread(replay_samples, CAPTURE_SAMPLE_BYTES, due, state.file);
+    esp_err_t ret = ESP_ERR_INVALID_SIZE;
+    if (got > 0) {
+        ret = imu_manager_inject_raw(replay_samples, (uint32_t)got,
+                                     (imu_manager_full_scale_t)state.header.full_scale_g,
+                                     state.header.odr_hz,
+                                     backlog > UINT16_MAX ? UINT16_MAX : (uint16_t)backlog,
+                                     data);
+        state.status.position += (uint32_t)got;
+        state.status.injected_samples += got;
+    }
+
+    if (got < due || state.status.position >= state.status.total_samples) {
+        if (state.status.loop && fseek(state.file, state.header.header_size, SEEK_SET) == 0) {
+            state.status.position = 0;
+            state.status.loops_completed++;
+            state.pace_start_us = esp_timer_get_time();
+            state.pace_start_pos = 0;
+        } else {
+            ESP_LOGI(TAG, "Replay of %s finished (%llu samples)", state.status.path,
+                     (unsigned long long)state.status.injected_samples);
+            replay_close_locked();
+        }
+    }
+
+    xSemaphoreGive(replay_mutex);
+    return ret;
+}
+
+esp_err_t replay_get_status(replay_status_t *status)
+{
+    if (status == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (replay_mutex == NULL || xSemaphoreTake(replay_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    *status = state.status;
+    xSemaphoreGive(replay_mutex);
+    return ESP_OK;
+}
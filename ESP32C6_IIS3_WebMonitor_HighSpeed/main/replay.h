@@ -0,0 +1,40 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "esp_err.h"
+#include "imu_manager.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Replay configuration
+#define REPLAY_BASE_PATH            "/spiffs"
+#define REPLAY_MAX_PATH_LEN         64
+#define REPLAY_MAX_BATCH_SAMPLES    512   // Samples injected per imu_task iteration
+
+typedef enum {
+    REPLAY_SPEED_REALTIME = 0,  // Pace samples at the recorded ODR
+    REPLAY_SPEED_MAX,           // Inject as fast as the pipeline accepts
+} replay_speed_t;
+
+typedef struct {
+    bool active;
+    char path[REPLAY_MAX_PATH_LEN];
+    replay_speed_t speed;
+    bool loop;
+    float odr_hz;
+    uint8_t full_scale_g;
+    uint32_t total_samples;
+    uint32_t position;
+    uint32_t loops_completed;
+    uint64_t injected_samples;
+} replay_status_t;
+
+// Replay API
+esp_err_t replay_init(void);
+esp_err_t replay_start(const char *path, replay_speed_t speed, bool loop);
+esp_err_t replay_stop(void);
+bool replay_is_active(void);
+esp_err_t replay_read(imu_data_t *data);
+esp_err_t replay_get_status(replay_status_t *status);
+
+#endif // REPLAY_H
@@ -0,0 +1,324 @@
+/**
+ * @file    iis3dwb_sim.c
+ * @brief   Simulated IIS3DWB: a register map behind the stmdev_ctx_t callbacks.
+ *          Samples are synthesized from elapsed esp_timer time at the configured
+ *          ODR, so the FIFO fills, overruns and drains like the real part and the
+ *          whole acquisition path above the HAL runs unchanged.
+ */
+
+#include "iis3dwb_sim.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+// ===== TAG FOR LOGGING =====
+static const char *TAG = "IIS3DWB_SIM";
+
+// ===== PRIVATE MACROS =====
+#define SIM_REG_COUNT           0x80
+#define SIM_SINE_BITS           10
+#define SIM_SINE_SIZE           (1U << SIM_SINE_BITS)
+#define SIM_WORD_BYTES          7
+#define SIM_CTRL3_C_DEFAULT     0x04        // IF_INC set after reset
+
+// ===== PRIVATE TYPES =====
+typedef struct {
+    int32_t offset_lsb;
+    int32_t tone_lsb;
+    uint32_t phase_step;        // Tone phase advance per sample (2^32 = one cycle)
+} sim_axis_t;
+
+typedef struct {
+    bool xl_on;
+    uint64_t xl_start_us;       // When XL_EN last turned on
+    bool fifo_on;               // Any mode other than bypass
+    uint64_t fifo_base;         // Sample index the FIFO started collecting at
+    uint8_t ts_decimation;      // Samples per timestamp word (0: no timestamps)
+    uint64_t words_written;     // Relative to fifo_base
+    uint64_t words_read;
+    uint32_t overruns;
+    bool ovr_latched;
+    int32_t noise_lsb;
+    uint32_t noise_state;
+    sim_axis_t axis[3];
+} sim_state_t;
+
+// ===== PRIVATE VARIABLES =====
+static uint8_t regs[SIM_REG_COUNT];
+static uint8_t out_latch[6];    // OUTX_L_A..OUTZ_H_A, one sample per read like BDU
+static int16_t sine[SIM_SINE_SIZE];
+static sim_state_t sim;
+
+static const float tone_hz[3] = { IIS3DWB_SIM_X_TONE_HZ, IIS3DWB_SIM_Y_TONE_HZ, IIS3DWB_SIM_Z_TONE_HZ };
+static const float tone_mg[3] = { IIS3DWB_SIM_X_TONE_MG, IIS3DWB_SIM_Y_TONE_MG, IIS3DWB_SIM_Z_TONE_MG };
+static const float offset_mg[3] = { IIS3DWB_SIM_X_OFFSET_MG, IIS3DWB_SIM_Y_OFFSET_MG, IIS3DWB_SIM_Z_OFFSET_MG };
+
+// ===== PRIVATE FUNCTIONS =====
+static float mg_per_lsb(uint8_t fs_xl)
+{
+    switch ((iis3dwb_fs_xl_t)fs_xl) {
+        case IIS3DWB_16g:
+            return iis3dwb_from_fs16g_to_mg(1);
+        case IIS3DWB_4g:
+            return iis3dwb_from_fs4g_to_mg(1);
+        case IIS3DWB_8g:
+            return iis3dwb_from_fs8g_to_mg(1);
+        case IIS3DWB_2g:
+        default:
+            return iis3dwb_from_fs2g_to_mg(1);
+    }
+}
+
+// Signal parameters in LSB at the current full scale; recomputed on CTRL1_XL writes
+// so the per-sample path is integer only
+static void update_scale(void)
+{
+    const float scale = 1.0f / mg_per_lsb((regs[IIS3DWB_CTRL1_XL] >> 2) & 0x03U);
+    for (int a = 0; a < 3; a++) {
+        sim.axis[a].offset_lsb = (int32_t)lroundf(offset_mg[a] * scale);
+        sim.axis[a].tone_lsb = (int32_t)lroundf(tone_mg[a] * scale);
+        sim.axis[a].phase_step = (uint32_t)(tone_hz[a] / IIS3DWB_SIM_ODR_HZ * 4294967296.0);
+    }
+    sim.noise_lsb = (int32_t)lroundf(IIS3DWB_SIM_NOISE_MG * scale);
+}
+
+static uint64_t samples_now(void)
+{
+    if (!sim.xl_on) {
+        return 0;
+    }
+    const uint64_t elapsed_us = (uint64_t)esp_timer_get_time() - sim.xl_start_us;
+    return (uint64_t)((double)elapsed_us * (double)IIS3DWB_SIM_ODR_HZ / 1e6);
+}
+
+static uint64_t words_for_samples(uint64_t samples)
+{
+    return samples + (sim.ts_decimation ? samples / sim.ts_decimation : 0);
+}
+
+// Bring the FIFO up to date with elapsed time; stream mode drops the oldest words
+static void advance(void)
+{
+    if (!sim.xl_on || !sim.fifo_on) {
+        return;
+    }
+    const uint64_t now = samples_now();
+    const uint64_t written = words_for_samples(now > sim.fifo_base ? now - sim.fifo_base : 0);
+    if (written <= sim.words_written) {
+        return;
+    }
+    sim.words_written = written;
+    if (sim.words_written - sim.words_read > IIS3DWB_SIM_FIFO_DEPTH) {
+        sim.overruns += (uint32_t)(sim.words_written - sim.words_read - IIS3DWB_SIM_FIFO_DEPTH);
+        sim.words_read = sim.words_written - IIS3DWB_SIM_FIFO_DEPTH;
+        sim.ovr_latched = true;
+    }
+}
+
+static uint16_t fifo_level(void)
+{
+    return (uint16_t)(sim.words_written - sim.words_read);
+}
+
+static int16_t sample_axis(uint64_t index, int a)
+{
+    const uint32_t phase = (uint32_t)(index * sim.axis[a].phase_step);
+    int32_t v = sim.axis[a].offset_lsb + ((sim.axis[a].tone_lsb * sine[phase >> (32 - SIM_SINE_BITS)]) >> 15);
+    if (sim.noise_lsb > 0) {
+        sim.noise_state = sim.noise_state * 1664525U + 1013904223U;
+        v += (int32_t)((sim.noise_state >> 8) % (uint32_t)(2 * sim.noise_lsb + 1)) - sim.noise_lsb;
+    }
+    if (v > INT16_MAX) {
+        v = INT16_MAX;
+    } else if (v < INT16_MIN) {
+        v = INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+static void put_xyz(uint8_t *out, uint64_t index)
+{
+    for (int a = 0; a < 3; a++) {
+        const int16_t v = sample_axis(index, a);
+        out[a * 2] = (uint8_t)(v & 0xFF);
+        out[a * 2 + 1] = (uint8_t)((uint16_t)v >> 8);
+    }
+}
+
+// One FIFO word: tag (with the 2-bit word counter) followed by 6 data bytes
+static void pop_word(uint8_t *out)
+{
+    memset(out, 0, SIM_WORD_BYTES);
+    if (fifo_level() == 0) {
+        return;                 // Empty FIFO reads back tag 0, which decoders skip
+    }
+
+    const uint64_t w = sim.words_read++;
+    const uint32_t group = sim.ts_decimation ? sim.ts_decimation + 1U : 1U;
+    const uint32_t pos = (uint32_t)(w % group);
+    const uint64_t sample = sim.fifo_base + (w / group) * (group - (sim.ts_decimation ? 1U : 0U)) + pos;
+
+    if (sim.ts_decimation && pos == sim.ts_decimation) {
+        // Timestamp word: 25 us per LSB, like the sensor's internal counter
+        const uint32_t ts = (uint32_t)((double)sample * 1e6 / IIS3DWB_SIM_ODR_HZ / 25.0);
+        out[0] = (uint8_t)((IIS3DWB_TIMESTAMP_TAG << 3) | ((w & 0x03U) << 1));
+        memcpy(&out[1], &ts, sizeof(ts));
+        return;
+    }
+    out[0] = (uint8_t)((IIS3DWB_XL_TAG << 3) | ((w & 0x03U) << 1));
+    put_xyz(&out[1], sample);
+}
+
+static uint8_t read_byte(uint8_t addr)
+{
+    switch (addr) {
+        case IIS3DWB_FIFO_STATUS1:
+            return (uint8_t)(fifo_level() & 0xFFU);
+        case IIS3DWB_FIFO_STATUS2: {
+            const uint16_t level = fifo_level();
+            const uint16_t wtm = (uint16_t)(regs[IIS3DWB_FIFO_CTRL1] | ((regs[IIS3DWB_FIFO_CTRL2] & 0x01U) << 8));
+            uint8_t v = (uint8_t)((level >> 8) & 0x03U);
+            if (sim.ovr_latched) {
+                v |= 0x08;      // FIFO_OVR_LATCHED, cleared by this read
+                sim.ovr_latched = false;
+            }
+            if (level >= IIS3DWB_SIM_FIFO_DEPTH) {
+                v |= 0x20 | 0x40;
+            }
+            if (wtm != 0 && level >= wtm) {
+                v |= 0x80;
+            }
+            return v;
+        }
+        case IIS3DWB_STATUS_REG:
+            return sim.xl_on ? 0x05 : 0x00;     // XLDA | TDA
+        case IIS3DWB_OUT_TEMP_L:
+        case IIS3DWB_OUT_TEMP_H:
+            return 0;                           // 25 degC
+        default:
+            break;
+    }
+
+    if (addr >= IIS3DWB_OUTX_L_A && addr <= IIS3DWB_OUTZ_H_A) {
+        return out_latch[addr - IIS3DWB_OUTX_L_A];
+    }
+    return regs[addr & (SIM_REG_COUNT - 1)];
+}
+
+static void reset_regs(void)
+{
+    memset(regs, 0, sizeof(regs));
+    regs[IIS3DWB_WHO_AM_I] = IIS3DWB_ID;
+    regs[IIS3DWB_CTRL3_C] = SIM_CTRL3_C_DEFAULT;
+    memset(&sim, 0, sizeof(sim));
+    sim.noise_state = 0x1D5A3U;
+    update_scale();
+}
+
+static void write_byte(uint8_t addr, uint8_t value)
+{
+    addr &= (SIM_REG_COUNT - 1);
+    if (addr == IIS3DWB_WHO_AM_I) {
+        return;
+    }
+    if (addr == IIS3DWB_CTRL3_C && (value & 0x01U)) {
+        reset_regs();           // SW_RESET completes immediately and self-clears
+        return;
+    }
+
+    regs[addr] = value;
+
+    if (addr == IIS3DWB_CTRL1_XL) {
+        const bool on = ((value >> 5) & 0x07U) == IIS3DWB_XL_ODR_26k7Hz;
+        if (on && !sim.xl_on) {
+            sim.xl_start_us = (uint64_t)esp_timer_get_time();
+            sim.fifo_base = 0;
+            sim.words_written = 0;
+            sim.words_read = 0;
+        }
+        sim.xl_on = on;
+        update_scale();
+    } else if (addr == IIS3DWB_FIFO_CTRL4) {
+        static const uint8_t ts_decimation[4] = { 0, 1, 8, 32 };
+        const bool on = (value & 0x07U) != IIS3DWB_BYPASS_MODE;
+        if (on != sim.fifo_on || ts_decimation[value >> 6] != sim.ts_decimation) {
+            // Bypass empties the FIFO; restart collection from the current sample
+            sim.fifo_base = samples_now();
+            sim.words_written = 0;
+            sim.words_read = 0;
+            sim.ovr_latched = false;
+        }
+        sim.fifo_on = on;
+        sim.ts_decimation = ts_decimation[value >> 6];
+    }
+}
+
+static int32_t sim_write(void *handle, uint8_t reg, const uint8_t *bufp, uint16_t len)
+{
+    (void)handle;
+    for (uint16_t i = 0; i < len; i++) {
+        write_byte((uint8_t)(reg + i), bufp[i]);
+    }
+    return 0;
+}
+
+static int32_t sim_read(void *handle, uint8_t reg, uint8_t *bufp, uint16_t len)
+{
+    (void)handle;
+    advance();
+    if (reg == IIS3DWB_FIFO_DATA_OUT_TAG) {
+        // Burst reads of FIFO_DATA_OUT wrap back to the tag register, one word per 7 bytes
+        uint16_t i = 0;
+        for (; i + SIM_WORD_BYTES <= len; i += SIM_WORD_BYTES) {
+            pop_word(&bufp[i]);
+        }
+        memset(&bufp[i], 0, len - i);
+        return 0;
+    }
+    if (reg <= IIS3DWB_OUTZ_H_A && reg + len > IIS3DWB_OUTX_L_A) {
+        const uint64_t n = samples_now();
+        put_xyz(out_latch, n ? n - 1 : 0);
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        bufp[i] = read_byte((uint8_t)(reg + i));
+    }
+    return 0;
+}
+
+static void sim_delay(uint32_t ms)
+{
+    vTaskDelay(ms / portTICK_PERIOD_MS);
+}
+
+// ===== PUBLIC FUNCTIONS =====
+esp_err_t iis3dwb_sim_init(stmdev_ctx_t *dev_ctx)
+{
+    for (uint32_t i = 0; i < SIM_SINE_SIZE; i++) {
+        sine[i] = (int16_t)lroundf(32767.0f * sinf(2.0f * (float)M_PI * (float)i / (float)SIM_SINE_SIZE));
+    }
+    reset_regs();
+
+    dev_ctx->handle = NULL;
+    dev_ctx->read_reg = sim_read;
+    dev_ctx->write_reg = sim_write;
+    dev_ctx->mdelay = sim_delay;
+
+    ESP_LOGW(TAG, "Using simulated IIS3DWB (%.0f Hz, %d-word FIFO)", IIS3DWB_SIM_ODR_HZ, IIS3DWB_SIM_FIFO_DEPTH);
+    return ESP_OK;
+}
+
+void iis3dwb_sim_get_stats(iis3dwb_sim_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    advance();
+    stats->samples_generated = samples_now();
+    stats->words_read = sim.words_read;
+    stats->overruns = sim.overruns;
+    stats->fifo_level = fifo_level();
+}
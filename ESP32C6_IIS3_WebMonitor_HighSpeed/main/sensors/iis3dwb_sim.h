@@ -0,0 +1,50 @@
+/**
+ * @file    iis3dwb_sim.h
+ * @brief   Simulated IIS3DWB register map, used in place of the SPI device
+ *          when IIS3DWB_SIMULATED is set in iis3dwb_hal.h
+ */
+
+#ifndef IIS3DWB_SIM_H
+#define IIS3DWB_SIM_H
+
+#include "iis3dwb_reg.h"
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ===== SIMULATION CONFIGURATION =====
+#define IIS3DWB_SIM_ODR_HZ          26667.0f    // Output rate when XL_EN selects 26.7 kHz
+#define IIS3DWB_SIM_FIFO_DEPTH      512         // FIFO words kept before stream mode overwrites
+#define IIS3DWB_SIM_NOISE_MG        5.0f        // Peak uniform noise added to every axis
+
+// One tone per axis on top of a static offset (z carries 1 g of gravity)
+#define IIS3DWB_SIM_X_OFFSET_MG     0.0f
+#define IIS3DWB_SIM_X_TONE_HZ       120.0f
+#define IIS3DWB_SIM_X_TONE_MG       500.0f
+#define IIS3DWB_SIM_Y_OFFSET_MG     0.0f
+#define IIS3DWB_SIM_Y_TONE_HZ       1000.0f
+#define IIS3DWB_SIM_Y_TONE_MG       250.0f
+#define IIS3DWB_SIM_Z_OFFSET_MG     1000.0f
+#define IIS3DWB_SIM_Z_TONE_HZ       50.0f
+#define IIS3DWB_SIM_Z_TONE_MG       100.0f
+
+// ===== SIMULATION STATISTICS =====
+typedef struct {
+    uint64_t samples_generated;     // Since the accelerometer was last enabled
+    uint64_t words_read;            // FIFO words, including timestamp words
+    uint32_t overruns;              // Words overwritten before they were read
+    uint16_t fifo_level;
+} iis3dwb_sim_stats_t;
+
+// ===== PUBLIC FUNCTION PROTOTYPES =====
+esp_err_t iis3dwb_sim_init(stmdev_ctx_t *dev_ctx);
+void iis3dwb_sim_get_stats(iis3dwb_sim_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* IIS3DWB_SIM_H */
@@ -0,0 +1,224 @@
+#include "sys_monitor.h"
+#include "metrics.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+static const char *TAG = "SYS_MONITOR";
+
+static const uint32_t heap_caps[SYS_HEAP_CAP_COUNT] = {
+    [SYS_HEAP_INTERNAL] = MALLOC_CAP_INTERNAL,
+    [SYS_HEAP_DMA]      = MALLOC_CAP_DMA,
+    [SYS_HEAP_8BIT]     = MALLOC_CAP_8BIT,
+};
+
+static const char *const heap_cap_names[SYS_HEAP_CAP_COUNT] = {
+    [SYS_HEAP_INTERNAL] = "internal",
+    [SYS_HEAP_DMA]      = "dma",
+    [SYS_HEAP_8BIT]     = "8bit",
+};
+
+static SemaphoreHandle_t monitor_mutex = NULL;
+static sys_snapshot_t current;
+static sys_history_entry_t history[SYS_MONITOR_HISTORY];
+static uint32_t history_count = 0;      // Entries written since boot
+
+#if SYS_MONITOR_TASK_STATS
+// Previous run-time counters and peaks, keyed by task handle
+typedef struct {
+    TaskHandle_t handle;
+    configRUN_TIME_COUNTER_TYPE runtime;
+    float cpu_peak_pct;
+} task_prev_t;
+
+static TaskStatus_t status_buf[SYS_MONITOR_MAX_TASKS];
+static task_prev_t prev[SYS_MONITOR_MAX_TASKS];
+static uint8_t prev_count = 0;
+static configRUN_TIME_COUNTER_TYPE prev_total = 0;
+
+static task_prev_t *find_prev(TaskHandle_t handle)
+{
+    for (uint8_t i = 0; i < prev_count; i++) {
+        if (prev[i].handle == handle) {
+            return &prev[i];
+        }
+    }
+    return NULL;
+}
+
+// Fill snap->tasks from one uxTaskGetSystemState() pass. Shares come from counter
+// deltas since the previous pass; unsigned subtraction absorbs counter wrap.
+static void sample_tasks(sys_snapshot_t *snap)
+{
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    const UBaseType_t n = uxTaskGetSystemState(status_buf, SYS_MONITOR_MAX_TASKS, &total);
+    const configRUN_TIME_COUNTER_TYPE total_delta = total - prev_total;
+
+    task_prev_t next[SYS_MONITOR_MAX_TASKS];
+    float idle_pct = 0.0f;
+    snap->task_count = 0;
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t *ts = &status_buf[i];
+        const task_prev_t *p = find_prev(ts->xHandle);
+        float pct = 0.0f;
+        if (p != NULL && prev_total != 0 && total_delta > 0) {
+            pct = (float)(ts->ulRunTimeCounter - p->runtime) * 100.0f / (float)total_delta;
+        }
+
+        next[i].handle = ts->xHandle;
+        next[i].runtime = ts->ulRunTimeCounter;
+        next[i].cpu_peak_pct = (p != NULL && p->cpu_peak_pct > pct) ? p->cpu_peak_pct : pct;
+
+        if (strncmp(ts->pcTaskName, "IDLE", 4) == 0) {
+            idle_pct += pct;
+        }
+
+        sys_task_info_t *info = &snap->tasks[snap->task_count++];
+        strncpy(info->name, ts->pcTaskName, sizeof(info->name) - 1);
+        info->name[sizeof(info->name) - 1] = '\0';
+        info->priority = (uint8_t)ts->uxCurrentPriority;
+        info->state = (uint8_t)ts->eCurrentState;
+        info->stack_free_min = (uint32_t)ts->usStackHighWaterMark;     // Bytes on ESP-IDF
+        info->cpu_pct = pct;
+        info->cpu_peak_pct = next[i].cpu_peak_pct;
+    }
+
+    memcpy(prev, next, n * sizeof(prev[0]));
+    prev_count = (uint8_t)n;
+    const bool have_delta = (prev_total != 0 && total_delta > 0);
+    prev_total = total;
+    snap->cpu_busy_pct = have_delta ? 100.0f - idle_pct : 0.0f;
+    snap->task_stats = true;
+}
+#else
+static void sample_tasks(sys_snapshot_t *snap)
+{
+    snap->task_count = 0;
+    snap->cpu_busy_pct = 0.0f;
+    snap->task_stats = false;
+}
+#endif // SYS_MONITOR_TASK_STATS
+
+static void sample_heap(sys_snapshot_t *snap)
+{
+    for (int i = 0; i < SYS_HEAP_CAP_COUNT; i++) {
+        multi_heap_info_t info;
+        heap_caps_get_info(&info, heap_caps[i]);
+        snap->heap[i].total = (uint32_t)heap_caps_get_total_size(heap_caps[i]);
+        snap->heap[i].free = (uint32_t)info.total_free_bytes;
+        snap->heap[i].min_free = (uint32_t)info.minimum_free_bytes;
+        snap->heap[i].largest_block = (uint32_t)info.largest_free_block;
+    }
+}
+
+static void monitor_task(void *arg)
+{
+    (void)arg;
+    // Sampled here rather than in `current` so the mutex is only held for the copy
+    static sys_snapshot_t sample;
+    TickType_t last_wake = xTaskGetTickCount();
+    metrics_register_task(NULL);
+
+    for (;;) {
+        sample.timestamp_us = esp_timer_get_time();
+        sample.period_ms = SYS_MONITOR_PERIOD_MS;
+        sample_tasks(&sample);
+        sample_heap(&sample);
+
+        sys_history_entry_t *h = &history[history_count % SYS_MONITOR_HISTORY];
+        xSemaphoreTake(monitor_mutex, portMAX_DELAY);
+        current = sample;
+        h->uptime_s = (uint32_t)(sample.timestamp_us / 1000000ULL);
+        h->cpu_busy_pct = sample.cpu_busy_pct;
+        h->heap_free = sample.heap[SYS_HEAP_INTERNAL].free;
+        h->heap_largest_block = sample.heap[SYS_HEAP_INTERNAL].largest_block;
+        history_count++;
+        xSemaphoreGive(monitor_mutex);
+
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(SYS_MONITOR_PERIOD_MS));
+    }
+}
+
+esp_err_t sys_monitor_init(void)
+{
+    if (monitor_mutex != NULL) {
+        return ESP_OK;
+    }
+
+    monitor_mutex = xSemaphoreCreateMutex();
+    if (monitor_mutex == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(monitor_task, "sys_monitor", SYS_MONITOR_TASK_STACK_SIZE, NULL,
+                    SYS_MONITOR_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create monitor task");
+        vSemaphoreDelete(monitor_mutex);
+        monitor_mutex = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+#if !SYS_MONITOR_TASK_STATS
+    ESP_LOGW(TAG, "FreeRTOS run-time stats disabled, sampling heap only");
+#endif
+    ESP_LOGI(TAG, "Sampling every %d ms, %d samples of history", SYS_MONITOR_PERIOD_MS, SYS_MONITOR_HISTORY);
+    return ESP_OK;
+}
+
+esp_err_t sys_monitor_get_snapshot(sys_snapshot_t *snapshot)
+{
+    if (snapshot == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (monitor_mutex == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(monitor_mutex, portMAX_DELAY);
+    *snapshot = current;
+    xSemaphoreGive(monitor_mutex);
+    return (snapshot->timestamp_us != 0) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+size_t sys_monitor_get_history(sys_history_entry_t *entries, size_t max_entries)
+{
+    if (entries == NULL || monitor_mutex == NULL) {
+        return 0;
+    }
+
+    xSemaphoreTake(monitor_mutex, portMAX_DELAY);
+    const uint32_t available = (history_count < SYS_MONITOR_HISTORY) ? history_count : SYS_MONITOR_HISTORY;
+    const size_t n = (available < max_entries) ? available : max_entries;
+    const uint32_t first = history_count - (uint32_t)n;
+    for (size_t i = 0; i < n; i++) {
+        entries[i] = history[(first + i) % SYS_MONITOR_HISTORY];
+    }
+    xSemaphoreGive(monitor_mutex);
+    return n;
+}
+
+const char *sys_monitor_heap_cap_name(sys_heap_cap_t cap)
+{
+    return (cap < SYS_HEAP_CAP_COUNT) ? heap_cap_names[cap] : "unknown";
+}
+
+const char *sys_monitor_task_state_name(uint8_t state)
+{
+    switch (state) {
+        case eRunning:
+            return "running";
+        case eReady:
+            return "ready";
+        case eBlocked:
+            return "blocked";
+        case eSuspended:
+            return "suspended";
+        case eDeleted:
+            return "deleted";
+        default:
+            return "invalid";
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef SYS_MONITOR_H
+#define SYS_MONITOR_H
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Periodic system sampler: per-task CPU share from the FreeRTOS run-time counters,
+// stack high-water marks and heap by capability, plus a short history of CPU load
+// and free heap. Per-task figures need CONFIG_FREERTOS_USE_TRACE_FACILITY and
+// CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS; without them only heap is sampled.
+#define SYS_MONITOR_PERIOD_MS       1000
+#define SYS_MONITOR_HISTORY         60      // Samples kept (1 minute at the default period)
+#define SYS_MONITOR_MAX_TASKS       24
+#define SYS_MONITOR_TASK_STACK_SIZE 3072
+#define SYS_MONITOR_TASK_PRIORITY   1
+
+#if defined(CONFIG_FREERTOS_USE_TRACE_FACILITY) && defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)
+#define SYS_MONITOR_TASK_STATS      1
+#else
+#define SYS_MONITOR_TASK_STATS      0
+#endif
+
+typedef enum {
+    SYS_HEAP_INTERNAL = 0,
+    SYS_HEAP_DMA,
+    SYS_HEAP_8BIT,
+    SYS_HEAP_CAP_COUNT
+} sys_heap_cap_t;
+
+typedef struct {
+    uint32_t total;
+    uint32_t free;
+    uint32_t min_free;          // Low-water mark since boot
+    uint32_t largest_block;
+} sys_heap_info_t;
+
+typedef struct {
+    char name[configMAX_TASK_NAME_LEN];
+    uint8_t priority;
+    uint8_t state;              // eTaskState
+    uint32_t stack_free_min;    // High-water mark, bytes never used
+    float cpu_pct;              // Share of the last period
+    float cpu_peak_pct;         // Highest period share since the task was first seen
+} sys_task_info_t;
+
+typedef struct {
+    uint64_t timestamp_us;
+    uint32_t period_ms;         // Interval the CPU shares were measured over
+    float cpu_busy_pct;         // 100 - idle share
+    uint8_t task_count;
+    bool task_stats;            // false when the run-time counters are compiled out
+    sys_task_info_t tasks[SYS_MONITOR_MAX_TASKS];
+    sys_heap_info_t heap[SYS_HEAP_CAP_COUNT];
+} sys_snapshot_t;
+
+typedef struct {
+    uint32_t uptime_s;
+    float cpu_busy_pct;
+    uint32_t heap_free;         // Internal heap
+    uint32_t heap_largest_block;
+} sys_history_entry_t;
+
+// System monitor API
+esp_err_t sys_monitor_init(void);
+esp_err_t sys_monitor_get_snapshot(sys_snapshot_t *snapshot);
+// Copy up to max_entries history samples, oldest first; returns the count copied
+size_t sys_monitor_get_history(sys_history_entry_t *entries, size_t max_entries);
+const char *sys_monitor_heap_cap_name(sys_heap_cap_t cap);
+const char *sys_monitor_task_state_name(uint8_t state);
+
+#endif // SYS_MONITOR_H
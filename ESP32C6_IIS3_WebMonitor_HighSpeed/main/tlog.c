@@ -0,0 +1,258 @@
+#include "tlog.h"
+#include "metrics.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+
+static const char *TAG = "TLOG";
+
+#define TLOG_TASK_STACK_SIZE    3072
+#define TLOG_TASK_PRIORITY      1
+#define TLOG_SPEC_MAX           16
+
+static portMUX_TYPE tlog_lock = portMUX_INITIALIZER_UNLOCKED;
+static tlog_entry_t ring[TLOG_RING_ENTRIES];
+static uint32_t next_seq = 0;
+static uint32_t drain_seq = 0;
+static uint32_t overwritten = 0;
+static bool tlog_started = false;
+
+void tlog_write(esp_log_level_t level, const char *tag, const char *fmt,
+                const tlog_word_t *args, uint8_t nargs)
+{
+    const uint64_t now_us = esp_timer_get_time();
+    if (nargs > TLOG_MAX_ARGS) {
+        nargs = TLOG_MAX_ARGS;
+    }
+
+    taskENTER_CRITICAL(&tlog_lock);
+    const uint32_t seq = next_seq++;
+    tlog_entry_t *e = &ring[seq & (TLOG_RING_ENTRIES - 1)];
+    e->timestamp_us = now_us;
+    e->tag = tag;
+    e->fmt = fmt;
+    for (uint8_t i = 0; i < nargs; i++) {
+        e->args[i] = args[i];
+    }
+    e->seq = seq;
+    e->level = (uint8_t)level;
+    e->nargs = nargs;
+    taskEXIT_CRITICAL(&tlog_lock);
+}
+
+bool tlog_get(uint32_t seq, tlog_entry_t *entry)
+{
+    if (entry == NULL) {
+        return false;
+    }
+
+    bool found = false;
+    taskENTER_CRITICAL(&tlog_lock);
+    const tlog_entry_t *e = &ring[seq & (TLOG_RING_ENTRIES - 1)];
+    if ((int32_t)(next_seq - seq) > 0 && e->seq == seq && e->fmt != NULL) {
+        *entry = *e;
+        found = true;
+    }
+    taskEXIT_CRITICAL(&tlog_lock);
+    return found;
+}
+
+void tlog_get_range(uint32_t *oldest, uint32_t *next)
+{
+    taskENTER_CRITICAL(&tlog_lock);
+    const uint32_t head = next_seq;
+    taskEXIT_CRITICAL(&tlog_lock);
+
+    if (oldest != NULL) {
+        *oldest = (head > TLOG_RING_ENTRIES) ? head - TLOG_RING_ENTRIES : 0;
+    }
+    if (next != NULL) {
+        *next = head;
+    }
+}
+
+static char level_letter(uint8_t level)
+{
+    switch (level) {
+        case ESP_LOG_ERROR:
+            return 'E';
+        case ESP_LOG_WARN:
+            return 'W';
+        case ESP_LOG_INFO:
+            return 'I';
+        case ESP_LOG_DEBUG:
+            return 'D';
+        default:
+            return 'V';
+    }
+}
+
+// Render the message by walking the format: each conversion is handed to snprintf
+// on its own with the stored word cast to the type the conversion expects
+static size_t format_message(const tlog_entry_t *entry, char *out, size_t out_len)
+{
+    size_t n = 0;
+    uint8_t arg = 0;
+    const char *p = entry->fmt;
+
+    while (*p != '\0' && n + 1 < out_len) {
+        if (*p != '%') {
+            out[n++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[n++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // %[flags][width][.precision][length]conversion; length modifiers are dropped
+        char spec[TLOG_SPEC_MAX];
+        size_t s = 0;
+        spec[s++] = *p++;
+        while (*p != '\0' && strchr("-+ #0123456789.", *p) != NULL && s < TLOG_SPEC_MAX - 2) {
+            spec[s++] = *p++;
+        }
+        while (*p != '\0' && strchr("hlzjt", *p) != NULL) {
+            p++;
+        }
+        const char conv = *p;
+        if (conv == '\0') {
+            break;
+        }
+        p++;
+        spec[s++] = conv;
+        spec[s] = '\0';
+
+        const tlog_word_t w = (arg < entry->nargs) ? entry->args[arg] : 0;
+        arg++;
+        int written;
+        switch (conv) {
+            case 'd':
+            case 'i':
+                written = snprintf(out + n, out_len - n, spec, (int)(int32_t)w);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'c':
+                written = snprintf(out + n, out_len - n, spec, (unsigned int)(uint32_t)w);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G': {
+                const uint32_t bits = (uint32_t)w;
+                float f;
+                memcpy(&f, &bits, sizeof(f));
+                written = snprintf(out + n, out_len - n, spec, (double)f);
+                break;
+            }
+            case 's':
+                written = snprintf(out + n, out_len - n, spec, w ? (const char *)w : "(null)");
+                break;
+            default:
+                written = snprintf(out + n, out_len - n, "%%%c", conv);
+                break;
+        }
+        if (written < 0) {
+            break;
+        }
+        n += (size_t)written;
+        if (n >= out_len) {
+            n = out_len - 1;
+        }
+    }
+
+    out[n] = '\0';
+    return n;
+}
+
+size_t tlog_format(const tlog_entry_t *entry, char *out, size_t out_len)
+{
+    if (entry == NULL || out == NULL || out_len == 0) {
+        return 0;
+    }
+
+    int n = snprintf(out, out_len, "%llu %c %s: ",
+                     (unsigned long long)(entry->timestamp_us / 1000ULL),
+                     level_letter(entry->level), entry->tag ? entry->tag : "?");
+    if (n < 0) {
+        out[0] = '\0';
+        return 0;
+    }
+    if ((size_t)n >= out_len) {
+        return out_len - 1;
+    }
+    return (size_t)n + format_message(entry, out + n, out_len - (size_t)n);
+}
+
+void tlog_get_stats(tlog_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&tlog_lock);
+    stats->written = next_seq;
+    stats->overwritten = overwritten;
+    taskEXIT_CRITICAL(&tlog_lock);
+    stats->capacity = TLOG_RING_ENTRIES;
+}
+
+// Low-priority drain: format what the hot paths recorded and echo it to the console
+static void tlog_task(void *arg)
+{
+    (void)arg;
+    char line[TLOG_LINE_MAX];
+    metrics_register_task(NULL);
+
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(TLOG_DRAIN_PERIOD_MS));
+
+        uint32_t oldest;
+        uint32_t next;
+        tlog_get_range(&oldest, &next);
+        if ((int32_t)(oldest - drain_seq) > 0) {
+            const uint32_t lost = oldest - drain_seq;
+            taskENTER_CRITICAL(&tlog_lock);
+            overwritten += lost;
+            taskEXIT_CRITICAL(&tlog_lock);
+            ESP_LOGW(TAG, "%lu entries overwritten before they were printed", (unsigned long)lost);
+            drain_seq = oldest;
+        }
+
+        while (drain_seq != next) {
+            tlog_entry_t entry;
+            if (!tlog_get(drain_seq, &entry)) {
+                break;  // Lapped while printing; picked up as overwritten next round
+            }
+            drain_seq++;
+#if TLOG_DRAIN_TO_CONSOLE
+            format_message(&entry, line, sizeof(line));
+            ESP_LOG_LEVEL((esp_log_level_t)entry.level, entry.tag, "[%llu ms] %s",
+                          (unsigned long long)(entry.timestamp_us / 1000ULL), line);
+#endif
+        }
+    }
+}
+
+esp_err_t tlog_init(void)
+{
+    if (tlog_started) {
+        return ESP_OK;
+    }
+
+    if (xTaskCreate(tlog_task, "tlog", TLOG_TASK_STACK_SIZE, NULL, TLOG_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create drain task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    tlog_started = true;
+    ESP_LOGI(TAG, "Deferred log ready: %u entries", (unsigned int)TLOG_RING_ENTRIES);
+    return ESP_OK;
+}
@@ -0,0 +1,105 @@
+#ifndef TLOG_H
+#define TLOG_H
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// Deferred binary log for hot paths. A TLOG_x() call stores the format pointer and
+// up to TLOG_MAX_ARGS raw argument words in a RAM ring (a few stores under a short
+// critical section); formatting and UART output happen later in a low-priority
+// drain task, or on demand through GET /api/log.
+//
+// Restrictions, since nothing is formatted at the call site:
+// - the format string and tag must be literals (or otherwise live forever)
+// - %s arguments must point at static strings (e.g. esp_err_to_name())
+// - integer arguments are stored as 32 bits: no %ll, no '*' width/precision
+#define TLOG_RING_ENTRIES       256     // Power of two
+#define TLOG_MAX_ARGS           6
+#define TLOG_LINE_MAX           160
+#define TLOG_DRAIN_PERIOD_MS    200
+#define TLOG_DRAIN_TO_CONSOLE   1       // Echo entries through ESP_LOG from the drain task
+
+typedef uintptr_t tlog_word_t;
+
+typedef struct {
+    uint64_t timestamp_us;
+    const char *tag;
+    const char *fmt;
+    tlog_word_t args[TLOG_MAX_ARGS];
+    uint32_t seq;
+    uint8_t level;              // esp_log_level_t
+    uint8_t nargs;
+} tlog_entry_t;
+
+typedef struct {
+    uint32_t written;
+    uint32_t overwritten;       // Entries lost before the drain task printed them
+    uint32_t capacity;
+} tlog_stats_t;
+
+// Argument packing: floats keep their bits, strings keep their pointer
+static inline tlog_word_t tlog_arg_float(double v)
+{
+    const float f = (float)v;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+static inline tlog_word_t tlog_arg_str(const char *s)
+{
+    return (tlog_word_t)s;
+}
+
+static inline tlog_word_t tlog_arg_int(long long v)
+{
+    return (tlog_word_t)(uint32_t)v;
+}
+
+#define TLOG_ARG(x) _Generic((x), \
+    float: tlog_arg_float, \
+    double: tlog_arg_float, \
+    char *: tlog_arg_str, \
+    const char *: tlog_arg_str, \
+    default: tlog_arg_int)(x)
+
+#define TLOG_NARGS(...) TLOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define TLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, N, ...) N
+#define TLOG_CAT(a, b) TLOG_CAT_(a, b)
+#define TLOG_CAT_(a, b) a##b
+#define TLOG_MAP_0()
+#define TLOG_MAP_1(a) TLOG_ARG(a)
+#define TLOG_MAP_2(a, b) TLOG_ARG(a), TLOG_ARG(b)
+#define TLOG_MAP_3(a, b, c) TLOG_MAP_2(a, b), TLOG_ARG(c)
+#define TLOG_MAP_4(a, b, c, d) TLOG_MAP_3(a, b, c), TLOG_ARG(d)
+#define TLOG_MAP_5(a, b, c, d, e) TLOG_MAP_4(a, b, c, d), TLOG_ARG(e)
+#define TLOG_MAP_6(a, b, c, d, e, f) TLOG_MAP_5(a, b, c, d, e), TLOG_ARG(f)
+
+#define TLOG_LEVEL(level, tag, fmt, ...) do { \
+        const tlog_word_t tlog_args_[TLOG_MAX_ARGS + 1] = { 0, TLOG_CAT(TLOG_MAP_, TLOG_NARGS(__VA_ARGS__))(__VA_ARGS__) }; \
+        tlog_write((level), (tag), (fmt), &tlog_args_[1], TLOG_NARGS(__VA_ARGS__)); \
+    } while (0)
+
+#define TLOG_E(tag, fmt, ...) TLOG_LEVEL(ESP_LOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define TLOG_W(tag, fmt, ...) TLOG_LEVEL(ESP_LOG_WARN, tag, fmt, ##__VA_ARGS__)
+#define TLOG_I(tag, fmt, ...) TLOG_LEVEL(ESP_LOG_INFO, tag, fmt, ##__VA_ARGS__)
+
+// Trace log API
+// Entries can be written before tlog_init(); init only starts the drain task.
+esp_err_t tlog_init(void);
+void tlog_write(esp_log_level_t level, const char *tag, const char *fmt,
+                const tlog_word_t *args, uint8_t nargs);
+// Copy the entry with sequence number `seq`; false once it has been overwritten
+// or not written yet
+bool tlog_get(uint32_t seq, tlog_entry_t *entry);
+// Oldest and next sequence numbers still in the ring
+void tlog_get_range(uint32_t *oldest, uint32_t *next);
+// Format one entry as "<timestamp ms> <L> <tag>: <message>" (no newline)
+size_t tlog_format(const tlog_entry_t *entry, char *out, size_t out_len);
+void tlog_get_stats(tlog_stats_t *stats);
+
+#endif // TLOG_H
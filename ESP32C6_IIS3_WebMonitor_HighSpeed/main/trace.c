@@ -0,0 +1,142 @@
+#include "trace.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *const point_names[TRACE_POINT_COUNT] = {
+    [TRACE_ACQUIRE]     = "acquire",
+    [TRACE_FIFO_READ]   = "fifo_read",
+    [TRACE_PIPELINE]    = "pipeline",
+    [TRACE_BUFFER_ADD]  = "buffer_add",
+    [TRACE_WS_READ]     = "ws_read",
+    [TRACE_WS_ENCODE]   = "ws_encode",
+    [TRACE_WS_SEND]     = "ws_send",
+};
+
+const char *trace_point_name(trace_point_t point)
+{
+    return (point < TRACE_POINT_COUNT) ? point_names[point] : "unknown";
+}
+
+uint32_t trace_cycles_per_us(void)
+{
+    return esp_rom_get_cpu_ticks_per_us();
+}
+
+#if TRACE_ENABLED
+
+typedef struct {
+    atomic_uint seq;            // Owner seq + 1, 0 while being written
+    trace_event_t event;
+} trace_slot_t;
+
+static trace_slot_t ring[TRACE_RING_EVENTS];
+static atomic_uint next_slot;
+static atomic_bool filled;      // Every slot written at least once; stays set when next_slot wraps
+static atomic_bool paused;
+static atomic_uint dropped;
+
+// Reserve a slot with one atomic add, fill it, then publish its seq; no lock,
+// so trace points are safe from any task
+void trace_record(trace_point_t point, trace_phase_t phase, uint16_t arg)
+{
+    if (atomic_load_explicit(&paused, memory_order_relaxed)) {
+        atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    const uint32_t cycles = esp_cpu_get_cycle_count();
+    const uint32_t seq = atomic_fetch_add_explicit(&next_slot, 1, memory_order_relaxed);
+    trace_slot_t *slot = &ring[seq & (TRACE_RING_EVENTS - 1)];
+    atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->event.cycles = cycles;
+    slot->event.task = xTaskGetCurrentTaskHandle();
+    slot->event.arg = arg;
+    slot->event.point = (uint8_t)point;
+    slot->event.phase = (uint8_t)phase;
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_release);
+    if (seq == TRACE_RING_EVENTS - 1) {
+        atomic_store_explicit(&filled, true, memory_order_relaxed);
+    }
+}
+
+void trace_pause(bool pause)
+{
+    atomic_store_explicit(&paused, pause, memory_order_relaxed);
+}
+
+void trace_get_range(uint32_t *oldest, uint32_t *next)
+{
+    const uint32_t head = atomic_load_explicit(&next_slot, memory_order_acquire);
+    if (oldest != NULL) {
+        // Modulo 2^32, like the seqs: once the ring is full the window is the last
+        // TRACE_RING_EVENTS seqs, also after head wraps past zero
+        const bool full = atomic_load_explicit(&filled, memory_order_relaxed) || head >= TRACE_RING_EVENTS;
+        *oldest = full ? head - TRACE_RING_EVENTS : 0;
+    }
+    if (next != NULL) {
+        *next = head;
+    }
+}
+
+bool trace_get(uint32_t seq, trace_event_t *event)
+{
+    if (event == NULL) {
+        return false;
+    }
+
+    trace_slot_t *slot = &ring[seq & (TRACE_RING_EVENTS - 1)];
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != seq + 1) {
+        return false;
+    }
+    *event = slot->event;
+    atomic_thread_fence(memory_order_acquire);
+    // Re-check: a writer may have reclaimed the slot while it was copied
+    return atomic_load_explicit(&slot->seq, memory_order_relaxed) == seq + 1;
+}
+
+void trace_get_stats(trace_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    stats->enabled = true;
+    stats->recorded = atomic_load_explicit(&next_slot, memory_order_relaxed);
+    stats->dropped = atomic_load_explicit(&dropped, memory_order_relaxed);
+    stats->capacity = TRACE_RING_EVENTS;
+}
+
+#else
+
+void trace_pause(bool pause)
+{
+    (void)pause;
+}
+
+void trace_get_range(uint32_t *oldest, uint32_t *next)
+{
+    if (oldest != NULL) {
+        *oldest = 0;
+    }
+    if (next != NULL) {
+        *next = 0;
+    }
+}
+
+bool trace_get(uint32_t seq, trace_event_t *event)
+{
+    (void)seq;
+    (void)event;
+    return false;
+}
+
+void trace_get_stats(trace_stats_t *stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+#endif // TRACE_ENABLED
@@ -0,0 +1,74 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Per-stage latency tracing. Trace points record the CPU cycle counter into a
+// lock-free ring; GET /api/trace exports the ring as Chrome trace JSON (load it in
+// chrome://tracing or ui.perfetto.dev). Build with TRACE_ENABLED 0 to compile every
+// trace point out.
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED           1
+#endif
+#define TRACE_RING_EVENTS       1024    // Power of two; 16 bytes each with the slot seq
+
+typedef enum {
+    TRACE_ACQUIRE = 0,          // imu_task: one imu_manager_read_all() / replay_read()
+    TRACE_FIFO_READ,            // SPI burst of one FIFO chunk
+    TRACE_PIPELINE,             // Raw listener fan-out (pipeline stages and sinks)
+    TRACE_BUFFER_ADD,           // data_buffer_add()
+    TRACE_WS_READ,              // Broadcaster pick-up from its ring cursor
+    TRACE_WS_ENCODE,            // JSON frame formatting
+    TRACE_WS_SEND,              // Frame hand-off to every client
+    TRACE_POINT_COUNT,
+} trace_point_t;
+
+typedef enum {
+    TRACE_PHASE_BEGIN = 0,
+    TRACE_PHASE_END,
+    TRACE_PHASE_INSTANT,
+} trace_phase_t;
+
+typedef struct {
+    uint32_t cycles;            // esp_cpu_get_cycle_count(), wraps every ~27 s at 160 MHz
+    TaskHandle_t task;
+    uint16_t arg;               // Point-specific count (samples, bytes, clients)
+    uint8_t point;              // trace_point_t
+    uint8_t phase;              // trace_phase_t
+} trace_event_t;
+
+typedef struct {
+    bool enabled;
+    uint32_t recorded;
+    uint32_t dropped;           // Events skipped while an export held the ring
+    uint32_t capacity;
+} trace_stats_t;
+
+#if TRACE_ENABLED
+void trace_record(trace_point_t point, trace_phase_t phase, uint16_t arg);
+#define TRACE_BEGIN(point)          trace_record((point), TRACE_PHASE_BEGIN, 0)
+#define TRACE_END(point, arg)       trace_record((point), TRACE_PHASE_END, (uint16_t)(arg))
+#define TRACE_INSTANT(point, arg)   trace_record((point), TRACE_PHASE_INSTANT, (uint16_t)(arg))
+#else
+#define TRACE_BEGIN(point)          ((void)0)
+#define TRACE_END(point, arg)       ((void)0)
+#define TRACE_INSTANT(point, arg)   ((void)0)
+#endif
+
+// Trace API (no-ops returning ESP_ERR_NOT_SUPPORTED / false when compiled out)
+// Hold the ring still while it is exported; events arriving meanwhile are dropped
+void trace_pause(bool paused);
+// Events still in the ring are seqs oldest..next-1, counted modulo 2^32; walk them
+// with seq != next
+void trace_get_range(uint32_t *oldest, uint32_t *next);
+bool trace_get(uint32_t seq, trace_event_t *event);
+const char *trace_point_name(trace_point_t point);
+uint32_t trace_cycles_per_us(void);
+void trace_get_stats(trace_stats_t *stats);
+
+#endif // TRACE_H
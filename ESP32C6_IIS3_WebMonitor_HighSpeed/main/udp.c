@@ -7,6 +7,7 @@
 #include "lwip/netdb.h"
 #include "lwip/inet.h"
 #include "udp.h"
+#include "metrics.h"
 
 static const char *TAG = "UDP_BROADCAST";
 
@@ -27,6 +28,7 @@ void udp_broadcast_task(void *pvParameters)
 
     int broadcast_perm = 1;
     setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &broadcast_perm, sizeof(broadcast_perm));
+    metrics_register_task(NULL);
 
     while (1) {
         esp_netif_ip_info_t ip_info;
@@ -0,0 +1,77 @@
+#include "web_json.h"
+#include "latency.h"
+
+// Reject bodies nested deeper than max_depth before cJSON recurses into them: even
+// a body that fits the small POST buffers ("[[[[...") is enough nested parse calls
+// to run the httpd task off its stack. Brackets inside strings do not count.
+bool web_json_depth_ok(const char *json, size_t len, int max_depth)
+{
+    int depth = 0;
+    bool in_string = false;
+    for (size_t i = 0; i < len; i++) {
+        const char c = json[i];
+        if (in_string) {
+            if (c == '\\') {
+                i++;
+            } else if (c == '"') {
+                in_string = false;
+            }
+        } else if (c == '"') {
+            in_string = true;
+        } else if (c == '{' || c == '[') {
+            if (++depth > max_depth) {
+                return false;
+            }
+        } else if ((c == '}' || c == ']') && --depth < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+cJSON *web_json_parse_body(const char *body, size_t len, const char **error)
+{
+    if (!web_json_depth_ok(body, len, WEB_JSON_MAX_DEPTH)) {
+        *error = "{\"error\":\"too_deep\"}";
+        return NULL;
+    }
+    cJSON *root = cJSON_ParseWithLength(body, len);
+    if (root == NULL) {
+        *error = "{\"error\":\"invalid_json\"}";
+    }
+    return root;
+}
+
+// Client numbers are doubles; casting one outside the target type's range (1e999
+// parses to infinity) is undefined, so range-check before converting
+bool web_json_get_int(const cJSON *item, int32_t min, int32_t max, int32_t *out)
+{
+    // The negated range test also turns away NaN
+    if (!cJSON_IsNumber(item) || !(item->valuedouble >= min && item->valuedouble <= max)) {
+        return false;
+    }
+    *out = (int32_t)item->valuedouble;
+    return true;
+}
+
+bool web_json_parse_echo(const uint8_t *payload, size_t len, uint32_t *seq, uint32_t *hold_us)
+{
+    const char *json = (const char *)payload;
+    if (!web_json_depth_ok(json, len, WEB_JSON_MAX_DEPTH)) {
+        return false;
+    }
+    cJSON *root = cJSON_ParseWithLength(json, len);
+    const cJSON *echo = cJSON_GetObjectItem(root, "echo");
+    const cJSON *hold = cJSON_GetObjectItem(root, "hold");
+    // The negated range test also turns away NaN
+    if (!cJSON_IsNumber(echo) || !(echo->valuedouble >= 0 && echo->valuedouble <= UINT32_MAX)) {
+        cJSON_Delete(root);
+        return false;
+    }
+    const double hold_value = cJSON_IsNumber(hold) ? hold->valuedouble : 0.0;
+    *seq = (uint32_t)echo->valuedouble;
+    *hold_us = (hold_value >= 0.0 && hold_value <= LATENCY_MAX_HOLD_US) ? (uint32_t)hold_value
+                                                                         : LATENCY_MAX_HOLD_US + 1;
+    cJSON_Delete(root);
+    return true;
+}
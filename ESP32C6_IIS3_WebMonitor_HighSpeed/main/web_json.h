@@ -0,0 +1,26 @@
+#ifndef WEB_JSON_H
+#define WEB_JSON_H
+
+#include "cJSON.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Parsing of the JSON that clients send: POST bodies and /ws/data messages. Kept
+// apart from the handlers so tools/fuzz can run it without httpd.
+#define WEB_JSON_MAX_DEPTH      8       // POST bodies are flat objects; see web_json_depth_ok()
+
+// False if brackets outside strings nest deeper than max_depth or close unopened
+bool web_json_depth_ok(const char *json, size_t len, int max_depth);
+// Parse a received POST body. On failure returns NULL and sets *error to the JSON
+// for the 400 response.
+cJSON *web_json_parse_body(const char *body, size_t len, const char **error);
+// Integer field of a parsed body. False if item is not a number, not finite, or
+// outside min..max; a fraction is truncated toward zero.
+bool web_json_get_int(const cJSON *item, int32_t min, int32_t max, int32_t *out);
+// Latency echo {"echo":<seq>,"hold":<us>} (see latency.h). False for any other
+// message; a hold outside 0..LATENCY_MAX_HOLD_US comes back as LATENCY_MAX_HOLD_US + 1
+// for the latency module to reject and count.
+bool web_json_parse_echo(const uint8_t *payload, size_t len, uint32_t *seq, uint32_t *hold_us);
+
+#endif // WEB_JSON_H
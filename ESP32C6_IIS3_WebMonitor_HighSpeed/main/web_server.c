@@ -2,29 +2,69 @@
 #include "data_buffer.h"
 #include "imu_manager.h"
 #include "led_status.h"
+#include "replay.h"
+#include "capture.h"
+#include "blackbox.h"
+#include "history.h"
+#include "duty_cycle.h"
+#include "mem_arena.h"
+#include "pipeline.h"
+#include "tlog.h"
+#include "trace.h"
+#include "metrics.h"
+#include "sys_monitor.h"
+#include "ws_frame.h"
+#include "web_json.h"
+#include "acq_stats.h"
+#if CONFIG_IMU_TEST_HOOKS
+#include "bench.h"
+#include "golden.h"
+#endif
+#include "latency.h"
+#include "sdkconfig.h"
 #include "esp_log.h"
 #include "esp_spiffs.h"
 #include "esp_timer.h"
 #include "esp_netif.h"
+#include "esp_rom_crc.h"
+#include "esp_rom_sys.h"
 #include "cJSON.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <stdatomic.h>
 
 static const char *TAG = "WEB_SERVER";
 
 static httpd_handle_t server = NULL;
 static httpd_handle_t ws_server = NULL;
 
-#define WS_PLOT_CHUNK_SAMPLES      100
-#define WS_PLOT_BUFFER_CAPACITY    5000
-#define WS_RECENT_MAX_SAMPLES      IMU_MANAGER_MAX_SAMPLES
+#define WS_PLOT_CHUNK_SAMPLES      WS_FRAME_MAX_SAMPLES
+#define WS_RING_CAPACITY           4096    // Plot ring: ~0.6 s at the default 6.7 kHz plot rate
+#define WS_SINK_NAME               "ws"
+#define WS_JSON_BUFFER_SIZE        WS_FRAME_BUFFER_SIZE
+#define HTTP_EXPORT_BUFFER_SIZE    8192
+#define WS_RX_MAX_PAYLOAD          64      // Largest client frame accepted on /ws/data
+
+// CSV/JSON export scratch from the arena (was 8 KB on the httpd stack); httpd
+// runs handlers one at a time, so a single buffer is enough
+static char *export_buf = NULL;
+
+// Plot feed: ring sink on the pipeline (decimated by default) read through our own cursor
+static pipeline_node_id_t ws_sink = 0;
+static bcast_ring_t *ws_ring = NULL;
+static bcast_consumer_id_t ws_consumer = -1;
 
 // WebSocket connection tracking
 typedef struct {
     int fd;
     bool active;
+    atomic_uint bytes_sent;     // Updated by the broadcaster, read by /metrics
+    atomic_uint frames_sent;
+    atomic_uint send_errors;
 } ws_connection_t;
 
 static ws_connection_t ws_connections[WEBSOCKET_MAX_CONNECTIONS];
@@ -39,6 +79,23 @@ static esp_err_t api_stats_handler(httpd_req_t *req);
 static esp_err_t api_config_handler(httpd_req_t *req);
 static esp_err_t api_download_handler(httpd_req_t *req);
 static esp_err_t api_ip_handler(httpd_req_t *req);
+static esp_err_t api_replay_handler(httpd_req_t *req);
+static esp_err_t api_blackbox_handler(httpd_req_t *req);
+static esp_err_t api_blackbox_segment_handler(httpd_req_t *req);
+static esp_err_t api_history_handler(httpd_req_t *req);
+static esp_err_t api_capture_handler(httpd_req_t *req);
+static esp_err_t api_schedule_handler(httpd_req_t *req);
+static esp_err_t api_memory_handler(httpd_req_t *req);
+static esp_err_t api_system_handler(httpd_req_t *req);
+#if CONFIG_IMU_TEST_HOOKS
+static esp_err_t api_bench_handler(httpd_req_t *req);
+static esp_err_t api_golden_handler(httpd_req_t *req);
+#endif
+static esp_err_t api_acquisition_handler(httpd_req_t *req);
+static esp_err_t api_pipeline_handler(httpd_req_t *req);
+static esp_err_t api_log_handler(httpd_req_t *req);
+static esp_err_t api_trace_handler(httpd_req_t *req);
+static esp_err_t metrics_handler(httpd_req_t *req);
 static esp_err_t ws_data_handler(httpd_req_t *req);
 static esp_err_t ws_control_handler(httpd_req_t *req);
 static esp_err_t file_handler(httpd_req_t *req);
@@ -59,6 +116,40 @@ extern const uint8_t app_js_end[] asm("_binary_app_js_end");
 
 static esp_err_t root_handler(httpd_req_t *req);
 
+// Read a small JSON POST body into buf and parse it. On failure the 400 response
+// has been sent and NULL is returned.
+static cJSON *recv_json_body(httpd_req_t *req, char *buf, size_t size)
+{
+    const char *error = NULL;
+    const size_t total_len = req->content_len;
+    size_t received = 0;
+
+    if (total_len == 0 || total_len >= size) {
+        error = "{\"error\":\"invalid_length\"}";
+    }
+    while (error == NULL && received < total_len) {
+        int r = httpd_req_recv(req, buf + received, total_len - received);
+        if (r <= 0) {
+            error = "{\"error\":\"recv_failed\"}";
+            break;
+        }
+        received += (size_t)r;
+    }
+
+    cJSON *root = NULL;
+    if (error == NULL) {
+        buf[received] = '\0';
+        root = web_json_parse_body(buf, received, &error);
+    }
+
+    if (error != NULL) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_send(req, error, HTTPD_RESP_USE_STRLEN);
+    }
+    return root;
+}
+
 // API Data endpoint - returns latest sensor data
 static esp_err_t api_data_handler(httpd_req_t *req)
 {
@@ -114,11 +205,91 @@ static esp_err_t api_data_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
-// API Stats endpoint - returns buffer statistics
+// Shared summary of one histogram: count, min, max, mean and tail percentiles
+static void add_hist_summary(cJSON *item, const hist_t *h)
+{
+    static const float percentiles[] = { 50.0f, 90.0f, 99.0f, 99.9f };
+    static const char *const percentile_names[] = { "p50", "p90", "p99", "p999" };
+
+    cJSON_AddNumberToObject(item, "count", h->total);
+    cJSON_AddNumberToObject(item, "min", h->total > 0 ? h->min : 0);
+    cJSON_AddNumberToObject(item, "max", h->max);
+    cJSON_AddNumberToObject(item, "mean", roundf(hist_mean(h) * 10.0f) / 10.0f);
+    for (size_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++) {
+        cJSON_AddNumberToObject(item, percentile_names[p], hist_percentile(h, percentiles[p]));
+    }
+}
+
+static void add_latency_stats(cJSON *item, hist_t *h, latency_transport_t transport, int client)
+{
+    for (int i = 0; i < LATENCY_STAT_COUNT; i++) {
+        cJSON *stat = cJSON_CreateObject();
+        latency_get(transport, client, (latency_stat_id_t)i, h);
+        add_hist_summary(stat, h);
+        cJSON_AddItemToObject(item, latency_stat_name((latency_stat_id_t)i), stat);
+    }
+}
+
+// Sensor-to-client latency per transport (total) and per connected client, in us
+static cJSON *latency_to_json(void)
+{
+    hist_t *h = malloc(sizeof(*h));
+    if (h == NULL) {
+        return NULL;
+    }
+
+    int fds[WEBSOCKET_MAX_CONNECTIONS];
+    for (int i = 0; i < WEBSOCKET_MAX_CONNECTIONS; i++) {
+        fds[i] = -1;
+    }
+    if (ws_mutex != NULL && xSemaphoreTake(ws_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
+        for (int i = 0; i < WEBSOCKET_MAX_CONNECTIONS; i++) {
+            if (ws_connections[i].active) {
+                fds[i] = ws_connections[i].fd;
+            }
+        }
+        xSemaphoreGive(ws_mutex);
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    for (int t = 0; t < LATENCY_TRANSPORT_COUNT; t++) {
+        const latency_transport_t transport = (latency_transport_t)t;
+        cJSON *item = cJSON_CreateObject();
+        add_latency_stats(item, h, transport, -1);
+        cJSON_AddNumberToObject(item, "rejected", latency_get_rejected(transport));
+
+        cJSON *clients = cJSON_CreateArray();
+        for (int c = 0; c < WEBSOCKET_MAX_CONNECTIONS && c < LATENCY_MAX_CLIENTS; c++) {
+            if (transport != LATENCY_TRANSPORT_WS || fds[c] < 0) {
+                continue;
+            }
+            cJSON *client = cJSON_CreateObject();
+            cJSON_AddNumberToObject(client, "slot", c);
+            cJSON_AddNumberToObject(client, "fd", fds[c]);
+            add_latency_stats(client, h, transport, c);
+            cJSON_AddItemToArray(clients, client);
+        }
+        cJSON_AddItemToObject(item, "clients", clients);
+        cJSON_AddItemToObject(json, latency_transport_name(transport), item);
+    }
+    free(h);
+    return json;
+}
+
+// API Stats endpoint - returns buffer statistics; ?reset=1 clears the latency
+// histograms after this report
 static esp_err_t api_stats_handler(httpd_req_t *req)
 {
     ESP_LOGI(TAG, "API Stats request");
     
+    char query[16] = {0};
+    char value[4];
+    bool reset = false;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK) {
+        reset = (strcmp(value, "1") == 0);
+    }
+
     buffer_stats_t stats;
     esp_err_t ret = data_buffer_get_stats(&stats);
     
@@ -134,6 +305,9 @@ static esp_err_t api_stats_handler(httpd_req_t *req)
     cJSON_AddNumberToObject(json, "buffer_overflows", stats.buffer_overflows);
     cJSON_AddNumberToObject(json, "last_timestamp_us", stats.last_timestamp_us);
     cJSON_AddNumberToObject(json, "avg_processing_time_us", stats.avg_processing_time_us);
+    cJSON_AddNumberToObject(json, "latest_reads", stats.latest_reads);
+    cJSON_AddNumberToObject(json, "latest_read_retries", stats.latest_read_retries);
+    cJSON_AddNumberToObject(json, "latest_read_fallbacks", stats.latest_read_fallbacks);
     cJSON_AddNumberToObject(json, "buffer_count", data_buffer_get_count());
     cJSON_AddBoolToObject(json, "buffer_full", data_buffer_is_full());
     cJSON_AddBoolToObject(json, "buffer_empty", data_buffer_is_empty());
@@ -142,6 +316,13 @@ static esp_err_t api_stats_handler(httpd_req_t *req)
     cJSON_AddNumberToObject(json, "ws_msg_per_sec", ws_msg_rate);
     cJSON_AddNumberToObject(json, "ws_samples_per_sec", ws_samples_rate);
     cJSON_AddNumberToObject(json, "ws_total_messages", ws_total_messages);
+    cJSON *latency = latency_to_json();
+    if (latency != NULL) {
+        cJSON_AddItemToObject(json, "latency", latency);
+    }
+    if (reset) {
+        latency_reset();
+    }
     
     char *json_string = cJSON_Print(json);
     if (json_string != NULL) {
@@ -165,29 +346,8 @@ static esp_err_t api_config_handler(httpd_req_t *req)
     
     if (req->method == HTTP_POST) {
         char buf[128] = {0};
-        int total_len = req->content_len;
-        if (total_len <= 0 || total_len >= (int)sizeof(buf)) {
-            httpd_resp_set_status(req, "400 Bad Request");
-            httpd_resp_send(req, "{\"error\":\"invalid_length\"}", HTTPD_RESP_USE_STRLEN);
-            return ESP_FAIL;
-        }
-
-        int received = 0;
-        while (received < total_len) {
-            int r = httpd_req_recv(req, buf + received, total_len - received);
-            if (r <= 0) {
-                httpd_resp_set_status(req, "400 Bad Request");
-                httpd_resp_send(req, "{\"error\":\"recv_failed\"}", HTTPD_RESP_USE_STRLEN);
-                return ESP_FAIL;
-            }
-            received += r;
-        }
-        buf[received] = '\0';
-
-        cJSON *root = cJSON_Parse(buf);
+        cJSON *root = recv_json_body(req, buf, sizeof(buf));
         if (root == NULL) {
-            httpd_resp_set_status(req, "400 Bad Request");
-            httpd_resp_send(req, "{\"error\":\"invalid_json\"}", HTTPD_RESP_USE_STRLEN);
             return ESP_FAIL;
         }
 
@@ -199,7 +359,8 @@ static esp_err_t api_config_handler(httpd_req_t *req)
             return ESP_FAIL;
         }
 
-        int requested_fs = (int)fs_item->valuedouble;
+        int32_t requested_fs = 0;       // Left at 0, so unsupported, if out of range or not finite
+        web_json_get_int(fs_item, 2, 16, &requested_fs);
         imu_manager_full_scale_t scale = IMU_MANAGER_FS_2G;
         switch (requested_fs) {
             case 2:
@@ -221,125 +382,1427 @@ static esp_err_t api_config_handler(httpd_req_t *req)
                 return ESP_FAIL;
         }
 
-        esp_err_t ret = imu_manager_set_full_scale(scale);
-        cJSON_Delete(root);
-        if (ret != ESP_OK) {
-            httpd_resp_set_status(req, "500 Internal Server Error");
-            httpd_resp_send(req, "{\"error\":\"apply_failed\"}", HTTPD_RESP_USE_STRLEN);
+        esp_err_t ret = imu_manager_set_full_scale(scale);
+        cJSON_Delete(root);
+        if (ret != ESP_OK) {
+            httpd_resp_set_status(req, "500 Internal Server Error");
+            httpd_resp_send(req, "{\"error\":\"apply_failed\"}", HTTPD_RESP_USE_STRLEN);
+            return ESP_FAIL;
+        }
+
+        cJSON *resp = cJSON_CreateObject();
+        cJSON_AddStringToObject(resp, "status", "ok");
+        cJSON_AddNumberToObject(resp, "full_scale_g", (double)requested_fs);
+        cJSON_AddNumberToObject(resp, "imu_full_scale_g", (double)imu_manager_get_full_scale_g());
+        char *resp_str = cJSON_PrintUnformatted(resp);
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+        if (resp_str) {
+            httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
+            free(resp_str);
+        } else {
+            httpd_resp_send(req, "{\"status\":\"ok\"}", HTTPD_RESP_USE_STRLEN);
+        }
+        cJSON_Delete(resp);
+        return ESP_OK;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    /* Do not include imu_odr_hz here to keep UI focused on actual plotted points/sec */
+    cJSON_AddNumberToObject(json, "imu_fifo_watermark", imu_manager_get_fifo_watermark());
+    cJSON_AddNumberToObject(json, "imu_full_scale_g", imu_manager_get_full_scale_g());
+
+    char *json_string = cJSON_Print(json);
+    if (json_string != NULL) {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+        httpd_resp_send(req, json_string, strlen(json_string));
+        free(json_string);
+    }
+
+    cJSON_Delete(json);
+    return ESP_OK;
+}
+
+// API Download endpoint - returns data in various formats
+static esp_err_t api_download_handler(httpd_req_t *req)
+{
+    ESP_LOGI(TAG, "API Download request");
+    
+    // Get format parameter
+    size_t buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1) {
+        char *buf = malloc(buf_len);
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            char format[16];
+            if (httpd_query_key_value(buf, "format", format, sizeof(format)) == ESP_OK) {
+                if (export_buf == NULL) {
+                    httpd_resp_set_status(req, "503 Service Unavailable");
+                    httpd_resp_send(req, "Export buffer unavailable", HTTPD_RESP_USE_STRLEN);
+                } else if (strcmp(format, "csv") == 0) {
+                    // Return CSV data
+                    esp_err_t ret = data_buffer_export_csv(export_buf, HTTP_EXPORT_BUFFER_SIZE, 100);
+                    if (ret == ESP_OK) {
+                        httpd_resp_set_type(req, "text/csv");
+                        httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=imu_data.csv");
+                        httpd_resp_send(req, export_buf, strlen(export_buf));
+                    } else {
+                        httpd_resp_set_status(req, "500 Internal Server Error");
+                        httpd_resp_send(req, "Failed to export CSV", HTTPD_RESP_USE_STRLEN);
+                    }
+                } else if (strcmp(format, "json") == 0) {
+                    // Return JSON data
+                    esp_err_t ret = data_buffer_export_json(export_buf, HTTP_EXPORT_BUFFER_SIZE, 100);
+                    if (ret == ESP_OK) {
+                        httpd_resp_set_type(req, "application/json");
+                        httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=imu_data.json");
+                        httpd_resp_send(req, export_buf, strlen(export_buf));
+                    } else {
+                        httpd_resp_set_status(req, "500 Internal Server Error");
+                        httpd_resp_send(req, "Failed to export JSON", HTTPD_RESP_USE_STRLEN);
+                    }
+                } else {
+                    httpd_resp_set_status(req, "400 Bad Request");
+                    httpd_resp_send(req, "Unsupported format", HTTPD_RESP_USE_STRLEN);
+                }
+            } else {
+                httpd_resp_set_status(req, "400 Bad Request");
+                httpd_resp_send(req, "Missing format parameter", HTTPD_RESP_USE_STRLEN);
+            }
+        }
+        free(buf);
+    } else {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_send(req, "Missing query parameters", HTTPD_RESP_USE_STRLEN);
+    }
+    
+    return ESP_OK;
+}
+
+// API History endpoint - without ?tier lists the tiers, with ?tier=N&count=M streams
+// the newest M entries of that tier as [min,max,mean,rms] rows (mg), null for gaps
+static esp_err_t api_history_handler(httpd_req_t *req)
+{
+    char query[64] = {0};
+    char value[16];
+    bool has_query = (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK);
+
+    if (!has_query || httpd_query_key_value(query, "tier", value, sizeof(value)) != ESP_OK) {
+        history_status_t status;
+        history_get_status(&status);
+
+        cJSON *json = cJSON_CreateObject();
+        cJSON_AddBoolToObject(json, "ready", status.ready);
+        cJSON_AddBoolToObject(json, "restored", status.restored);
+        cJSON_AddNumberToObject(json, "checkpoints", status.checkpoints);
+        cJSON_AddNumberToObject(json, "checkpoint_failures", status.checkpoint_failures);
+        cJSON_AddNumberToObject(json, "now_us", (double)esp_timer_get_time());
+        cJSON *list = cJSON_CreateArray();
+        for (uint8_t t = 0; t < HISTORY_TIER_COUNT; t++) {
+            history_tier_info_t info;
+            if (history_get_tier_info(t, &info) != ESP_OK) {
+                continue;
+            }
+            cJSON *tier = cJSON_CreateObject();
+            cJSON_AddNumberToObject(tier, "tier", t);
+            cJSON_AddNumberToObject(tier, "period_s", info.period_s);
+            cJSON_AddNumberToObject(tier, "capacity", info.capacity);
+            cJSON_AddNumberToObject(tier, "count", info.total < info.capacity ? info.total : info.capacity);
+            cJSON_AddItemToArray(list, tier);
+        }
+        cJSON_AddItemToObject(json, "tiers", list);
+
+        char *json_string = cJSON_PrintUnformatted(json);
+        if (json_string != NULL) {
+            httpd_resp_set_type(req, "application/json");
+            httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+            httpd_resp_send(req, json_string, strlen(json_string));
+            free(json_string);
+        } else {
+            httpd_resp_set_status(req, "500 Internal Server Error");
+            httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        }
+        cJSON_Delete(json);
+        return ESP_OK;
+    }
+
+    history_tier_info_t info;
+    char *end = NULL;
+    const unsigned long tier = strtoul(value, &end, 10);
+    if (end == value || *end != '\0' || tier >= HISTORY_TIER_COUNT ||
+        history_get_tier_info((uint8_t)tier, &info) != ESP_OK) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_send(req, "Invalid tier", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    uint32_t available = info.total < info.capacity ? info.total : info.capacity;
+    uint32_t count = 300;
+    if (httpd_query_key_value(query, "count", value, sizeof(value)) == ESP_OK) {
+        count = (uint32_t)strtoul(value, NULL, 10);
+    }
+    if (count > available) {
+        count = available;
+    }
+    const uint32_t first_seq = info.total - count;
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+    // Rows are streamed in chunks; a full hour of 1 s entries would not fit cJSON in RAM
+    char out[1024];
+    int len = snprintf(out, sizeof(out),
+                       "{\"tier\":%d,\"period_s\":%lu,\"capacity\":%lu,\"end_us\":%llu,\"now_us\":%llu,"
+                       "\"count\":%lu,\"fields\":[\"min_mg\",\"max_mg\",\"mean_mg\",\"rms_mg\"],\"rows\":[",
+                       (int)tier, (unsigned long)info.period_s, (unsigned long)info.capacity,
+                       (unsigned long long)info.last_end_us, (unsigned long long)esp_timer_get_time(),
+                       (unsigned long)count);
+
+    history_entry_t entries[32];
+    uint32_t sent = 0;
+    esp_err_t ret = ESP_OK;
+    while (sent < count && ret == ESP_OK) {
+        uint32_t want = count - sent;
+        if (want > sizeof(entries) / sizeof(entries[0])) {
+            want = sizeof(entries) / sizeof(entries[0]);
+        }
+        size_t got = history_read((uint8_t)tier, first_seq + sent, entries, want);
+        if (got == 0) {
+            break;
+        }
+        for (size_t i = 0; i < got; i++) {
+            if (len > (int)sizeof(out) - 40) {
+                ret = httpd_resp_send_chunk(req, out, len);
+                len = 0;
+            }
+            const char *sep = (sent + i == 0) ? "" : ",";
+            if (entries[i].min_mg == HISTORY_GAP) {
+                len += snprintf(out + len, sizeof(out) - len, "%snull", sep);
+            } else {
+                len += snprintf(out + len, sizeof(out) - len, "%s[%u,%u,%u,%u]", sep,
+                                entries[i].min_mg, entries[i].max_mg,
+                                entries[i].mean_mg, entries[i].rms_mg);
+            }
+        }
+        sent += got;
+    }
+
+    if (ret == ESP_OK) {
+        len += snprintf(out + len, sizeof(out) - len, "]}");
+        ret = httpd_resp_send_chunk(req, out, len);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "History response aborted: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// API Pipeline endpoint - GET lists nodes and edges with per-edge throughput and,
+// for ring sinks, each consumer's lag and missed samples; POST applies {"connect":{"from","to"}}, {"disconnect":{"from","to"}}
+// and/or {"param":{"stage","value"}}
+static esp_err_t api_pipeline_handler(httpd_req_t *req)
+{
+    ESP_LOGI(TAG, "API Pipeline request");
+
+    if (req->method == HTTP_POST) {
+        char buf[192] = {0};
+        cJSON *root = recv_json_body(req, buf, sizeof(buf));
+        if (root == NULL) {
+            return ESP_FAIL;
+        }
+
+        esp_err_t ret = ESP_OK;
+        cJSON *connect = cJSON_GetObjectItem(root, "connect");
+        cJSON *disconnect = cJSON_GetObjectItem(root, "disconnect");
+        cJSON *param = cJSON_GetObjectItem(root, "param");
+        if (cJSON_IsObject(connect)) {
+            ret = pipeline_connect(cJSON_GetStringValue(cJSON_GetObjectItem(connect, "from")),
+                                   cJSON_GetStringValue(cJSON_GetObjectItem(connect, "to")));
+        }
+        if (ret == ESP_OK && cJSON_IsObject(disconnect)) {
+            ret = pipeline_disconnect(cJSON_GetStringValue(cJSON_GetObjectItem(disconnect, "from")),
+                                      cJSON_GetStringValue(cJSON_GetObjectItem(disconnect, "to")));
+        }
+        if (ret == ESP_OK && cJSON_IsObject(param)) {
+            int32_t value;
+            ret = web_json_get_int(cJSON_GetObjectItem(param, "value"), INT32_MIN, INT32_MAX, &value)
+                  ? pipeline_set_param(cJSON_GetStringValue(cJSON_GetObjectItem(param, "stage")), value)
+                  : ESP_ERR_INVALID_ARG;
+        }
+        cJSON_Delete(root);
+
+        if (ret != ESP_OK) {
+            httpd_resp_set_status(req, ret == ESP_ERR_NOT_FOUND ? "404 Not Found" : "400 Bad Request");
+            httpd_resp_set_type(req, "application/json");
+            char err[64];
+            snprintf(err, sizeof(err), "{\"error\":\"%s\"}", esp_err_to_name(ret));
+            httpd_resp_send(req, err, HTTPD_RESP_USE_STRLEN);
+            return ESP_FAIL;
+        }
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON *node_list = cJSON_CreateArray();
+    const size_t node_count = pipeline_get_node_count();
+    for (size_t i = 0; i < node_count; i++) {
+        pipeline_node_info_t node;
+        if (pipeline_get_node((pipeline_node_id_t)i, &node) != ESP_OK) {
+            continue;
+        }
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", node.name);
+        cJSON_AddStringToObject(item, "kind", pipeline_node_kind_name(node.kind));
+        if (node.kind == PIPELINE_NODE_STAGE) {
+            cJSON_AddNumberToObject(item, "param", node.param);
+            cJSON_AddNumberToObject(item, "param_min", node.param_min);
+            cJSON_AddNumberToObject(item, "param_max", node.param_max);
+        }
+        if (node.ring != NULL) {
+            cJSON_AddNumberToObject(item, "ring_capacity", node.ring_capacity);
+            cJSON *consumers = cJSON_CreateArray();
+            for (uint8_t c = 0; c < node.ring->consumer_count; c++) {
+                bcast_consumer_stats_t stats;
+                if (bcast_ring_get_consumer_stats(node.ring, (bcast_consumer_id_t)c, &stats) != ESP_OK) {
+                    continue;
+                }
+                cJSON *consumer = cJSON_CreateObject();
+                cJSON_AddStringToObject(consumer, "name", stats.name);
+                cJSON_AddNumberToObject(consumer, "lag", stats.lag);
+                cJSON_AddNumberToObject(consumer, "read", stats.read_total);
+                cJSON_AddNumberToObject(consumer, "missed", stats.missed_total);
+                cJSON_AddItemToArray(consumers, consumer);
+            }
+            cJSON_AddItemToObject(item, "consumers", consumers);
+        }
+        cJSON_AddItemToArray(node_list, item);
+    }
+    cJSON_AddItemToObject(json, "nodes", node_list);
+
+    cJSON *edge_list = cJSON_CreateArray();
+    const size_t edge_count = pipeline_get_edge_count();
+    for (size_t i = 0; i < edge_count; i++) {
+        pipeline_edge_info_t edge;
+        pipeline_node_info_t from;
+        pipeline_node_info_t to;
+        if (pipeline_get_edge(i, &edge) != ESP_OK ||
+            pipeline_get_node(edge.from, &from) != ESP_OK ||
+            pipeline_get_node(edge.to, &to) != ESP_OK) {
+            continue;
+        }
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "from", from.name);
+        cJSON_AddStringToObject(item, "to", to.name);
+        cJSON_AddBoolToObject(item, "enabled", edge.enabled);
+        cJSON_AddNumberToObject(item, "blocks", edge.blocks);
+        cJSON_AddNumberToObject(item, "samples", edge.samples);
+        cJSON_AddNumberToObject(item, "samples_per_s", edge.samples_per_s);
+        if (to.ring != NULL) {
+            cJSON_AddNumberToObject(item, "max_lag", to.ring_max_lag);
+            cJSON_AddNumberToObject(item, "missed", to.ring_missed);
+        }
+        cJSON_AddItemToArray(edge_list, item);
+    }
+    cJSON_AddItemToObject(json, "edges", edge_list);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (json_string == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    return ESP_OK;
+}
+
+// API Memory endpoint - arena usage per subsystem against its budget, plus heap
+// free/low-water/largest block and fragmentation
+static esp_err_t api_memory_handler(httpd_req_t *req)
+{
+    mem_report_t report;
+    mem_arena_get_report(&report);
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON *arena = cJSON_CreateObject();
+    cJSON_AddNumberToObject(arena, "size", report.arena_size);
+    cJSON_AddNumberToObject(arena, "used", report.arena_used);
+    cJSON_AddNumberToObject(arena, "free", report.arena_size > report.arena_used ?
+                                           report.arena_size - report.arena_used : 0);
+    cJSON_AddItemToObject(json, "arena", arena);
+
+    cJSON *subsystems = cJSON_CreateArray();
+    for (int i = 0; i < MEM_SUBSYS_COUNT; i++) {
+        const mem_subsys_usage_t *u = &report.subsys[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", mem_arena_subsys_name((mem_subsys_t)i));
+        cJSON_AddNumberToObject(item, "budget", u->budget);
+        cJSON_AddNumberToObject(item, "arena_bytes", u->arena_bytes);
+        cJSON_AddNumberToObject(item, "heap_bytes", u->heap_bytes);
+        cJSON_AddNumberToObject(item, "headroom", u->budget > u->arena_bytes + u->heap_bytes ?
+                                                  u->budget - u->arena_bytes - u->heap_bytes : 0);
+        cJSON_AddNumberToObject(item, "allocations", u->allocations);
+        cJSON_AddNumberToObject(item, "failures", u->failures);
+        cJSON_AddItemToArray(subsystems, item);
+    }
+    cJSON_AddItemToObject(json, "subsystems", subsystems);
+
+    cJSON *heap = cJSON_CreateObject();
+    cJSON_AddNumberToObject(heap, "total", report.heap_total);
+    cJSON_AddNumberToObject(heap, "free", report.heap_free);
+    cJSON_AddNumberToObject(heap, "min_free", report.heap_min_free);
+    cJSON_AddNumberToObject(heap, "largest_free_block", report.heap_largest_block);
+    cJSON_AddNumberToObject(heap, "allocated_blocks", report.heap_allocated_blocks);
+    cJSON_AddNumberToObject(heap, "free_blocks", report.heap_free_blocks);
+    cJSON_AddNumberToObject(heap, "fragmentation_pct", report.heap_fragmentation_pct);
+    cJSON_AddItemToObject(json, "heap", heap);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (json_string == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    return ESP_OK;
+}
+
+// API System endpoint - per-task CPU share and stack, heap by capability, and the
+// monitor's recent history as [uptime_s, cpu_busy_pct, heap_free, largest_block] rows
+static esp_err_t api_system_handler(httpd_req_t *req)
+{
+    sys_snapshot_t *snap = malloc(sizeof(*snap));
+    sys_history_entry_t *hist = malloc(SYS_MONITOR_HISTORY * sizeof(*hist));
+    if (snap == NULL || hist == NULL) {
+        free(snap);
+        free(hist);
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "Out of memory", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = sys_monitor_get_snapshot(snap);
+    if (ret != ESP_OK) {
+        free(snap);
+        free(hist);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+        httpd_resp_send(req, "{\"error\":\"no_sample_yet\"}", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+    }
+    const size_t hist_count = sys_monitor_get_history(hist, SYS_MONITOR_HISTORY);
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, "uptime_s", (double)(snap->timestamp_us / 1000000ULL));
+    cJSON_AddNumberToObject(json, "period_ms", snap->period_ms);
+    cJSON_AddBoolToObject(json, "task_stats", snap->task_stats);
+    cJSON_AddNumberToObject(json, "cpu_busy_pct", roundf(snap->cpu_busy_pct * 10.0f) / 10.0f);
+
+    cJSON *tasks = cJSON_CreateArray();
+    for (uint8_t i = 0; i < snap->task_count; i++) {
+        const sys_task_info_t *t = &snap->tasks[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", t->name);
+        cJSON_AddNumberToObject(item, "priority", t->priority);
+        cJSON_AddStringToObject(item, "state", sys_monitor_task_state_name(t->state));
+        cJSON_AddNumberToObject(item, "cpu_pct", roundf(t->cpu_pct * 10.0f) / 10.0f);
+        cJSON_AddNumberToObject(item, "cpu_peak_pct", roundf(t->cpu_peak_pct * 10.0f) / 10.0f);
+        cJSON_AddNumberToObject(item, "stack_free_min", t->stack_free_min);
+        cJSON_AddItemToArray(tasks, item);
+    }
+    cJSON_AddItemToObject(json, "tasks", tasks);
+
+    cJSON *heap = cJSON_CreateObject();
+    for (int i = 0; i < SYS_HEAP_CAP_COUNT; i++) {
+        const sys_heap_info_t *h = &snap->heap[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "total", h->total);
+        cJSON_AddNumberToObject(item, "free", h->free);
+        cJSON_AddNumberToObject(item, "min_free", h->min_free);
+        cJSON_AddNumberToObject(item, "largest_free_block", h->largest_block);
+        cJSON_AddItemToObject(heap, sys_monitor_heap_cap_name((sys_heap_cap_t)i), item);
+    }
+    cJSON_AddItemToObject(json, "heap", heap);
+
+    cJSON *history = cJSON_CreateArray();
+    for (size_t i = 0; i < hist_count; i++) {
+        cJSON *row = cJSON_CreateArray();
+        cJSON_AddItemToArray(row, cJSON_CreateNumber(hist[i].uptime_s));
+        cJSON_AddItemToArray(row, cJSON_CreateNumber(roundf(hist[i].cpu_busy_pct * 10.0f) / 10.0f));
+        cJSON_AddItemToArray(row, cJSON_CreateNumber(hist[i].heap_free));
+        cJSON_AddItemToArray(row, cJSON_CreateNumber(hist[i].heap_largest_block));
+        cJSON_AddItemToArray(history, row);
+    }
+    cJSON_AddItemToObject(json, "history", history);
+    free(snap);
+    free(hist);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (json_string == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    return ESP_OK;
+}
+
+#if CONFIG_IMU_TEST_HOOKS
+// API Bench endpoint - runs the hot-path micro-benchmarks in the HTTP task and
+// returns one result per case; ?iterations=N overrides the default count
+static esp_err_t api_bench_handler(httpd_req_t *req)
+{
+    char query[32] = {0};
+    char value[12];
+    uint32_t iterations = 0;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "iterations", value, sizeof(value)) == ESP_OK) {
+        iterations = (uint32_t)strtoul(value, NULL, 10);
+    }
+
+    bench_result_t results[BENCH_MAX_RESULTS];
+    size_t count = 0;
+    esp_err_t ret = bench_run(iterations, results, BENCH_MAX_RESULTS, &count);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_send(req, "Benchmark already running", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+    }
+    if (ret != ESP_OK) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, esp_err_to_name(ret), HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, "cpu_mhz", esp_rom_get_cpu_ticks_per_us());
+    cJSON_AddNumberToObject(json, "seed", BENCH_CORPUS_SEED);
+    cJSON *list = cJSON_CreateArray();
+    for (size_t i = 0; i < count; i++) {
+        const bench_result_t *r = &results[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", r->name);
+        cJSON_AddBoolToObject(item, "skipped", r->skipped);
+        cJSON_AddNumberToObject(item, "iterations", r->iterations);
+        cJSON_AddNumberToObject(item, "samples", r->samples);
+        cJSON_AddNumberToObject(item, "bytes", r->bytes);
+        cJSON_AddNumberToObject(item, "ns_per_sample", roundf(r->ns_per_sample * 10.0f) / 10.0f);
+        cJSON_AddNumberToObject(item, "best_ns_per_sample", roundf(r->best_ns_per_sample * 10.0f) / 10.0f);
+        cJSON_AddNumberToObject(item, "bytes_per_s", roundf(r->bytes_per_s));
+        char crc[9];
+        snprintf(crc, sizeof(crc), "%08lx", (unsigned long)r->checksum);
+        cJSON_AddStringToObject(item, "checksum", crc);
+        cJSON_AddItemToArray(list, item);
+    }
+    cJSON_AddItemToObject(json, "results", list);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (json_string == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    return ESP_OK;
+}
+
+// API Golden endpoint - replays the embedded golden FIFO streams through the signal
+// path and compares every stage with the stored outputs; 200 with "passed":false
+// on a mismatch, 500 when the embedded file itself is unusable
+static esp_err_t api_golden_handler(httpd_req_t *req)
+{
+    golden_result_t *results = malloc(GOLDEN_MAX_RESULTS * sizeof(*results));
+    if (results == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "Out of memory", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    size_t count = 0;
+    bool passed = false;
+    esp_err_t ret = golden_run(results, GOLDEN_MAX_RESULTS, &count, &passed);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        free(results);
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_send(req, "Golden check already running", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+    }
+    if (ret != ESP_OK) {
+        free(results);
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, esp_err_to_name(ret), HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddBoolToObject(json, "passed", passed);
+    cJSON *list = cJSON_CreateArray();
+    for (size_t i = 0; i < count; i++) {
+        const golden_result_t *r = &results[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", r->name);
+        cJSON_AddBoolToObject(item, "passed", r->passed);
+        cJSON_AddNumberToObject(item, "samples", r->samples);
+        cJSON_AddNumberToObject(item, "mismatches", r->mismatches);
+        cJSON_AddNumberToObject(item, "max_error", isfinite(r->max_error) ? r->max_error : -1.0);
+        cJSON_AddNumberToObject(item, "ns_per_sample", roundf(r->ns_per_sample * 10.0f) / 10.0f);
+        cJSON_AddItemToArray(list, item);
+    }
+    cJSON_AddItemToObject(json, "results", list);
+    free(results);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (json_string == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    return ESP_OK;
+}
+#endif // CONFIG_IMU_TEST_HOOKS
+
+// API Acquisition endpoint - histograms of the acquisition loop timing with
+// percentiles and the non-empty buckets as [low, high, count] rows; ?reset=1
+// clears them after this report
+static esp_err_t api_acquisition_handler(httpd_req_t *req)
+{
+    char query[16] = {0};
+    char value[4];
+    bool reset = false;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK) {
+        reset = (strcmp(value, "1") == 0);
+    }
+
+    hist_t *h = malloc(sizeof(*h));
+    if (h == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "Out of memory", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, "window_s",
+                            roundf((float)(esp_timer_get_time() - (int64_t)acq_stats_get_since_us()) / 1e5f) / 10.0f);
+    cJSON_AddNumberToObject(json, "period_us", acq_stats_get_period_us());
+    cJSON_AddNumberToObject(json, "odr_hz", imu_manager_get_configured_odr());
+    cJSON_AddNumberToObject(json, "fifo_depth", IMU_MANAGER_FIFO_DEPTH);
+    cJSON_AddNumberToObject(json, "fifo_overflows", imu_manager_get_fifo_overflow_count());
+
+    for (int i = 0; i < ACQ_STAT_COUNT; i++) {
+        acq_stats_get((acq_stat_id_t)i, h);
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "unit", acq_stats_unit((acq_stat_id_t)i));
+        add_hist_summary(item, h);
+        cJSON *buckets = cJSON_CreateArray();
+        for (size_t b = 0; b < HIST_BUCKETS; b++) {
+            if (h->counts[b] == 0) {
+                continue;
+            }
+            cJSON *row = cJSON_CreateArray();
+            cJSON_AddItemToArray(row, cJSON_CreateNumber(hist_bucket_low(b)));
+            cJSON_AddItemToArray(row, cJSON_CreateNumber(hist_bucket_high(b)));
+            cJSON_AddItemToArray(row, cJSON_CreateNumber(h->counts[b]));
+            cJSON_AddItemToArray(buckets, row);
+        }
+        cJSON_AddItemToObject(item, "buckets", buckets);
+        cJSON_AddItemToObject(json, acq_stats_name((acq_stat_id_t)i), item);
+    }
+    free(h);
+
+    if (reset) {
+        acq_stats_reset();
+    }
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (json_string == NULL) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    return ESP_OK;
+}
+
+// API Log endpoint - formats the deferred log ring as text, oldest first;
+// ?since=<seq> returns only newer entries (the X-Log-Next header gives the next seq)
+static esp_err_t api_log_handler(httpd_req_t *req)
+{
+    uint32_t oldest;
+    uint32_t next;
+    tlog_get_range(&oldest, &next);
+
+    char query[32] = {0};
+    char value[16];
+    uint32_t seq = oldest;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK) {
+        const uint32_t since = (uint32_t)strtoul(value, NULL, 10);
+        if ((int32_t)(since - oldest) > 0) {
+            seq = since;
+        }
+    }
+
+    char next_str[16];
+    snprintf(next_str, sizeof(next_str), "%lu", (unsigned long)next);
+    httpd_resp_set_type(req, "text/plain");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "X-Log-Next", next_str);
+
+    char out[1024];
+    int len = 0;
+    esp_err_t ret = ESP_OK;
+    for (; seq != next && ret == ESP_OK; seq++) {
+        tlog_entry_t entry;
+        if (!tlog_get(seq, &entry)) {
+            continue;   // Overwritten since the range was taken
+        }
+        if (len > (int)sizeof(out) - TLOG_LINE_MAX - 2) {
+            ret = httpd_resp_send_chunk(req, out, len);
+            len = 0;
+        }
+        len += (int)tlog_format(&entry, out + len, TLOG_LINE_MAX);
+        out[len++] = '\n';
+    }
+
+    if (ret == ESP_OK && len > 0) {
+        ret = httpd_resp_send_chunk(req, out, len);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Prometheus scrape endpoint
+static esp_err_t metrics_write_chunk(void *ctx, const char *data, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, len);
+}
+
+static esp_err_t metrics_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+    esp_err_t ret = metrics_render(metrics_write_chunk, req);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// API Trace endpoint - the trace ring as Chrome trace JSON. Cycle stamps are turned
+// into microseconds since the oldest event by summing signed deltas, which is exact
+// as long as consecutive events are less than ~13 s apart.
+#define TRACE_EXPORT_MAX_TASKS 12
+
+static esp_err_t api_trace_handler(httpd_req_t *req)
+{
+    trace_stats_t stats;
+    trace_get_stats(&stats);
+    if (!stats.enabled) {
+        httpd_resp_set_status(req, "404 Not Found");
+        httpd_resp_send(req, "{\"error\":\"tracing_disabled\"}", HTTPD_RESP_USE_STRLEN);
+        return ESP_OK;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"trace.json\"");
+
+    // Hold the ring still so the export is one consistent window
+    trace_pause(true);
+    uint32_t oldest;
+    uint32_t next;
+    trace_get_range(&oldest, &next);
+
+    const double cycles_per_us = (double)trace_cycles_per_us();
+    TaskHandle_t tasks[TRACE_EXPORT_MAX_TASKS];
+    int task_count = 0;
+    bool have_base = false;
+    uint32_t prev_cycles = 0;
+    int64_t elapsed_cycles = 0;
+
+    char out[1024];
+    int len = snprintf(out, sizeof(out), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    bool first = true;
+    esp_err_t ret = ESP_OK;
+    for (uint32_t seq = oldest; seq != next && ret == ESP_OK; seq++) {
+        trace_event_t ev;
+        if (!trace_get(seq, &ev)) {
+            continue;
+        }
+        if (have_base) {
+            elapsed_cycles += (int32_t)(ev.cycles - prev_cycles);
+        }
+        have_base = true;
+        prev_cycles = ev.cycles;
+
+        int tid = 0;
+        while (tid < task_count && tasks[tid] != ev.task) {
+            tid++;
+        }
+        if (tid == task_count && task_count < TRACE_EXPORT_MAX_TASKS) {
+            tasks[task_count++] = ev.task;
+        }
+
+        if (len > (int)sizeof(out) - 160) {
+            ret = httpd_resp_send_chunk(req, out, len);
+            len = 0;
+        }
+        const char *ph = (ev.phase == TRACE_PHASE_BEGIN) ? "B" : (ev.phase == TRACE_PHASE_END) ? "E" : "i";
+        len += snprintf(out + len, sizeof(out) - len,
+                        "%s{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%d",
+                        first ? "" : ",", trace_point_name((trace_point_t)ev.point), ph,
+                        (double)elapsed_cycles / cycles_per_us, tid + 1);
+        if (ev.phase == TRACE_PHASE_BEGIN) {
+            len += snprintf(out + len, sizeof(out) - len, "}");
+        } else {
+            len += snprintf(out + len, sizeof(out) - len, "%s\"args\":{\"n\":%u}}",
+                            ev.phase == TRACE_PHASE_INSTANT ? ",\"s\":\"t\"," : ",",
+                            (unsigned int)ev.arg);
+        }
+        first = false;
+    }
+    trace_pause(false);
+
+    // Thread names; every task that records trace points lives for the whole run
+    for (int i = 0; i < task_count && ret == ESP_OK; i++) {
+        if (len > (int)sizeof(out) - 120) {
+            ret = httpd_resp_send_chunk(req, out, len);
+            len = 0;
+        }
+        len += snprintf(out + len, sizeof(out) - len,
+                        "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                        "\"args\":{\"name\":\"%s\"}}",
+                        first ? "" : ",", i + 1, tasks[i] ? pcTaskGetName(tasks[i]) : "?");
+        first = false;
+    }
+
+    if (ret == ESP_OK) {
+        len += snprintf(out + len, sizeof(out) - len,
+                        "],\"otherData\":{\"recorded\":%lu,\"dropped\":%lu,\"capacity\":%lu}}",
+                        (unsigned long)stats.recorded, (unsigned long)stats.dropped,
+                        (unsigned long)stats.capacity);
+        ret = httpd_resp_send_chunk(req, out, len);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// API Schedule endpoint - GET returns duty-cycle config, metrics and recent slot
+// features, POST updates {"enabled","interval_s","window_ms","store_raw"}
+static esp_err_t api_schedule_handler(httpd_req_t *req)
+{
+    ESP_LOGI(TAG, "API Schedule request");
+
+    if (req->method == HTTP_POST) {
+        char buf[160] = {0};
+        cJSON *root = recv_json_body(req, buf, sizeof(buf));
+        if (root == NULL) {
+            return ESP_FAIL;
+        }
+
+        duty_status_t current;
+        duty_cycle_get_status(&current);
+        duty_config_t cfg = current.config;
+
+        cJSON *enabled = cJSON_GetObjectItem(root, "enabled");
+        cJSON *interval = cJSON_GetObjectItem(root, "interval_s");
+        cJSON *window = cJSON_GetObjectItem(root, "window_ms");
+        cJSON *store_raw = cJSON_GetObjectItem(root, "store_raw");
+        bool valid = true;
+        int32_t number;
+        if (cJSON_IsBool(enabled)) {
+            cfg.enabled = cJSON_IsTrue(enabled);
+        }
+        if (interval != NULL) {
+            valid = web_json_get_int(interval, DUTY_MIN_INTERVAL_S, DUTY_MAX_INTERVAL_S, &number);
+            cfg.interval_s = (uint32_t)number;
+        }
+        if (valid && window != NULL) {
+            valid = web_json_get_int(window, 1, DUTY_MAX_WINDOW_MS, &number);
+            cfg.window_ms = (uint32_t)number;
+        }
+        if (cJSON_IsBool(store_raw)) {
+            cfg.store_raw = cJSON_IsTrue(store_raw);
+        }
+        cJSON_Delete(root);
+
+        if (!valid || duty_cycle_configure(&cfg) != ESP_OK) {
+            httpd_resp_set_status(req, "400 Bad Request");
+            httpd_resp_send(req, "{\"error\":\"invalid_schedule\"}", HTTPD_RESP_USE_STRLEN);
+            return ESP_FAIL;
+        }
+    }
+
+    duty_status_t status;
+    if (duty_cycle_get_status(&status) != ESP_OK) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "Failed to get schedule status", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddBoolToObject(json, "enabled", status.config.enabled);
+    cJSON_AddNumberToObject(json, "interval_s", status.config.interval_s);
+    cJSON_AddNumberToObject(json, "window_ms", status.config.window_ms);
+    cJSON_AddBoolToObject(json, "store_raw", status.config.store_raw);
+    cJSON_AddBoolToObject(json, "capturing", status.capturing);
+    cJSON_AddNumberToObject(json, "slots", status.slots_completed);
+    cJSON_AddNumberToObject(json, "slots_late", status.slots_late);
+    cJSON_AddNumberToObject(json, "next_slot_us", (double)status.next_slot_us);
+    cJSON_AddNumberToObject(json, "now_us", (double)esp_timer_get_time());
+    cJSON_AddNumberToObject(json, "sensor_on_s", status.sensor_on_s);
+    cJSON_AddNumberToObject(json, "sensor_off_s", status.sensor_off_s);
+    cJSON_AddNumberToObject(json, "duty_pct", status.duty_pct);
+    cJSON_AddNumberToObject(json, "sensor_mah", status.sensor_charge_mah);
+    cJSON_AddBoolToObject(json, "radio_power_save", status.radio_power_save);
+    cJSON_AddNumberToObject(json, "raw_files", status.raw_files_written);
+
+    static duty_result_t results[DUTY_RESULT_HISTORY];
+    size_t count = duty_cycle_get_results(results, DUTY_RESULT_HISTORY);
+    static const char *axis_names[3] = {"x", "y", "z"};
+    cJSON *list = cJSON_CreateArray();
+    for (size_t i = 0; i < count; i++) {
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "slot", results[i].slot);
+        cJSON_AddNumberToObject(item, "t", (double)results[i].timestamp_us);
+        cJSON_AddNumberToObject(item, "samples", results[i].samples);
+        cJSON_AddNumberToObject(item, "duration_s", results[i].duration_s);
+        cJSON_AddNumberToObject(item, "fs", results[i].full_scale_g);
+        for (int axis = 0; axis < 3; axis++) {
+            const duty_axis_features_t *f = &results[i].axis[axis];
+            cJSON *features = cJSON_CreateObject();
+            cJSON_AddNumberToObject(features, "mean", f->mean_g);
+            cJSON_AddNumberToObject(features, "rms", f->rms_g);
+            cJSON_AddNumberToObject(features, "peak", f->peak_g);
+            cJSON_AddNumberToObject(features, "p2p", f->p2p_g);
+            cJSON_AddNumberToObject(features, "crest", f->crest);
+            cJSON_AddItemToObject(item, axis_names[axis], features);
+        }
+        if (results[i].raw_stored) {
+            cJSON_AddStringToObject(item, "raw", results[i].raw_file);
+        }
+        cJSON_AddItemToArray(list, item);
+    }
+    cJSON_AddItemToObject(json, "results", list);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    if (json_string != NULL) {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+        httpd_resp_send(req, json_string, strlen(json_string));
+        free(json_string);
+    } else {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+    }
+
+    cJSON_Delete(json);
+    return ESP_OK;
+}
+
+// API IP endpoint - returns current IP address as JSON
+static esp_err_t api_ip_handler(httpd_req_t *req)
+{
+    ESP_LOGI(TAG, "API IP request received");
+
+    esp_netif_ip_info_t ip_info;
+    char ip_str[32] = "0.0.0.0";
+    esp_netif_t *netif = esp_netif_get_default_netif();
+    if (netif && esp_netif_get_ip_info(netif, &ip_info) == ESP_OK) {
+        snprintf(ip_str, sizeof(ip_str), "%d.%d.%d.%d",
+                 esp_ip4_addr1(&ip_info.ip), esp_ip4_addr2(&ip_info.ip),
+                 esp_ip4_addr3(&ip_info.ip), esp_ip4_addr4(&ip_info.ip));
+        ESP_LOGI(TAG, "Returning IP: %s", ip_str);
+    } else {
+        ESP_LOGW(TAG, "Failed to get IP, returning 0.0.0.0");
+    }
+
+    char json[64];
+    snprintf(json, sizeof(json), "{\"ip\":\"%s\"}", ip_str);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_send(req, json, HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+}
+
+// API Replay endpoint - GET lists captures and replay state, POST starts/stops replay
+static esp_err_t api_replay_handler(httpd_req_t *req)
+{
+    ESP_LOGI(TAG, "API Replay request");
+
+    if (req->method == HTTP_POST) {
+        char buf[192] = {0};
+        cJSON *root = recv_json_body(req, buf, sizeof(buf));
+        if (root == NULL) {
+            return ESP_FAIL;
+        }
+
+        const char *error = NULL;
+        cJSON *action = cJSON_GetObjectItem(root, "action");
+        if (!cJSON_IsString(action)) {
+            error = "missing_action";
+        } else if (strcmp(action->valuestring, "stop") == 0) {
+            if (replay_stop() != ESP_OK) {
+                error = "stop_failed";
+            }
+        } else if (strcmp(action->valuestring, "start") == 0) {
+            cJSON *file = cJSON_GetObjectItem(root, "file");
+            cJSON *speed = cJSON_GetObjectItem(root, "speed");
+            cJSON *loop = cJSON_GetObjectItem(root, "loop");
+            char path[REPLAY_MAX_PATH_LEN];
+
+            if (!cJSON_IsString(file) || strchr(file->valuestring, '/') != NULL ||
+                strstr(file->valuestring, "..") != NULL) {
+                error = "invalid_file";
+            } else if (snprintf(path, sizeof(path), REPLAY_BASE_PATH "/%s", file->valuestring) >= (int)sizeof(path)) {
+                error = "invalid_file";
+            } else {
+                replay_speed_t mode = REPLAY_SPEED_REALTIME;
+                if (cJSON_IsString(speed) && strcmp(speed->valuestring, "max") == 0) {
+                    mode = REPLAY_SPEED_MAX;
+                }
+                if (replay_start(path, mode, cJSON_IsTrue(loop)) != ESP_OK) {
+                    error = "start_failed";
+                }
+            }
+        } else {
+            error = "unsupported_action";
+        }
+        cJSON_Delete(root);
+
+        if (error != NULL) {
+            char err_json[64];
+            snprintf(err_json, sizeof(err_json), "{\"error\":\"%s\"}", error);
+            httpd_resp_set_status(req, "400 Bad Request");
+            httpd_resp_send(req, err_json, HTTPD_RESP_USE_STRLEN);
+            return ESP_FAIL;
+        }
+    }
+
+    replay_status_t status;
+    if (replay_get_status(&status) != ESP_OK) {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "Failed to get replay status", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddBoolToObject(json, "active", status.active);
+    cJSON_AddStringToObject(json, "file", status.path);
+    cJSON_AddStringToObject(json, "speed", status.speed == REPLAY_SPEED_MAX ? "max" : "realtime");
+    cJSON_AddBoolToObject(json, "loop", status.loop);
+    cJSON_AddNumberToObject(json, "odr_hz", status.odr_hz);
+    cJSON_AddNumberToObject(json, "full_scale_g", status.full_scale_g);
+    cJSON_AddNumberToObject(json, "total_samples", status.total_samples);
+    cJSON_AddNumberToObject(json, "position", status.position);
+    cJSON_AddNumberToObject(json, "loops_completed", status.loops_completed);
+    cJSON_AddNumberToObject(json, "injected_samples", (double)status.injected_samples);
+
+    cJSON *files = cJSON_CreateArray();
+    DIR *dir = opendir(REPLAY_BASE_PATH);
+    if (dir != NULL) {
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL) {
+            const size_t len = strlen(entry->d_name);
+            const size_t ext_len = strlen(CAPTURE_FILE_EXT);
+            if (len > ext_len && strcmp(entry->d_name + len - ext_len, CAPTURE_FILE_EXT) == 0) {
+                cJSON_AddItemToArray(files, cJSON_CreateString(entry->d_name));
+            }
+        }
+        closedir(dir);
+    }
+    cJSON_AddItemToObject(json, "captures", files);
+
+    char *json_string = cJSON_PrintUnformatted(json);
+    if (json_string != NULL) {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+        httpd_resp_send(req, json_string, strlen(json_string));
+        free(json_string);
+    } else {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
+    }
+
+    cJSON_Delete(json);
+    return ESP_OK;
+}
+
+// Parse a single "bytes=" range. Returns 1 for a valid range, 0 when the header should
+// be ignored (malformed or multi-range: the full body is sent) and -1 if unsatisfiable.
+static int parse_byte_range(const char *value, size_t size, size_t *start, size_t *end)
+{
+    if (strncmp(value, "bytes=", 6) != 0 || strchr(value, ',') != NULL) {
+        return 0;
+    }
+
+    const char *spec = value + 6;
+    char *next = NULL;
+    if (*spec == '-') {
+        // Suffix range: the last N bytes
+        unsigned long suffix = strtoul(spec + 1, &next, 10);
+        if (next == spec + 1 || *next != '\0') {
+            return 0;
+        }
+        if (suffix == 0 || size == 0) {
+            return -1;
+        }
+        *start = suffix >= size ? 0 : size - suffix;
+        *end = size - 1;
+        return 1;
+    }
+
+    unsigned long first = strtoul(spec, &next, 10);
+    if (next == spec || *next != '-') {
+        return 0;
+    }
+    const char *last_str = next + 1;
+    unsigned long last = size > 0 ? size - 1 : 0;
+    if (*last_str != '\0') {
+        last = strtoul(last_str, &next, 10);
+        if (next == last_str || *next != '\0' || last < first) {
+            return 0;
+        }
+    }
+    if (first >= size) {
+        return -1;
+    }
+    *start = first;
+    *end = last >= size ? size - 1 : last;
+    return 1;
+}
+
+static bool get_req_hdr(httpd_req_t *req, const char *field, char *value, size_t value_len)
+{
+    size_t len = httpd_req_get_hdr_value_len(req, field);
+    return len > 0 && len < value_len &&
+           httpd_req_get_hdr_value_str(req, field, value, value_len) == ESP_OK;
+}
+
+static esp_err_t http_send_all(httpd_req_t *req, const char *buf, size_t len)
+{
+    while (len > 0) {
+        int sent = httpd_send(req, buf, len);
+        if (sent <= 0) {
+            return ESP_FAIL;
+        }
+        buf += sent;
+        len -= (size_t)sent;
+    }
+    return ESP_OK;
+}
+
+// Stream a file from SPIFFS with Content-Length, a strong ETag and Range/If-Range
+// support so host tools can resume or split large downloads.
+static esp_err_t send_file_ranged(httpd_req_t *req, const char *path, const char *content_type)
+{
+    struct stat st;
+    FILE *file = fopen(path, "rb");
+    if (file == NULL || stat(path, &st) != 0) {
+        if (file != NULL) {
+            fclose(file);
+        }
+        httpd_resp_set_status(req, "404 Not Found");
+        httpd_resp_send(req, "File not found", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+    const size_t size = (size_t)st.st_size;
+
+    // Strong validator: size, modification time and a CRC of the file header
+    uint8_t head[64];
+    size_t head_len = fread(head, 1, sizeof(head), file);
+    char etag[40];
+    snprintf(etag, sizeof(etag), "\"%lx-%lx-%08lx\"", (unsigned long)size,
+             (unsigned long)st.st_mtime, (unsigned long)esp_rom_crc32_le(0, head, head_len));
+
+    char hdr_value[64];
+    if (get_req_hdr(req, "If-None-Match", hdr_value, sizeof(hdr_value)) &&
+        strcmp(hdr_value, etag) == 0) {
+        fclose(file);
+        httpd_resp_set_status(req, "304 Not Modified");
+        httpd_resp_set_hdr(req, "ETag", etag);
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    size_t start = 0;
+    size_t end = size > 0 ? size - 1 : 0;
+    bool partial = false;
+    if (get_req_hdr(req, "Range", hdr_value, sizeof(hdr_value))) {
+        char if_range[48];
+        // A stale If-Range validator means the client's copy changed: send everything
+        bool honor = !get_req_hdr(req, "If-Range", if_range, sizeof(if_range)) ||
+                     strcmp(if_range, etag) == 0;
+        int range = honor ? parse_byte_range(hdr_value, size, &start, &end) : 0;
+        if (range < 0) {
+            fclose(file);
+            char content_range[32];
+            snprintf(content_range, sizeof(content_range), "bytes */%lu", (unsigned long)size);
+            httpd_resp_set_status(req, "416 Range Not Satisfiable");
+            httpd_resp_set_hdr(req, "Content-Range", content_range);
+            return httpd_resp_send(req, NULL, 0);
+        }
+        partial = (range > 0);
+    }
+
+    const size_t length = size > 0 ? end - start + 1 : 0;
+    const char *name = strrchr(path, '/');
+    char header[512];
+    int header_len = snprintf(header, sizeof(header),
+                              "HTTP/1.1 %s\r\n"
+                              "Content-Type: %s\r\n"
+                              "Content-Length: %lu\r\n"
+                              "Accept-Ranges: bytes\r\n"
+                              "ETag: %s\r\n"
+                              "Content-Disposition: attachment; filename=%s\r\n"
+                              "Access-Control-Allow-Origin: *\r\n"
+                              "Access-Control-Expose-Headers: Content-Length, Content-Range, ETag, Accept-Ranges\r\n",
+                              partial ? "206 Partial Content" : "200 OK",
+                              content_type, (unsigned long)length, etag,
+                              name != NULL ? name + 1 : path);
+    if (partial) {
+        header_len += snprintf(header + header_len, sizeof(header) - header_len,
+                               "Content-Range: bytes %lu-%lu/%lu\r\n",
+                               (unsigned long)start, (unsigned long)end, (unsigned long)size);
+    }
+    header_len += snprintf(header + header_len, sizeof(header) - header_len, "\r\n");
+
+    // Headers and body go out raw so Content-Length replaces chunked encoding
+    esp_err_t ret = http_send_all(req, header, header_len);
+    if (ret == ESP_OK && length > 0 && fseek(file, (long)start, SEEK_SET) != 0) {
+        ret = ESP_FAIL;
+    }
+
+    char chunk[1024];
+    size_t remaining = length;
+    while (ret == ESP_OK && remaining > 0) {
+        size_t want = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+        size_t got = fread(chunk, 1, want, file);
+        if (got == 0) {
+            ret = ESP_FAIL;
+            break;
+        }
+        ret = http_send_all(req, chunk, got);
+        remaining -= got;
+    }
+    fclose(file);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Download of %s aborted at %lu/%lu bytes", path,
+                 (unsigned long)(length - remaining), (unsigned long)length);
+    }
+    return ret;
+}
+
+// API Black-box endpoint - GET returns loop state and frozen segments,
+// POST freezes manually or changes the event threshold / enable flag
+static esp_err_t api_blackbox_handler(httpd_req_t *req)
+{
+    ESP_LOGI(TAG, "API Blackbox request");
+
+    if (req->method == HTTP_POST) {
+        char buf[128] = {0};
+        cJSON *root = recv_json_body(req, buf, sizeof(buf));
+        if (root == NULL) {
             return ESP_FAIL;
         }
 
-        cJSON *resp = cJSON_CreateObject();
-        cJSON_AddStringToObject(resp, "status", "ok");
-        cJSON_AddNumberToObject(resp, "full_scale_g", (double)requested_fs);
-        cJSON_AddNumberToObject(resp, "imu_full_scale_g", (double)imu_manager_get_full_scale_g());
-        char *resp_str = cJSON_PrintUnformatted(resp);
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-        if (resp_str) {
-            httpd_resp_send(req, resp_str, HTTPD_RESP_USE_STRLEN);
-            free(resp_str);
-        } else {
-            httpd_resp_send(req, "{\"status\":\"ok\"}", HTTPD_RESP_USE_STRLEN);
+        const char *error = NULL;
+        cJSON *enabled = cJSON_GetObjectItem(root, "enabled");
+        cJSON *threshold = cJSON_GetObjectItem(root, "threshold_mg");
+        cJSON *action = cJSON_GetObjectItem(root, "action");
+        if (cJSON_IsBool(enabled)) {
+            blackbox_set_enabled(cJSON_IsTrue(enabled));
+        }
+        if (threshold != NULL) {
+            int32_t threshold_mg;
+            if (!web_json_get_int(threshold, 0, INT32_MAX, &threshold_mg)) {
+                error = "invalid_threshold";
+            } else {
+                blackbox_set_threshold((uint32_t)threshold_mg);
+            }
+        }
+        if (error == NULL && cJSON_IsString(action)) {
+            if (strcmp(action->valuestring, "freeze") != 0) {
+                error = "unsupported_action";
+            } else if (blackbox_trigger(BLACKBOX_TRIGGER_MANUAL) != ESP_OK) {
+                error = "busy";
+            }
+        }
+        cJSON_Delete(root);
+
+        if (error != NULL) {
+            char err_json[64];
+            snprintf(err_json, sizeof(err_json), "{\"error\":\"%s\"}", error);
+            httpd_resp_set_status(req, strcmp(error, "busy") == 0 ? "409 Conflict" : "400 Bad Request");
+            httpd_resp_send(req, err_json, HTTPD_RESP_USE_STRLEN);
+            return ESP_FAIL;
         }
-        cJSON_Delete(resp);
-        return ESP_OK;
     }
 
+    blackbox_status_t status;
+    blackbox_get_status(&status);
+
     cJSON *json = cJSON_CreateObject();
-    /* Do not include imu_odr_hz here to keep UI focused on actual plotted points/sec */
-    cJSON_AddNumberToObject(json, "imu_fifo_watermark", imu_manager_get_fifo_watermark());
-    cJSON_AddNumberToObject(json, "imu_full_scale_g", imu_manager_get_full_scale_g());
+    cJSON_AddBoolToObject(json, "enabled", status.enabled);
+    cJSON_AddStringToObject(json, "state", status.flushing ? "flushing" : (status.armed ? "armed" : "recording"));
+    cJSON_AddNumberToObject(json, "threshold_mg", status.threshold_mg);
+    cJSON_AddNumberToObject(json, "last_p2p_mg", status.last_peak_to_peak_mg);
+    cJSON_AddStringToObject(json, "last_trigger", blackbox_trigger_name(status.last_trigger));
+    cJSON_AddNumberToObject(json, "triggers", status.triggers);
+    cJSON_AddNumberToObject(json, "triggers_ignored", status.triggers_ignored);
+    cJSON_AddNumberToObject(json, "segments_written", status.segments_written);
+    cJSON_AddNumberToObject(json, "recorded_samples", (double)status.recorded_samples);
+    cJSON_AddNumberToObject(json, "dropped_samples", status.dropped_samples);
+    cJSON_AddNumberToObject(json, "fullrate_s", status.fullrate_seconds);
+    cJSON_AddNumberToObject(json, "trend_s", (double)status.trend_samples / BLACKBOX_TREND_HZ);
+    cJSON_AddNumberToObject(json, "trend_hz", BLACKBOX_TREND_HZ);
+
+    blackbox_segment_t segments[BLACKBOX_MAX_SEGMENTS];
+    size_t count = blackbox_list_segments(segments, BLACKBOX_MAX_SEGMENTS);
+    cJSON *list = cJSON_CreateArray();
+    for (size_t i = 0; i < count; i++) {
+        cJSON *seg = cJSON_CreateObject();
+        cJSON_AddNumberToObject(seg, "id", segments[i].id);
+        cJSON_AddStringToObject(seg, "trigger", blackbox_trigger_name(segments[i].trigger));
+        cJSON_AddNumberToObject(seg, "t", (double)segments[i].start_timestamp_us);
+        cJSON_AddNumberToObject(seg, "full_samples", segments[i].full_samples);
+        cJSON_AddNumberToObject(seg, "full_odr_hz", segments[i].full_odr_hz);
+        cJSON_AddNumberToObject(seg, "trend_samples", segments[i].trend_samples);
+        cJSON_AddItemToArray(list, seg);
+    }
+    cJSON_AddItemToObject(json, "segments", list);
 
-    char *json_string = cJSON_Print(json);
+    char *json_string = cJSON_PrintUnformatted(json);
     if (json_string != NULL) {
         httpd_resp_set_type(req, "application/json");
         httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
         httpd_resp_send(req, json_string, strlen(json_string));
         free(json_string);
+    } else {
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        httpd_resp_send(req, "JSON generation failed", HTTPD_RESP_USE_STRLEN);
     }
 
     cJSON_Delete(json);
     return ESP_OK;
 }
 
-// API Download endpoint - returns data in various formats
-static esp_err_t api_download_handler(httpd_req_t *req)
+// API Black-box segment download - streams a frozen .cap file (?id=N&part=full|trend)
+static esp_err_t api_blackbox_segment_handler(httpd_req_t *req)
 {
-    ESP_LOGI(TAG, "API Download request");
-    
-    // Get format parameter
-    size_t buf_len = httpd_req_get_url_query_len(req) + 1;
-    if (buf_len > 1) {
-        char *buf = malloc(buf_len);
-        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
-            char format[16];
-            if (httpd_query_key_value(buf, "format", format, sizeof(format)) == ESP_OK) {
-                if (strcmp(format, "csv") == 0) {
-                    // Return CSV data
-                    char csv_buffer[8192];
-                    esp_err_t ret = data_buffer_export_csv(csv_buffer, sizeof(csv_buffer), 100);
-                    if (ret == ESP_OK) {
-                        httpd_resp_set_type(req, "text/csv");
-                        httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=imu_data.csv");
-                        httpd_resp_send(req, csv_buffer, strlen(csv_buffer));
-                    } else {
-                        httpd_resp_set_status(req, "500 Internal Server Error");
-                        httpd_resp_send(req, "Failed to export CSV", HTTPD_RESP_USE_STRLEN);
-                    }
-                } else if (strcmp(format, "json") == 0) {
-                    // Return JSON data
-                    char json_buffer[8192];
-                    esp_err_t ret = data_buffer_export_json(json_buffer, sizeof(json_buffer), 100);
-                    if (ret == ESP_OK) {
-                        httpd_resp_set_type(req, "application/json");
-                        httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=imu_data.json");
-                        httpd_resp_send(req, json_buffer, strlen(json_buffer));
-                    } else {
-                        httpd_resp_set_status(req, "500 Internal Server Error");
-                        httpd_resp_send(req, "Failed to export JSON", HTTPD_RESP_USE_STRLEN);
-                    }
-                } else {
-                    httpd_resp_set_status(req, "400 Bad Request");
-                    httpd_resp_send(req, "Unsupported format", HTTPD_RESP_USE_STRLEN);
-                }
-            } else {
-                httpd_resp_set_status(req, "400 Bad Request");
-                httpd_resp_send(req, "Missing format parameter", HTTPD_RESP_USE_STRLEN);
-            }
-        }
-        free(buf);
-    } else {
+    char query[64];
+    char value[16];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "id", value, sizeof(value)) != ESP_OK) {
         httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_send(req, "Missing query parameters", HTTPD_RESP_USE_STRLEN);
+        httpd_resp_send(req, "Missing id parameter", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
     }
-    
-    return ESP_OK;
+
+    char *end = NULL;
+    unsigned long id = strtoul(value, &end, 10);
+    if (end == value || *end != '\0') {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_send(req, "Invalid id parameter", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    blackbox_part_t part = BLACKBOX_PART_FULL;
+    if (httpd_query_key_value(query, "part", value, sizeof(value)) == ESP_OK &&
+        strcmp(value, "trend") == 0) {
+        part = BLACKBOX_PART_TREND;
+    }
+
+    char path[BLACKBOX_MAX_PATH_LEN];
+    if (blackbox_segment_path((uint32_t)id, part, path, sizeof(path)) != ESP_OK) {
+        httpd_resp_set_status(req, "404 Not Found");
+        httpd_resp_send(req, "Segment not found", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+    return send_file_ranged(req, path, "application/octet-stream");
 }
 
-// API IP endpoint - returns current IP address as JSON
-static esp_err_t api_ip_handler(httpd_req_t *req)
+// API Capture download - ranged/resumable download of a .cap recording (?file=NAME)
+static esp_err_t api_capture_handler(httpd_req_t *req)
 {
-    ESP_LOGI(TAG, "API IP request received");
+    char query[80];
+    char name[REPLAY_MAX_PATH_LEN - sizeof(REPLAY_BASE_PATH)];
+    char path[REPLAY_MAX_PATH_LEN];
+    const size_t ext_len = strlen(CAPTURE_FILE_EXT);
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "file", name, sizeof(name)) != ESP_OK ||
+        strchr(name, '/') != NULL || strstr(name, "..") != NULL ||
+        strlen(name) <= ext_len || strcmp(name + strlen(name) - ext_len, CAPTURE_FILE_EXT) != 0) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_send(req, "Invalid file parameter", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
 
-    esp_netif_ip_info_t ip_info;
-    char ip_str[32] = "0.0.0.0";
-    esp_netif_t *netif = esp_netif_get_default_netif();
-    if (netif && esp_netif_get_ip_info(netif, &ip_info) == ESP_OK) {
-        snprintf(ip_str, sizeof(ip_str), "%d.%d.%d.%d",
-                 esp_ip4_addr1(&ip_info.ip), esp_ip4_addr2(&ip_info.ip),
-                 esp_ip4_addr3(&ip_info.ip), esp_ip4_addr4(&ip_info.ip));
-        ESP_LOGI(TAG, "Returning IP: %s", ip_str);
-    } else {
-        ESP_LOGW(TAG, "Failed to get IP, returning 0.0.0.0");
+    snprintf(path, sizeof(path), REPLAY_BASE_PATH "/%s", name);
+    return send_file_ranged(req, path, "application/octet-stream");
+}
+
+// Latency echo from a client: {"echo":<seq>,"hold":<us>}, see latency.h. Other
+// messages are ignored.
+static void ws_handle_echo(int fd, const uint8_t *payload, size_t len)
+{
+    uint32_t seq;
+    uint32_t hold_us;
+    if (!web_json_parse_echo(payload, len, &seq, &hold_us)) {
+        return;
     }
 
-    char json[64];
-    snprintf(json, sizeof(json), "{\"ip\":\"%s\"}", ip_str);
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    httpd_resp_send(req, json, HTTPD_RESP_USE_STRLEN);
-    return ESP_OK;
+    int slot = -1;
+    if (xSemaphoreTake(ws_mutex, pdMS_TO_TICKS(20)) == pdTRUE) {
+        for (int i = 0; i < WEBSOCKET_MAX_CONNECTIONS; i++) {
+            if (ws_connections[i].active && ws_connections[i].fd == fd) {
+                slot = i;
+                break;
+            }
+        }
+        xSemaphoreGive(ws_mutex);
+    }
+    if (slot >= 0) {
+        latency_record_echo(LATENCY_TRANSPORT_WS, slot, seq, hold_us);
+    }
 }
 
 // WebSocket data handler
@@ -370,11 +1833,24 @@ static esp_err_t ws_data_handler(httpd_req_t *req)
     }
 
     if (ws_pkt.len) {
-        uint8_t tmp_buf[64];
+        uint8_t tmp_buf[WS_RX_MAX_PAYLOAD];
+        int fd = httpd_req_to_sockfd(req);
+        // A partial read would leave the rest of the payload in the socket to be
+        // parsed as the next frame header; drop the client instead
+        if (ws_pkt.len > sizeof(tmp_buf)) {
+            TLOG_W(TAG, "WS frame of %u bytes from fd=%d exceeds %u, closing",
+                   (unsigned int)ws_pkt.len, fd, (unsigned int)sizeof(tmp_buf));
+            ws_unregister_connection(fd);
+            httpd_sess_trigger_close(req->handle, fd);
+            return ESP_FAIL;
+        }
         ws_pkt.payload = tmp_buf;
-        size_t to_read = ws_pkt.len < sizeof(tmp_buf) ? ws_pkt.len : sizeof(tmp_buf);
-        httpd_ws_recv_frame(req, &ws_pkt, to_read);
-        // Optional: parse control messages here
+        ret = httpd_ws_recv_frame(req, &ws_pkt, sizeof(tmp_buf));
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to read WS payload: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        ws_handle_echo(fd, tmp_buf, ws_pkt.len);
     }
     return ESP_OK;
 }
@@ -452,6 +1928,10 @@ static void ws_register_connection(int fd)
             if (!ws_connections[i].active) {
                 ws_connections[i].fd = fd;
                 ws_connections[i].active = true;
+                atomic_store_explicit(&ws_connections[i].bytes_sent, 0, memory_order_relaxed);
+                atomic_store_explicit(&ws_connections[i].frames_sent, 0, memory_order_relaxed);
+                atomic_store_explicit(&ws_connections[i].send_errors, 0, memory_order_relaxed);
+                latency_client_reset(LATENCY_TRANSPORT_WS, i);
                 ESP_LOGI(TAG, "WebSocket connection registered: fd=%d at slot %d", fd, i);
 
                 // Send IP address to client
@@ -546,16 +2026,23 @@ static esp_err_t ws_send_to_all(const char *data, size_t len)
                 esp_err_t r = httpd_ws_send_frame_async(server, ws_connections[i].fd, &frame);
                 if (r == ESP_OK) {
                     active_connections++;
+                    atomic_fetch_add_explicit(&ws_connections[i].bytes_sent, (unsigned int)len, memory_order_relaxed);
+                    atomic_fetch_add_explicit(&ws_connections[i].frames_sent, 1, memory_order_relaxed);
                 } else {
-                    ESP_LOGW(TAG, "WS send failed for fd=%d: %s", ws_connections[i].fd, esp_err_to_name(r));
+                    atomic_fetch_add_explicit(&ws_connections[i].send_errors, 1, memory_order_relaxed);
+                    metrics_inc(METRIC_WS_SEND_ERRORS);
+                    TLOG_W(TAG, "WS send failed for fd=%d: %s", ws_connections[i].fd, esp_err_to_name(r));
                 }
             }
         }
         xSemaphoreGive(ws_mutex);
+        if (active_connections > 0) {
+            metrics_inc(METRIC_WS_FRAMES);
+        }
         
         total_sends++;
         if (total_sends % 500 == 0) {
-            ESP_LOGI(TAG, "WS broadcast: %lu total sends, %d active connections", total_sends, active_connections);
+            TLOG_I(TAG, "WS broadcast: %lu total sends, %d active connections", total_sends, active_connections);
         }
     }
     return ESP_OK;
@@ -575,6 +2062,13 @@ esp_err_t web_server_start(void)
     // Initialize WebSocket connections
     memset(ws_connections, 0, sizeof(ws_connections));
     
+    if (export_buf == NULL) {
+        export_buf = mem_arena_alloc(MEM_SUBSYS_HTTP, HTTP_EXPORT_BUFFER_SIZE);
+        if (export_buf == NULL) {
+            ESP_LOGW(TAG, "No export buffer, /api/download disabled");
+        }
+    }
+    
     // HTTP server configuration
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = WEB_SERVER_PORT;
@@ -626,6 +2120,162 @@ esp_err_t web_server_start(void)
         };
         httpd_register_uri_handler(server, &api_config_post_uri);
         
+        httpd_uri_t api_replay_get_uri = {
+            .uri = API_REPLAY_PATH,
+            .method = HTTP_GET,
+            .handler = api_replay_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_replay_get_uri);
+
+        httpd_uri_t api_replay_post_uri = {
+            .uri = API_REPLAY_PATH,
+            .method = HTTP_POST,
+            .handler = api_replay_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_replay_post_uri);
+
+        httpd_uri_t api_blackbox_get_uri = {
+            .uri = API_BLACKBOX_PATH,
+            .method = HTTP_GET,
+            .handler = api_blackbox_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_blackbox_get_uri);
+
+        httpd_uri_t api_blackbox_post_uri = {
+            .uri = API_BLACKBOX_PATH,
+            .method = HTTP_POST,
+            .handler = api_blackbox_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_blackbox_post_uri);
+
+        httpd_uri_t api_blackbox_segment_uri = {
+            .uri = API_BLACKBOX_SEGMENT_PATH,
+            .method = HTTP_GET,
+            .handler = api_blackbox_segment_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_blackbox_segment_uri);
+
+        httpd_uri_t api_history_uri = {
+            .uri = API_HISTORY_PATH,
+            .method = HTTP_GET,
+            .handler = api_history_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_history_uri);
+
+        httpd_uri_t api_capture_uri = {
+            .uri = API_CAPTURE_PATH,
+            .method = HTTP_GET,
+            .handler = api_capture_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_capture_uri);
+
+        httpd_uri_t api_schedule_get_uri = {
+            .uri = API_SCHEDULE_PATH,
+            .method = HTTP_GET,
+            .handler = api_schedule_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_schedule_get_uri);
+
+        httpd_uri_t api_schedule_post_uri = {
+            .uri = API_SCHEDULE_PATH,
+            .method = HTTP_POST,
+            .handler = api_schedule_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_schedule_post_uri);
+
+        httpd_uri_t api_memory_uri = {
+            .uri = API_MEMORY_PATH,
+            .method = HTTP_GET,
+            .handler = api_memory_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_memory_uri);
+
+        httpd_uri_t api_system_uri = {
+            .uri = API_SYSTEM_PATH,
+            .method = HTTP_GET,
+            .handler = api_system_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_system_uri);
+
+#if CONFIG_IMU_TEST_HOOKS
+        httpd_uri_t api_bench_uri = {
+            .uri = API_BENCH_PATH,
+            .method = HTTP_POST,
+            .handler = api_bench_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_bench_uri);
+#endif
+
+        httpd_uri_t api_acquisition_uri = {
+            .uri = API_ACQUISITION_PATH,
+            .method = HTTP_GET,
+            .handler = api_acquisition_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_acquisition_uri);
+
+#if CONFIG_IMU_TEST_HOOKS
+        httpd_uri_t api_golden_uri = {
+            .uri = API_GOLDEN_PATH,
+            .method = HTTP_POST,
+            .handler = api_golden_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_golden_uri);
+#endif
+
+        httpd_uri_t api_log_uri = {
+            .uri = API_LOG_PATH,
+            .method = HTTP_GET,
+            .handler = api_log_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_log_uri);
+
+        httpd_uri_t api_trace_uri = {
+            .uri = API_TRACE_PATH,
+            .method = HTTP_GET,
+            .handler = api_trace_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_trace_uri);
+
+        httpd_uri_t metrics_uri = {
+            .uri = METRICS_PATH,
+            .method = HTTP_GET,
+            .handler = metrics_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &metrics_uri);
+
+        httpd_uri_t api_pipeline_get_uri = {
+            .uri = API_PIPELINE_PATH,
+            .method = HTTP_GET,
+            .handler = api_pipeline_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_pipeline_get_uri);
+
+        httpd_uri_t api_pipeline_post_uri = {
+            .uri = API_PIPELINE_PATH,
+            .method = HTTP_POST,
+            .handler = api_pipeline_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(server, &api_pipeline_post_uri);
+
         httpd_uri_t api_download_uri = {
             .uri = API_DOWNLOAD_PATH,
             .method = HTTP_GET,
@@ -681,6 +2331,20 @@ esp_err_t web_server_start(void)
         httpd_register_uri_handler(server, &file_uri);
         
         ESP_LOGI(TAG, "Web server started successfully");
+        if (ws_ring == NULL) {
+            esp_err_t sink_ret = pipeline_add_ring_sink(WS_SINK_NAME, WS_RING_CAPACITY, &ws_sink);
+            if (sink_ret == ESP_OK) {
+                sink_ret = pipeline_connect(PIPELINE_STAGE_DECIMATE, WS_SINK_NAME);
+            }
+            if (sink_ret == ESP_OK) {
+                sink_ret = bcast_ring_attach(pipeline_get_ring(ws_sink), WS_SINK_NAME, &ws_consumer);
+            }
+            if (sink_ret == ESP_OK) {
+                ws_ring = pipeline_get_ring(ws_sink);
+            } else {
+                ESP_LOGE(TAG, "Failed to attach plot feed to the pipeline: %s", esp_err_to_name(sink_ret));
+            }
+        }
         // Start broadcaster task (~100 Hz)
         xTaskCreatePinnedToCore(ws_broadcast_task, "ws_broadcast", 4096, NULL, 4, NULL, 0);
         return ESP_OK;
@@ -711,28 +2375,47 @@ esp_err_t web_server_broadcast_data(const char *data, size_t len)
     return ws_send_to_all(data, len);
 }
 
+size_t web_server_get_ws_clients(web_server_ws_client_t *clients, size_t max_clients)
+{
+    if (clients == NULL || ws_mutex == NULL) {
+        return 0;
+    }
+
+    size_t n = 0;
+    if (xSemaphoreTake(ws_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
+        for (int i = 0; i < WEBSOCKET_MAX_CONNECTIONS && n < max_clients; i++) {
+            if (!ws_connections[i].active) {
+                continue;
+            }
+            clients[n].fd = ws_connections[i].fd;
+            clients[n].slot = (uint8_t)i;
+            clients[n].bytes_sent = atomic_load_explicit(&ws_connections[i].bytes_sent, memory_order_relaxed);
+            clients[n].frames_sent = atomic_load_explicit(&ws_connections[i].frames_sent, memory_order_relaxed);
+            clients[n].send_errors = atomic_load_explicit(&ws_connections[i].send_errors, memory_order_relaxed);
+            n++;
+        }
+        xSemaphoreGive(ws_mutex);
+    }
+    return n;
+}
+
 // Broadcast latest sample periodically as compact JSON
 static void ws_broadcast_task(void *arg)
 {
     (void)arg;
-    static float ring_x[WS_PLOT_BUFFER_CAPACITY];
-    static float ring_y[WS_PLOT_BUFFER_CAPACITY];
-    static float ring_z[WS_PLOT_BUFFER_CAPACITY];
-    static float temp_x[WS_RECENT_MAX_SAMPLES];
-    static float temp_y[WS_RECENT_MAX_SAMPLES];
-    static float temp_z[WS_RECENT_MAX_SAMPLES];
-    static char json_buf[4096];
-
-    size_t ring_head = 0;
-    size_t ring_size = 0;
+    int16_t *chunk_xyz = mem_arena_alloc(MEM_SUBSYS_WS_PLOT, WS_PLOT_CHUNK_SAMPLES * 3 * sizeof(int16_t));
+    char *json_buf = mem_arena_alloc(MEM_SUBSYS_WS_PLOT, WS_JSON_BUFFER_SIZE);
+    if (chunk_xyz == NULL || json_buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate WebSocket plot buffers");
+        vTaskDelete(NULL);
+        return;
+    }
+    metrics_register_task(NULL);
+
+    uint32_t frame_seq = 0;
     uint32_t window_msgs = 0;
     uint32_t window_samples = 0;
     uint64_t window_start_us = esp_timer_get_time();
-    uint32_t last_sequence = 0;
-    bool sequence_init = false;
-    uint16_t last_fifo_level = 0;
-    uint16_t last_batch_samples = 0;
-    uint64_t last_timestamp = 0;
     uint64_t last_send_time_us = 0;
 
     TickType_t last_wake = xTaskGetTickCount();
@@ -744,42 +2427,20 @@ static void ws_broadcast_task(void *arg)
     ESP_LOGI(TAG, "WebSocket broadcast task started");
 
     for (;;) {
-        uint64_t batch_ts = 0;
-        uint16_t fifo_level = 0;
-        uint32_t seq_id = 0;
-        uint16_t fetched = imu_manager_copy_recent_samples(temp_x, temp_y, temp_z,
-                                                           WS_RECENT_MAX_SAMPLES,
-                                                           &batch_ts, &fifo_level, &seq_id);
-        if (fetched == 0) {
+        // Next run of samples after our cursor; the ring reports what it overwrote
+        // if we fell behind, so the frame can say how many points are missing
+        bcast_read_info_t info;
+        uint16_t chunk = 0;
+        TRACE_BEGIN(TRACE_WS_READ);
+        if (ws_ring != NULL) {
+            chunk = bcast_ring_read(ws_ring, ws_consumer, chunk_xyz, WS_PLOT_CHUNK_SAMPLES, &info);
+        }
+        TRACE_END(TRACE_WS_READ, chunk);
+        if (chunk == 0) {
             static uint32_t no_sample_log = 0;
             if ((no_sample_log++ % 200) == 0) {
-                ESP_LOGW(TAG, "No new IIS3DWB samples available from manager");
-            }
-        }
-        // Only skip if we've seen data before AND sequence hasn't changed
-        if (fetched > 0 && (!sequence_init || seq_id != last_sequence)) {
-            sequence_init = true;
-            last_sequence = seq_id;
-            last_fifo_level = fifo_level;
-            last_batch_samples = fetched;
-            last_timestamp = batch_ts;
-
-            for (uint16_t i = 0; i < fetched; ++i) {
-                size_t idx = (ring_head + ring_size) % WS_PLOT_BUFFER_CAPACITY;
-                ring_x[idx] = temp_x[i];
-                ring_y[idx] = temp_y[i];
-                ring_z[idx] = temp_z[i];
-                if (ring_size == WS_PLOT_BUFFER_CAPACITY) {
-                    ring_head = (ring_head + 1) % WS_PLOT_BUFFER_CAPACITY;
-                } else {
-                    ring_size++;
-                }
+                TLOG_W(TAG, "No new IIS3DWB samples from the pipeline");
             }
-        }
-
-        uint16_t available = (ring_size > UINT16_MAX) ? UINT16_MAX : (uint16_t)ring_size;
-        uint16_t chunk = available < WS_PLOT_CHUNK_SAMPLES ? available : WS_PLOT_CHUNK_SAMPLES;
-        if (chunk == 0) {
             vTaskDelayUntil(&last_wake, broadcast_period);
             continue;
         }
@@ -805,7 +2466,7 @@ static void ws_broadcast_task(void *arg)
             window_msgs = 0;
             window_samples = 0;
             window_start_us = now_us;
-            ESP_LOGI(TAG, "WS metrics: %.2f msg/s, %.0f points/s", ws_msg_rate, ws_samples_rate);
+            TLOG_I(TAG, "WS metrics: %.2f msg/s, %.0f points/s", ws_msg_rate, ws_samples_rate);
         }
 
         uint64_t send_now_us = esp_timer_get_time();
@@ -825,61 +2486,39 @@ static void ws_broadcast_task(void *arg)
             sensor_sps = plot_point_rate;
         }
 
-        size_t head = ring_head;
-        float last_chunk_x = 0.0f;
-        float last_chunk_y = 0.0f;
-        float last_chunk_z = 0.0f;
-
-        uint8_t full_scale_g = imu_manager_get_full_scale_g();
-
-        int n = snprintf(json_buf, sizeof(json_buf), "{\"t\":%llu,\"chunks\":{\"x\":[",
-                         (unsigned long long)(last_timestamp ? last_timestamp : now_us));
-
-        for (uint16_t i = 0; i < chunk && n > 0 && n < (int)sizeof(json_buf); ++i) {
-            size_t idx = (head + i) % WS_PLOT_BUFFER_CAPACITY;
-            last_chunk_x = ring_x[idx];
-            n += snprintf(json_buf + n, sizeof(json_buf) - n, i ? ",%.5f" : "%.5f", ring_x[idx]);
-        }
-        n += snprintf(json_buf + n, sizeof(json_buf) - n, "],\"y\":[");
-        for (uint16_t i = 0; i < chunk && n > 0 && n < (int)sizeof(json_buf); ++i) {
-            size_t idx = (head + i) % WS_PLOT_BUFFER_CAPACITY;
-            last_chunk_y = ring_y[idx];
-            n += snprintf(json_buf + n, sizeof(json_buf) - n, i ? ",%.5f" : "%.5f", ring_y[idx]);
-        }
-        n += snprintf(json_buf + n, sizeof(json_buf) - n, "],\"z\":[");
-        for (uint16_t i = 0; i < chunk && n > 0 && n < (int)sizeof(json_buf); ++i) {
-            size_t idx = (head + i) % WS_PLOT_BUFFER_CAPACITY;
-            last_chunk_z = ring_z[idx];
-            n += snprintf(json_buf + n, sizeof(json_buf) - n, i ? ",%.5f" : "%.5f", ring_z[idx]);
-        }
-
-        float chunk_mag = sqrtf(last_chunk_x * last_chunk_x +
-                                 last_chunk_y * last_chunk_y +
-                                 last_chunk_z * last_chunk_z);
-
-    n += snprintf(json_buf + n, sizeof(json_buf) - n,
-              "]},\"mag\":%.5f,\"s\":{\"fifo\":%u,\"batch\":%u,"
-                      "\"sps\":%.2f,\"pps\":%.2f,\"mps\":%.2f,\"chunk\":%u},\"fs\":%u}",
-              chunk_mag,
-              last_fifo_level,
-              last_batch_samples,
-              sensor_sps,
-                      ws_samples_rate,
-                      ws_msg_rate,
-              chunk,
-              (unsigned int)full_scale_g);
+        const ws_frame_t frame = {
+            .seq = frame_seq++,
+            .timestamp_us = info.timestamp_us ? info.timestamp_us : now_us,
+            .sent_us = esp_timer_get_time(),
+            .xyz = chunk_xyz,
+            .count = chunk,
+            .lsb_to_g = pipeline_lsb_to_g(info.scale),
+            .full_scale_g = (uint8_t)info.scale,
+            .fifo_level = have_stats ? d.stats.fifo_level : 0,
+            .batch = have_stats ? d.stats.samples_read : 0,
+            .sensor_sps = sensor_sps,
+            .points_per_s = ws_samples_rate,
+            .msgs_per_s = ws_msg_rate,
+            .missed = info.missed,
+        };
 
-        ring_head = (ring_head + chunk) % WS_PLOT_BUFFER_CAPACITY;
-        ring_size -= chunk;
+        TRACE_BEGIN(TRACE_WS_ENCODE);
+        const int n = ws_frame_encode(json_buf, WS_JSON_BUFFER_SIZE, &frame);
+        TRACE_END(TRACE_WS_ENCODE, n > 0 ? n : 0);
 
-        if (n > 0 && n < (int)sizeof(json_buf)) {
+        if (n > 0 && n < (int)WS_JSON_BUFFER_SIZE) {
             bool has_clients = ws_has_active_clients();
             if (has_clients) {
                 led_status_data_pulse_start();
             }
+            TRACE_BEGIN(TRACE_WS_SEND);
             esp_err_t send_ret = ws_send_to_all(json_buf, (size_t)n);
+            TRACE_END(TRACE_WS_SEND, n);
             if (send_ret == ESP_OK) {
                 ws_total_messages++;
+                if (has_clients) {
+                    latency_frame_sent(LATENCY_TRANSPORT_WS, frame.seq, frame.timestamp_us, frame.sent_us);
+                }
             } else {
                 ESP_LOGW(TAG, "Failed to enqueue WS frame: %s", esp_err_to_name(send_ret));
             }
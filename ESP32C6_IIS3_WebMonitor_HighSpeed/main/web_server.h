@@ -7,7 +7,7 @@
 
 // Web server configuration
 #define WEB_SERVER_PORT 80
-#define WEB_SERVER_MAX_URI_HANDLERS 20
+#define WEB_SERVER_MAX_URI_HANDLERS 32
 #define WEB_SERVER_STACK_SIZE 8192
 
 // WebSocket configuration
@@ -21,14 +21,39 @@
 #define API_CONFIG_PATH "/api/config"
 #define API_DOWNLOAD_PATH "/api/download"
 #define API_IP_PATH "/api/ip"
+#define API_REPLAY_PATH "/api/replay"
+#define API_BLACKBOX_PATH "/api/blackbox"
+#define API_BLACKBOX_SEGMENT_PATH "/api/blackbox/segment"
+#define API_HISTORY_PATH "/api/history"
+#define API_CAPTURE_PATH "/api/capture"
+#define API_SCHEDULE_PATH "/api/schedule"
+#define API_MEMORY_PATH "/api/memory"
+#define API_PIPELINE_PATH "/api/pipeline"
+#define API_LOG_PATH "/api/log"
+#define API_TRACE_PATH "/api/trace"
+#define API_SYSTEM_PATH "/api/system"
+#define API_BENCH_PATH "/api/bench"
+#define API_ACQUISITION_PATH "/api/acquisition"
+#define API_GOLDEN_PATH "/api/golden"
+#define METRICS_PATH "/metrics"
 
 // WebSocket endpoints
 #define WS_DATA_PATH "/ws/data"
 #define WS_CONTROL_PATH "/ws/control"
 
+// Per-client WebSocket counters, reset when the slot is reused
+typedef struct {
+    int fd;
+    uint8_t slot;
+    uint32_t bytes_sent;
+    uint32_t frames_sent;
+    uint32_t send_errors;
+} web_server_ws_client_t;
+
 // Web server API
 esp_err_t web_server_start(void);
 esp_err_t web_server_stop(void);
 esp_err_t web_server_broadcast_data(const char *data, size_t len);
+size_t web_server_get_ws_clients(web_server_ws_client_t *clients, size_t max_clients);
 
 #endif // WEB_SERVER_H
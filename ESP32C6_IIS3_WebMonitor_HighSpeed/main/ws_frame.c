@@ -0,0 +1,61 @@
+#include "ws_frame.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+
+// snprintf that tracks the running length; once the buffer is full every later
+// append is a no-op and the length stays past the end
+static void append(char *buf, size_t size, int *n, const char *fmt, ...)
+{
+    if (*n < 0 || (size_t)*n >= size) {
+        *n = (int)size;
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    const int written = vsnprintf(buf + *n, size - (size_t)*n, fmt, args);
+    va_end(args);
+    *n = (written < 0) ? (int)size : *n + written;
+}
+
+// One "[...]" column of the chunk; returns the last value in g
+static float append_axis(char *buf, size_t size, int *n, const ws_frame_t *frame, int axis)
+{
+    float value = 0.0f;
+    for (uint16_t i = 0; i < frame->count && *n < (int)size; i++) {
+        value = frame->xyz[i * 3 + axis] * frame->lsb_to_g;
+        append(buf, size, n, i ? ",%.5f" : "%.5f", value);
+    }
+    return value;
+}
+
+int ws_frame_encode(char *buf, size_t size, const ws_frame_t *frame)
+{
+    if (buf == NULL || frame == NULL || size == 0) {
+        return -1;
+    }
+
+    int n = 0;
+    append(buf, size, &n, "{\"seq\":%lu,\"t\":%llu,\"tx\":%llu,\"chunks\":{\"x\":[", (unsigned long)frame->seq,
+           (unsigned long long)frame->timestamp_us, (unsigned long long)frame->sent_us);
+    const float x = append_axis(buf, size, &n, frame, 0);
+    append(buf, size, &n, "],\"y\":[");
+    const float y = append_axis(buf, size, &n, frame, 1);
+    append(buf, size, &n, "],\"z\":[");
+    const float z = append_axis(buf, size, &n, frame, 2);
+
+    append(buf, size, &n,
+           "]},\"mag\":%.5f,\"s\":{\"fifo\":%u,\"batch\":%u,"
+           "\"sps\":%.2f,\"pps\":%.2f,\"mps\":%.2f,\"chunk\":%u,\"miss\":%lu},\"fs\":%u}",
+           sqrtf(x * x + y * y + z * z),
+           (unsigned int)frame->fifo_level,
+           (unsigned int)frame->batch,
+           frame->sensor_sps,
+           frame->points_per_s,
+           frame->msgs_per_s,
+           (unsigned int)frame->count,
+           (unsigned long)frame->missed,
+           (unsigned int)frame->full_scale_g);
+
+    return (n < (int)size) ? n : -1;
+}
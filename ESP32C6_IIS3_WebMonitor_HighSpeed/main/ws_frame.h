@@ -0,0 +1,32 @@
+#ifndef WS_FRAME_H
+#define WS_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// JSON encoding of one live-plot WebSocket frame: a chunk of x,y,z samples plus
+// the stream stats the dashboard shows. Kept apart from the broadcast task so it
+// can be exercised without a socket (see bench.c).
+#define WS_FRAME_MAX_SAMPLES    100
+#define WS_FRAME_BUFFER_SIZE    4096    // Fits WS_FRAME_MAX_SAMPLES at any full scale
+
+typedef struct {
+    uint32_t seq;               // Broadcast counter; a gap means this client missed frames
+    uint64_t timestamp_us;      // Device time of the last sample
+    uint64_t sent_us;           // Device time the frame was handed to the transport
+    const int16_t *xyz;         // Interleaved raw samples
+    uint16_t count;
+    float lsb_to_g;
+    uint8_t full_scale_g;
+    uint16_t fifo_level;
+    uint16_t batch;
+    float sensor_sps;
+    float points_per_s;
+    float msgs_per_s;
+    uint32_t missed;            // Samples the ring overwrote before this read
+} ws_frame_t;
+
+// Returns the encoded length, or -1 when the frame does not fit in size bytes
+int ws_frame_encode(char *buf, size_t size, const ws_frame_t *frame);
+
+#endif // WS_FRAME_H
@@ -0,0 +1,269 @@
+/*
+ * Host stress check for the broadcast ring (main/bcast_ring.c).
+ *
+ * One producer thread writes a stream whose samples encode their own stream index,
+ * in writes of 1-64 samples with the format (scale/ODR) switching every 5000 samples.
+ * BCAST_RING_MAX_CONSUMERS consumer threads read it with different poll delays and
+ * read sizes, from a consumer that never sleeps to one that is lapped on most polls.
+ * Every consumer must see:
+ *   read + missed == written   - every sample is either delivered or counted as missed
+ *   no torn samples            - a returned block never mixes two producer laps
+ *   no gaps                    - first_index advances by exactly the samples read + missed
+ *   the right format           - scale, ODR and timestamp of the write each sample came from
+ * and the ring's own per-consumer stats must agree with what the consumer counted.
+ * Runs twice: unpaced (the producer laps slow consumers constantly) and paced at
+ * about the 26.67 kHz sample rate.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools bcast_ring_stress && tools/build/bcast_ring_stress [samples]
+ *
+ * Exits non-zero if any consumer breaks an invariant.
+ */
+#include "bcast_ring.h"
+#include "mem_arena.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define STRESS_SAMPLES          2000000
+#define STRESS_PACED_SAMPLES    200000
+#define STRESS_CAPACITY         4096
+#define STRESS_META_SLOTS       256
+#define STRESS_MAX_WRITE        64
+#define STRESS_MAX_READ         256
+#define STRESS_FORMAT_RUN       5000        // Samples per scale/ODR run
+#define STRESS_SAMPLE_NS        37          // Paced producer: ~26.67 kHz
+#define STRESS_SEED             0x1D5A3u    // BENCH_CORPUS_SEED
+#define STRESS_TIMESTAMP_SLACK  2           // us, rounding of the producer's timestamps
+
+#define STRESS_CONSUMERS        BCAST_RING_MAX_CONSUMERS
+
+typedef struct {
+    unsigned delay_us;
+    uint16_t max_read;
+    bcast_consumer_id_t id;
+    uint64_t reads;
+    uint64_t read_samples;
+    uint64_t missed;
+    uint64_t torn;
+    uint64_t gaps;
+    uint64_t format_errors;
+} consumer_t;
+
+static consumer_t consumers[STRESS_CONSUMERS] = {
+    { .delay_us = 0,    .max_read = 100 },
+    { .delay_us = 0,    .max_read = 7 },
+    { .delay_us = 50,   .max_read = 100 },
+    { .delay_us = 200,  .max_read = STRESS_MAX_READ },
+    { .delay_us = 1000, .max_read = 64 },
+    { .delay_us = 5000, .max_read = 100 },
+};
+
+static bcast_ring_t ring;
+static atomic_bool producer_done;
+static uint32_t total_samples;
+static bool paced;
+
+static uint8_t format_scale(uint32_t index)
+{
+    return ((index / STRESS_FORMAT_RUN) % 2) ? IMU_MANAGER_FS_4G : IMU_MANAGER_FS_2G;
+}
+
+static float format_odr(uint8_t scale)
+{
+    return (scale == IMU_MANAGER_FS_4G) ? 6667.0f : 26667.0f;
+}
+
+static uint64_t sample_timestamp_us(uint32_t index, float odr_hz)
+{
+    return (uint64_t)(index * (1e6 / odr_hz));
+}
+
+// x, y and z together identify the stream index and the format it was written in
+static void encode_sample(int16_t *xyz, uint32_t index, uint8_t scale)
+{
+    xyz[0] = (int16_t)(index & 0x7fff);
+    xyz[1] = (int16_t)((index >> 15) & 0x7fff);
+    xyz[2] = (int16_t)(scale * 1000 + (index & 0xff));
+}
+
+static void *producer_task(void *arg)
+{
+    int16_t xyz[STRESS_MAX_WRITE * 3];
+    uint32_t state = STRESS_SEED;
+    uint32_t index = 0;
+
+    while (index < total_samples) {
+        state = state * 1664525u + 1013904223u;
+        uint32_t count = 1 + (state >> 16) % STRESS_MAX_WRITE;
+        // One format per write, as imu_task writes one FIFO batch at a time
+        const uint32_t run_end = (index / STRESS_FORMAT_RUN + 1) * STRESS_FORMAT_RUN;
+        if (index + count > run_end) {
+            count = run_end - index;
+        }
+        if (index + count > total_samples) {
+            count = total_samples - index;
+        }
+
+        const uint8_t scale = format_scale(index);
+        const float odr_hz = format_odr(scale);
+        for (uint32_t i = 0; i < count; i++) {
+            encode_sample(&xyz[i * 3], index + i, scale);
+        }
+        bcast_ring_write(&ring, xyz, (uint16_t)count, (imu_manager_full_scale_t)scale, odr_hz,
+                         sample_timestamp_us(index + count - 1, odr_hz));
+        index += count;
+
+        if (paced) {
+            usleep(count * STRESS_SAMPLE_NS / 1000 + 1);
+        } else if ((index & 1023) < STRESS_MAX_WRITE) {
+            sched_yield();
+        }
+    }
+    atomic_store(&producer_done, true);
+    return NULL;
+}
+
+static void check_block(consumer_t *c, const int16_t *xyz, uint16_t n, const bcast_read_info_t *info)
+{
+    for (uint16_t i = 0; i < n; i++) {
+        int16_t want[3];
+        encode_sample(want, info->first_index + i, info->scale);
+        if (xyz[i * 3] != want[0] || xyz[i * 3 + 1] != want[1] || xyz[i * 3 + 2] != want[2]) {
+            c->torn++;
+            break;
+        }
+    }
+
+    // One read never spans a format change, so the whole block has the first sample's format
+    const uint8_t scale = format_scale(info->first_index);
+    const int64_t skew = (int64_t)info->timestamp_us -
+                         (int64_t)sample_timestamp_us(info->first_index + n - 1, info->odr_hz);
+    if (info->scale != scale || format_scale(info->first_index + n - 1) != scale ||
+        info->odr_hz != format_odr(scale) || skew > STRESS_TIMESTAMP_SLACK || skew < -STRESS_TIMESTAMP_SLACK) {
+        c->format_errors++;
+    }
+}
+
+static void *consumer_task(void *arg)
+{
+    consumer_t *c = arg;
+    int16_t xyz[STRESS_MAX_READ * 3];
+    uint32_t expected_index = 0;
+
+    for (;;) {
+        bcast_read_info_t info;
+        const uint16_t n = bcast_ring_read(&ring, c->id, xyz, c->max_read, &info);
+        if (n == 0) {
+            if (atomic_load(&producer_done) && bcast_ring_available(&ring, c->id) == 0) {
+                break;
+            }
+            if (c->delay_us > 0) {
+                usleep(c->delay_us);
+            } else {
+                sched_yield();
+            }
+            continue;
+        }
+
+        c->reads++;
+        if (info.first_index != expected_index + info.missed) {
+            c->gaps++;
+        }
+        check_block(c, xyz, n, &info);
+        expected_index = info.first_index + n;
+        c->read_samples += n;
+        c->missed += info.missed;
+
+        if (c->delay_us > 0) {
+            usleep(c->delay_us);
+        }
+    }
+    return NULL;
+}
+
+// Returns the number of consumers that broke an invariant
+static int run(const char *label, uint32_t samples, bool pace)
+{
+    pthread_t producer;
+    pthread_t threads[STRESS_CONSUMERS];
+
+    if (bcast_ring_init(&ring, "stress", STRESS_CAPACITY, STRESS_META_SLOTS, MEM_SUBSYS_PIPELINE) != ESP_OK) {
+        printf("FAIL: bcast_ring_init\n");
+        return STRESS_CONSUMERS;
+    }
+    for (int i = 0; i < STRESS_CONSUMERS; i++) {
+        char name[BCAST_RING_NAME_LEN];
+        snprintf(name, sizeof(name), "c%d", i);
+        consumer_t *c = &consumers[i];
+        *c = (consumer_t){ .delay_us = c->delay_us, .max_read = c->max_read };
+        if (bcast_ring_attach(&ring, name, &c->id) != ESP_OK) {
+            printf("FAIL: bcast_ring_attach %s\n", name);
+            return STRESS_CONSUMERS;
+        }
+    }
+
+    total_samples = samples;
+    paced = pace;
+    atomic_store(&producer_done, false);
+    for (int i = 0; i < STRESS_CONSUMERS; i++) {
+        pthread_create(&threads[i], NULL, consumer_task, &consumers[i]);
+    }
+    pthread_create(&producer, NULL, producer_task, NULL);
+    pthread_join(producer, NULL);
+    for (int i = 0; i < STRESS_CONSUMERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    int failures = 0;
+    printf("%s: %u samples written\n", label, samples);
+    printf("  %-4s %8s %5s %9s %10s %10s %6s %6s %6s\n", "id", "delay us", "max", "reads", "read", "missed",
+           "torn", "gaps", "format");
+    for (int i = 0; i < STRESS_CONSUMERS; i++) {
+        const consumer_t *c = &consumers[i];
+        bcast_consumer_stats_t stats;
+        bcast_ring_get_consumer_stats(&ring, c->id, &stats);
+
+        const bool accounted = (c->read_samples + c->missed == samples);
+        const bool stats_agree = (stats.read_total == c->read_samples && stats.missed_total == c->missed &&
+                                  stats.lag == 0);
+        const bool ok = accounted && stats_agree && c->torn == 0 && c->gaps == 0 && c->format_errors == 0;
+        printf("  c%-3d %8u %5u %9llu %10llu %10llu %6llu %6llu %6llu%s%s\n", i, c->delay_us, c->max_read,
+               (unsigned long long)c->reads, (unsigned long long)c->read_samples,
+               (unsigned long long)c->missed, (unsigned long long)c->torn, (unsigned long long)c->gaps,
+               (unsigned long long)c->format_errors, accounted ? "" : "  read+missed != written",
+               stats_agree ? "" : "  ring stats disagree");
+        failures += ok ? 0 : 1;
+    }
+
+    bcast_ring_deinit(&ring, MEM_SUBSYS_PIPELINE);
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t samples = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : STRESS_SAMPLES;
+    if (samples == 0) {
+        fprintf(stderr, "usage: %s [samples]\n", argv[0]);
+        return 2;
+    }
+
+    if (mem_arena_init() != ESP_OK) {
+        printf("FAIL: mem_arena_init\n");
+        return 1;
+    }
+
+    const uint32_t paced_samples = (samples < STRESS_PACED_SAMPLES) ? samples : STRESS_PACED_SAMPLES;
+    int failures = run("unpaced", samples, false);
+    failures += run("paced", paced_samples, true);
+
+    if (failures > 0) {
+        printf("FAIL: %d consumer run(s) broke an invariant\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
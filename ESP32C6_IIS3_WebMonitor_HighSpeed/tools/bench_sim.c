@@ -0,0 +1,145 @@
+/*
+ * Host run of a single-sensor test project's throughput benchmark against the
+ * register models in host/sim.
+ *
+ * Built once per project with that project's main/ on the include path and one of
+ * BENCH_SIM_IIS2MDC, BENCH_SIM_IIS3DWB, BENCH_SIM_SCL3300 or BENCH_SIM_ICM45686
+ * defined, so each run links the project's own driver copy and its bench.c mode
+ * table on components/sensor_bench. The board comes up the way the project's
+ * main.c brings it up, then bench_run() runs every mode for BENCH_DURATION_MS (set
+ * short by the Makefile) and prints the usual table. The rates are the host's; what
+ * carries over to the C6 is bytes per sample and that every mode works.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools bench_sim && tools/build/bench_sim_icm45686
+ *
+ * Exits non-zero if the sensor fails to come up, a mode does not run, delivers no
+ * samples or sees a failed transaction, a FIFO mode loses more than
+ * BENCH_SIM_MAX_LOST_PCT of its samples, or a model saw a protocol error.
+ */
+#include "bench.h"
+#include "host_sim.h"
+#include "sensor_sim.h"
+#include "driver/spi_master.h"
+#include <stdio.h>
+
+#define BENCH_SIM_MAX_LOST_PCT  5
+
+#if defined(BENCH_SIM_IIS2MDC)
+// As in ESP32C6_IIS2MDC Test/main/main.c
+#define BENCH_SIM_FIFO_MODES    0x0u    // Modes paced by a FIFO, by index
+
+static iis2mdc_handle_t mag;
+
+static size_t bench_sim_run(sensor_bench_result_t *results)
+{
+    if (sensor_sim_attach_iis2mdc(IIS2MDC_I2C_ADDR) != ESP_OK ||
+        iis2mdc_init(&mag, I2C_NUM_0, 23, 22, 400000) != ESP_OK) {
+        return 0;
+    }
+    return bench_run(&mag, results);
+}
+
+#elif defined(BENCH_SIM_IIS3DWB)
+// As in ESP32C6_IIS3DWBTR Test/main/main.c, with the bus sized for the bench
+#define BENCH_SIM_FIFO_MODES    0x6u
+#define BENCH_SIM_CS            19
+
+static iis3dwb_handle_t dev;
+
+static size_t bench_sim_run(sensor_bench_result_t *results)
+{
+    const spi_bus_config_t buscfg = { .max_transfer_sz = BENCH_MAX_TRANSFER };
+    if (sensor_sim_attach_iis3dwb(BENCH_SIM_CS) != ESP_OK ||
+        spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK ||
+        iis3dwb_init_spi(&dev, SPI2_HOST, BENCH_SIM_CS) != ESP_OK ||
+        iis3dwb_device_init(&dev) != ESP_OK ||
+        iis3dwb_configure(&dev, IIS3DWB_FS_2G, IIS3DWB_ODR_26K7HZ) != ESP_OK ||
+        iis3dwb_fifo_config(&dev, 32, 0x06) != ESP_OK) {
+        return 0;
+    }
+    return bench_run(&dev, results);
+}
+
+#elif defined(BENCH_SIM_SCL3300)
+// As in SCL3300 Test/main/main.c
+#define BENCH_SIM_FIFO_MODES    0x0u
+#define BENCH_SIM_CS            11
+
+static scl3300_t inclinometer;
+
+static size_t bench_sim_run(sensor_bench_result_t *results)
+{
+    const spi_bus_config_t buscfg = { .max_transfer_sz = 4 };
+    if (sensor_sim_attach_scl3300(BENCH_SIM_CS) != ESP_OK ||
+        spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK ||
+        scl3300_init(SPI2_HOST, BENCH_SIM_CS, &inclinometer) != ESP_OK) {
+        return 0;
+    }
+    return bench_run(&inclinometer, results);
+}
+
+#elif defined(BENCH_SIM_ICM45686)
+// As in icm45686 test/main/main.c
+#define BENCH_SIM_FIFO_MODES    0x6u
+#define BENCH_SIM_CS            5
+
+static icm456xx_dev_t imu_dev;
+
+static size_t bench_sim_run(sensor_bench_result_t *results)
+{
+    const spi_bus_config_t buscfg = { .max_transfer_sz = 4096 };
+    if (sensor_sim_attach_icm45686(BENCH_SIM_CS) != ESP_OK ||
+        spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK ||
+        icm456xx_init_spi(&imu_dev, SPI2_HOST, BENCH_SIM_CS, 6000000) != 0 ||
+        icm456xx_begin(&imu_dev) != 0) {
+        return 0;
+    }
+    return bench_run(&imu_dev, results);
+}
+
+#else
+#error "Define the test project to run: BENCH_SIM_IIS2MDC, _IIS3DWB, _SCL3300 or _ICM45686"
+#endif
+
+int main(void)
+{
+    sensor_bench_result_t results[BENCH_MODES];
+    const sensor_sim_state_t state = {
+        .accel_g = { 0.10f, -0.20f, 0.97f },
+        .gyro_dps = { 1.5f, -3.0f, 0.25f },
+        .mag_mg = { 210.0f, -45.0f, 380.0f },
+        .temp_c = 27.5f,
+    };
+    sensor_sim_set_state(&state);
+
+    const size_t done = bench_sim_run(results);
+    int failed = (done != BENCH_MODES);
+    if (failed) {
+        printf("%zu of %d modes ran\n", done, BENCH_MODES);
+    }
+    for (size_t i = 0; i < done; i++) {
+        const sensor_bench_result_t *r = &results[i];
+        const uint32_t lost = (r->expected > r->samples) ? r->expected - r->samples : 0;
+        if (r->samples == 0 || r->errors != 0 || r->bus_bytes == 0) {
+            printf("%s: %lu samples, %lu errors, %lu bytes\n", r->mode, (unsigned long)r->samples,
+                   (unsigned long)r->errors, (unsigned long)r->bus_bytes);
+            failed = 1;
+        }
+        if ((BENCH_SIM_FIFO_MODES & (1u << i)) && (uint64_t)lost * 100 > (uint64_t)r->expected * BENCH_SIM_MAX_LOST_PCT) {
+            printf("%s: lost %lu of %lu samples\n", r->mode, (unsigned long)lost, (unsigned long)r->expected);
+            failed = 1;
+        }
+    }
+
+    sensor_sim_errors_t errors;
+    sensor_sim_get_errors(&errors);
+    if (errors.scl3300_crc_errors || errors.scl3300_bad_commands || errors.icm45686_ireg_errors) {
+        printf("model protocol errors: SCL3300 CRC %lu, bad commands %lu, ICM IREG %lu\n",
+               (unsigned long)errors.scl3300_crc_errors, (unsigned long)errors.scl3300_bad_commands,
+               (unsigned long)errors.icm45686_ireg_errors);
+        failed = 1;
+    }
+    printf("%s\n", failed ? "FAIL" : "OK");
+    return failed;
+}
@@ -0,0 +1,178 @@
+/*
+ * Host benchmark for the raw-to-g kernels in main/convert.c.
+ *
+ * For every full scale it times three ways of converting the same seeded corpus:
+ *   switch  - the per-sample switch on the full scale that imu_manager.c used
+ *             before the kernels (kept here as the reference)
+ *   lookup  - imu_manager_raw_to_g(): a per-sample sensitivity table lookup
+ *   kernel  - the specialized kernel, looked up once per block
+ * and checks the kernel against the reference with the golden-data tolerance
+ * (1e-6 g plus 1e-5 relative, main/golden.h). Host timings only show the relative
+ * cost; POST /api/bench reports the on-target numbers (raw_to_g, raw_to_g_kernel).
+ *
+ * Build and run from the project directory:
+ *   cc -O2 -Imain -o convert_bench tools/convert_bench.c main/convert.c -lm
+ *   ./convert_bench [iterations]
+ *
+ * Exits non-zero if any kernel disagrees with the reference.
+ */
+#include "convert.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_SAMPLES       (64 * 3)    // One FIFO batch of x,y,z (IMU_MANAGER_MAX_SAMPLES)
+#define BENCH_ITERATIONS    20000
+#define BENCH_SEED          0x1D5A3u    // BENCH_CORPUS_SEED
+#define G_TOLERANCE         1e-6f
+#define G_REL_TOLERANCE     1e-5f
+
+static const uint8_t full_scales[] = { 2, 4, 8, 16 };
+
+// Keeps the compiler from hoisting the full-scale switch out of the loop, which the
+// firmware could not do either: the scale was a global read on every call
+static volatile uint8_t reference_scale;
+
+// Pre-kernel imu_manager.c conversion (convert_raw_to_g), mg constants from iis3dwb_reg.c
+__attribute__((noinline)) static float reference_raw_to_g(int16_t raw, uint8_t full_scale_g)
+{
+    float mg = 0.0f;
+
+    switch (full_scale_g) {
+        case 2:
+            mg = (float)raw * 0.061f;
+            break;
+        case 4:
+            mg = (float)raw * 0.122f;
+            break;
+        case 8:
+            mg = (float)raw * 0.244f;
+            break;
+        case 16:
+            mg = (float)raw * 0.488f;
+            break;
+        default:
+            mg = 0.0f;
+            break;
+    }
+
+    return mg / 1000.0f;
+}
+
+// imu_manager_raw_to_g() without the IDF dependencies of imu_manager.c
+__attribute__((noinline)) static float lookup_raw_to_g(int16_t raw, uint8_t full_scale_g)
+{
+    return (float)raw * convert_sensitivity_g(full_scale_g);
+}
+
+static uint32_t lcg_next(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Defeats dead-store elimination of the output between iterations
+static float sink;
+
+static double time_switch(const int16_t *raw, float *g, uint32_t iterations)
+{
+    const double start = now_ns();
+    for (uint32_t it = 0; it < iterations; it++) {
+        for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+            g[i] = reference_raw_to_g(raw[i], reference_scale);
+        }
+        sink += g[it % BENCH_SAMPLES];
+    }
+    return (now_ns() - start) / ((double)iterations * BENCH_SAMPLES);
+}
+
+static double time_lookup(const int16_t *raw, float *g, uint8_t fs, uint32_t iterations)
+{
+    const double start = now_ns();
+    for (uint32_t it = 0; it < iterations; it++) {
+        for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+            g[i] = lookup_raw_to_g(raw[i], fs);
+        }
+        sink += g[it % BENCH_SAMPLES];
+    }
+    return (now_ns() - start) / ((double)iterations * BENCH_SAMPLES);
+}
+
+static double time_kernel(const int16_t *raw, float *g, uint8_t fs, uint32_t iterations)
+{
+    const double start = now_ns();
+    for (uint32_t it = 0; it < iterations; it++) {
+        convert_get_kernel(fs)(raw, g, BENCH_SAMPLES);
+        sink += g[it % BENCH_SAMPLES];
+    }
+    return (now_ns() - start) / ((double)iterations * BENCH_SAMPLES);
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_ITERATIONS;
+    if (iterations == 0) {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 2;
+    }
+
+    int16_t raw[BENCH_SAMPLES];
+    float expected[BENCH_SAMPLES];
+    float g[BENCH_SAMPLES];
+    uint32_t state = BENCH_SEED;
+    for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+        raw[i] = (int16_t)lcg_next(&state);
+    }
+    // Full-range extremes, where the relative error of a rounded constant is largest
+    raw[0] = INT16_MIN;
+    raw[1] = INT16_MAX;
+
+    int failures = 0;
+    printf("%-4s %12s %12s %12s %9s %12s\n", "fs", "switch ns", "lookup ns", "kernel ns", "speedup",
+           "max err g");
+    for (size_t f = 0; f < sizeof(full_scales); f++) {
+        const uint8_t fs = full_scales[f];
+        reference_scale = fs;
+
+        for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+            expected[i] = reference_raw_to_g(raw[i], fs);
+        }
+        convert_get_kernel(fs)(raw, g, BENCH_SAMPLES);
+        float max_err = 0.0f;
+        for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+            const float err = fabsf(g[i] - expected[i]);
+            if (err > G_TOLERANCE + G_REL_TOLERANCE * fabsf(expected[i]) ||
+                fabsf(lookup_raw_to_g(raw[i], fs) - g[i]) > 0.0f) {
+                failures++;
+            }
+            if (err > max_err) {
+                max_err = err;
+            }
+        }
+
+        const double t_switch = time_switch(raw, g, iterations);
+        const double t_lookup = time_lookup(raw, g, fs, iterations);
+        const double t_kernel = time_kernel(raw, g, fs, iterations);
+        printf("%-4u %12.3f %12.3f %12.3f %8.1fx %12.3g\n", fs, t_switch, t_lookup, t_kernel,
+               (t_kernel > 0.0) ? t_switch / t_kernel : 0.0, max_err);
+    }
+
+    if (convert_get_kernel(3) != NULL || convert_get_kernel(255) != NULL || convert_sensitivity_g(0) != 0.0f) {
+        printf("unsupported full scales must have no kernel\n");
+        failures++;
+    }
+    if (failures > 0) {
+        printf("FAIL: %d value(s) outside tolerance\n", failures);
+        return 1;
+    }
+    printf("OK (%u iterations of %u values, sink %g)\n", iterations, BENCH_SAMPLES, sink);
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Host round-trip check and benchmark for the columnar data_buffer (main/data_buffer.c).
+ *
+ * Feeds a seeded stream through data_buffer_add() with the cases the compact encoding
+ * has to keep exact:
+ *   gaps       - a 200 ms hole every 500 samples (duty-cycle sleep), which overflows
+ *                the 16-bit timestamp delta and forces a keyframe
+ *   ODR change - 26.67 kHz for the first half, 1 kHz after
+ *   overwrite  - 20000 samples through a DATA_BUFFER_SIZE ring
+ *   pop        - data_buffer_get() drains the survivors oldest first
+ * and checks every decoded field against the input (accel to the 2048 LSB/g storage
+ * resolution). Then it times add, get_latest and a full get_range. Host timings only
+ * show the relative cost; the commit numbers came from an x86 laptop.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools data_buffer_bench && tools/build/data_buffer_bench [iterations]
+ *
+ * Exits non-zero on the first mismatch.
+ */
+#include "data_buffer.h"
+#include "mem_arena.h"
+#include "esp_timer.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_STREAM_SAMPLES    20000
+#define BENCH_CHECK_INTERVAL    997         // Prime, so checks land at every ring phase
+#define BENCH_GAP_INTERVAL      500
+#define BENCH_GAP_US            200000
+#define BENCH_ITERATIONS        1000000
+#define BENCH_SEED              0x1D5A3u    // BENCH_CORPUS_SEED
+#define ACCEL_TOLERANCE_G       (0.5f / DATA_BUFFER_ACCEL_LSB_PER_G + 1e-6f)
+
+static imu_data_t reference[BENCH_STREAM_SAMPLES];
+static imu_data_t out[DATA_BUFFER_SIZE];
+
+static uint32_t lcg_next(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+static bool sample_matches(const imu_data_t *got, const imu_data_t *want)
+{
+    if (got->timestamp_us != want->timestamp_us ||
+        got->accelerometer.valid != want->accelerometer.valid ||
+        got->stats.fifo_level != want->stats.fifo_level ||
+        got->stats.samples_read != want->stats.samples_read ||
+        got->stats.odr_hz != want->stats.odr_hz) {
+        return false;
+    }
+    if (!want->accelerometer.valid) {
+        return true;
+    }
+    return fabsf(got->accelerometer.x_g - want->accelerometer.x_g) <= ACCEL_TOLERANCE_G &&
+           fabsf(got->accelerometer.y_g - want->accelerometer.y_g) <= ACCEL_TOLERANCE_G &&
+           fabsf(got->accelerometer.z_g - want->accelerometer.z_g) <= ACCEL_TOLERANCE_G;
+}
+
+static void make_stream(void)
+{
+    uint32_t state = BENCH_SEED;
+    uint64_t timestamp_us = 1000;
+
+    for (int i = 0; i < BENCH_STREAM_SAMPLES; i++) {
+        imu_data_t *d = &reference[i];
+        timestamp_us += (i % BENCH_GAP_INTERVAL == 0) ? BENCH_GAP_US : 2000 + lcg_next(&state) % 3000;
+        d->timestamp_us = timestamp_us;
+        d->accelerometer.x_g = (float)((int)(lcg_next(&state) % 32000) - 16000) / 1000.0f;
+        d->accelerometer.y_g = 0.5f;
+        d->accelerometer.z_g = -1.0f;
+        d->accelerometer.valid = (i % 7) != 0;
+        d->stats.fifo_level = (uint16_t)(i % 600);
+        d->stats.samples_read = 64;
+        d->stats.odr_hz = (i < BENCH_STREAM_SAMPLES / 2) ? 26670.0f : 1000.0f;
+    }
+}
+
+static int check_round_trip(void)
+{
+    for (int i = 0; i < BENCH_STREAM_SAMPLES; i++) {
+        if (data_buffer_add(&reference[i]) != ESP_OK) {
+            printf("FAIL: add %d\n", i);
+            return 1;
+        }
+        if (i % BENCH_CHECK_INTERVAL != 0 && i != BENCH_STREAM_SAMPLES - 1) {
+            continue;
+        }
+
+        const uint32_t count = data_buffer_get_count();
+        if (data_buffer_get_range(out, 0, count) != ESP_OK) {
+            printf("FAIL: get_range(0, %u) after %d adds\n", count, i + 1);
+            return 1;
+        }
+        for (uint32_t k = 0; k < count; k++) {
+            const imu_data_t *want = &reference[i - count + 1 + k];
+            if (!sample_matches(&out[k], want)) {
+                printf("FAIL: range entry %u after %d adds: ts %llu, want %llu\n", k, i + 1,
+                       (unsigned long long)out[k].timestamp_us, (unsigned long long)want->timestamp_us);
+                return 1;
+            }
+        }
+
+        imu_data_t latest;
+        if (data_buffer_get_latest(&latest) != ESP_OK || latest.timestamp_us != reference[i].timestamp_us ||
+            latest.accelerometer.x_g != reference[i].accelerometer.x_g) {
+            printf("FAIL: get_latest after %d adds\n", i + 1);
+            return 1;
+        }
+    }
+
+    if (!data_buffer_is_full()) {
+        printf("FAIL: %d adds did not fill a %d-entry buffer\n", BENCH_STREAM_SAMPLES, DATA_BUFFER_SIZE);
+        return 1;
+    }
+
+    const uint32_t count = data_buffer_get_count();
+    for (uint32_t k = 0; k < count; k++) {
+        imu_data_t popped;
+        if (data_buffer_get(&popped) != ESP_OK ||
+            !sample_matches(&popped, &reference[BENCH_STREAM_SAMPLES - count + k])) {
+            printf("FAIL: pop %u of %u\n", k, count);
+            return 1;
+        }
+    }
+    imu_data_t none;
+    if (!data_buffer_is_empty() || data_buffer_get_latest(&none) != ESP_ERR_NOT_FOUND) {
+        printf("FAIL: buffer not empty after popping every entry\n");
+        return 1;
+    }
+
+    printf("round trip OK: %d samples, %u survived overwrite, sizeof(imu_data_t) %zu\n",
+           BENCH_STREAM_SAMPLES, count, sizeof(imu_data_t));
+    return 0;
+}
+
+static void run_bench(uint32_t iterations)
+{
+    imu_data_t sample = reference[1];
+    imu_data_t latest;
+
+    int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < iterations; i++) {
+        sample.timestamp_us += 2500;
+        data_buffer_add(&sample);
+    }
+    const double add_ns = (double)(esp_timer_get_time() - start) * 1000.0 / iterations;
+
+    start = esp_timer_get_time();
+    for (uint32_t i = 0; i < iterations; i++) {
+        data_buffer_get_latest(&latest);
+    }
+    const double latest_ns = (double)(esp_timer_get_time() - start) * 1000.0 / iterations;
+
+    const uint32_t range_iterations = iterations / DATA_BUFFER_SIZE + 1;
+    start = esp_timer_get_time();
+    for (uint32_t i = 0; i < range_iterations; i++) {
+        data_buffer_get_range(out, 0, DATA_BUFFER_SIZE);
+    }
+    const double range_ns = (double)(esp_timer_get_time() - start) * 1000.0 /
+                            ((double)range_iterations * DATA_BUFFER_SIZE);
+
+    printf("%-24s %10.1f ns\n", "add", add_ns);
+    printf("%-24s %10.1f ns\n", "get_latest", latest_ns);
+    printf("%-24s %10.1f ns/sample\n", "get_range (full)", range_ns);
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_ITERATIONS;
+    if (iterations == 0) {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 2;
+    }
+
+    if (mem_arena_init() != ESP_OK || data_buffer_init() != ESP_OK) {
+        printf("FAIL: init\n");
+        return 1;
+    }
+
+    make_stream();
+    if (check_round_trip() != 0) {
+        return 1;
+    }
+    run_bench(iterations);
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * Host stress check for the lock-free data_buffer_get_latest() (main/data_buffer.c).
+ *
+ * One writer adds a stream of samples while N reader threads spin on the latest
+ * sample, all pinned to one CPU so readers preempt the writer mid-publish the way the
+ * WebSocket task preempts imu_task on the single-core C6. Each run reports:
+ *   writer p50/p99/max  - data_buffer_add() latency
+ *   reads, torn         - samples whose fields came from two different adds
+ *   retries, fallbacks  - buffer_stats_t latest_read_retries / latest_read_fallbacks
+ *   dropped             - adds that gave up on buffer_mutex (10 ms timeout)
+ * for two reader paths:
+ *   latest  - data_buffer_get_latest(), the double-buffered slot
+ *   mutex   - data_buffer_get_range() on the newest entry, which takes buffer_mutex
+ *             like get_latest() did before the slot was added
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools data_buffer_latest_stress && tools/build/data_buffer_latest_stress [adds]
+ *
+ * Exits non-zero if the lock-free path returns a torn sample or makes the writer drop.
+ */
+#define _GNU_SOURCE
+#include "data_buffer.h"
+#include "mem_arena.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STRESS_ADDS         300000
+#define STRESS_MAX_READERS  8
+#define STRESS_PERIOD_US    2400        // One 64-sample FIFO batch at 26.67 kHz
+
+typedef enum {
+    READ_LATEST,
+    READ_MUTEX,
+} read_path_t;
+
+static const unsigned reader_counts[] = { 0, 2, 8 };
+static const char *const path_names[] = { "latest", "mutex" };
+
+static atomic_bool stop;
+static atomic_ulong reads;
+static atomic_ulong torn;
+static read_path_t path;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Every field is a function of the timestamp, in whole g so the 2048 LSB/g ring is exact
+static float expected_g(uint64_t timestamp_us)
+{
+    return (float)((timestamp_us / STRESS_PERIOD_US) % 16) - 8.0f;
+}
+
+static void *reader_task(void *arg)
+{
+    imu_data_t d;
+
+    while (!atomic_load(&stop)) {
+        esp_err_t ret;
+        if (path == READ_LATEST) {
+            ret = data_buffer_get_latest(&d);
+        } else {
+            const uint32_t count = data_buffer_get_count();
+            ret = (count > 0) ? data_buffer_get_range(&d, count - 1, 1) : ESP_ERR_NOT_FOUND;
+        }
+        if (ret != ESP_OK) {
+            continue;
+        }
+        atomic_fetch_add(&reads, 1);
+        const float want = expected_g(d.timestamp_us);
+        if (d.accelerometer.x_g != want || d.accelerometer.y_g != want || d.accelerometer.z_g != -want) {
+            atomic_fetch_add(&torn, 1);
+        }
+    }
+    return NULL;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    const uint64_t x = *(const uint64_t *)a;
+    const uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t latency_ns[STRESS_ADDS];
+
+// Returns the number of failed invariants for this run
+static int run(read_path_t read_path, unsigned readers, uint32_t adds)
+{
+    pthread_t threads[STRESS_MAX_READERS];
+    imu_data_t d;
+
+    data_buffer_clear();
+    buffer_stats_t before;
+    data_buffer_get_stats(&before);
+
+    path = read_path;
+    atomic_store(&stop, false);
+    atomic_store(&reads, 0);
+    atomic_store(&torn, 0);
+    for (unsigned i = 0; i < readers; i++) {
+        pthread_create(&threads[i], NULL, reader_task, NULL);
+    }
+
+    memset(&d, 0, sizeof(d));
+    d.accelerometer.valid = true;
+    d.stats.odr_hz = 26670.0f;
+    d.stats.samples_read = 64;
+    for (uint32_t i = 0; i < adds; i++) {
+        d.timestamp_us += STRESS_PERIOD_US;
+        d.accelerometer.x_g = expected_g(d.timestamp_us);
+        d.accelerometer.y_g = d.accelerometer.x_g;
+        d.accelerometer.z_g = -d.accelerometer.x_g;
+        const uint64_t start = now_ns();
+        data_buffer_add(&d);
+        latency_ns[i] = now_ns() - start;
+    }
+
+    atomic_store(&stop, true);
+    for (unsigned i = 0; i < readers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    buffer_stats_t after;
+    data_buffer_get_stats(&after);
+    qsort(latency_ns, adds, sizeof(latency_ns[0]), compare_u64);
+
+    const unsigned long torn_count = atomic_load(&torn);
+    const uint32_t dropped = after.dropped_samples - before.dropped_samples;
+    printf("%-7s %7u %9.2f %9.2f %9.1f %10lu %6lu %8u %9u %7u\n", path_names[read_path], readers,
+           latency_ns[adds / 2] / 1000.0, latency_ns[(uint64_t)adds * 99 / 100] / 1000.0,
+           latency_ns[adds - 1] / 1000.0, atomic_load(&reads), torn_count,
+           after.latest_read_retries - before.latest_read_retries,
+           after.latest_read_fallbacks - before.latest_read_fallbacks, dropped);
+
+    // The mutex path is the baseline being compared against; only the slot must hold
+    return (read_path == READ_LATEST) ? (torn_count > 0) + (dropped > 0) : 0;
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t adds = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : STRESS_ADDS;
+    if (adds == 0 || adds > STRESS_ADDS) {
+        fprintf(stderr, "usage: %s [adds, 1..%u]\n", argv[0], STRESS_ADDS);
+        return 2;
+    }
+
+    // One CPU, like the C6: readers run only when they preempt the writer
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(0, &cpus);
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        printf("note: could not pin to one CPU, results are for an SMP host\n");
+    }
+
+    if (mem_arena_init() != ESP_OK || data_buffer_init() != ESP_OK) {
+        printf("FAIL: init\n");
+        return 1;
+    }
+
+    int failures = 0;
+    printf("%-7s %7s %9s %9s %9s %10s %6s %8s %9s %7s\n", "path", "readers", "p50 us", "p99 us", "max us",
+           "reads", "torn", "retries", "fallbacks", "dropped");
+    for (size_t p = 0; p < sizeof(path_names) / sizeof(path_names[0]); p++) {
+        for (size_t r = 0; r < sizeof(reader_counts) / sizeof(reader_counts[0]); r++) {
+            failures += run((read_path_t)p, reader_counts[r], adds);
+        }
+    }
+
+    if (failures > 0) {
+        printf("FAIL: lock-free latest reads tore or blocked the writer\n");
+        return 1;
+    }
+    printf("OK (%u adds per run)\n", adds);
+    return 0;
+}
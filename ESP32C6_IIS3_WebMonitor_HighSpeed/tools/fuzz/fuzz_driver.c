@@ -0,0 +1,273 @@
+/*
+ * Standalone driver for the libFuzzer harnesses in this directory, for toolchains
+ * without -fsanitize=fuzzer (the gcc the firmware's host tools build with). It runs
+ * every corpus input once, then a seeded stream of mutations of them, all under
+ * ASan/UBSan, and takes a subset of libFuzzer's flags:
+ *
+ *   fuzz_<target> [-runs=N] [-seed=N] [-max_len=N] [-timeout_ms=N] [-artifact_prefix=P] CORPUS...
+ *
+ * CORPUS entries are files or directories of files. A crash or sanitizer report
+ * writes the input to <prefix>crash-<run> before the process dies; an input slower
+ * than -timeout_ms is written to <prefix>slow-<run> and fails the run. There is no
+ * coverage feedback: this is a regression gate for the seed corpora, not a
+ * replacement for a libFuzzer campaign (make -C tools fuzz CC=clang LIBFUZZER=1).
+ */
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <sanitizer/common_interface_defs.h>
+
+#define DRIVER_MAX_INPUTS       1024
+#define DRIVER_DEFAULT_RUNS     20000
+#define DRIVER_DEFAULT_MAX_LEN  4096
+#define DRIVER_DEFAULT_TIMEOUT  100     // ms per input
+#define DRIVER_MAX_STACKED      8       // Mutations applied to one input
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} input_t;
+
+static input_t corpus[DRIVER_MAX_INPUTS];
+static size_t corpus_count;
+static const char *artifact_prefix = "";
+static const uint8_t *current;
+static size_t current_size;
+static unsigned long current_run;
+static uint64_t rng_state;
+
+// Bytes that steer the parsers: JSON structure, escapes, FIFO tags, header bits
+static const uint8_t interesting[] = { '{', '}', '[', ']', '"', '\\', ':', ',', '-', '0', 'e', '.', 0x00,
+                                       0x10, 0x18, 0x20, 0x68, 0x7F, 0x80, 0xFF };
+
+static uint32_t rng(void)
+{
+    rng_state = rng_state * 6364136223846793005ull + 1442695040888963407ull;
+    return (uint32_t)(rng_state >> 33);
+}
+
+static void write_artifact(const char *kind, const uint8_t *data, size_t size)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s%s-%lu", artifact_prefix, kind, current_run);
+    FILE *f = fopen(path, "wb");
+    if (f != NULL) {
+        fwrite(data, 1, size, f);
+        fclose(f);
+        fprintf(stderr, "fuzz: wrote %zu-byte input to %s\n", size, path);
+    }
+}
+
+// Called by the ASan runtime after it printed its report
+static void on_death(void)
+{
+    if (current != NULL) {
+        write_artifact("crash", current, current_size);
+        current = NULL;
+    }
+}
+
+// gcc links UBSan as its own runtime, which skips ASan's death callback but calls
+// this hook on every report; with -fno-sanitize-recover the report is fatal
+void __ubsan_on_report(void)
+{
+    on_death();
+}
+
+static void add_file(const char *path, size_t max_len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL || corpus_count == DRIVER_MAX_INPUTS) {
+        if (f != NULL) {
+            fclose(f);
+        }
+        return;
+    }
+    input_t *in = &corpus[corpus_count];
+    in->data = malloc(max_len);
+    in->size = fread(in->data, 1, max_len, f);
+    fclose(f);
+    corpus_count++;
+}
+
+static void add_path(const char *path, size_t max_len)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        fprintf(stderr, "fuzz: %s not found\n", path);
+        return;
+    }
+    if (!S_ISDIR(st.st_mode)) {
+        add_file(path, max_len);
+        return;
+    }
+    DIR *dir = opendir(path);
+    struct dirent *e;
+    while (dir != NULL && (e = readdir(dir)) != NULL) {
+        if (e->d_name[0] != '.') {
+            char file[512];
+            snprintf(file, sizeof(file), "%s/%s", path, e->d_name);
+            add_file(file, max_len);
+        }
+    }
+    if (dir != NULL) {
+        closedir(dir);
+    }
+}
+
+static size_t mutate(uint8_t *buf, size_t size, size_t max_len)
+{
+    const unsigned count = 1 + rng() % DRIVER_MAX_STACKED;
+    for (unsigned m = 0; m < count; m++) {
+        const size_t pos = size ? rng() % size : 0;
+        switch (rng() % 7) {
+            case 0:     // Flip a bit
+                if (size) {
+                    buf[pos] ^= (uint8_t)(1u << (rng() % 8));
+                }
+                break;
+            case 1:     // Random byte
+                if (size) {
+                    buf[pos] = (uint8_t)rng();
+                }
+                break;
+            case 2:     // Interesting byte
+                if (size) {
+                    buf[pos] = interesting[rng() % sizeof(interesting)];
+                }
+                break;
+            case 3:     // Insert a byte
+                if (size < max_len) {
+                    memmove(buf + pos + 1, buf + pos, size - pos);
+                    buf[pos] = interesting[rng() % sizeof(interesting)];
+                    size++;
+                }
+                break;
+            case 4:     // Delete a range
+                if (size) {
+                    const size_t n = 1 + rng() % (size - pos);
+                    memmove(buf + pos, buf + pos + n, size - pos - n);
+                    size -= n;
+                }
+                break;
+            case 5: {   // Repeat a range, e.g. nesting or FIFO words
+                const size_t n = size ? 1 + rng() % (size - pos) : 0;
+                const unsigned times = 1 + rng() % 16;
+                for (unsigned t = 0; t < times && size + n <= max_len; t++) {
+                    memmove(buf + pos + n, buf + pos, size - pos);
+                    size += n;
+                }
+                break;
+            }
+            default: {  // Splice in part of another corpus input
+                const input_t *other = &corpus[rng() % corpus_count];
+                if (other->size) {
+                    const size_t from = rng() % other->size;
+                    size_t n = 1 + rng() % (other->size - from);
+                    if (pos + n > max_len) {
+                        n = max_len - pos;
+                    }
+                    memcpy(buf + pos, other->data + from, n);
+                    if (pos + n > size) {
+                        size = pos + n;
+                    }
+                }
+                break;
+            }
+        }
+    }
+    return size;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// Returns false if the input ran longer than timeout_ms
+static bool run_one(const uint8_t *data, size_t size, double timeout_ms, double *slowest_ms)
+{
+    // libFuzzer hands the target a buffer of exactly size bytes; so do we, so
+    // ASan sees any read past the end
+    uint8_t *copy = malloc(size ? size : 1);
+    memcpy(copy, data, size);
+    current = copy;
+    current_size = size;
+    const double start = now_ms();
+    LLVMFuzzerTestOneInput(copy, size);
+    const double elapsed = now_ms() - start;
+    current = NULL;
+    const bool ok = elapsed <= timeout_ms;
+    if (!ok) {
+        fprintf(stderr, "fuzz: input took %.1f ms (limit %.0f)\n", elapsed, timeout_ms);
+        write_artifact("slow", copy, size);
+    }
+    free(copy);
+    if (elapsed > *slowest_ms) {
+        *slowest_ms = elapsed;
+    }
+    current_run++;
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long runs = DRIVER_DEFAULT_RUNS;
+    unsigned long seed = 1;
+    size_t max_len = DRIVER_DEFAULT_MAX_LEN;
+    double timeout_ms = DRIVER_DEFAULT_TIMEOUT;
+
+    __sanitizer_set_death_callback(on_death);
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strncmp(arg, "-runs=", 6) == 0) {
+            runs = strtoul(arg + 6, NULL, 0);
+        } else if (strncmp(arg, "-seed=", 6) == 0) {
+            seed = strtoul(arg + 6, NULL, 0);
+        } else if (strncmp(arg, "-max_len=", 9) == 0) {
+            max_len = strtoul(arg + 9, NULL, 0);
+        } else if (strncmp(arg, "-timeout_ms=", 12) == 0) {
+            timeout_ms = strtod(arg + 12, NULL);
+        } else if (strncmp(arg, "-artifact_prefix=", 17) == 0) {
+            artifact_prefix = arg + 17;
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "fuzz: unknown flag %s\n", arg);
+            return 2;
+        } else {
+            add_path(arg, max_len);
+        }
+    }
+    if (corpus_count == 0 || max_len == 0) {
+        fprintf(stderr, "usage: %s [-runs=N] [-seed=N] [-max_len=N] [-timeout_ms=N] [-artifact_prefix=P] CORPUS...\n",
+                argv[0]);
+        return 2;
+    }
+    rng_state = seed;
+
+    double slowest_ms = 0.0;
+    bool ok = true;
+    for (size_t i = 0; i < corpus_count; i++) {
+        ok &= run_one(corpus[i].data, corpus[i].size, timeout_ms, &slowest_ms);
+    }
+    uint8_t *buf = malloc(max_len);
+    for (unsigned long r = 0; r < runs; r++) {
+        const input_t *base = &corpus[rng() % corpus_count];
+        memcpy(buf, base->data, base->size);
+        const size_t size = mutate(buf, base->size, max_len);
+        ok &= run_one(buf, size, timeout_ms, &slowest_ms);
+    }
+    free(buf);
+
+    printf("%zu corpus inputs + %lu mutations (seed %lu), slowest %.2f ms: %s\n", corpus_count, runs, seed,
+           slowest_ms, ok ? "OK" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+/*
+ * IIS3DWB FIFO decode (main/imu_fifo.c imu_manager_decode_fifo): the words are
+ * whatever the SPI read returned. The first input byte sets the caller's sample
+ * capacity, the rest are FIFO words; the output buffer is exactly that capacity.
+ */
+#include "imu_manager.h"
+#include <stdlib.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size < 1) {
+        return 0;
+    }
+    const uint16_t max_samples = data[0];
+    const uint16_t entries = (uint16_t)((size - 1) / IMU_MANAGER_FIFO_ENTRY_BYTES);
+    int16_t *xyz = malloc((max_samples ? max_samples : 1) * 3 * sizeof(int16_t));
+
+    const uint16_t n = imu_manager_decode_fifo(data + 1, entries, xyz, max_samples);
+    if (n > max_samples || n > entries) {
+        abort();
+    }
+    free(xyz);
+    return 0;
+}
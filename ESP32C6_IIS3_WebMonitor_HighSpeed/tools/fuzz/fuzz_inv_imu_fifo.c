@@ -0,0 +1,46 @@
+/*
+ * ICM-45686 FIFO parse (components/imu_sensors/imu inv_imu_adv_parse_fifo_data)
+ * on frames as the sensor sent them. The first input byte picks the FIFO setup
+ * icm45686.c could have configured:
+ *   bits [1:0]  frame size 8 / 16 / 20 / 32 (accel or gyro, both, hires, external)
+ *   bit 2       compression
+ *   bit 3       endianness_data (SREG_CTRL data byte order)
+ * The rest is the FIFO, and the frame count is what inv_imu_adv_get_data_from_fifo
+ * could have read into its FIFO_MIRRORING_SIZE buffer.
+ */
+#include "imu/inv_imu_driver_advanced.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const uint8_t frame_sizes[] = { 8, 16, 20, 32 };
+static volatile uint32_t sink;     // Keeps the parsed fields live
+
+static void event_cb(inv_imu_sensor_event_t *event)
+{
+    sink += (uint32_t)(event->accel[0] + event->gyro[0] + event->temperature) + event->timestamp_fsync;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size < 1) {
+        return 0;
+    }
+    static inv_imu_device_t dev;
+    memset(&dev, 0, sizeof(dev));
+    dev.fifo_frame_size = frame_sizes[data[0] & 0x03];
+    dev.endianness_data = (data[0] >> 3) & 0x01;
+    inv_imu_adv_var_t *e = (inv_imu_adv_var_t *)dev.adv_var;
+    e->sensor_event_cb = event_cb;
+    e->fifo_comp_en = (data[0] & 0x04) ? 1 : 0;
+    e->fifo_is_used = 1;
+
+    uint8_t *fifo = calloc(1, FIFO_MIRRORING_SIZE);
+    size_t len = size - 1;
+    if (len > FIFO_MIRRORING_SIZE) {
+        len = FIFO_MIRRORING_SIZE;
+    }
+    memcpy(fifo, data + 1, len);
+    inv_imu_adv_parse_fifo_data(&dev, fifo, (uint16_t)(len / dev.fifo_frame_size));
+    free(fifo);
+    return 0;
+}
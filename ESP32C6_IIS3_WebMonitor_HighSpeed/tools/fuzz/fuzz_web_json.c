@@ -0,0 +1,71 @@
+/*
+ * POST body parsing (main/web_json.c): the path every JSON handler in
+ * web_server.c takes after recv_json_body() has read the body, then the checked
+ * integer accessor on each numeric field the handlers read, at their ranges.
+ * Inputs are the bodies the handlers accept, NUL-terminated like recv_json_body()
+ * leaves them. The accessor also runs on the whole body read as one number
+ * (strtod takes "1e999", "nan" and "-inf"), so it is fuzzed without a cJSON checkout.
+ */
+#include "web_json.h"
+#include "duty_cycle.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FUZZ_BODY_MAX   192     // Largest POST buffer in web_server.c
+#define FUZZ_UNSET      0x5A5A5A5A
+
+// The ranges web_server.c passes to web_json_get_int()
+static const struct {
+    const char *field;
+    int32_t min;
+    int32_t max;
+} int_fields[] = {
+    { "full_scale_g", 2, 16 },                                  // /api/config
+    { "value", INT32_MIN, INT32_MAX },                          // /api/pipeline param
+    { "interval_s", DUTY_MIN_INTERVAL_S, DUTY_MAX_INTERVAL_S }, // /api/schedule
+    { "window_ms", 1, DUTY_MAX_WINDOW_MS },
+    { "threshold_mg", 0, INT32_MAX },                           // /api/blackbox
+};
+
+static void check_int(const cJSON *item, int32_t min, int32_t max)
+{
+    int32_t out = FUZZ_UNSET;
+    if (web_json_get_int(item, min, max, &out)) {
+        if (!cJSON_IsNumber(item) || out < min || out > max) {
+            abort();
+        }
+    } else if (out != FUZZ_UNSET) {
+        abort();                // A rejected value must not be written
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size == 0 || size >= FUZZ_BODY_MAX) {
+        return 0;               // recv_json_body() answers these with invalid_length
+    }
+    char *body = malloc(size + 1);
+    memcpy(body, data, size);
+    body[size] = '\0';
+
+    const char *error = NULL;
+    cJSON *root = web_json_parse_body(body, size, &error);
+    if ((root == NULL) == (error == NULL)) {
+        abort();                // Exactly one of a tree or a 400 body
+    }
+    if (root != NULL && !web_json_depth_ok(body, size, WEB_JSON_MAX_DEPTH)) {
+        abort();
+    }
+
+    const cJSON *param = cJSON_GetObjectItem(root, "param");
+    const cJSON number = { .type = cJSON_Number, .valuedouble = strtod(body, NULL) };
+    for (size_t i = 0; i < sizeof(int_fields) / sizeof(int_fields[0]); i++) {
+        check_int(cJSON_GetObjectItem(root, int_fields[i].field), int_fields[i].min, int_fields[i].max);
+        check_int(cJSON_GetObjectItem(param, int_fields[i].field), int_fields[i].min, int_fields[i].max);
+        check_int(&number, int_fields[i].min, int_fields[i].max);
+    }
+
+    cJSON_Delete(root);
+    free(body);
+    return 0;
+}
@@ -0,0 +1,18 @@
+/*
+ * /ws/data client messages (main/web_json.c web_json_parse_echo): payloads come
+ * straight from httpd_ws_recv_frame() without a terminator, so the harness passes
+ * exactly size bytes and ASan catches a parse that reads past them.
+ */
+#include "web_json.h"
+#include "latency.h"
+#include <stdlib.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    uint32_t seq = 0;
+    uint32_t hold_us = 0;
+    if (web_json_parse_echo(data, size, &seq, &hold_us) && hold_us > LATENCY_MAX_HOLD_US + 1) {
+        abort();
+    }
+    return 0;
+}
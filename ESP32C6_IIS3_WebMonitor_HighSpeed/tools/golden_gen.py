@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+"""Generate the golden-data files: IIS3DWB streams for POST /api/golden and
+conversion vectors for the other sensor drivers, checked on the host.
+
+Each case is an IIS3DWB FIFO stream (accelerometer words mixed with timestamp and
+temperature words) plus the outputs a correct firmware must produce from it:
+decoded x,y,z, the dc_block output and the decimate output. The outputs come
+from the reference model below, written from the datasheet and the documented
+stage behaviour, not from the firmware, so a firmware change that alters any
+stage shows up as a mismatch.
+
+The built-in cases are synthetic and seeded: tones at 2 g, clipping square waves
+at 16 g (dc_block clamp), steps at 8 g and noise at 4 g with a 64x decimation.
+--capture adds a case built from a .cap file recorded on a device
+(GET /api/capture?file=...), so real traffic can be pinned as well.
+
+Rebuild the firmware after regenerating; the file is embedded with EMBED_FILES.
+
+The sensor file (tools/golden/sensors.gld, checked by tools/golden_sensors.c) holds
+raw values and the expected outputs of the conversions in components/imu_sensors:
+SCL3300 acceleration in each mode (6000 / 3000 / 12000 / 12000 LSB/g), angle and
+temperature; ICM-45686 acceleration and angular rate at every full scale the driver
+accepts, and temperature; IIS2MDC field (1.5 mG/LSB) and temperature. Layout,
+little-endian, no alignment:
+  "GLDS" magic, u16 version, u16 case count
+  case_count x { char name[16], u8 sensor, u8 quantity, u16 param (mode or full
+                 scale as passed to the driver), u16 count, u16 reserved,
+                 f32 relative tolerance, f32 absolute tolerance,
+                 count x int16 raw, count x f64 expected }
+
+Example:
+  python3 golden_gen.py --capture run1.cap
+"""
+
+import argparse
+import math
+import os
+import random
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUT = os.path.join(HERE, "..", "data", "golden", "iis3dwb.gld")
+DEFAULT_SENSORS_OUT = os.path.join(HERE, "golden", "sensors.gld")
+
+GOLDEN_MAGIC = 0x4E444C47
+GOLDEN_VERSION = 1
+GOLDEN_NAME_LEN = 16
+GOLDEN_MAX_SAMPLES = 2048
+
+ODR_HZ = 26667.0
+XL_TAG, TEMPERATURE_TAG, TIMESTAMP_TAG = 2, 3, 4
+SENSITIVITY_MG = {2: 0.061, 4: 0.122, 8: 0.244, 16: 0.488}    # Datasheet, mg/LSB
+
+SENSORS_MAGIC = 0x53444C47     # "GLDS"
+SENSORS_VERSION = 1
+SENSOR_SCL3300, SENSOR_ICM45686, SENSOR_IIS2MDC = 1, 2, 3
+QTY_ACCEL, QTY_GYRO, QTY_MAG, QTY_ANGLE, QTY_TEMP = 1, 2, 3, 4, 5
+SCL3300_LSB_PER_G = {1: 6000.0, 2: 3000.0, 3: 12000.0, 4: 12000.0}   # Datasheet, per mode
+ICM_ACCEL_FS_G = [2, 4, 8, 16, 32]
+# Driver argument -> datasheet range in dps
+ICM_GYRO_FS_DPS = [(15, 15.625), (31, 31.25), (62, 62.5), (125, 125.0), (250, 250.0),
+                   (500, 500.0), (1000, 1000.0), (2000, 2000.0), (4000, 4000.0)]
+# Float outputs: two roundings (the scale and the product) of 2^-24 each
+TOL_FLOAT = 2.5e-7
+TOL_DOUBLE = 1e-14
+TOL_ABS = 1e-12                # Results that land next to zero, e.g. SCL3300 temperature
+SENSOR_RAW_EDGES = [-32768, -32767, -16384, -1, 0, 1, 16384, 32767]
+SENSOR_RAW_COUNT = 256
+
+CAPTURE_MAGIC = 0x43554D49
+CAPTURE_HEADER = struct.Struct("<IHHQfIBBH")
+
+
+def clamp16(v):
+    return max(-32768, min(32767, int(v)))
+
+
+def check_i32(v):
+    if not -2 ** 31 <= v < 2 ** 31:
+        raise ValueError("dc_block accumulator overflows int32; use a gentler case")
+    return v
+
+
+def cdiv(a, b):
+    """C integer division (truncates toward zero)."""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+def dc_block(samples, shift):
+    """y[n] = x[n] - x[n-1] + (1 - 2^-shift) y[n-1], accumulator in Q8."""
+    prev = [0, 0, 0]
+    acc = [0, 0, 0]
+    primed = False
+    out = []
+    for s in samples:
+        row = []
+        for axis in range(3):
+            x = s[axis]
+            if not primed:
+                prev[axis] = x
+            acc[axis] = check_i32(acc[axis] + (x - prev[axis]) * 256 - (acc[axis] >> shift))
+            prev[axis] = x
+            row.append(clamp16(acc[axis] >> 8))
+        primed = True
+        out.append(tuple(row))
+    return out
+
+
+def decimate(samples, factor):
+    """Boxcar average of `factor` samples, rounded half away from zero."""
+    out = []
+    for i in range(0, len(samples) - factor + 1, factor):
+        row = []
+        for axis in range(3):
+            s = sum(samples[j][axis] for j in range(i, i + factor))
+            row.append(cdiv(s + factor // 2 if s >= 0 else s - factor // 2, factor))
+        out.append(tuple(row))
+    return out
+
+
+def fifo_stream(rng, samples, other_every):
+    """Wrap samples in FIFO words, inserting a non-accel word every `other_every` words."""
+    words = []
+    count = 0
+    for s in samples:
+        if other_every and len(words) % other_every == other_every - 1:
+            tag = TIMESTAMP_TAG if rng.random() < 0.7 else TEMPERATURE_TAG
+            words.append(bytes([(tag << 3) | ((count & 3) << 1)]) + bytes(rng.randrange(256) for _ in range(6)))
+            count += 1
+        words.append(bytes([(XL_TAG << 3) | ((count & 3) << 1)]) + struct.pack("<hhh", *s))
+        count += 1
+    return b"".join(words)
+
+
+def mg_to_lsb(mg, fs):
+    return clamp16(round(mg / SENSITIVITY_MG[fs]))
+
+
+def case_tone(rng):
+    fs = 2
+    out = []
+    for n in range(1024):
+        t = n / ODR_HZ
+        out.append((mg_to_lsb(500 * math.sin(2 * math.pi * 120 * t) + rng.uniform(-5, 5), fs),
+                    mg_to_lsb(250 * math.sin(2 * math.pi * 1000 * t) + rng.uniform(-5, 5), fs),
+                    mg_to_lsb(1000 + 100 * math.sin(2 * math.pi * 50 * t) + rng.uniform(-5, 5), fs)))
+    return "tone_2g", fs, 8, 4, out, 32
+
+
+def case_clip(rng):
+    fs = 16
+    out = []
+    for n in range(600):
+        high = (n // 5) % 2 == 0
+        out.append((32767 if high else -32768, -32768 if high else 32767, 32767 if n % 50 < 25 else 0))
+    return "clip_16g", fs, 2, 3, out, 17
+
+
+def case_step(rng):
+    fs = 8
+    out = []
+    level = [0, 0, 4098]
+    for n in range(700):
+        if n % 100 == 0:
+            level = [rng.randrange(-8000, 8000) for _ in range(3)]
+        out.append(tuple(clamp16(level[a] + rng.randrange(-3, 4)) for a in range(3)))
+    return "step_8g", fs, 14, 1, out, 0
+
+
+def case_noise(rng):
+    fs = 4
+    out = [tuple(rng.randrange(-2000, 2001) for _ in range(3)) for _ in range(1500)]
+    return "noise_4g", fs, 8, 64, out, 9
+
+
+def case_capture(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, header_size, _, odr_hz, _, fs, channels, _ = CAPTURE_HEADER.unpack_from(data)
+    if magic != CAPTURE_MAGIC or channels != 3 or fs not in SENSITIVITY_MG:
+        raise ValueError(f"{path}: not a 3-channel .cap file")
+    body = data[header_size:]
+    n = min(len(body) // 6, GOLDEN_MAX_SAMPLES - GOLDEN_MAX_SAMPLES // 32)
+    out = [struct.unpack_from("<hhh", body, i * 6) for i in range(n)]
+    return "capture", fs, 8, 4, out, 32
+
+
+def encode_case(rng, name, fs, shift, factor, samples, other_every):
+    fifo = fifo_stream(rng, samples, other_every)
+    entries = len(fifo) // 7
+    if len(samples) > GOLDEN_MAX_SAMPLES or entries > 0xFFFF:
+        raise ValueError(f"{name}: too many samples")
+    dc = dc_block(samples, shift)
+    dec = decimate(dc, factor)
+    header = struct.pack("<16sBBBBHHHHf", name.encode()[:GOLDEN_NAME_LEN], fs, shift, factor, 0,
+                         entries, len(samples), len(dec), 0, SENSITIVITY_MG[fs] / 1000.0)
+    flat = lambda rows: b"".join(struct.pack("<hhh", *r) for r in rows)
+    print(f"{name:<10} fs={fs:>2}g dc_shift={shift:>2} decimate={factor:>2} "
+          f"fifo={entries:>4} samples={len(samples):>4} decimated={len(dec):>4}")
+    return header + fifo + flat(samples) + flat(dc) + flat(dec)
+
+
+def sensor_cases():
+    """(name, sensor, quantity, param, rel_tol, raw -> expected) for every conversion."""
+    cases = []
+    for mode, lsb in SCL3300_LSB_PER_G.items():
+        cases.append((f"scl_acc_m{mode}", SENSOR_SCL3300, QTY_ACCEL, mode, TOL_DOUBLE, lambda r, lsb=lsb: r / lsb))
+    cases.append(("scl_angle", SENSOR_SCL3300, QTY_ANGLE, 0, TOL_DOUBLE, lambda r: r / 2 ** 14 * 90.0))
+    cases.append(("scl_temp", SENSOR_SCL3300, QTY_TEMP, 0, TOL_DOUBLE, lambda r: -273.0 + r / 18.9))
+    for fs in ICM_ACCEL_FS_G:
+        cases.append((f"icm_acc_{fs}g", SENSOR_ICM45686, QTY_ACCEL, fs, TOL_FLOAT, lambda r, fs=fs: r * fs / 32768.0))
+    for arg, dps in ICM_GYRO_FS_DPS:
+        cases.append((f"icm_gyr_{arg}", SENSOR_ICM45686, QTY_GYRO, arg, TOL_FLOAT,
+                      lambda r, dps=dps: r * dps / 32768.0))
+    cases.append(("icm_temp", SENSOR_ICM45686, QTY_TEMP, 0, TOL_FLOAT, lambda r: r / 128.0 + 25.0))
+    cases.append(("mdc_field", SENSOR_IIS2MDC, QTY_MAG, 0, TOL_FLOAT, lambda r: r * 1.5))
+    cases.append(("mdc_temp", SENSOR_IIS2MDC, QTY_TEMP, 0, TOL_FLOAT, lambda r: r / 8.0 + 25.0))
+    return cases
+
+
+def encode_sensor_case(rng, name, sensor, quantity, param, rel_tol, model):
+    raw = SENSOR_RAW_EDGES + [rng.randrange(-32768, 32768) for _ in range(SENSOR_RAW_COUNT - len(SENSOR_RAW_EDGES))]
+    header = struct.pack("<16sBBHHHff", name.encode()[:GOLDEN_NAME_LEN], sensor, quantity, param, len(raw), 0,
+                         rel_tol, TOL_ABS)
+    return (header + struct.pack(f"<{len(raw)}h", *raw) +
+            struct.pack(f"<{len(raw)}d", *(model(r) for r in raw)))
+
+
+def write_sensors(path, seed):
+    rng = random.Random(seed)
+    cases = sensor_cases()
+    body = b"".join(encode_sensor_case(rng, *c) for c in cases)
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IHH", SENSORS_MAGIC, SENSORS_VERSION, len(cases)) + body)
+    print(f"wrote {path} ({len(cases)} conversion cases, {8 + len(body)} bytes)")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--out", default=DEFAULT_OUT)
+    parser.add_argument("--seed", type=int, default=0x60D)
+    parser.add_argument("--capture", action="append", default=[], help=".cap file to add as a case")
+    parser.add_argument("--sensors-out", default=DEFAULT_SENSORS_OUT)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    cases = [case_tone(rng), case_clip(rng), case_step(rng), case_noise(rng)]
+    cases += [case_capture(path) for path in args.capture]
+    if len(cases) * 5 > 30:
+        print("too many cases for GOLDEN_MAX_RESULTS", file=sys.stderr)
+        return 1
+
+    body = b"".join(encode_case(rng, *c) for c in cases)
+    os.makedirs(os.path.dirname(os.path.abspath(args.out)), exist_ok=True)
+    with open(args.out, "wb") as f:
+        f.write(struct.pack("<IHH", GOLDEN_MAGIC, GOLDEN_VERSION, len(cases)) + body)
+    print(f"wrote {args.out} ({8 + len(body)} bytes)")
+    write_sensors(args.sensors_out, args.seed + 1)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
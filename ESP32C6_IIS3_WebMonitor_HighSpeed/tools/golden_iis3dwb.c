@@ -0,0 +1,75 @@
+/*
+ * Host run of the firmware's golden-data check (main/golden.c) on
+ * data/golden/iis3dwb.gld: the recorded and generated IIS3DWB FIFO streams go
+ * through the FIFO decoder (imu_fifo.c), raw-to-g conversion (convert.c), the
+ * dc_block and decimate stages (pipeline.c) and the WebSocket frame encoder
+ * (ws_frame.c), each compared with the expected values golden_gen.py stored next to
+ * the input. host/golden_blob.S embeds the file under the names the firmware
+ * build's EMBED_FILES gives it, so golden_run() runs unchanged.
+ *
+ * The frame check parses the encoded frames with cJSON. Built on host/cjson_stub
+ * (no IDF_PATH), nothing parses, so the "ws_frame" results are reported as skipped
+ * rather than failed; golden.c still logs a warning for each of them.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools golden_iis3dwb && tools/build/golden_iis3dwb
+ *
+ * Prints one line per case/stage and exits non-zero on any mismatch or a bad file.
+ */
+#include "golden.h"
+#include "web_server.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <string.h>
+
+#define GOLDEN_FRAME_STAGE      "/ws_frame"
+
+static bool is_frame_check(const golden_result_t *r)
+{
+    const size_t len = strlen(r->name);
+    const size_t suffix = sizeof(GOLDEN_FRAME_STAGE) - 1;
+    return len >= suffix && strcmp(r->name + len - suffix, GOLDEN_FRAME_STAGE) == 0;
+}
+
+// metrics.c lists the WebSocket clients; there are none here
+size_t web_server_get_ws_clients(web_server_ws_client_t *clients, size_t max_clients)
+{
+    return 0;
+}
+
+int main(void)
+{
+    golden_result_t results[GOLDEN_MAX_RESULTS];
+    size_t count = 0;
+    bool passed = false;
+
+    cJSON *probe = cJSON_Parse("{}");
+    const bool have_cjson = (probe != NULL);
+    cJSON_Delete(probe);
+
+    const esp_err_t ret = golden_run(results, GOLDEN_MAX_RESULTS, &count, &passed);
+    if (ret != ESP_OK) {
+        printf("golden_run: %s\nFAIL\n", esp_err_to_name(ret));
+        return 1;
+    }
+
+    int failed = (count == 0);
+    size_t skipped = 0;
+    printf("%-28s %8s %10s %12s %10s\n", "check", "samples", "mismatch", "max error", "ns/sample");
+    for (size_t i = 0; i < count; i++) {
+        const golden_result_t *r = &results[i];
+        if (!have_cjson && is_frame_check(r)) {
+            printf("%-28s %8lu %10s\n", r->name, (unsigned long)r->samples, "skipped");
+            skipped++;
+            continue;
+        }
+        printf("%-28s %8lu %10lu %12.3g %10.1f%s\n", r->name, (unsigned long)r->samples,
+               (unsigned long)r->mismatches, r->max_error, r->ns_per_sample, r->passed ? "" : "  MISMATCH");
+        failed |= !r->passed;
+    }
+    if (skipped > 0) {
+        printf("%zu frame checks skipped: no cJSON to parse the frames (set IDF_PATH)\n", skipped);
+    }
+    printf("%s\n", failed ? "FAIL" : "OK");
+    return failed;
+}
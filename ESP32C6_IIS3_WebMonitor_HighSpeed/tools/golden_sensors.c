@@ -0,0 +1,196 @@
+/*
+ * Host check of the raw-to-unit conversions in components/imu_sensors against the
+ * vectors in golden/sensors.gld (written by golden_gen.py from the datasheets):
+ *   SCL3300   acceleration in modes 1-4 (6000 / 3000 / 12000 / 12000 LSB/g), angle
+ *             and temperature
+ *   ICM45686  acceleration and angular rate at every full scale the driver takes,
+ *             and temperature
+ *   IIS2MDC   field (1.5 mG/LSB) and temperature
+ * The SCL3300 picks its acceleration kernel in scl3300_set_mode(), which talks to
+ * the part, so that driver runs on the register model in host/sim; the others
+ * convert without a device.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools golden_sensors && (cd tools && build/golden_sensors [file])
+ *
+ * Prints one line per case and exits non-zero on any mismatch or a bad file.
+ */
+#include "scl3300.h"
+#include "icm45686.h"
+#include "iis2mdc.h"
+#include "sensor_sim.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GOLDEN_SENSORS_FILE     "golden/sensors.gld"
+#define GOLDEN_SENSORS_MAGIC    0x53444C47u     // "GLDS"
+#define GOLDEN_SENSORS_VERSION  1
+#define GOLDEN_NAME_LEN         16
+#define GOLDEN_MAX_COUNT        4096
+#define GOLDEN_CS_SCL3300       21
+
+// Layout as in golden_gen.py
+enum { SENSOR_SCL3300 = 1, SENSOR_ICM45686, SENSOR_IIS2MDC };
+enum { QTY_ACCEL = 1, QTY_GYRO, QTY_MAG, QTY_ANGLE, QTY_TEMP };
+
+typedef struct __attribute__((packed)) {
+    char name[GOLDEN_NAME_LEN];
+    uint8_t sensor;
+    uint8_t quantity;
+    uint16_t param;
+    uint16_t count;
+    uint16_t reserved;
+    float rel_tol;
+    float abs_tol;
+} golden_case_t;
+
+static scl3300_t scl;
+static bool scl_ready;
+
+static bool scl_setup(uint16_t mode)
+{
+    if (!scl_ready) {
+        if (sensor_sim_attach_scl3300(GOLDEN_CS_SCL3300) != ESP_OK ||
+            scl3300_init(SPI2_HOST, GOLDEN_CS_SCL3300, &scl) != ESP_OK) {
+            return false;
+        }
+        scl_ready = true;
+    }
+    return mode == 0 || scl3300_set_mode(&scl, (uint8_t)mode) == ESP_OK;
+}
+
+// The driver's output for one raw value; false if the case names no conversion
+static bool convert(const golden_case_t *c, int16_t raw, double *out)
+{
+    float f = 0;
+    switch (c->sensor * 16 + c->quantity) {
+        case SENSOR_SCL3300 * 16 + QTY_ACCEL:
+            scl.data.AccX = raw;
+            *out = scl3300_get_accel_x(&scl);
+            return true;
+        case SENSOR_SCL3300 * 16 + QTY_ANGLE:
+            scl.data.AngX = raw;
+            *out = scl3300_get_angle_x(&scl);
+            return true;
+        case SENSOR_SCL3300 * 16 + QTY_TEMP:
+            scl.data.TEMP = raw;
+            *out = scl3300_get_temp_c(&scl);
+            return true;
+        case SENSOR_ICM45686 * 16 + QTY_ACCEL:
+            *out = icm456xx_accel_to_g(raw, c->param);
+            return true;
+        case SENSOR_ICM45686 * 16 + QTY_GYRO:
+            *out = icm456xx_gyro_to_dps(raw, c->param);
+            return true;
+        case SENSOR_ICM45686 * 16 + QTY_TEMP:
+            *out = icm456xx_temp_to_c(raw);
+            return true;
+        case SENSOR_IIS2MDC * 16 + QTY_MAG: {
+            iis2mdc_raw_magnetometer_t mag = { .x = raw, .y = raw, .z = raw };
+            float y, z;
+            if (iis2mdc_convert_magnetic_raw_to_mg(&mag, &f, &y, &z) != ESP_OK || y != f || z != f) {
+                return false;
+            }
+            *out = f;
+            return true;
+        }
+        case SENSOR_IIS2MDC * 16 + QTY_TEMP:
+            if (iis2mdc_convert_temperature_raw_to_celsius(raw, &f) != ESP_OK) {
+                return false;
+            }
+            *out = f;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static int run_case(FILE *f, const golden_case_t *c, const char *name)
+{
+    static int16_t raw[GOLDEN_MAX_COUNT];
+    static double expected[GOLDEN_MAX_COUNT];
+
+    if (c->count > GOLDEN_MAX_COUNT ||
+        fread(raw, sizeof(raw[0]), c->count, f) != c->count ||
+        fread(expected, sizeof(expected[0]), c->count, f) != c->count) {
+        printf("%-16s truncated\n", name);
+        return -1;
+    }
+    if (c->sensor == SENSOR_SCL3300 && !scl_setup(c->quantity == QTY_ACCEL ? c->param : 0)) {
+        printf("%-16s SCL3300 setup failed\n", name);
+        return -1;
+    }
+
+    int mismatches = 0;
+    double worst = 0;
+    for (uint16_t i = 0; i < c->count; i++) {
+        double got;
+        if (!convert(c, raw[i], &got)) {
+            printf("%-16s no conversion for sensor %u quantity %u\n", name, c->sensor, c->quantity);
+            return -1;
+        }
+        const double err = fabs(got - expected[i]);
+        const double limit = c->abs_tol + c->rel_tol * fabs(expected[i]);
+        if (err > limit || isnan(got)) {
+            if (mismatches++ < 3) {
+                printf("%-16s raw %6d: got %.17g, expected %.17g\n", name, raw[i], got, expected[i]);
+            }
+        }
+        if (fabs(expected[i]) > 0 && err / fabs(expected[i]) > worst) {
+            worst = err / fabs(expected[i]);
+        }
+    }
+    printf("%-16s param %5u  %4u values  worst rel %.2e  %s\n", name, c->param, c->count, worst,
+           mismatches ? "FAIL" : "ok");
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : GOLDEN_SENSORS_FILE;
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    struct __attribute__((packed)) { uint32_t magic; uint16_t version; uint16_t cases; } header;
+    if (fread(&header, sizeof(header), 1, f) != 1 || header.magic != GOLDEN_SENSORS_MAGIC ||
+        header.version != GOLDEN_SENSORS_VERSION) {
+        fprintf(stderr, "%s: not a version %d sensor golden file\n", path, GOLDEN_SENSORS_VERSION);
+        fclose(f);
+        return 1;
+    }
+
+    int failed = 0;
+    for (uint16_t n = 0; n < header.cases; n++) {
+        golden_case_t c;
+        char name[GOLDEN_NAME_LEN + 1] = { 0 };
+        if (fread(&c, sizeof(c), 1, f) != 1) {
+            fprintf(stderr, "%s: truncated at case %u\n", path, n);
+            failed++;
+            break;
+        }
+        memcpy(name, c.name, GOLDEN_NAME_LEN);
+        const int r = run_case(f, &c, name);
+        if (r != 0) {
+            failed++;
+        }
+        if (r < 0) {
+            break;
+        }
+    }
+    fclose(f);
+
+    sensor_sim_errors_t errors;
+    sensor_sim_get_errors(&errors);
+    if (errors.scl3300_crc_errors || errors.scl3300_bad_commands) {
+        printf("SCL3300 model: %lu CRC errors, %lu bad commands\n",
+               (unsigned long)errors.scl3300_crc_errors, (unsigned long)errors.scl3300_bad_commands);
+        failed++;
+    }
+    printf("%s\n", failed ? "FAIL" : "OK");
+    return failed ? 1 : 0;
+}
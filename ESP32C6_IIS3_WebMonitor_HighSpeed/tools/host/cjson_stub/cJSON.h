@@ -0,0 +1,57 @@
+#ifndef HOST_CJSON_STUB_H
+#define HOST_CJSON_STUB_H
+
+// Fallback when no cJSON checkout is found (tools/Makefile, CJSON_DIR): every
+// constructor returns NULL, so JSON export paths take their allocation-failure
+// branch. Point CJSON_DIR at the IDF copy to link the real library instead.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Type bits as in cJSON, so code that builds an item by hand can be tested with the stub
+#define cJSON_Invalid   0
+#define cJSON_False     (1 << 0)
+#define cJSON_True      (1 << 1)
+#define cJSON_NULL      (1 << 2)
+#define cJSON_Number    (1 << 3)
+#define cJSON_String    (1 << 4)
+#define cJSON_Array     (1 << 5)
+#define cJSON_Object    (1 << 6)
+
+typedef struct cJSON {
+    struct cJSON *next;
+    struct cJSON *prev;
+    struct cJSON *child;
+    int type;
+    char *valuestring;
+    int valueint;
+    double valuedouble;
+    char *string;
+} cJSON;
+
+typedef int cJSON_bool;
+
+#define cJSON_ArrayForEach(element, array) \
+    for (element = (array != NULL) ? (array)->child : NULL; element != NULL; element = element->next)
+
+cJSON *cJSON_Parse(const char *value);
+cJSON *cJSON_ParseWithLength(const char *value, size_t length);
+cJSON *cJSON_CreateObject(void);
+cJSON *cJSON_CreateArray(void);
+cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number);
+cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string);
+cJSON *cJSON_AddBoolToObject(cJSON *object, const char *name, cJSON_bool boolean);
+cJSON_bool cJSON_AddItemToObject(cJSON *object, const char *name, cJSON *item);
+cJSON_bool cJSON_AddItemToArray(cJSON *array, cJSON *item);
+cJSON *cJSON_GetObjectItem(const cJSON *object, const char *name);
+int cJSON_GetArraySize(const cJSON *array);
+cJSON_bool cJSON_IsNumber(const cJSON *item);
+cJSON_bool cJSON_IsString(const cJSON *item);
+cJSON_bool cJSON_IsBool(const cJSON *item);
+cJSON_bool cJSON_IsTrue(const cJSON *item);
+cJSON_bool cJSON_IsArray(const cJSON *item);
+char *cJSON_Print(const cJSON *item);
+char *cJSON_PrintUnformatted(const cJSON *item);
+void cJSON_Delete(cJSON *item);
+void cJSON_free(void *object);
+
+#endif // HOST_CJSON_STUB_H
@@ -0,0 +1,24 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include "cJSON.h"
+
+cJSON *cJSON_Parse(const char *value) { (void)value; return NULL; }
+cJSON *cJSON_ParseWithLength(const char *value, size_t length) { (void)value; (void)length; return NULL; }
+cJSON *cJSON_CreateObject(void) { return NULL; }
+cJSON *cJSON_CreateArray(void) { return NULL; }
+cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number) { (void)object; (void)name; (void)number; return NULL; }
+cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string) { (void)object; (void)name; (void)string; return NULL; }
+cJSON *cJSON_AddBoolToObject(cJSON *object, const char *name, cJSON_bool boolean) { (void)object; (void)name; (void)boolean; return NULL; }
+cJSON_bool cJSON_AddItemToObject(cJSON *object, const char *name, cJSON *item) { (void)object; (void)name; (void)item; return 0; }
+cJSON_bool cJSON_AddItemToArray(cJSON *array, cJSON *item) { (void)array; (void)item; return 0; }
+cJSON *cJSON_GetObjectItem(const cJSON *object, const char *name) { (void)object; (void)name; return NULL; }
+int cJSON_GetArraySize(const cJSON *array) { (void)array; return 0; }
+cJSON_bool cJSON_IsNumber(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_Number; }
+cJSON_bool cJSON_IsString(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_String; }
+cJSON_bool cJSON_IsBool(const cJSON *item) { return item != NULL && (item->type & (cJSON_True | cJSON_False)) != 0; }
+cJSON_bool cJSON_IsTrue(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_True; }
+cJSON_bool cJSON_IsArray(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_Array; }
+char *cJSON_Print(const cJSON *item) { (void)item; return NULL; }
+char *cJSON_PrintUnformatted(const cJSON *item) { (void)item; return NULL; }
+void cJSON_Delete(cJSON *item) { (void)item; }
+void cJSON_free(void *object) { free(object); }
@@ -0,0 +1,301 @@
+/*
+ * SPI, I2C and GPIO stubs behind tools/host/include/driver, routed to the simulated
+ * devices registered through host_sim.h.
+ */
+#include "host_sim.h"
+#include "driver/gpio.h"
+#include "driver/i2c_master.h"
+#include "driver/spi_master.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    int cs_pin;
+    host_spi_sim_fn transfer;
+    void *ctx;
+} spi_sim_t;
+
+typedef struct {
+    uint16_t address;
+    host_i2c_write_fn write;
+    host_i2c_read_fn read;
+    void *ctx;
+} i2c_sim_t;
+
+struct host_spi_device {
+    spi_device_interface_config_t config;
+};
+
+struct host_i2c_bus {
+    i2c_master_bus_config_t config;
+};
+
+struct host_i2c_device {
+    i2c_device_config_t config;
+};
+
+static spi_sim_t spi_sims[HOST_SIM_MAX_DEVICES];
+static size_t spi_sim_count;
+static i2c_sim_t i2c_sims[HOST_SIM_MAX_DEVICES];
+static size_t i2c_sim_count;
+static atomic_ullong bus_bytes;
+static uint8_t gpio_levels[GPIO_NUM_MAX];
+
+// ---- Simulation registry ----
+
+esp_err_t host_sim_attach_spi(int cs_pin, host_spi_sim_fn transfer, void *ctx)
+{
+    if (transfer == NULL || spi_sim_count >= HOST_SIM_MAX_DEVICES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    spi_sims[spi_sim_count++] = (spi_sim_t){ .cs_pin = cs_pin, .transfer = transfer, .ctx = ctx };
+    return ESP_OK;
+}
+
+esp_err_t host_sim_attach_i2c(uint16_t address, host_i2c_write_fn write, host_i2c_read_fn read, void *ctx)
+{
+    if (write == NULL || read == NULL || i2c_sim_count >= HOST_SIM_MAX_DEVICES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    i2c_sims[i2c_sim_count++] = (i2c_sim_t){ .address = address, .write = write, .read = read, .ctx = ctx };
+    return ESP_OK;
+}
+
+void host_sim_detach_all(void)
+{
+    spi_sim_count = 0;
+    i2c_sim_count = 0;
+}
+
+uint64_t host_sim_bus_bytes(void)
+{
+    return atomic_load(&bus_bytes);
+}
+
+void host_sim_reset_bus_bytes(void)
+{
+    atomic_store(&bus_bytes, 0);
+}
+
+static const spi_sim_t *find_spi_sim(int cs_pin)
+{
+    for (size_t i = 0; i < spi_sim_count; i++) {
+        if (spi_sims[i].cs_pin == cs_pin) {
+            return &spi_sims[i];
+        }
+    }
+    return NULL;
+}
+
+static const i2c_sim_t *find_i2c_sim(uint16_t address)
+{
+    for (size_t i = 0; i < i2c_sim_count; i++) {
+        if (i2c_sims[i].address == address) {
+            return &i2c_sims[i];
+        }
+    }
+    return NULL;
+}
+
+// ---- SPI ----
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, int dma_chan)
+{
+    return (config != NULL) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host)
+{
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle)
+{
+    if (config == NULL || handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_spi_device *dev = calloc(1, sizeof(*dev));
+    if (dev == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    dev->config = *config;
+    *handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle)
+{
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    if (handle == NULL || trans == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t bytes = (trans->length + 7) / 8;
+    const uint8_t *tx = (trans->flags & SPI_TRANS_USE_TXDATA) ? trans->tx_data : trans->tx_buffer;
+    uint8_t *rx = (trans->flags & SPI_TRANS_USE_RXDATA) ? trans->rx_data : trans->rx_buffer;
+    uint8_t tx_zero[64] = { 0 };
+    uint8_t rx_discard[64];
+
+    if ((tx == NULL || rx == NULL) && bytes > sizeof(tx_zero)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (handle->config.pre_cb != NULL) {
+        handle->config.pre_cb(trans);
+    }
+
+    esp_err_t ret = ESP_OK;
+    const spi_sim_t *sim = find_spi_sim(handle->config.spics_io_num);
+    if (sim != NULL) {
+        ret = sim->transfer(sim->ctx, tx ? tx : tx_zero, rx ? rx : rx_discard, bytes);
+    } else if (rx != NULL) {
+        memset(rx, 0, bytes);
+    }
+    atomic_fetch_add(&bus_bytes, bytes);
+
+    if (handle->config.post_cb != NULL) {
+        handle->config.post_cb(trans);
+    }
+    return ret;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+    return spi_device_transmit(handle, trans);
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, uint32_t wait)
+{
+    return ESP_OK;
+}
+
+void spi_device_release_bus(spi_device_handle_t handle)
+{
+}
+
+// ---- I2C ----
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *config, i2c_master_bus_handle_t *bus)
+{
+    if (config == NULL || bus == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_i2c_bus *b = calloc(1, sizeof(*b));
+    if (b == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    b->config = *config;
+    *bus = b;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus)
+{
+    free(bus);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t *config,
+                                    i2c_master_dev_handle_t *dev)
+{
+    if (bus == NULL || config == NULL || dev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_i2c_device *d = calloc(1, sizeof(*d));
+    if (d == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    d->config = *config;
+    *dev = d;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t dev)
+{
+    free(dev);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t *write_buffer, size_t write_size,
+                              int xfer_timeout_ms)
+{
+    const i2c_sim_t *sim = (dev != NULL) ? find_i2c_sim(dev->config.device_address) : NULL;
+    if (sim == NULL) {
+        return ESP_FAIL;
+    }
+    atomic_fetch_add(&bus_bytes, write_size + 1);   // Address byte included
+    return sim->write(sim->ctx, write_buffer, write_size);
+}
+
+esp_err_t i2c_master_receive(i2c_master_dev_handle_t dev, uint8_t *read_buffer, size_t read_size,
+                             int xfer_timeout_ms)
+{
+    const i2c_sim_t *sim = (dev != NULL) ? find_i2c_sim(dev->config.device_address) : NULL;
+    if (sim == NULL) {
+        return ESP_FAIL;
+    }
+    atomic_fetch_add(&bus_bytes, read_size + 1);
+    return sim->read(sim->ctx, read_buffer, read_size);
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t dev, const uint8_t *write_buffer,
+                                      size_t write_size, uint8_t *read_buffer, size_t read_size,
+                                      int xfer_timeout_ms)
+{
+    esp_err_t ret = i2c_master_transmit(dev, write_buffer, write_size, xfer_timeout_ms);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return i2c_master_receive(dev, read_buffer, read_size, xfer_timeout_ms);
+}
+
+// ---- GPIO ----
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    return (config != NULL) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if (gpio_num < 0 || gpio_num >= GPIO_NUM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpio_levels[gpio_num] = (level != 0);
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    return (gpio_num >= 0 && gpio_num < GPIO_NUM_MAX) ? gpio_levels[gpio_num] : 0;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    return ESP_OK;
+}
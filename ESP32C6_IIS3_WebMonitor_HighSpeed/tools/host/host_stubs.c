@@ -0,0 +1,441 @@
+/*
+ * POSIX implementations behind the headers in tools/host/include. Linked into every
+ * host tool in tools/Makefile; none of this is built into the firmware.
+ */
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_rom_crc.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+bool host_log_verbose = false;
+
+// ---- Time ----
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t boot_ns;
+
+__attribute__((constructor)) static void host_boot(void)
+{
+    boot_ns = mono_ns();
+    host_log_verbose = getenv("HOST_LOG_VERBOSE") != NULL;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)((mono_ns() - boot_ns) / 1000ULL);
+}
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void)
+{
+    return (esp_cpu_cycle_count_t)(mono_ns() - boot_ns);
+}
+
+uint32_t esp_rom_get_cpu_ticks_per_us(void)
+{
+    return 1000;
+}
+
+void esp_rom_delay_us(uint32_t us)
+{
+    const uint64_t end = mono_ns() + (uint64_t)us * 1000ULL;
+    while (mono_ns() < end) {
+    }
+}
+
+static void deadline_after(struct timespec *ts, TickType_t ticks)
+{
+    clock_gettime(CLOCK_REALTIME, ts);
+    const uint64_t ns = (uint64_t)ts->tv_nsec + (uint64_t)ticks * (1000000000ULL / configTICK_RATE_HZ);
+    ts->tv_sec += (time_t)(ns / 1000000000ULL);
+    ts->tv_nsec = (long)(ns % 1000000000ULL);
+}
+
+// ---- Errors, CRC, heap ----
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+        case ESP_OK:                    return "ESP_OK";
+        case ESP_FAIL:                  return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:            return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:       return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE:     return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE:      return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND:         return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED:     return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT:           return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_INVALID_RESPONSE:  return "ESP_ERR_INVALID_RESPONSE";
+        case ESP_ERR_INVALID_CRC:       return "ESP_ERR_INVALID_CRC";
+        case ESP_ERR_INVALID_VERSION:   return "ESP_ERR_INVALID_VERSION";
+        case ESP_ERR_INVALID_MAC:       return "ESP_ERR_INVALID_MAC";
+        case ESP_ERR_NOT_FINISHED:      return "ESP_ERR_NOT_FINISHED";
+        case ESP_ERR_NOT_ALLOWED:       return "ESP_ERR_NOT_ALLOWED";
+        default:                        return "UNKNOWN ERROR";
+    }
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return calloc(n, size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    (void)caps;
+    return 0;
+}
+
+size_t heap_caps_get_total_size(uint32_t caps)
+{
+    (void)caps;
+    return 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    (void)caps;
+    return 0;
+}
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps)
+{
+    (void)caps;
+    memset(info, 0, sizeof(*info));
+}
+
+// ---- Critical sections ----
+
+static pthread_mutex_t critical_lock;
+static pthread_once_t critical_once = PTHREAD_ONCE_INIT;
+
+static void critical_init(void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&critical_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+void host_critical_enter(void)
+{
+    pthread_once(&critical_once, critical_init);
+    pthread_mutex_lock(&critical_lock);
+}
+
+void host_critical_exit(void)
+{
+    pthread_mutex_unlock(&critical_lock);
+}
+
+// ---- Semaphores ----
+
+struct host_sem {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max;
+};
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial)
+{
+    struct host_sem *sem = calloc(1, sizeof(*sem));
+    if (sem == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = initial;
+    sem->max = max;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return xSemaphoreCreateCounting(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    struct timespec deadline;
+    deadline_after(&deadline, ticks);
+    int rc = 0;
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0 && rc == 0) {
+        if (ticks == portMAX_DELAY) {
+            rc = pthread_cond_wait(&sem->cond, &sem->lock);
+        } else if (ticks == 0) {
+            rc = ETIMEDOUT;
+        } else {
+            rc = pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline);
+        }
+    }
+    const bool taken = (sem->count > 0);
+    if (taken) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return taken ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    pthread_mutex_lock(&sem->lock);
+    const bool given = (sem->count < sem->max);
+    if (given) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return given ? pdTRUE : pdFALSE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    if (sem == NULL) {
+        return;
+    }
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+}
+
+// ---- Tasks ----
+
+struct host_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    char name[configMAX_TASK_NAME_LEN];
+    SemaphoreHandle_t notify;
+};
+
+static __thread struct host_task *current_task;
+
+static void *task_entry(void *p)
+{
+    struct host_task *task = p;
+    current_task = task;
+    task->fn(task->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    (void)stack;
+    (void)priority;
+    (void)core;
+    struct host_task *task = calloc(1, sizeof(*task));
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    strncpy(task->name, name ? name : "", sizeof(task->name) - 1);
+    task->notify = xSemaphoreCreateCounting(UINT32_MAX, 0);
+    if (pthread_create(&task->thread, NULL, task_entry, task) != 0) {
+        vSemaphoreDelete(task->notify);
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(task->thread);
+    if (handle != NULL) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t priority, TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    // Only self-deletion is used; other tasks run until the process exits
+    if (task == NULL || task == current_task) {
+        pthread_exit(NULL);
+    }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    if (ticks == 0) {
+        sched_yield();
+        return;
+    }
+    usleep((useconds_t)ticks * (1000000 / configTICK_RATE_HZ));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)((mono_ns() - boot_ns) / (1000000000ULL / configTICK_RATE_HZ));
+}
+
+void vTaskDelayUntil(TickType_t *previous_wake, TickType_t period)
+{
+    *previous_wake += period;
+    const TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(*previous_wake - now) > 0) {
+        vTaskDelay(*previous_wake - now);
+    }
+}
+
+void host_task_yield(void)
+{
+    sched_yield();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return current_task;
+}
+
+char *pcTaskGetName(TaskHandle_t task)
+{
+    static char main_name[] = "main";
+    if (task == NULL) {
+        task = current_task;
+    }
+    return task ? task->name : main_name;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    (void)task;
+    return 0;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *status, UBaseType_t max, configRUN_TIME_COUNTER_TYPE *total)
+{
+    (void)status;
+    (void)max;
+    if (total != NULL) {
+        *total = 0;
+    }
+    return 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    struct host_task *task = current_task;
+    if (task == NULL || xSemaphoreTake(task->notify, ticks) != pdTRUE) {
+        return 0;
+    }
+    uint32_t value = 1;
+    if (clear_on_exit) {
+        while (xSemaphoreTake(task->notify, 0) == pdTRUE) {
+            value++;
+        }
+    }
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    return (task != NULL) ? xSemaphoreGive(task->notify) : pdFAIL;
+}
+
+// ---- Event groups ----
+
+struct host_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+};
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct host_event_group *group = calloc(1, sizeof(*group));
+    if (group != NULL) {
+        pthread_mutex_init(&group->lock, NULL);
+        pthread_cond_init(&group->cond, NULL);
+    }
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    const EventBits_t now = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return now;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks)
+{
+    struct timespec deadline;
+    deadline_after(&deadline, ticks);
+    int rc = 0;
+
+    pthread_mutex_lock(&group->lock);
+    for (;;) {
+        const EventBits_t set = group->bits & bits;
+        if ((wait_for_all && set == bits) || (!wait_for_all && set != 0) || rc != 0) {
+            break;
+        }
+        rc = (ticks == portMAX_DELAY) ? pthread_cond_wait(&group->cond, &group->lock)
+                                      : pthread_cond_timedwait(&group->cond, &group->lock, &deadline);
+    }
+    const EventBits_t result = group->bits;
+    if (clear_on_exit) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+    return result;
+}
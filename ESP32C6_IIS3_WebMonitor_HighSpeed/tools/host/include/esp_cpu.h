@@ -0,0 +1,10 @@
+#ifndef HOST_ESP_CPU_H
+#define HOST_ESP_CPU_H
+
+#include <stdint.h>
+
+// One host "cycle" is a nanosecond; esp_rom_get_cpu_ticks_per_us() returns 1000
+typedef uint32_t esp_cpu_cycle_count_t;
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void);
+
+#endif // HOST_ESP_CPU_H
@@ -0,0 +1,9 @@
+#ifndef HOST_ESP_HTTP_SERVER_H
+#define HOST_ESP_HTTP_SERVER_H
+
+// Host stand-in for ESP-IDF esp_http_server.h: the types web_server.h names. The
+// server itself is not built on the host.
+typedef void *httpd_handle_t;
+typedef struct httpd_req httpd_req_t;
+
+#endif // HOST_ESP_HTTP_SERVER_H
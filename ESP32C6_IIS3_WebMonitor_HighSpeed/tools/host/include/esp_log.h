@@ -0,0 +1,37 @@
+#ifndef HOST_ESP_LOG_H
+#define HOST_ESP_LOG_H
+
+// Host stand-in for ESP-IDF esp_log.h. Errors and warnings go to stderr; info and
+// below are dropped unless host_log_verbose is set, so benchmarks stay quiet.
+#include <stdio.h>
+#include <stdbool.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+extern bool host_log_verbose;
+
+#define HOST_LOG(letter, tag, fmt, ...) \
+    fprintf(stderr, letter " (%s) " fmt "\n", tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, fmt, ...) HOST_LOG("E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) HOST_LOG("W", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) do { if (host_log_verbose) HOST_LOG("I", tag, fmt, ##__VA_ARGS__); } while (0)
+#define ESP_LOGD(tag, fmt, ...) do { if (host_log_verbose) HOST_LOG("D", tag, fmt, ##__VA_ARGS__); } while (0)
+#define ESP_LOGV(tag, fmt, ...) do { if (host_log_verbose) HOST_LOG("V", tag, fmt, ##__VA_ARGS__); } while (0)
+#define ESP_LOG_LEVEL(level, tag, fmt, ...) \
+    do { if ((level) <= ESP_LOG_WARN || host_log_verbose) HOST_LOG("L", tag, fmt, ##__VA_ARGS__); } while (0)
+
+static inline void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    (void)tag;
+    (void)level;
+}
+
+#endif // HOST_ESP_LOG_H
@@ -0,0 +1,39 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+// Host stand-in for the FreeRTOS subset the firmware uses, on POSIX threads.
+// Critical sections take one process-wide recursive lock, which is what disabling
+// interrupts amounts to on the single-core C6.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t StackType_t;
+typedef uint32_t configRUN_TIME_COUNTER_TYPE;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffffu)
+#define configTICK_RATE_HZ      1000
+#define portTICK_PERIOD_MS      (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define configMAX_PRIORITIES    25
+#define configMAX_TASK_NAME_LEN 16
+#define tskNO_AFFINITY          0x7fffffff
+
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+
+void host_critical_enter(void);
+void host_critical_exit(void);
+
+#define portENTER_CRITICAL(mux)     ((void)(mux), host_critical_enter())
+#define portEXIT_CRITICAL(mux)      ((void)(mux), host_critical_exit())
+
+#endif // HOST_FREERTOS_H
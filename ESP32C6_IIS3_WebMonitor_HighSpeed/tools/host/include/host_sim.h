@@ -0,0 +1,26 @@
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+// Attach simulated devices to the host SPI/I2C stubs. Attach before the driver adds
+// its device; the stub looks the simulation up by chip-select pin or I2C address.
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define HOST_SIM_MAX_DEVICES    8
+
+// One full-duplex SPI transaction with chip select held for its whole length
+typedef esp_err_t (*host_spi_sim_fn)(void *ctx, const uint8_t *tx, uint8_t *rx, size_t bytes);
+// I2C write and read phases; a repeated-start register read is a write then a read
+typedef esp_err_t (*host_i2c_write_fn)(void *ctx, const uint8_t *data, size_t len);
+typedef esp_err_t (*host_i2c_read_fn)(void *ctx, uint8_t *data, size_t len);
+
+esp_err_t host_sim_attach_spi(int cs_pin, host_spi_sim_fn transfer, void *ctx);
+esp_err_t host_sim_attach_i2c(uint16_t address, host_i2c_write_fn write, host_i2c_read_fn read, void *ctx);
+void host_sim_detach_all(void);
+
+// Bytes moved through the stubs since the last reset, for bytes-per-sample figures
+uint64_t host_sim_bus_bytes(void);
+void host_sim_reset_bus_bytes(void);
+
+#endif // HOST_SIM_H
@@ -0,0 +1,6 @@
+#ifndef HOST_SDKCONFIG_H
+#define HOST_SDKCONFIG_H
+
+// Host builds select features with -D on the command line (see tools/Makefile)
+
+#endif // HOST_SDKCONFIG_H
@@ -0,0 +1,341 @@
+/*
+ * ICM45686 model: 4-wire SPI register file, the IREG window onto the MREG/SRAM
+ * space, soft reset with RESET_DONE, and UI data registers for accel, gyro and
+ * temperature at the selected full scales (accel 32..2 g, gyro 4000..15.625 dps).
+ * Data follows sensor_sim_state; disabled sensors read the part's invalid value.
+ * The FIFO fills in real time at the accel ODR (gyro ODR with accel off) once it is
+ * enabled in stream or snapshot mode, with 8-, 16- or 20-byte frames as FIFO_CONFIG3
+ * selects; each frame carries the state at the time it is read out.
+ *
+ * Data byte order follows SREG_CTRL like the part's; the driver reads it back after
+ * every reset, so either order works. APEX, the eDMP, FIFO compression and the
+ * watermark interrupt are not modelled.
+ */
+#include "sensor_sim.h"
+#include "host_sim.h"
+#include "esp_timer.h"
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define ICM_REG_COUNT           0x80
+#define ICM_MREG_SIZE           0xB000
+
+#define ICM_ACCEL_DATA_X1       0x00
+#define ICM_GYRO_DATA_X1        0x06
+#define ICM_TEMP_DATA1          0x0C
+#define ICM_PWR_MGMT0           0x10
+#define ICM_FIFO_COUNT_0        0x12
+#define ICM_FIFO_DATA           0x14
+#define ICM_INT1_STATUS0        0x19
+#define ICM_ACCEL_CONFIG0       0x1B
+#define ICM_GYRO_CONFIG0        0x1C
+#define ICM_FIFO_CONFIG0        0x1D
+#define ICM_FIFO_CONFIG2        0x20
+#define ICM_FIFO_CONFIG3        0x21
+#define ICM_WHO_AM_I            0x72
+#define ICM_IREG_ADDR_15_8      0x7C
+#define ICM_IREG_ADDR_7_0       0x7D
+#define ICM_IREG_DATA           0x7E
+#define ICM_REG_MISC2           0x7F
+#define ICM_SREG_CTRL           0xA267
+
+#define ICM_ID                  0xE9
+#define ICM_CONFIG0_DEFAULT     0x06        // Full range, 800 Hz
+#define ICM_RESET_DONE          0x80
+#define ICM_SOFT_RST            0x02
+#define ICM_SREG_BIG_ENDIAN     0x02
+#define ICM_INVALID             INT16_MIN
+#define ICM_LSB_PER_DEGC        128.0
+#define ICM_FIFO_LSB_PER_DEGC   2.0         // One-byte temperature in 8- and 16-byte frames
+#define ICM_FIFO_MODE_BYPASS    0x00
+#define ICM_FIFO_FLUSH          0x80
+#define ICM_FIFO_IF_EN          0x01
+#define ICM_FIFO_ACCEL_EN       0x02
+#define ICM_FIFO_GYRO_EN        0x04
+#define ICM_FIFO_HIRES_EN       0x08
+#define ICM_FIFO_MAX_FRAME      20
+#define ICM_FIFO_EMPTY          0xFF        // Header of a read from an empty FIFO: ext_header set
+
+static uint8_t regs[ICM_REG_COUNT];
+static uint8_t mreg[ICM_MREG_SIZE];
+static uint16_t ireg_addr;
+
+static struct {
+    int64_t start_us;           // When the FIFO was last enabled or flushed
+    uint64_t produced;          // Frames the part has made since start_us
+    uint32_t frames;            // Frames queued
+    uint8_t frame[ICM_FIFO_MAX_FRAME];
+    uint8_t cursor;             // Next byte of frame[] to read, 0 between frames
+} fifo;
+
+// AN-000364: the IREG window stalls the part outside these ranges
+static bool mreg_valid(uint16_t addr)
+{
+    return addr <= 0x23FF || (addr >= 0x4000 && addr <= 0x83FF) || (addr >= 0xA000 && addr < ICM_MREG_SIZE);
+}
+
+static uint8_t mreg_read(void)
+{
+    const uint16_t addr = ireg_addr++;
+    if (!mreg_valid(addr)) {
+        sensor_sim_errors.icm45686_ireg_errors++;
+        return 0;
+    }
+    return mreg[addr];
+}
+
+static void mreg_write(uint8_t value)
+{
+    const uint16_t addr = ireg_addr++;
+    if (!mreg_valid(addr)) {
+        sensor_sim_errors.icm45686_ireg_errors++;
+        return;
+    }
+    mreg[addr] = value;
+}
+
+static void reset(void)
+{
+    memset(regs, 0, sizeof(regs));
+    memset(mreg, 0, sizeof(mreg));
+    regs[ICM_WHO_AM_I] = ICM_ID;
+    regs[ICM_ACCEL_CONFIG0] = ICM_CONFIG0_DEFAULT;
+    regs[ICM_GYRO_CONFIG0] = ICM_CONFIG0_DEFAULT;
+    regs[ICM_INT1_STATUS0] = ICM_RESET_DONE;
+    mreg[ICM_SREG_CTRL] = ICM_SREG_BIG_ENDIAN;
+    ireg_addr = 0;
+    memset(&fifo, 0, sizeof(fifo));
+}
+
+static void put16(uint8_t *out, int16_t value)
+{
+    const bool big_endian = (mreg[ICM_SREG_CTRL] & ICM_SREG_BIG_ENDIAN) != 0;
+    out[big_endian ? 0 : 1] = (uint8_t)((uint16_t)value >> 8);
+    out[big_endian ? 1 : 0] = (uint8_t)((uint16_t)value & 0xFF);
+}
+
+static int16_t quantize(double value, double lsb_per_unit)
+{
+    const long v = lround(value * lsb_per_unit);
+    // The part saturates one LSB short of the invalid marker
+    return (int16_t)((v > INT16_MAX) ? INT16_MAX : (v <= INT16_MIN) ? INT16_MIN + 1 : v);
+}
+
+static bool accel_on(void)
+{
+    return (regs[ICM_PWR_MGMT0] & 0x03) != 0;
+}
+
+static bool gyro_on(void)
+{
+    return ((regs[ICM_PWR_MGMT0] >> 2) & 0x03) != 0;
+}
+
+// Current state at the selected full scales
+static void raw_data(int16_t accel[3], int16_t gyro[3])
+{
+    const uint8_t accel_fs = (regs[ICM_ACCEL_CONFIG0] >> 4) & 0x07;
+    const uint8_t gyro_fs = (regs[ICM_GYRO_CONFIG0] >> 4) & 0x0F;
+    const double accel_lsb = 32768.0 / (32.0 / (double)(1u << accel_fs));
+    const double gyro_lsb = 32768.0 / (4000.0 / (double)(1u << gyro_fs));
+
+    for (int a = 0; a < 3; a++) {
+        accel[a] = accel_on() ? quantize(sensor_sim_state.accel_g[a], accel_lsb) : ICM_INVALID;
+        gyro[a] = gyro_on() ? quantize(sensor_sim_state.gyro_dps[a], gyro_lsb) : ICM_INVALID;
+    }
+}
+
+// Latch the current state into the UI data registers, as a read of them does
+static void sample(void)
+{
+    int16_t accel[3], gyro[3];
+    raw_data(accel, gyro);
+    for (int a = 0; a < 3; a++) {
+        put16(&regs[ICM_ACCEL_DATA_X1 + a * 2], accel[a]);
+        put16(&regs[ICM_GYRO_DATA_X1 + a * 2], gyro[a]);
+    }
+    put16(&regs[ICM_TEMP_DATA1], quantize(sensor_sim_state.temp_c - 25.0, ICM_LSB_PER_DEGC));
+}
+
+static uint8_t fifo_frame_size(void)
+{
+    const uint8_t cfg = regs[ICM_FIFO_CONFIG3];
+    if (cfg & ICM_FIFO_HIRES_EN) {
+        return 20;
+    }
+    return ((cfg & ICM_FIFO_ACCEL_EN) && (cfg & ICM_FIFO_GYRO_EN)) ? 16 : 8;
+}
+
+static bool fifo_running(void)
+{
+    const uint8_t cfg = regs[ICM_FIFO_CONFIG3];
+    return (regs[ICM_FIFO_CONFIG0] >> 6) != ICM_FIFO_MODE_BYPASS && (cfg & ICM_FIFO_IF_EN) &&
+           (cfg & (ICM_FIFO_ACCEL_EN | ICM_FIFO_GYRO_EN | ICM_FIFO_HIRES_EN));
+}
+
+static void fifo_flush(void)
+{
+    fifo.start_us = esp_timer_get_time();
+    fifo.produced = 0;
+    fifo.frames = 0;
+    fifo.cursor = 0;
+}
+
+// Queue the frames made since the last look. A full FIFO drops the oldest frame in
+// stream mode and stops in snapshot mode; frames carry no history, so both keep the
+// count at capacity.
+static void fifo_fill(void)
+{
+    if (!fifo_running()) {
+        return;
+    }
+    const uint8_t odr = (accel_on() ? regs[ICM_ACCEL_CONFIG0] : regs[ICM_GYRO_CONFIG0]) & 0x0F;
+    if (odr < 3) {
+        return;                     // Reserved codes
+    }
+    const uint32_t capacity = (uint32_t)((regs[ICM_FIFO_CONFIG0] & 0x3F) + 1) * 256 / fifo_frame_size();
+    const uint64_t total = (uint64_t)(esp_timer_get_time() - fifo.start_us) * (6400u >> (odr - 3)) / 1000000;
+    const uint64_t made = total - fifo.produced;
+    fifo.produced = total;
+    fifo.frames = (fifo.frames + made > capacity) ? capacity : fifo.frames + (uint32_t)made;
+}
+
+static void fifo_build_frame(void)
+{
+    const uint8_t size = fifo_frame_size();
+    const uint8_t cfg = regs[ICM_FIFO_CONFIG3];
+    const uint16_t tmst = (uint16_t)(esp_timer_get_time() & 0xFFFF);
+    int16_t accel[3], gyro[3];
+    raw_data(accel, gyro);
+
+    memset(fifo.frame, 0, sizeof(fifo.frame));
+    fifo.frame[0] = (uint8_t)(((cfg & ICM_FIFO_ACCEL_EN) ? 0x40 : 0) | ((cfg & ICM_FIFO_GYRO_EN) ? 0x20 : 0) |
+                              ((size == 20) ? 0x10 : 0) | ((size > 8) ? 0x08 : 0));
+    if (size == 8) {
+        const int16_t *data = (cfg & ICM_FIFO_ACCEL_EN) ? accel : gyro;
+        for (int a = 0; a < 3; a++) {
+            put16(&fifo.frame[1 + a * 2], data[a]);
+        }
+        fifo.frame[7] = (uint8_t)quantize(sensor_sim_state.temp_c - 25.0, ICM_FIFO_LSB_PER_DEGC);
+        return;
+    }
+    for (int a = 0; a < 3; a++) {
+        put16(&fifo.frame[1 + a * 2], accel[a]);
+        put16(&fifo.frame[7 + a * 2], gyro[a]);
+    }
+    if (size == 16) {
+        fifo.frame[13] = (uint8_t)quantize(sensor_sim_state.temp_c - 25.0, ICM_FIFO_LSB_PER_DEGC);
+        put16(&fifo.frame[14], (int16_t)tmst);
+    } else {
+        // 20-bit data: the low nibbles in bytes 17..19 stay zero
+        put16(&fifo.frame[13], quantize(sensor_sim_state.temp_c - 25.0, ICM_LSB_PER_DEGC));
+        put16(&fifo.frame[15], (int16_t)tmst);
+    }
+}
+
+static uint8_t fifo_read(void)
+{
+    if (fifo.cursor == 0) {
+        if (fifo.frames == 0) {
+            return ICM_FIFO_EMPTY;
+        }
+        fifo_build_frame();
+    }
+    const uint8_t value = fifo.frame[fifo.cursor++];
+    if (fifo.cursor == fifo_frame_size()) {
+        fifo.cursor = 0;
+        fifo.frames--;
+    }
+    return value;
+}
+
+static uint8_t read_byte(uint8_t reg)
+{
+    if (reg == ICM_IREG_DATA) {
+        return mreg_read();
+    }
+    if (reg == ICM_FIFO_DATA) {
+        return fifo_read();
+    }
+    const uint8_t value = regs[reg];
+    if (reg == ICM_INT1_STATUS0) {
+        regs[reg] = 0;              // Read to clear
+    }
+    return value;
+}
+
+static void write_byte(uint8_t reg, uint8_t value)
+{
+    switch (reg) {
+        case ICM_WHO_AM_I:
+        case ICM_INT1_STATUS0:
+            return;
+        case ICM_IREG_ADDR_15_8:
+            ireg_addr = (uint16_t)((ireg_addr & 0x00FF) | (value << 8));
+            return;
+        case ICM_IREG_ADDR_7_0:
+            ireg_addr = (uint16_t)((ireg_addr & 0xFF00) | value);
+            return;
+        case ICM_IREG_DATA:
+            mreg_write(value);
+            return;
+        case ICM_REG_MISC2:
+            if (value & ICM_SOFT_RST) {
+                reset();            // Completes within the driver's 1 ms wait
+            }
+            return;
+        case ICM_FIFO_CONFIG0:
+        case ICM_FIFO_CONFIG3:
+            regs[reg] = value;
+            fifo_flush();           // The driver disables the FIFO around every change
+            return;
+        case ICM_FIFO_CONFIG2:
+            regs[reg] = value & (uint8_t)~ICM_FIFO_FLUSH;
+            if (value & ICM_FIFO_FLUSH) {
+                fifo_flush();
+            }
+            return;
+        default:
+            regs[reg] = value;
+            return;
+    }
+}
+
+static esp_err_t icm45686_transfer(void *ctx, const uint8_t *tx, uint8_t *rx, size_t bytes)
+{
+    if (bytes == 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const bool read = (tx[0] & 0x80) != 0;
+    uint8_t reg = tx[0] & 0x7F;
+    rx[0] = 0;
+
+    if (read && reg <= ICM_TEMP_DATA1 + 1) {
+        sample();
+    }
+    if (read && (reg == ICM_FIFO_COUNT_0 || reg == ICM_FIFO_COUNT_0 + 1)) {
+        fifo_fill();
+        put16(&regs[ICM_FIFO_COUNT_0], (int16_t)fifo.frames);
+    }
+    for (size_t i = 1; i < bytes; i++) {
+        if (read) {
+            rx[i] = read_byte(reg);
+        } else {
+            write_byte(reg, tx[i]);
+            rx[i] = 0;
+        }
+        // Bursts walk the register file; IREG_DATA stays put and walks the MREG address,
+        // FIFO_DATA stays put and pops bytes
+        if (reg != ICM_IREG_DATA && reg != ICM_FIFO_DATA) {
+            reg = (reg + 1) & (ICM_REG_COUNT - 1);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t sensor_sim_attach_icm45686(int cs_pin)
+{
+    reset();
+    return host_sim_attach_spi(cs_pin, icm45686_transfer, NULL);
+}
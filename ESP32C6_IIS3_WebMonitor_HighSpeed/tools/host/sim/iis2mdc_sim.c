@@ -0,0 +1,105 @@
+/*
+ * IIS2MDC model: I2C register file with auto-increment, continuous and single
+ * measurement modes, 1.5 mG/LSB field and 8 LSB/degC temperature around 25 degC.
+ * The field follows sensor_sim_state.mag_mg.
+ */
+#include "sensor_sim.h"
+#include "host_sim.h"
+#include <math.h>
+#include <string.h>
+
+#define MDC_REG_COUNT       0x80
+#define MDC_WHO_AM_I        0x4F
+#define MDC_CFG_REG_A       0x60
+#define MDC_STATUS          0x67
+#define MDC_OUTX_L          0x68
+#define MDC_TEMP_OUT_L      0x6E
+
+#define MDC_ID              0x40
+#define MDC_CFG_A_DEFAULT   0x03        // Idle
+#define MDC_SOFT_RST        0x20
+#define MDC_MD_MASK         0x03
+#define MDC_MD_CONTINUOUS   0x00
+#define MDC_MD_SINGLE       0x01
+#define MDC_MD_IDLE         0x03
+#define MDC_ZYXDA           0x08
+#define MDC_MG_PER_LSB      1.5
+#define MDC_LSB_PER_DEGC    8.0
+
+static uint8_t regs[MDC_REG_COUNT];
+static uint8_t pointer;
+
+static void put_le16(uint8_t *out, double value)
+{
+    const long v = lround(value);
+    const int16_t s = (int16_t)((v > INT16_MAX) ? INT16_MAX : (v < INT16_MIN) ? INT16_MIN : v);
+    out[0] = (uint8_t)((uint16_t)s & 0xFF);
+    out[1] = (uint8_t)((uint16_t)s >> 8);
+}
+
+static void reset(void)
+{
+    memset(regs, 0, sizeof(regs));
+    regs[MDC_WHO_AM_I] = MDC_ID;
+    regs[MDC_CFG_REG_A] = MDC_CFG_A_DEFAULT;
+}
+
+// A new sample lands whenever the host looks at it while the part is measuring
+static void measure(void)
+{
+    const uint8_t md = regs[MDC_CFG_REG_A] & MDC_MD_MASK;
+    if (md != MDC_MD_CONTINUOUS && md != MDC_MD_SINGLE) {
+        return;
+    }
+    for (int a = 0; a < 3; a++) {
+        put_le16(&regs[MDC_OUTX_L + a * 2], sensor_sim_state.mag_mg[a] / MDC_MG_PER_LSB);
+    }
+    put_le16(&regs[MDC_TEMP_OUT_L], (sensor_sim_state.temp_c - 25.0) * MDC_LSB_PER_DEGC);
+    regs[MDC_STATUS] = MDC_ZYXDA;
+    if (md == MDC_MD_SINGLE) {
+        regs[MDC_CFG_REG_A] = (uint8_t)((regs[MDC_CFG_REG_A] & ~MDC_MD_MASK) | MDC_MD_IDLE);
+    }
+}
+
+static esp_err_t iis2mdc_write(void *ctx, const uint8_t *data, size_t len)
+{
+    if (len == 0) {
+        return ESP_FAIL;    // Address NACK
+    }
+    pointer = data[0] & (MDC_REG_COUNT - 1);
+    for (size_t i = 1; i < len; i++) {
+        const uint8_t reg = pointer;
+        pointer = (pointer + 1) & (MDC_REG_COUNT - 1);
+        if (reg == MDC_WHO_AM_I || reg == MDC_STATUS || (reg >= MDC_OUTX_L && reg <= MDC_TEMP_OUT_L + 1)) {
+            continue;       // Read-only
+        }
+        if (reg == MDC_CFG_REG_A && (data[i] & MDC_SOFT_RST)) {
+            reset();
+            continue;
+        }
+        regs[reg] = data[i];
+    }
+    return ESP_OK;
+}
+
+static esp_err_t iis2mdc_read(void *ctx, uint8_t *data, size_t len)
+{
+    if (pointer >= MDC_STATUS && pointer <= MDC_TEMP_OUT_L) {
+        measure();
+    }
+    for (size_t i = 0; i < len; i++) {
+        data[i] = regs[pointer];
+        if (pointer >= MDC_OUTX_L && pointer <= MDC_OUTX_L + 5) {
+            regs[MDC_STATUS] = 0;   // Reading the outputs clears data-ready
+        }
+        pointer = (pointer + 1) & (MDC_REG_COUNT - 1);
+    }
+    return ESP_OK;
+}
+
+esp_err_t sensor_sim_attach_iis2mdc(uint16_t address)
+{
+    reset();
+    pointer = 0;
+    return host_sim_attach_i2c(address, iis2mdc_write, iis2mdc_read, NULL);
+}
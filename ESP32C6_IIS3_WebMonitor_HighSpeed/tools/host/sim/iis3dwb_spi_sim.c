@@ -0,0 +1,34 @@
+/*
+ * IIS3DWB on the SPI bus: the firmware's register model (main/sensors/iis3dwb_sim.c)
+ * behind the part's SPI framing, bit 7 of the first byte selecting a read. Built with
+ * this project's include paths, since the model speaks stmdev_ctx_t.
+ */
+#include "sensor_sim.h"
+#include "host_sim.h"
+#include "iis3dwb_sim.h"
+
+static stmdev_ctx_t model;
+
+static esp_err_t iis3dwb_transfer(void *ctx, const uint8_t *tx, uint8_t *rx, size_t bytes)
+{
+    if (bytes < 2 || bytes - 1 > UINT16_MAX) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const uint8_t reg = tx[0] & 0x7F;
+    rx[0] = 0;
+    if (tx[0] & 0x80) {
+        model.read_reg(model.handle, reg, &rx[1], (uint16_t)(bytes - 1));
+    } else {
+        model.write_reg(model.handle, reg, &tx[1], (uint16_t)(bytes - 1));
+    }
+    return ESP_OK;
+}
+
+esp_err_t sensor_sim_attach_iis3dwb(int cs_pin)
+{
+    esp_err_t ret = iis3dwb_sim_init(&model);
+    if (ret == ESP_OK) {
+        ret = host_sim_attach_spi(cs_pin, iis3dwb_transfer, NULL);
+    }
+    return ret;
+}
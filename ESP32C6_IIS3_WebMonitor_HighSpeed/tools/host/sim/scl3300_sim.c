@@ -0,0 +1,213 @@
+/*
+ * SCL3300 model: 32-bit SPI frames, MSB first, off-frame protocol (each response
+ * answers the previous command), CRC-8 on both directions, modes 1-4 and angle
+ * outputs. Accelerations and angles follow sensor_sim_state.
+ *
+ * Return status: after a reset the part latches its start-up flags and answers with
+ * RS = 11 until STATUS is read, which then reads 01 ("normal") in later frames.
+ * components/imu_sensors/sensors/scl3300.c never reads STATUS and treats RS = 11 as
+ * the good state, so against this model (as against the part) it sees 11 throughout.
+ */
+#include "sensor_sim.h"
+#include "host_sim.h"
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define SCL_RS_NORMAL       0x1
+#define SCL_RS_ERROR        0x3
+
+// Register addresses (bits [30:26] of a command)
+#define SCL_REG_ACC_X       0x01
+#define SCL_REG_ACC_Y       0x02
+#define SCL_REG_ACC_Z       0x03
+#define SCL_REG_STO         0x04
+#define SCL_REG_TEMP        0x05
+#define SCL_REG_STATUS      0x06
+#define SCL_REG_ERR_FLAG1   0x07
+#define SCL_REG_ERR_FLAG2   0x08
+#define SCL_REG_ANG_X       0x09
+#define SCL_REG_ANG_Y       0x0A
+#define SCL_REG_ANG_Z       0x0B
+#define SCL_REG_ANG_CTRL    0x0C
+#define SCL_REG_MODE        0x0D
+#define SCL_REG_WHOAMI      0x10
+#define SCL_REG_SERIAL1     0x19
+#define SCL_REG_SERIAL2     0x1A
+#define SCL_REG_SELBANK     0x1F
+
+#define SCL_WHOAMI          0x00C1
+#define SCL_ANG_ENABLE      0x001F
+#define SCL_MODE_SW_RESET   0x0020
+#define SCL_MODE_POWER_DOWN 0x0004
+#define SCL_SERIAL          0x0B5A3C1Du
+
+typedef struct {
+    uint8_t mode;           // MODE register bits [1:0]: 0..3 for modes 1..4
+    bool angles_on;
+    bool power_down;
+    uint8_t bank;
+    bool status_latched;
+    uint32_t pending;       // Response shifted out with the next frame
+} scl_sim_t;
+
+static scl_sim_t scl;
+
+// Datasheet CRC-8 (poly 0x1D, init 0xFF, inverted) over the top three bytes
+static uint8_t frame_crc(uint32_t frame)
+{
+    uint8_t crc = 0xFF;
+    for (int shift = 24; shift >= 8; shift -= 8) {
+        crc ^= (uint8_t)(frame >> shift);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x1D) : (uint8_t)(crc << 1);
+        }
+    }
+    return (uint8_t)~crc;
+}
+
+static int16_t saturate(double value)
+{
+    const long v = lround(value);
+    return (int16_t)((v > INT16_MAX) ? INT16_MAX : (v < INT16_MIN) ? INT16_MIN : v);
+}
+
+static int16_t accel_raw(int axis)
+{
+    static const double lsb_per_g[4] = { 6000.0, 3000.0, 12000.0, 12000.0 };
+    return saturate(sensor_sim_state.accel_g[axis] * lsb_per_g[scl.mode]);
+}
+
+// The part's inclination: each axis against the plane of the other two
+static int16_t angle_raw(int axis)
+{
+    if (!scl.angles_on) {
+        return 0;
+    }
+    const double a = sensor_sim_state.accel_g[axis];
+    const double b = sensor_sim_state.accel_g[(axis + 1) % 3];
+    const double c = sensor_sim_state.accel_g[(axis + 2) % 3];
+    const double deg = atan2(a, sqrt(b * b + c * c)) * 180.0 / M_PI;
+    return saturate(deg / 90.0 * 16384.0);
+}
+
+static void reset(void)
+{
+    const uint32_t pending = scl.pending;
+    memset(&scl, 0, sizeof(scl));
+    scl.status_latched = true;
+    scl.pending = pending;
+}
+
+static bool read_reg(uint8_t addr, uint16_t *data)
+{
+    if (scl.bank == 1) {
+        switch (addr) {
+            case SCL_REG_SERIAL1: *data = (uint16_t)(SCL_SERIAL & 0xFFFF); return true;
+            case SCL_REG_SERIAL2: *data = (uint16_t)(SCL_SERIAL >> 16); return true;
+            case SCL_REG_SELBANK: *data = scl.bank; return true;
+            default: return false;
+        }
+    }
+    switch (addr) {
+        case SCL_REG_ACC_X:
+        case SCL_REG_ACC_Y:
+        case SCL_REG_ACC_Z:
+            *data = (uint16_t)accel_raw(addr - SCL_REG_ACC_X);
+            return true;
+        case SCL_REG_ANG_X:
+        case SCL_REG_ANG_Y:
+        case SCL_REG_ANG_Z:
+            *data = (uint16_t)angle_raw(addr - SCL_REG_ANG_X);
+            return true;
+        case SCL_REG_TEMP:
+            *data = (uint16_t)saturate((sensor_sim_state.temp_c + 273.0) * 18.9);
+            return true;
+        case SCL_REG_STATUS:
+            *data = 0;
+            scl.status_latched = false;
+            return true;
+        case SCL_REG_STO:
+        case SCL_REG_ERR_FLAG1:
+        case SCL_REG_ERR_FLAG2:
+            *data = 0;
+            return true;
+        case SCL_REG_MODE:
+            *data = (uint16_t)(scl.mode | (scl.power_down ? SCL_MODE_POWER_DOWN : 0));
+            return true;
+        case SCL_REG_WHOAMI:
+            *data = SCL_WHOAMI;
+            return true;
+        case SCL_REG_SELBANK:
+            *data = scl.bank;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool write_reg(uint8_t addr, uint16_t data)
+{
+    switch (addr) {
+        case SCL_REG_MODE:
+            if (data & SCL_MODE_SW_RESET) {
+                reset();
+            } else {
+                scl.power_down = (data & SCL_MODE_POWER_DOWN) != 0;
+                scl.mode = (uint8_t)(data & 0x03);
+            }
+            return true;
+        case SCL_REG_ANG_CTRL:
+            scl.angles_on = (data == SCL_ANG_ENABLE);
+            return true;
+        case SCL_REG_SELBANK:
+            scl.bank = (uint8_t)(data & 0x01);
+            return true;
+        default:
+            return false;
+    }
+}
+
+static uint32_t execute(uint32_t cmd)
+{
+    const uint8_t op = (uint8_t)(cmd >> 24);
+    const bool write = (op & 0x80) != 0;
+    const uint8_t addr = (op >> 2) & 0x1F;
+    uint16_t data = (uint16_t)(cmd >> 8);
+
+    // The driver's NOP (an all-zero frame) only clocks out the previous answer
+    const bool nop = (cmd == 0);
+    if (!nop && frame_crc(cmd) != (uint8_t)cmd) {
+        sensor_sim_errors.scl3300_crc_errors++;
+    }
+    if (!nop && !(write ? write_reg(addr, data) : read_reg(addr, &data))) {
+        sensor_sim_errors.scl3300_bad_commands++;
+        data = 0;
+    }
+
+    const uint8_t rs = scl.status_latched ? SCL_RS_ERROR : SCL_RS_NORMAL;
+    const uint32_t resp = ((uint32_t)(op & 0xFC) | rs) << 24 | (uint32_t)data << 8;
+    return resp | frame_crc(resp);
+}
+
+static esp_err_t scl3300_transfer(void *ctx, const uint8_t *tx, uint8_t *rx, size_t bytes)
+{
+    if (bytes != 4) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const uint32_t cmd = (uint32_t)tx[0] << 24 | (uint32_t)tx[1] << 16 | (uint32_t)tx[2] << 8 | tx[3];
+    const uint32_t out = scl.pending;
+    rx[0] = (uint8_t)(out >> 24);
+    rx[1] = (uint8_t)(out >> 16);
+    rx[2] = (uint8_t)(out >> 8);
+    rx[3] = (uint8_t)out;
+    scl.pending = execute(cmd);
+    return ESP_OK;
+}
+
+esp_err_t sensor_sim_attach_scl3300(int cs_pin)
+{
+    memset(&scl, 0, sizeof(scl));
+    reset();
+    return host_sim_attach_spi(cs_pin, scl3300_transfer, NULL);
+}
@@ -0,0 +1,30 @@
+/*
+ * Board state shared by the sensor models in tools/host/sim.
+ */
+#include "sensor_sim.h"
+#include <string.h>
+
+// A board lying slightly tilted on a bench, turning slowly, in the Earth's field
+sensor_sim_state_t sensor_sim_state = {
+    .accel_g = { 0.12f, -0.25f, 0.96f },
+    .gyro_dps = { 1.5f, -12.0f, 30.0f },
+    .mag_mg = { 210.0f, -45.0f, 420.0f },
+    .temp_c = 27.5f,
+};
+
+sensor_sim_errors_t sensor_sim_errors;
+
+void sensor_sim_set_state(const sensor_sim_state_t *state)
+{
+    sensor_sim_state = *state;
+}
+
+void sensor_sim_get_state(sensor_sim_state_t *state)
+{
+    *state = sensor_sim_state;
+}
+
+void sensor_sim_get_errors(sensor_sim_errors_t *errors)
+{
+    *errors = sensor_sim_errors;
+}
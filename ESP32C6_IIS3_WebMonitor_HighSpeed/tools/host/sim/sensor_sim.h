@@ -0,0 +1,44 @@
+#ifndef SENSOR_SIM_H
+#define SENSOR_SIM_H
+
+// Register-level models of the four sensors on the WebMonitor boards, attached to the
+// host SPI/I2C stubs (host_sim.h). Each model speaks its part's wire protocol, so the
+// unmodified drivers in components/imu_sensors and main/sensors run against them.
+//
+// The SCL3300, IIS2MDC and ICM45686 models report one shared board state (below),
+// quantized to each part's LSB. The IIS3DWB model is main/sensors/iis3dwb_sim.c
+// behind an SPI front end: it keeps its own tone-plus-noise signal and time-driven
+// FIFO, the same one the firmware uses with CONFIG_IMU_TEST_SIMULATED_IIS3DWB.
+#include "esp_err.h"
+#include <stdint.h>
+
+// Physical state of the simulated board
+typedef struct {
+    float accel_g[3];       // SCL3300 and ICM45686 acceleration
+    float gyro_dps[3];      // ICM45686 angular rate
+    float mag_mg[3];        // IIS2MDC field
+    float temp_c;           // Die temperature of every part
+} sensor_sim_state_t;
+
+// Protocol errors seen by the models; a driver talking to them correctly leaves all zero
+typedef struct {
+    uint32_t scl3300_crc_errors;    // Command frames whose CRC did not match
+    uint32_t scl3300_bad_commands;  // Reads or writes of addresses the part does not have
+    uint32_t icm45686_ireg_errors;  // Indirect accesses outside the valid MREG ranges
+} sensor_sim_errors_t;
+
+void sensor_sim_set_state(const sensor_sim_state_t *state);
+void sensor_sim_get_state(sensor_sim_state_t *state);
+void sensor_sim_get_errors(sensor_sim_errors_t *errors);
+
+// Attach one model each; call before the driver adds its device
+esp_err_t sensor_sim_attach_scl3300(int cs_pin);
+esp_err_t sensor_sim_attach_icm45686(int cs_pin);
+esp_err_t sensor_sim_attach_iis2mdc(uint16_t address);
+esp_err_t sensor_sim_attach_iis3dwb(int cs_pin);
+
+// Private to the models: the shared state and error counters
+extern sensor_sim_state_t sensor_sim_state;
+extern sensor_sim_errors_t sensor_sim_errors;
+
+#endif // SENSOR_SIM_H
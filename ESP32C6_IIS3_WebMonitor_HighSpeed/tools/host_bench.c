@@ -0,0 +1,376 @@
+/*
+ * Host benchmark for the firmware hot paths, built against the ESP-IDF stubs in
+ * tools/host. It is the host counterpart of POST /api/bench (main/bench.c): the cases
+ * that exist on both sides use the same seeded corpus, so their checksums must match
+ * the device's, and every case reports ns/sample, best ns/sample and bytes/s.
+ *
+ *   raw_to_g, raw_to_g_kernel, lsb_scale   main/imu_fifo.c, main/convert.c, pipeline.h
+ *   fifo_decode                            imu_manager_decode_fifo()
+ *   ws_frame_encode                        main/ws_frame.c (the WebSocket JSON builder)
+ *   hist_record                            main/hist.c
+ *   buffer_add, buffer_get_range,
+ *   buffer_get_columns, buffer_export_json main/data_buffer.c
+ *   ble_frame_build, scl3300_crc,
+ *   icm_parse_fifo                         host_bench_sensors.c
+ *
+ * Build and run from the project directory:
+ *   make -C tools host_bench
+ *   tools/build/host_bench [--iterations N] [--json results.json] [--filter name]
+ *
+ * --json writes the results in the /api/bench response shape (plus "host": true), so
+ * host and device runs, or runs of two builds, can be diffed with the same script.
+ * Timings depend on the host; compare runs from the same machine only.
+ */
+#include "host_bench.h"
+#include "bench.h"
+#include "convert.h"
+#include "data_buffer.h"
+#include "hist.h"
+#include "imu_manager.h"
+#include "mem_arena.h"
+#include "pipeline.h"
+#include "ws_frame.h"
+#include "sensors/iis3dwb_reg.h"
+#include "esp_rom_crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HOST_BENCH_ITERATIONS       2000
+#define HOST_BENCH_MAX_CASES        24
+#define BENCH_FIFO_ENTRIES          IMU_MANAGER_MAX_SAMPLES
+#define BENCH_FIFO_OTHER_EVERY      8       // As main/bench.c
+#define BENCH_CONVERT_SAMPLES       IMU_MANAGER_MAX_SAMPLES
+#define BENCH_ADD_SAMPLES           64
+#define BENCH_RANGE_SAMPLES         64
+#define BENCH_COLUMN_SAMPLES        256
+#define BENCH_EXPORT_SAMPLES        32
+#define BENCH_TEXT_SIZE             8192
+
+static uint8_t fifo_corpus[BENCH_FIFO_ENTRIES * IMU_MANAGER_FIFO_ENTRY_BYTES];
+static int16_t xyz_corpus[WS_FRAME_MAX_SAMPLES * 3];
+static imu_data_t add_corpus[BENCH_ADD_SAMPLES];
+static int16_t xyz_out[BENCH_COLUMN_SAMPLES * 3];
+static float g_out[BENCH_CONVERT_SAMPLES * 3];
+static char text_out[BENCH_TEXT_SIZE];
+static size_t text_len;
+static imu_data_t range_out[BENCH_RANGE_SAMPLES];
+static hist_t hist;
+static uint64_t add_timestamp_us;
+
+// Same generator and order as main/bench.c build_corpora()
+static bool setup_corpora(void)
+{
+    uint32_t state = HOST_BENCH_SEED;
+    for (uint32_t i = 0; i < BENCH_FIFO_ENTRIES; i++) {
+        uint8_t *entry = &fifo_corpus[i * IMU_MANAGER_FIFO_ENTRY_BYTES];
+        const uint8_t tag = ((i % BENCH_FIFO_OTHER_EVERY) == BENCH_FIFO_OTHER_EVERY - 1)
+                                ? IIS3DWB_TIMESTAMP_TAG
+                                : IIS3DWB_XL_TAG;
+        entry[0] = (uint8_t)((tag << 3) | ((i & 0x3u) << 1));
+        for (int b = 1; b < IMU_MANAGER_FIFO_ENTRY_BYTES; b++) {
+            entry[b] = (uint8_t)host_bench_lcg(&state);
+        }
+    }
+    for (uint32_t i = 0; i < WS_FRAME_MAX_SAMPLES * 3; i++) {
+        xyz_corpus[i] = (int16_t)host_bench_lcg(&state);
+    }
+    return true;
+}
+
+static bool setup_buffer(void)
+{
+    static bool ready;
+    if (ready) {
+        return true;
+    }
+    if (mem_arena_init() != ESP_OK || data_buffer_init() != ESP_OK) {
+        return false;
+    }
+    for (uint32_t i = 0; i < BENCH_ADD_SAMPLES; i++) {
+        imu_data_t *d = &add_corpus[i];
+        memset(d, 0, sizeof(*d));
+        d->accelerometer.x_g = imu_manager_raw_to_g(xyz_corpus[i * 3 + 0], IMU_MANAGER_FS_16G);
+        d->accelerometer.y_g = imu_manager_raw_to_g(xyz_corpus[i * 3 + 1], IMU_MANAGER_FS_16G);
+        d->accelerometer.z_g = imu_manager_raw_to_g(xyz_corpus[i * 3 + 2], IMU_MANAGER_FS_16G);
+        d->accelerometer.valid = true;
+        d->stats.fifo_level = (uint16_t)(i * 7);
+        d->stats.samples_read = 64;
+        d->stats.odr_hz = 26667.0f;
+    }
+    // Fill the ring so the read cases see a full buffer, as they would after boot
+    for (uint32_t i = 0; i < DATA_BUFFER_SIZE; i += BENCH_ADD_SAMPLES) {
+        for (uint32_t k = 0; k < BENCH_ADD_SAMPLES; k++) {
+            add_corpus[k].timestamp_us = (add_timestamp_us += 2400);
+            data_buffer_add(&add_corpus[k]);
+        }
+    }
+    ready = data_buffer_is_full();
+    return ready;
+}
+
+static bool setup_export(void)
+{
+    // Needs the real cJSON (IDF_PATH); with the stub in tools/host nothing is printed
+    text_out[0] = '\0';
+    return setup_buffer() && data_buffer_export_json(text_out, sizeof(text_out), BENCH_EXPORT_SAMPLES) == ESP_OK &&
+           text_out[0] != '\0';
+}
+
+static size_t run_raw_to_g(void)
+{
+    for (uint32_t i = 0; i < BENCH_CONVERT_SAMPLES * 3; i++) {
+        g_out[i] = imu_manager_raw_to_g(xyz_corpus[i], IMU_MANAGER_FS_16G);
+    }
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(int16_t);
+}
+
+static size_t run_raw_to_g_kernel(void)
+{
+    convert_get_kernel(IMU_MANAGER_FS_16G)(xyz_corpus, g_out, BENCH_CONVERT_SAMPLES * 3);
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(int16_t);
+}
+
+static size_t run_lsb_scale(void)
+{
+    const float lsb_to_g = pipeline_lsb_to_g(IMU_MANAGER_FS_16G);
+    for (uint32_t i = 0; i < BENCH_CONVERT_SAMPLES * 3; i++) {
+        g_out[i] = xyz_corpus[i] * lsb_to_g;
+    }
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(int16_t);
+}
+
+static size_t run_fifo_decode(void)
+{
+    imu_manager_decode_fifo(fifo_corpus, BENCH_FIFO_ENTRIES, xyz_out, BENCH_FIFO_ENTRIES);
+    return BENCH_FIFO_ENTRIES * IMU_MANAGER_FIFO_ENTRY_BYTES;
+}
+
+static size_t run_ws_frame(void)
+{
+    const ws_frame_t frame = {
+        .seq = 4242,
+        .timestamp_us = 123456789ULL,
+        .xyz = xyz_corpus,
+        .count = WS_FRAME_MAX_SAMPLES,
+        .lsb_to_g = pipeline_lsb_to_g(IMU_MANAGER_FS_16G),
+        .full_scale_g = IMU_MANAGER_FS_16G,
+        .fifo_level = 120,
+        .batch = 64,
+        .sensor_sps = 26667.0f,
+        .points_per_s = 6700.0f,
+        .msgs_per_s = 67.0f,
+        .missed = 0,
+    };
+    const int n = ws_frame_encode(text_out, WS_FRAME_BUFFER_SIZE, &frame);
+    text_len = (n > 0) ? (size_t)n : 0;
+    return text_len;
+}
+
+static size_t run_hist_record(void)
+{
+    hist_reset(&hist);
+    for (uint32_t i = 0; i < BENCH_CONVERT_SAMPLES * 3; i++) {
+        // Latency-like spread: 0 .. 2^22 us
+        hist_record(&hist, (uint32_t)(uint16_t)xyz_corpus[i] << (i % 7));
+    }
+    return BENCH_CONVERT_SAMPLES * 3 * sizeof(uint32_t);
+}
+
+static size_t run_buffer_add(void)
+{
+    for (uint32_t i = 0; i < BENCH_ADD_SAMPLES; i++) {
+        add_corpus[i].timestamp_us = (add_timestamp_us += 2400);
+        data_buffer_add(&add_corpus[i]);
+    }
+    return BENCH_ADD_SAMPLES * sizeof(imu_data_t);
+}
+
+static size_t run_buffer_range(void)
+{
+    return (data_buffer_get_range(range_out, 0, BENCH_RANGE_SAMPLES) == ESP_OK)
+               ? BENCH_RANGE_SAMPLES * sizeof(imu_data_t)
+               : 0;
+}
+
+static size_t run_buffer_columns(void)
+{
+    const uint32_t n = data_buffer_get_accel_columns(&xyz_out[0], &xyz_out[BENCH_COLUMN_SAMPLES],
+                                                     &xyz_out[BENCH_COLUMN_SAMPLES * 2], 0,
+                                                     BENCH_COLUMN_SAMPLES);
+    return n * 3 * sizeof(int16_t);
+}
+
+static size_t run_buffer_export(void)
+{
+    if (data_buffer_export_json(text_out, BENCH_TEXT_SIZE, BENCH_EXPORT_SAMPLES) != ESP_OK) {
+        return 0;
+    }
+    return strlen(text_out);
+}
+
+static const void *output_g(size_t *len)
+{
+    *len = sizeof(g_out);
+    return g_out;
+}
+
+static const void *output_xyz(size_t *len)
+{
+    *len = BENCH_FIFO_ENTRIES * 3 * sizeof(int16_t);
+    return xyz_out;
+}
+
+static const void *output_text(size_t *len)
+{
+    *len = text_len;
+    return text_out;
+}
+
+static const void *output_hist(size_t *len)
+{
+    *len = sizeof(hist.counts);
+    return hist.counts;
+}
+
+static const host_bench_case_t core_cases[] = {
+    { "raw_to_g",           BENCH_CONVERT_SAMPLES,  setup_corpora, run_raw_to_g,        output_g },
+    { "raw_to_g_kernel",    BENCH_CONVERT_SAMPLES,  setup_corpora, run_raw_to_g_kernel, output_g },
+    { "lsb_scale",          BENCH_CONVERT_SAMPLES,  setup_corpora, run_lsb_scale,       output_g },
+    { "fifo_decode",        BENCH_FIFO_ENTRIES,     setup_corpora, run_fifo_decode,     output_xyz },
+    { "ws_frame_encode",    WS_FRAME_MAX_SAMPLES,   setup_corpora, run_ws_frame,        output_text },
+    { "hist_record",        BENCH_CONVERT_SAMPLES * 3, setup_corpora, run_hist_record, output_hist },
+    { "buffer_add",         BENCH_ADD_SAMPLES,      setup_buffer,  run_buffer_add,      NULL },
+    { "buffer_get_range",   BENCH_RANGE_SAMPLES,    setup_buffer,  run_buffer_range,    NULL },
+    { "buffer_get_columns", BENCH_COLUMN_SAMPLES,   setup_buffer,  run_buffer_columns,  NULL },
+    { "buffer_export_json", BENCH_EXPORT_SAMPLES,   setup_export,  run_buffer_export,   NULL },
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void run_case(const host_bench_case_t *c, uint32_t iterations, bench_result_t *r)
+{
+    memset(r, 0, sizeof(*r));
+    r->name = c->name;
+    r->samples = c->samples;
+    if (c->setup != NULL && !c->setup()) {
+        r->skipped = true;
+        return;
+    }
+
+    uint64_t total_ns = 0;
+    uint64_t best_ns = UINT64_MAX;
+    size_t bytes = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        const uint64_t start = now_ns();
+        bytes = c->run();
+        const uint64_t elapsed = now_ns() - start;
+        total_ns += elapsed;
+        if (elapsed < best_ns) {
+            best_ns = elapsed;
+        }
+    }
+
+    r->iterations = iterations;
+    r->bytes = (uint32_t)bytes;
+    r->ns_per_sample = (float)total_ns / ((float)iterations * (float)c->samples);
+    r->best_ns_per_sample = (float)best_ns / (float)c->samples;
+    r->bytes_per_s = (total_ns > 0) ? (float)bytes * (float)iterations * 1e9f / (float)total_ns : 0.0f;
+    if (c->output != NULL) {
+        size_t len = 0;
+        const void *out = c->output(&len);
+        r->checksum = esp_rom_crc32_le(0, (const uint8_t *)out, (uint32_t)len);
+    }
+}
+
+static int write_json(const char *path, uint32_t iterations, const bench_result_t *results, size_t count)
+{
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    fprintf(f, "{\"host\":true,\"seed\":%u,\"iterations\":%u,\"results\":[", HOST_BENCH_SEED, iterations);
+    for (size_t i = 0; i < count; i++) {
+        const bench_result_t *r = &results[i];
+        fprintf(f, "%s{\"name\":\"%s\",\"skipped\":%s,\"iterations\":%u,\"samples\":%u,\"bytes\":%u,"
+                   "\"ns_per_sample\":%.1f,\"best_ns_per_sample\":%.1f,\"bytes_per_s\":%.0f,\"checksum\":\"%08x\"}",
+                (i > 0) ? "," : "", r->name, r->skipped ? "true" : "false", r->iterations, r->samples,
+                r->bytes, r->ns_per_sample, r->best_ns_per_sample, r->bytes_per_s, r->checksum);
+    }
+    fprintf(f, "]}\n");
+    return fclose(f);
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--iterations N] [--json FILE] [--filter NAME]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iterations = HOST_BENCH_ITERATIONS;
+    const char *json_path = NULL;
+    const char *filter = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (iterations == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    const host_bench_case_t *all[HOST_BENCH_MAX_CASES];
+    size_t case_count = 0;
+    for (size_t i = 0; i < sizeof(core_cases) / sizeof(core_cases[0]); i++) {
+        all[case_count++] = &core_cases[i];
+    }
+    size_t sensor_count = 0;
+    const host_bench_case_t *sensor_cases = host_bench_sensor_cases(&sensor_count);
+    for (size_t i = 0; i < sensor_count && case_count < HOST_BENCH_MAX_CASES; i++) {
+        all[case_count++] = &sensor_cases[i];
+    }
+
+    setup_corpora();
+    static bench_result_t results[HOST_BENCH_MAX_CASES];
+    size_t count = 0;
+    printf("%-20s %12s %12s %14s %10s\n", "case", "ns/sample", "best", "bytes/s", "checksum");
+    for (size_t i = 0; i < case_count; i++) {
+        if (filter != NULL && strstr(all[i]->name, filter) == NULL) {
+            continue;
+        }
+        bench_result_t *r = &results[count++];
+        run_case(all[i], iterations, r);
+        if (r->skipped) {
+            printf("%-20s %12s\n", r->name, "skipped");
+        } else {
+            char crc[12] = "-";
+            if (all[i]->output != NULL) {
+                snprintf(crc, sizeof(crc), "%08x", r->checksum);
+            }
+            printf("%-20s %12.1f %12.1f %14.0f %10s\n", r->name, r->ns_per_sample, r->best_ns_per_sample,
+                   r->bytes_per_s, crc);
+        }
+    }
+
+    if (json_path != NULL && write_json(json_path, iterations, results, count) != 0) {
+        return 1;
+    }
+    return 0;
+}
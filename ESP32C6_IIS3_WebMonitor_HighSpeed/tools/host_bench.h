@@ -0,0 +1,30 @@
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+// Case table shared by the host_bench translation units. The sensor-driver cases are
+// built in their own unit (host_bench_sensors.c) because the BLEStreamer and
+// HighSpeed projects both have an imu_manager.h with a different imu_data_t.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HOST_BENCH_SEED     0x1D5A3u    // BENCH_CORPUS_SEED, so shared cases hash alike
+
+typedef struct {
+    const char *name;
+    uint32_t samples;               // Samples (or frames, records) per iteration
+    bool (*setup)(void);            // Builds the corpus; false skips the case
+    size_t (*run)(void);            // One iteration; returns the bytes it processed
+    // Output hashed into the checksum; NULL when it is not deterministic
+    const void *(*output)(size_t *len);
+} host_bench_case_t;
+
+static inline uint32_t host_bench_lcg(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+const host_bench_case_t *host_bench_sensor_cases(size_t *count);
+
+#endif // HOST_BENCH_H
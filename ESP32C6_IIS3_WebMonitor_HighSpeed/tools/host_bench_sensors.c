@@ -0,0 +1,184 @@
+/*
+ * host_bench cases for code outside the HighSpeed project: the BLEStreamer frame
+ * encoder and the shared sensor drivers in components/imu_sensors. Built in its own
+ * unit with those projects' include paths (see tools/Makefile).
+ */
+#include "host_bench.h"
+#include "ble_frame.h"
+#include "scl3300.h"
+#include "imu/inv_imu_driver_advanced.h"
+#include <string.h>
+
+#define BLE_BENCH_FRAMES        64
+#define BLE_BENCH_FRAME_SIZE    244     // imu_ble.c producer_task frame buffer
+#define SCL_BENCH_FRAMES        192
+#define ICM_BENCH_FRAMES        64
+#define ICM_BENCH_FRAME_SIZE    16      // Header, accel, gyro, 1-byte temp, timestamp
+#define ICM_BENCH_HEADER        0x68    // accel_bit | gyro_bit | timestamp_bit
+#define ICM_BENCH_OTHER_EVERY   8       // Every 8th frame carries accel only
+
+// The fields of an inv_imu event the parser fills on every frame
+typedef struct {
+    int32_t sensor_mask;
+    int16_t accel[3];
+    int16_t gyro[3];
+    int16_t temperature;
+    uint16_t timestamp_fsync;
+} icm_event_t;
+
+static imu_data_t ble_corpus[BLE_BENCH_FRAMES];
+static uint8_t ble_out[BLE_BENCH_FRAMES * BLE_BENCH_FRAME_SIZE];
+static const imu_ble_config_t ble_cfg = {
+    .enable_iis2mdc = true,
+    .enable_iis3dwb = true,
+    .enable_icm45686 = true,
+    .enable_scl3300 = true,
+};
+
+static uint32_t scl_corpus[SCL_BENCH_FRAMES];
+static uint8_t scl_out[SCL_BENCH_FRAMES];
+
+// Sized like the driver's FIFO mirror, which is what the parser's prototype takes
+static uint8_t icm_corpus[FIFO_MIRRORING_SIZE];
+static icm_event_t icm_out[ICM_BENCH_FRAMES];
+static uint16_t icm_events;
+static inv_imu_device_t icm_dev;
+
+static float corpus_float(uint32_t *state, float span)
+{
+    return ((float)host_bench_lcg(state) / 65535.0f - 0.5f) * span;
+}
+
+static bool setup_ble(void)
+{
+    uint32_t state = HOST_BENCH_SEED;
+    for (uint32_t i = 0; i < BLE_BENCH_FRAMES; i++) {
+        imu_data_t *d = &ble_corpus[i];
+        memset(d, 0, sizeof(*d));
+        d->timestamp_us = 1000000ULL + i * 20000ULL;
+        d->accelerometer.x_g = corpus_float(&state, 4.0f);
+        d->accelerometer.y_g = corpus_float(&state, 4.0f);
+        d->accelerometer.z_g = corpus_float(&state, 4.0f);
+        d->accelerometer.valid = true;
+        d->imu_6axis.accel_x_g = corpus_float(&state, 4.0f);
+        d->imu_6axis.accel_y_g = corpus_float(&state, 4.0f);
+        d->imu_6axis.accel_z_g = corpus_float(&state, 4.0f);
+        d->imu_6axis.gyro_x_dps = corpus_float(&state, 500.0f);
+        d->imu_6axis.gyro_y_dps = corpus_float(&state, 500.0f);
+        d->imu_6axis.gyro_z_dps = corpus_float(&state, 500.0f);
+        d->imu_6axis.temperature_c = 25.0f + corpus_float(&state, 10.0f);
+        d->imu_6axis.valid = true;
+        d->magnetometer.x_mg = corpus_float(&state, 1000.0f);
+        d->magnetometer.y_mg = corpus_float(&state, 1000.0f);
+        d->magnetometer.z_mg = corpus_float(&state, 1000.0f);
+        d->magnetometer.temperature_c = 25.0f + corpus_float(&state, 10.0f);
+        d->magnetometer.valid = true;
+        d->inclinometer.angle_x_deg = corpus_float(&state, 180.0f);
+        d->inclinometer.angle_y_deg = corpus_float(&state, 180.0f);
+        d->inclinometer.angle_z_deg = corpus_float(&state, 180.0f);
+        d->inclinometer.accel_x_g = corpus_float(&state, 2.0f);
+        d->inclinometer.accel_y_g = corpus_float(&state, 2.0f);
+        d->inclinometer.accel_z_g = corpus_float(&state, 2.0f);
+        d->inclinometer.temperature_c = 25.0f + corpus_float(&state, 10.0f);
+        d->inclinometer.valid = true;
+    }
+    return true;
+}
+
+static size_t run_ble_frame(void)
+{
+    size_t bytes = 0;
+    for (uint32_t i = 0; i < BLE_BENCH_FRAMES; i++) {
+        bytes += ble_frame_build(&ble_corpus[i], &ble_cfg, i, &ble_out[i * BLE_BENCH_FRAME_SIZE],
+                                 BLE_BENCH_FRAME_SIZE);
+    }
+    return bytes;
+}
+
+static const void *output_ble(size_t *len)
+{
+    *len = sizeof(ble_out);
+    return ble_out;
+}
+
+static bool setup_scl(void)
+{
+    uint32_t state = HOST_BENCH_SEED;
+    for (uint32_t i = 0; i < SCL_BENCH_FRAMES; i++) {
+        scl_corpus[i] = host_bench_lcg(&state) << 16 | host_bench_lcg(&state);
+    }
+    return true;
+}
+
+static size_t run_scl_crc(void)
+{
+    for (uint32_t i = 0; i < SCL_BENCH_FRAMES; i++) {
+        scl_out[i] = scl3300_calculate_crc(scl_corpus[i]);
+    }
+    return SCL_BENCH_FRAMES * sizeof(uint32_t);
+}
+
+static const void *output_scl(size_t *len)
+{
+    *len = sizeof(scl_out);
+    return scl_out;
+}
+
+static void icm_event_cb(inv_imu_sensor_event_t *event)
+{
+    if (icm_events < ICM_BENCH_FRAMES) {
+        icm_event_t *out = &icm_out[icm_events++];
+        out->sensor_mask = event->sensor_mask;
+        memcpy(out->accel, event->accel, sizeof(out->accel));
+        memcpy(out->gyro, event->gyro, sizeof(out->gyro));
+        out->temperature = event->temperature;
+        out->timestamp_fsync = event->timestamp_fsync;
+    }
+}
+
+static bool setup_icm(void)
+{
+    uint32_t state = HOST_BENCH_SEED;
+    for (uint32_t i = 0; i < ICM_BENCH_FRAMES; i++) {
+        uint8_t *frame = &icm_corpus[i * ICM_BENCH_FRAME_SIZE];
+        frame[0] = ((i % ICM_BENCH_OTHER_EVERY) == ICM_BENCH_OTHER_EVERY - 1) ? 0x48 : ICM_BENCH_HEADER;
+        for (int b = 1; b < ICM_BENCH_FRAME_SIZE; b++) {
+            frame[b] = (uint8_t)host_bench_lcg(&state);
+        }
+    }
+
+    // The state inv_imu_adv_init() and inv_imu_adv_enable_fifo() leave for a 16-byte,
+    // uncompressed, little-endian FIFO; parsing touches no registers
+    memset(&icm_dev, 0, sizeof(icm_dev));
+    icm_dev.fifo_frame_size = ICM_BENCH_FRAME_SIZE;
+    inv_imu_adv_var_t *e = (inv_imu_adv_var_t *)icm_dev.adv_var;
+    e->sensor_event_cb = icm_event_cb;
+    e->fifo_is_used = INV_IMU_ENABLE;
+    e->fifo_comp_en = INV_IMU_DISABLE;
+    return true;
+}
+
+static size_t run_icm_parse(void)
+{
+    icm_events = 0;
+    inv_imu_adv_parse_fifo_data(&icm_dev, icm_corpus, ICM_BENCH_FRAMES);
+    return ICM_BENCH_FRAMES * ICM_BENCH_FRAME_SIZE;
+}
+
+static const void *output_icm(size_t *len)
+{
+    *len = icm_events * sizeof(icm_event_t);
+    return icm_out;
+}
+
+static const host_bench_case_t sensor_cases[] = {
+    { "ble_frame_build",    BLE_BENCH_FRAMES,   setup_ble,  run_ble_frame,  output_ble },
+    { "scl3300_crc",        SCL_BENCH_FRAMES,   setup_scl,  run_scl_crc,    output_scl },
+    { "icm_parse_fifo",     ICM_BENCH_FRAMES,   setup_icm,  run_icm_parse,  output_icm },
+};
+
+const host_bench_case_t *host_bench_sensor_cases(size_t *count)
+{
+    *count = sizeof(sensor_cases) / sizeof(sensor_cases[0]);
+    return sensor_cases;
+}
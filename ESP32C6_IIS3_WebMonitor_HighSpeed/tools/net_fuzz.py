@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+"""Network fuzzer for the HTTP API and the /ws/data WebSocket.
+
+Mutates real request bodies and query strings (fuzz_seeds.json), malformed raw
+HTTP and malformed WebSocket frames, and sends them to a running device. The
+oracle watches the device, not the responses:
+  - crash:  uptime_seconds in /metrics went backwards (the device rebooted)
+  - stall:  imu_samples_total stopped increasing (acquisition blocked)
+  - hang:   the device did not answer within --timeout
+  - slow:   a response took longer than --slow-ms
+Each finding is written to --out as a reproducer with the preceding cases, since
+a reboot is only noticed at the next probe. Runs are deterministic for a given
+--seed. Known-good requests from the seed file's "restore" list are sent at the
+end to put the device back in its normal state.
+
+Example:
+  python3 net_fuzz.py 192.168.1.50 --cases 2000 --seed 1 --out fuzz-findings
+"""
+
+import argparse
+import base64
+import json
+import os
+import random
+import socket
+import struct
+import sys
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+INTERESTING_NUMBERS = [0, -1, 1, 2, 3, 4, 7, 8, 15, 16, 17, 255, 256, 65535, 65536,
+                       2147483647, -2147483648, 4294967295, 1e308, -1e308, 1e-308, 0.5]
+INTERESTING_STRINGS = ["", "a" * 200, "../../etc/passwd", "%s%n%x", "\u0000", "ÿ☃",
+                       "imu", "ws", "decimate", "dc_block", "run1.cap", "/spiffs/x.cap"]
+
+
+class Device:
+    def __init__(self, args):
+        self.host = args.host
+        self.port = args.port
+        self.timeout = args.timeout
+
+    def raw(self, data, read_response=True, half_close=False):
+        """Send raw bytes; return (status, body, seconds) or raise on timeout.
+
+        half_close shuts down the sending side so a truncated request ends at EOF
+        instead of waiting out the server's receive timeout."""
+        start = time.monotonic()
+        with socket.create_connection((self.host, self.port), timeout=self.timeout) as s:
+            s.sendall(data)
+            if half_close:
+                s.shutdown(socket.SHUT_WR)
+            if not read_response:
+                return None, b"", time.monotonic() - start
+            chunks = []
+            try:
+                # Connection: close, so read to EOF; large bodies are cut after 64 KB
+                while sum(len(c) for c in chunks) < 65536:
+                    chunk = s.recv(4096)
+                    if not chunk:
+                        break
+                    chunks.append(chunk)
+            except ConnectionResetError:
+                pass
+        resp = b"".join(chunks)
+        status = None
+        if resp.startswith(b"HTTP/"):
+            try:
+                status = int(resp.split(b" ", 2)[1])
+            except (IndexError, ValueError):
+                pass
+        return status, resp, time.monotonic() - start
+
+    def request(self, method, path, body=b""):
+        head = (f"{method} {path} HTTP/1.1\r\nHost: {self.host}\r\nConnection: close\r\n"
+                f"Content-Length: {len(body)}\r\n\r\n").encode()
+        return self.raw(head + body)
+
+    def metrics(self):
+        status, resp, _ = self.request("GET", "/metrics")
+        if status != 200:
+            return None
+        values = {}
+        for line in resp.split(b"\r\n\r\n", 1)[-1].decode(errors="replace").splitlines():
+            if line and not line.startswith("#"):
+                name, _, value = line.rpartition(" ")
+                try:
+                    values[name] = float(value)
+                except ValueError:
+                    pass
+        return values
+
+
+# --- Mutators --------------------------------------------------------------------
+
+def mutate_value(rng, value, depth=0):
+    choice = rng.random()
+    if isinstance(value, dict) and choice < 0.6 and depth < 4:
+        out = {k: mutate_value(rng, v, depth + 1) if rng.random() < 0.5 else v for k, v in value.items()}
+        if out and rng.random() < 0.2:
+            out.pop(rng.choice(list(out)))
+        if rng.random() < 0.2:
+            out[rng.choice(INTERESTING_STRINGS) or "x"] = rng.choice(INTERESTING_NUMBERS)
+        return out
+    if choice < 0.25:
+        return rng.choice(INTERESTING_NUMBERS)
+    if choice < 0.45:
+        return rng.choice(INTERESTING_STRINGS)
+    if choice < 0.55:
+        return rng.choice([None, True, False, [], {}])
+    if choice < 0.65:
+        return [value] * rng.randint(1, 4)
+    return value
+
+
+def mutate_bytes(rng, data):
+    data = bytearray(data)
+    for _ in range(rng.randint(1, 6)):
+        op = rng.randrange(5)
+        pos = rng.randrange(len(data) + 1)
+        if op == 0 and data:
+            data[min(pos, len(data) - 1)] ^= 1 << rng.randrange(8)
+        elif op == 1:
+            data[pos:pos] = bytes([rng.choice(b'{}[]",:\\0 \x00\xff')])
+        elif op == 2 and data:
+            del data[pos:pos + rng.randint(1, 8)]
+        elif op == 3:
+            data = data[:pos]
+        else:
+            data[pos:pos] = data[pos:pos + rng.randint(1, 16)] * rng.randint(2, 8)
+    return bytes(data)
+
+
+def deep_nesting(rng):
+    depth = rng.choice([9, 32, 100, 180])
+    opener, closer = rng.choice([("[", "]"), ('{"a":', "}")])
+    return (opener * depth + "1" + closer * depth).encode()
+
+
+def gen_post(rng, seeds):
+    path = rng.choice(list(seeds["post"]))
+    seed = rng.choice(seeds["post"][path])
+    kind = rng.random()
+    if kind < 0.45:
+        body = json.dumps(mutate_value(rng, seed)).encode()
+    elif kind < 0.85:
+        body = mutate_bytes(rng, json.dumps(seed).encode())
+    else:
+        body = deep_nesting(rng)
+    return {"kind": "post", "path": path, "body": body.decode("latin-1")}
+
+
+def gen_get(rng, seeds):
+    path = rng.choice(list(seeds["get"]))
+    query = rng.choice(seeds["get"][path])
+    if rng.random() < 0.7:
+        parts = [p.split("=", 1) for p in query.split("&") if p]
+        parts = [[k, str(rng.choice(INTERESTING_NUMBERS + INTERESTING_STRINGS))] if rng.random() < 0.6
+                 else [k, v] for k, v in parts] or [["x", "1"]]
+        query = "&".join(f"{k}={v}" for k, v in parts)
+    if rng.random() < 0.3:
+        query = mutate_bytes(rng, query.encode()).decode("latin-1")
+    query = "".join(c if 0x21 <= ord(c) < 0x7F else "%%%02X" % (ord(c) & 0xFF) for c in query)
+    return {"kind": "get", "path": f"{path}?{query}" if query else path}
+
+
+def gen_raw_http(rng, seeds):
+    path = rng.choice(list(seeds["post"]))
+    body = json.dumps(rng.choice(seeds["post"][path])).encode()
+    variant = rng.randrange(5)
+    if variant == 0:
+        # Declares more body than it sends: the server must time out, not wedge
+        data = (f"POST {path} HTTP/1.1\r\nHost: x\r\nContent-Length: {len(body) + 50}\r\n\r\n").encode() + body
+    elif variant == 1:
+        data = (f"POST {path} HTTP/1.1\r\nHost: x\r\nContent-Length: -5\r\n\r\n").encode() + body
+    elif variant == 2:
+        data = f"GET {path}?{'a' * 2048} HTTP/1.1\r\nHost: x\r\n\r\n".encode()
+    elif variant == 3:
+        data = (f"GET / HTTP/1.1\r\nHost: x\r\nX-Pad: {'b' * 4096}\r\n\r\n").encode()
+    else:
+        data = mutate_bytes(rng, f"GET {path} HTTP/1.1\r\nHost: x\r\n\r\n".encode())
+    return {"kind": "raw", "data": data.decode("latin-1")}
+
+
+def ws_frame(rng):
+    opcode = rng.choice([0x0, 0x1, 0x2, 0x3, 0x8, 0x9, 0xA, 0xB])
+    payload = os.urandom(rng.choice([0, 1, 63, 64, 65, 125, 126, 200, 1000, 70000]))
+    fin = 0x80 if rng.random() < 0.8 else 0
+    masked = rng.random() < 0.85
+    n = len(payload)
+    declared = n if rng.random() < 0.8 else rng.choice([n + 100, 2 ** 31, 2 ** 63 - 1])
+    if declared < 126:
+        header = bytes([fin | opcode, (0x80 if masked else 0) | declared])
+    elif declared < 65536:
+        header = bytes([fin | opcode, (0x80 if masked else 0) | 126]) + struct.pack("!H", declared)
+    else:
+        header = bytes([fin | opcode, (0x80 if masked else 0) | 127]) + struct.pack("!Q", declared)
+    if masked:
+        mask = os.urandom(4)
+        payload = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+        header += mask
+    return header + payload
+
+
+def gen_ws(rng, seeds):
+    key = base64.b64encode(bytes(rng.randrange(256) for _ in range(16))).decode()
+    upgrade = (f"GET /ws/data HTTP/1.1\r\nHost: x\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+               f"Sec-WebSocket-Key: {key}\r\nSec-WebSocket-Version: 13\r\n\r\n").encode()
+    frames = b"".join(ws_frame(rng) for _ in range(rng.randint(1, 4)))
+    return {"kind": "ws", "upgrade": upgrade.decode("latin-1"), "frames": frames.hex()}
+
+
+GENERATORS = {"post": gen_post, "get": gen_get, "raw": gen_raw_http, "ws": gen_ws}
+
+
+def run_case(dev, case):
+    if case["kind"] == "post":
+        return dev.request("POST", case["path"], case["body"].encode("latin-1"))
+    if case["kind"] == "get":
+        return dev.request("GET", case["path"])
+    if case["kind"] == "raw":
+        return dev.raw(case["data"].encode("latin-1"), half_close=True)
+    start = time.monotonic()
+    with socket.create_connection((dev.host, dev.port), timeout=dev.timeout) as s:
+        s.sendall(case["upgrade"].encode("latin-1"))
+        s.recv(1024)
+        try:
+            s.sendall(bytes.fromhex(case["frames"]))
+            time.sleep(0.05)
+        except OSError:
+            pass
+    return 101, b"", time.monotonic() - start
+
+
+# --- Driver ------------------------------------------------------------------------
+
+def save_finding(out_dir, kind, seed, recent, detail):
+    os.makedirs(out_dir, exist_ok=True)
+    name = os.path.join(out_dir, f"{kind}-seed{seed}-{int(time.time())}.json")
+    with open(name, "w") as f:
+        json.dump({"finding": kind, "seed": seed, "detail": detail, "cases": recent}, f, indent=2)
+    return name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--cases", type=int, default=500)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--kinds", default="post,get,raw,ws", help="subset of post,get,raw,ws")
+    parser.add_argument("--seeds", default=os.path.join(HERE, "fuzz_seeds.json"))
+    parser.add_argument("--probe-every", type=int, default=10, help="cases between liveness probes")
+    parser.add_argument("--slow-ms", type=float, default=1000.0)
+    parser.add_argument("--timeout", type=float, default=8.0)
+    parser.add_argument("--out", default="fuzz-findings")
+    parser.add_argument("--replay", help="re-send the cases of a saved finding instead of fuzzing")
+    args = parser.parse_args()
+
+    with open(args.seeds) as f:
+        seeds = json.load(f)
+    dev = Device(args)
+    rng = random.Random(args.seed)
+    kinds = [k for k in args.kinds.split(",") if k in GENERATORS]
+
+    if args.replay:
+        with open(args.replay) as f:
+            cases = json.load(f)["cases"]
+    else:
+        cases = None
+
+    base = dev.metrics()
+    if base is None:
+        print("device did not answer GET /metrics", file=sys.stderr)
+        return 2
+    last_uptime = base.get("uptime_seconds", 0.0)
+    last_samples = base.get("imu_samples_total", 0.0)
+
+    findings = []
+    recent = []
+    statuses = {}
+    total = len(cases) if cases is not None else args.cases
+    for i in range(total):
+        case = cases[i] if cases is not None else GENERATORS[rng.choice(kinds)](rng, seeds)
+        recent = (recent + [case])[-args.probe_every:]
+        try:
+            status, _, seconds = run_case(dev, case)
+            statuses[status] = statuses.get(status, 0) + 1
+            if seconds * 1000.0 > args.slow_ms:
+                findings.append(save_finding(args.out, "slow", args.seed, [case],
+                                             f"{seconds * 1000.0:.0f} ms"))
+        except (socket.timeout, TimeoutError):
+            findings.append(save_finding(args.out, "hang", args.seed, [case], "no response"))
+        except OSError as exc:
+            statuses[type(exc).__name__] = statuses.get(type(exc).__name__, 0) + 1
+
+        if (i + 1) % args.probe_every == 0 or i + 1 == total:
+            time.sleep(0.2)
+            m = None
+            for _ in range(10):
+                try:
+                    m = dev.metrics()
+                except OSError:
+                    m = None
+                if m is not None:
+                    break
+                time.sleep(1.0)
+            if m is None:
+                findings.append(save_finding(args.out, "unreachable", args.seed, recent, "no /metrics"))
+                break
+            uptime = m.get("uptime_seconds", 0.0)
+            samples = m.get("imu_samples_total", 0.0)
+            if uptime < last_uptime:
+                findings.append(save_finding(args.out, "crash", args.seed, recent,
+                                             f"uptime {last_uptime:.0f} -> {uptime:.0f} s"))
+            elif samples <= last_samples:
+                findings.append(save_finding(args.out, "stall", args.seed, recent,
+                                             f"imu_samples_total stuck at {samples:.0f}"))
+            last_uptime, last_samples = uptime, samples
+            print(f"\r{i + 1}/{total} cases, {len(findings)} findings", end="", flush=True)
+
+    for path, body in seeds.get("restore", []):
+        try:
+            dev.request("POST", path, json.dumps(body).encode())
+        except OSError:
+            pass
+
+    print()
+    print("responses: " + ", ".join(f"{k}={v}" for k, v in sorted(statuses.items(), key=str)))
+    for f in findings:
+        print(f"finding: {f}")
+    return 1 if findings else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
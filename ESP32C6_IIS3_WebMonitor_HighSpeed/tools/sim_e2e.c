@@ -0,0 +1,400 @@
+/*
+ * End-to-end host run of the HighSpeed acquisition and live-plot path against the
+ * simulated IIS3DWB, out through a real loopback TCP socket.
+ *
+ *   acquisition  imu_manager_read_all() on main/sensors/iis3dwb_hal.c's SPI path, the
+ *                SPI stub and the register model (tools/host/sim), then
+ *                data_buffer_add(), paced like main.c imu_task
+ *   pipeline     the raw listener, dc_block and decimate stages, into a "ws" ring sink
+ *                connected the way web_server.c connects it, with the decimation
+ *                factor re-applied from another thread as /api/pipeline does
+ *   broadcast    ws_broadcast_task's loop: bcast_ring_read() every 10 ms,
+ *                ws_frame_encode(), then one newline-terminated frame per send() on
+ *                a TCP connection to 127.0.0.1
+ *   client       a thread reading the socket, checking seq and sample accounting
+ *
+ * and reports sample and frame throughput, FIFO overruns, and latency from the last
+ * sample of a frame ("t") and from its hand-off ("tx") to the client having read it.
+ * esp_http_server and the WebSocket handshake and framing are not built on the host:
+ * the socket carries the same JSON text the firmware sends, without the WebSocket
+ * header. The timings are the host's, not the C6's.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools sim_e2e && tools/build/sim_e2e [seconds]
+ *
+ * Exits non-zero if a frame is lost or reordered, the client's sample count does not
+ * match what the ring sink received, or no samples reach the client.
+ */
+#include "imu_manager.h"
+#include "data_buffer.h"
+#include "pipeline.h"
+#include "bcast_ring.h"
+#include "mem_arena.h"
+#include "ws_frame.h"
+#include "web_server.h"
+#include "sensor_sim.h"
+#include "host_sim.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define E2E_SECONDS             3
+#define E2E_MAX_SECONDS         600
+#define E2E_CS_IIS3DWB          19          // imu_manager.c IIS3DWB_SPI_CS
+#define E2E_IMU_PERIOD_MS       2           // main.c imu_task starting delay
+#define E2E_WS_PERIOD_MS        10          // ws_broadcast_task period
+#define E2E_WS_RING_CAPACITY    4096        // web_server.c WS_RING_CAPACITY
+#define E2E_SINK_NAME           "ws"
+#define E2E_MAX_FRAMES          (E2E_MAX_SECONDS * 1000 / E2E_WS_PERIOD_MS)
+#define E2E_LINE_MAX            (WS_FRAME_BUFFER_SIZE + 2)
+
+typedef struct {
+    uint64_t frames;
+    uint64_t bytes;
+    uint64_t samples;           // Sum of "chunk"
+    uint64_t missed;            // Sum of "miss"
+    uint64_t seq_errors;        // Frames whose seq is not the previous one plus one
+    uint64_t malformed;
+    uint32_t latency_count;
+    uint32_t sample_latency_us[E2E_MAX_FRAMES];
+    uint32_t transport_latency_us[E2E_MAX_FRAMES];
+} client_stats_t;
+
+static atomic_bool stop;
+static pipeline_node_id_t ws_sink;
+static bcast_ring_t *ws_ring;
+static bcast_consumer_id_t ws_consumer;
+static uint64_t frames_sent;
+static uint64_t acquired_samples;
+static client_stats_t client;
+
+// ---- Acquisition: main.c imu_task without replay, black box or adaptive pacing ----
+
+static void *imu_thread(void *arg)
+{
+    imu_data_t d;
+    TickType_t last_wake = xTaskGetTickCount();
+    while (!atomic_load(&stop)) {
+        if (imu_manager_read_all(&d) == ESP_OK) {
+            data_buffer_add(&d);
+            acquired_samples += d.stats.samples_read;
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(E2E_IMU_PERIOD_MS));
+    }
+    return NULL;
+}
+
+// ---- Broadcast: web_server.c ws_broadcast_task with a socket for ws_send_to_all() ----
+
+static bool send_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        const ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static void *broadcast_thread(void *arg)
+{
+    const int fd = *(const int *)arg;
+    static int16_t xyz[WS_FRAME_MAX_SAMPLES * 3];
+    static char json[E2E_LINE_MAX];
+    uint32_t seq = 0;
+    TickType_t last_wake = xTaskGetTickCount();
+
+    // One pass after stop so the last samples still go out
+    for (bool last = false; !last;) {
+        last = atomic_load(&stop);
+        bcast_read_info_t info;
+        uint16_t chunk;
+        while ((chunk = bcast_ring_read(ws_ring, ws_consumer, xyz, WS_FRAME_MAX_SAMPLES, &info)) > 0) {
+            const uint64_t now_us = esp_timer_get_time();
+            const ws_frame_t frame = {
+                .seq = seq++,
+                .timestamp_us = info.timestamp_us ? info.timestamp_us : now_us,
+                .sent_us = esp_timer_get_time(),
+                .xyz = xyz,
+                .count = chunk,
+                .lsb_to_g = pipeline_lsb_to_g(info.scale),
+                .full_scale_g = (uint8_t)info.scale,
+                .missed = info.missed,
+            };
+            const int n = ws_frame_encode(json, WS_FRAME_BUFFER_SIZE, &frame);
+            if (n <= 0) {
+                printf("FAIL: ws_frame_encode returned %d for %u samples\n", n, chunk);
+                continue;
+            }
+            json[n] = '\n';
+            if (!send_all(fd, json, (size_t)n + 1)) {
+                printf("FAIL: send\n");
+                return NULL;
+            }
+            frames_sent++;
+            // Like the firmware: one frame per period unless the ring has piled up
+            if (!last && bcast_ring_available(ws_ring, ws_consumer) < WS_FRAME_MAX_SAMPLES) {
+                break;
+            }
+        }
+        if (!last) {
+            vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(E2E_WS_PERIOD_MS));
+        }
+    }
+    shutdown(fd, SHUT_WR);
+    return NULL;
+}
+
+// metrics.c lists the WebSocket clients; here the loopback connection is the one
+size_t web_server_get_ws_clients(web_server_ws_client_t *clients, size_t max_clients)
+{
+    if (max_clients == 0) {
+        return 0;
+    }
+    clients[0] = (web_server_ws_client_t){ .fd = -1, .frames_sent = (uint32_t)frames_sent };
+    return 1;
+}
+
+// ---- Client: the dashboard's view of the stream ----
+
+static bool json_u64(const char *line, const char *key, uint64_t *out)
+{
+    const char *p = strstr(line, key);
+    if (p == NULL) {
+        return false;
+    }
+    char *end;
+    *out = strtoull(p + strlen(key), &end, 10);
+    return end != p + strlen(key);
+}
+
+static void client_line(const char *line, size_t len, uint64_t received_us)
+{
+    uint64_t seq;
+    uint64_t t;
+    uint64_t tx;
+    uint64_t chunk;
+    uint64_t miss;
+    client.bytes += len + 1;
+    if (len < 2 || line[0] != '{' || line[len - 1] != '}' || !json_u64(line, "\"seq\":", &seq) ||
+        !json_u64(line, "\"t\":", &t) || !json_u64(line, "\"tx\":", &tx) ||
+        !json_u64(line, "\"chunk\":", &chunk) || !json_u64(line, "\"miss\":", &miss)) {
+        client.malformed++;
+        return;
+    }
+    if (seq != client.frames) {
+        client.seq_errors++;
+    }
+    client.frames++;
+    client.samples += chunk;
+    client.missed += miss;
+    if (client.latency_count < E2E_MAX_FRAMES) {
+        client.sample_latency_us[client.latency_count] = (uint32_t)(received_us - t);
+        client.transport_latency_us[client.latency_count] = (uint32_t)(received_us - tx);
+        client.latency_count++;
+    }
+}
+
+static void *client_thread(void *arg)
+{
+    const int fd = *(const int *)arg;
+    static char buf[E2E_LINE_MAX * 4];
+    size_t fill = 0;
+
+    for (;;) {
+        const ssize_t n = recv(fd, buf + fill, sizeof(buf) - fill, 0);
+        if (n <= 0) {
+            break;
+        }
+        const uint64_t received_us = esp_timer_get_time();
+        fill += (size_t)n;
+        size_t start = 0;
+        for (size_t i = 0; i < fill; i++) {
+            if (buf[i] == '\n') {
+                buf[i] = '\0';
+                client_line(&buf[start], i - start, received_us);
+                start = i + 1;
+            }
+        }
+        memmove(buf, buf + start, fill - start);
+        fill -= start;
+        if (fill == sizeof(buf)) {
+            client.malformed++;     // A line longer than any frame
+            fill = 0;
+        }
+    }
+    return NULL;
+}
+
+// ---- Setup ----
+
+// A connected loopback pair: *server_fd is the firmware's end, *client_fd the dashboard's
+static bool open_loopback(int *server_fd, int *client_fd)
+{
+    struct sockaddr_in addr = { .sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+    socklen_t addr_len = sizeof(addr);
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0 || bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(listener, 1) != 0 ||
+        getsockname(listener, (struct sockaddr *)&addr, &addr_len) != 0) {
+        return false;
+    }
+    *client_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (*client_fd < 0 || connect(*client_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        return false;
+    }
+    *server_fd = accept(listener, NULL, NULL);
+    close(listener);
+    if (*server_fd < 0) {
+        return false;
+    }
+    // httpd sends each WebSocket frame as it is queued
+    const int one = 1;
+    setsockopt(*server_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return true;
+}
+
+static esp_err_t setup_pipeline(void)
+{
+    esp_err_t ret = pipeline_add_ring_sink(E2E_SINK_NAME, E2E_WS_RING_CAPACITY, &ws_sink);
+    if (ret == ESP_OK) {
+        ret = pipeline_connect(PIPELINE_STAGE_DECIMATE, E2E_SINK_NAME);
+    }
+    if (ret == ESP_OK) {
+        ws_ring = pipeline_get_ring(ws_sink);
+        ret = bcast_ring_attach(ws_ring, E2E_SINK_NAME, &ws_consumer);
+    }
+    return ret;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t *)a;
+    const uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void print_latency(const char *label, uint32_t *us, uint32_t n)
+{
+    qsort(us, n, sizeof(us[0]), compare_u32);
+    printf("  %-22s p50 %7.2f ms  p99 %7.2f ms  max %7.2f ms\n", label, us[n / 2] / 1000.0,
+           us[(uint64_t)n * 99 / 100] / 1000.0, us[n - 1] / 1000.0);
+}
+
+// /api/pipeline's parameter path: out-of-range values and non-stages are refused
+static bool check_set_param(void)
+{
+    return pipeline_set_param(PIPELINE_STAGE_DECIMATE, 0) == ESP_ERR_INVALID_ARG &&
+           pipeline_set_param(PIPELINE_STAGE_DECIMATE, PIPELINE_DECIMATE_MAX + 1) == ESP_ERR_INVALID_ARG &&
+           pipeline_set_param(PIPELINE_STAGE_DC_BLOCK, INT32_MIN) == ESP_ERR_INVALID_ARG &&
+           pipeline_set_param(PIPELINE_SOURCE_IMU, PIPELINE_DECIMATE_DEFAULT) == ESP_ERR_NOT_FOUND &&
+           pipeline_set_param(PIPELINE_STAGE_DECIMATE, PIPELINE_DECIMATE_DEFAULT) == ESP_OK;
+}
+
+int main(int argc, char **argv)
+{
+    const unsigned seconds = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 0) : E2E_SECONDS;
+    if (seconds == 0 || seconds > E2E_MAX_SECONDS) {
+        fprintf(stderr, "usage: %s [seconds, 1..%u]\n", argv[0], E2E_MAX_SECONDS);
+        return 2;
+    }
+
+    int server_fd;
+    int client_fd;
+    if (mem_arena_init() != ESP_OK || data_buffer_init() != ESP_OK || pipeline_init() != ESP_OK ||
+        setup_pipeline() != ESP_OK) {
+        printf("FAIL: init\n");
+        return 1;
+    }
+    if (!check_set_param()) {
+        printf("FAIL: pipeline_set_param range checks\n");
+        return 1;
+    }
+    if (sensor_sim_attach_iis3dwb(E2E_CS_IIS3DWB) != ESP_OK || imu_manager_init() != ESP_OK) {
+        printf("FAIL: IIS3DWB bring-up on the simulated bus\n");
+        return 1;
+    }
+    if (!open_loopback(&server_fd, &client_fd)) {
+        printf("FAIL: loopback socket\n");
+        return 1;
+    }
+
+    pthread_t imu;
+    pthread_t broadcast;
+    pthread_t reader;
+    host_sim_reset_bus_bytes();
+    const uint32_t overflows_before = imu_manager_get_fifo_overflow_count();
+    const int64_t start_us = esp_timer_get_time();
+    pthread_create(&reader, NULL, client_thread, &client_fd);
+    pthread_create(&broadcast, NULL, broadcast_thread, &server_fd);
+    pthread_create(&imu, NULL, imu_thread, NULL);
+
+    // Re-apply the decimation factor while samples flow, as a POST to /api/pipeline
+    // would from the httpd task
+    for (unsigned i = 0; i < seconds * 10; i++) {
+        usleep(100 * 1000);
+        pipeline_set_param(PIPELINE_STAGE_DECIMATE, PIPELINE_DECIMATE_DEFAULT);
+    }
+    atomic_store(&stop, true);
+    pthread_join(imu, NULL);
+    pthread_join(broadcast, NULL);
+    pthread_join(reader, NULL);
+    const double elapsed_s = (esp_timer_get_time() - start_us) / 1e6;
+    close(server_fd);
+    close(client_fd);
+
+    const uint32_t published = atomic_load(&ws_ring->head);
+    bcast_consumer_stats_t ws_stats = { 0 };
+    bcast_ring_get_consumer_stats(ws_ring, ws_consumer, &ws_stats);
+    const uint32_t overflows = imu_manager_get_fifo_overflow_count() - overflows_before;
+    printf("%.2f s on the simulated IIS3DWB (%.0f Hz)\n", elapsed_s, imu_manager_get_configured_odr());
+    printf("  acquired  %10llu samples  %9.0f sps  %6.1f bus bytes/sample  %u FIFO overrun(s)\n",
+           (unsigned long long)acquired_samples, acquired_samples / elapsed_s,
+           acquired_samples ? (double)host_sim_bus_bytes() / acquired_samples : 0.0, overflows);
+    printf("  ws ring   %10u samples  %9.0f sps  (ODR / %u expected)\n", published, published / elapsed_s,
+           PIPELINE_DECIMATE_DEFAULT);
+    printf("  client    %10llu samples  %9.0f sps  %llu frames (%.1f/s)  %.1f KiB/s  %llu missed\n",
+           (unsigned long long)client.samples, client.samples / elapsed_s, (unsigned long long)client.frames,
+           client.frames / elapsed_s, client.bytes / elapsed_s / 1024.0, (unsigned long long)client.missed);
+    if (client.latency_count > 0) {
+        print_latency("last sample -> client", client.sample_latency_us, client.latency_count);
+        print_latency("hand-off -> client", client.transport_latency_us, client.latency_count);
+    }
+
+    int failures = 0;
+    if (client.frames != frames_sent || client.seq_errors > 0 || client.malformed > 0) {
+        printf("FAIL: sent %llu frames, client parsed %llu (%llu out of order, %llu malformed)\n",
+               (unsigned long long)frames_sent, (unsigned long long)client.frames,
+               (unsigned long long)client.seq_errors, (unsigned long long)client.malformed);
+        failures++;
+    }
+    if (client.samples != ws_stats.read_total || client.missed != ws_stats.missed_total ||
+        client.samples + client.missed + ws_stats.lag != published) {
+        printf("FAIL: client saw %llu samples + %llu missed, the ring read %u + %u missed + %u unread of %u\n",
+               (unsigned long long)client.samples, (unsigned long long)client.missed, ws_stats.read_total,
+               ws_stats.missed_total, ws_stats.lag, published);
+        failures++;
+    }
+    if (client.samples == 0) {
+        printf("FAIL: no samples reached the client\n");
+        failures++;
+    }
+
+    if (failures > 0) {
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
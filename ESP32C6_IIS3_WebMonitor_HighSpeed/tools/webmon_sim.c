@@ -0,0 +1,263 @@
+/*
+ * Host run of the ESP32C6_IMU_WebMonitor acquisition path against simulated sensors.
+ *
+ * Builds that project's main/imu_manager.c and the shared drivers in
+ * components/imu_sensors with all four sensors enabled, on the SPI/I2C stubs in
+ * tools/host with the register models in tools/host/sim attached at the board's
+ * chip selects and I2C address. imu_manager_init() brings every sensor up through
+ * its real init sequence; the run then calls imu_manager_read_all() in a loop,
+ * moving the simulated board to a new pose every WEBMON_POSE_READS reads, and checks
+ * each reading against the pose to within one LSB of the part:
+ *   IIS2MDC   field (1.5 mG/LSB) and temperature
+ *   ICM45686  accel (16 g), gyro (2000 dps) and temperature
+ *   SCL3300   accel (mode 1, 6000 LSB/g), angles and temperature
+ *   IIS3DWB   within the envelope of its simulated tones (2 g)
+ * It reports read_all() latency and bus bytes per call. The timings are the host's,
+ * not the C6's: the figures to compare are bytes per read and how they change.
+ *
+ * Build and run with the ESP-IDF stubs in tools/host:
+ *   make -C tools webmon_sim && tools/build/webmon_sim [reads]
+ *
+ * Exits non-zero if a sensor fails to come up, a reading is off, or a model saw a
+ * protocol error (bad SCL3300 CRC, IREG access out of range).
+ */
+#include "imu_manager.h"
+#include "host_sim.h"
+#include "sensor_sim.h"
+#include "esp_timer.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WEBMON_READS        2000
+#define WEBMON_MAX_READS    100000
+#define WEBMON_POSE_READS   50
+#define WEBMON_SEED         0x1D5A3u
+
+// Board wiring, as in ESP32C6_IMU_WebMonitor/main/imu_manager.c
+#define WEBMON_CS_IIS3DWB   19
+#define WEBMON_CS_ICM45686  20
+#define WEBMON_CS_SCL3300   11
+#define WEBMON_IIS2MDC_ADDR 0x1E
+
+// One LSB of each reading, plus float rounding
+#define TOL_MAG_MG          1.5
+#define TOL_MAG_TEMP_C      (1.0 / 8.0)
+#define TOL_ICM_ACCEL_G     (16.0 / 32768.0)
+#define TOL_ICM_GYRO_DPS    (2000.0 / 32768.0)
+#define TOL_ICM_TEMP_C      (1.0 / 128.0)
+#define TOL_SCL_ACCEL_G     (1.0 / 6000.0)
+#define TOL_SCL_ANGLE_DEG   (90.0 / 16384.0)
+#define TOL_SCL_TEMP_C      (1.0 / 18.9)
+#define TOL_IIS3DWB_G       (2 * 0.061e-3)      // Tone and noise amplitudes are rounded to LSBs
+#define TOL_EPSILON         1e-4
+
+// iis3dwb_sim.h tones: offset +/- (tone + noise), in g
+static const double iis3dwb_center_g[3] = { 0.0, 0.0, 1.0 };
+static const double iis3dwb_swing_g[3] = { 0.505, 0.255, 0.105 };
+
+typedef enum {
+    CHECK_MAG,
+    CHECK_ACCEL,
+    CHECK_IMU_6AXIS,
+    CHECK_INCLINOMETER,
+    CHECK_COUNT,
+} check_id_t;
+
+typedef struct {
+    const char *name;
+    uint32_t valid;
+    uint32_t off;
+    double worst;           // Largest error seen, in units of the check's tolerance
+} check_t;
+
+static check_t checks[CHECK_COUNT] = {
+    [CHECK_MAG] = { "IIS2MDC" },
+    [CHECK_ACCEL] = { "IIS3DWB" },
+    [CHECK_IMU_6AXIS] = { "ICM45686" },
+    [CHECK_INCLINOMETER] = { "SCL3300" },
+};
+
+static uint32_t lcg(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 16;
+}
+
+static float uniform(uint32_t *state, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)lcg(state) / 65535.0f;
+}
+
+// A random pose inside every part's range: tilt under 1 g, slow rotation, Earth-size field
+static void next_pose(uint32_t *state)
+{
+    sensor_sim_state_t s;
+    for (int a = 0; a < 3; a++) {
+        s.accel_g[a] = uniform(state, -0.9f, 0.9f);
+        s.gyro_dps[a] = uniform(state, -250.0f, 250.0f);
+        s.mag_mg[a] = uniform(state, -600.0f, 600.0f);
+    }
+    s.temp_c = uniform(state, -10.0f, 60.0f);
+    sensor_sim_set_state(&s);
+}
+
+// Returns the error in units of tol; above 1 is a failed reading
+static double off_by(double got, double want, double tol)
+{
+    return fabs(got - want) / (tol + TOL_EPSILON);
+}
+
+static void record(check_id_t id, bool valid, double worst)
+{
+    check_t *c = &checks[id];
+    if (!valid) {
+        c->off++;
+        return;
+    }
+    c->valid++;
+    if (worst > 1.0) {
+        c->off++;
+    }
+    if (worst > c->worst) {
+        c->worst = worst;
+    }
+}
+
+static double scl_angle_deg(const sensor_sim_state_t *s, int axis)
+{
+    const double a = s->accel_g[axis];
+    const double b = s->accel_g[(axis + 1) % 3];
+    const double c = s->accel_g[(axis + 2) % 3];
+    return atan2(a, sqrt(b * b + c * c)) * 180.0 / M_PI;
+}
+
+static void check_reading(const imu_data_t *d, const sensor_sim_state_t *s)
+{
+    double worst = 0.0;
+    worst = fmax(worst, off_by(d->magnetometer.x_mg, s->mag_mg[0], TOL_MAG_MG));
+    worst = fmax(worst, off_by(d->magnetometer.y_mg, s->mag_mg[1], TOL_MAG_MG));
+    worst = fmax(worst, off_by(d->magnetometer.z_mg, s->mag_mg[2], TOL_MAG_MG));
+    worst = fmax(worst, off_by(d->magnetometer.temperature_c, s->temp_c, TOL_MAG_TEMP_C));
+    record(CHECK_MAG, d->magnetometer.valid, worst);
+
+    const float accel[3] = { d->accelerometer.x_g, d->accelerometer.y_g, d->accelerometer.z_g };
+    worst = 0.0;
+    for (int a = 0; a < 3; a++) {
+        worst = fmax(worst, fabs(accel[a] - iis3dwb_center_g[a]) / (iis3dwb_swing_g[a] + TOL_IIS3DWB_G));
+    }
+    record(CHECK_ACCEL, d->accelerometer.valid, worst);
+
+    const float icm_accel[3] = { d->imu_6axis.accel_x_g, d->imu_6axis.accel_y_g, d->imu_6axis.accel_z_g };
+    const float icm_gyro[3] = { d->imu_6axis.gyro_x_dps, d->imu_6axis.gyro_y_dps, d->imu_6axis.gyro_z_dps };
+    worst = 0.0;
+    for (int a = 0; a < 3; a++) {
+        worst = fmax(worst, off_by(icm_accel[a], s->accel_g[a], TOL_ICM_ACCEL_G));
+        worst = fmax(worst, off_by(icm_gyro[a], s->gyro_dps[a], TOL_ICM_GYRO_DPS));
+    }
+    worst = fmax(worst, off_by(d->imu_6axis.temperature_c, s->temp_c, TOL_ICM_TEMP_C));
+    record(CHECK_IMU_6AXIS, d->imu_6axis.valid, worst);
+
+    const float scl_accel[3] = { d->inclinometer.accel_x_g, d->inclinometer.accel_y_g, d->inclinometer.accel_z_g };
+    const float scl_angle[3] = { d->inclinometer.angle_x_deg, d->inclinometer.angle_y_deg,
+                                 d->inclinometer.angle_z_deg };
+    worst = 0.0;
+    for (int a = 0; a < 3; a++) {
+        worst = fmax(worst, off_by(scl_accel[a], s->accel_g[a], TOL_SCL_ACCEL_G));
+        worst = fmax(worst, off_by(scl_angle[a], scl_angle_deg(s, a), TOL_SCL_ANGLE_DEG));
+    }
+    worst = fmax(worst, off_by(d->inclinometer.temperature_c, s->temp_c, TOL_SCL_TEMP_C));
+    record(CHECK_INCLINOMETER, d->inclinometer.valid, worst);
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    const uint32_t x = *(const uint32_t *)a;
+    const uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t latency_us[WEBMON_MAX_READS];
+
+int main(int argc, char **argv)
+{
+    const uint32_t reads = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : WEBMON_READS;
+    if (reads == 0 || reads > WEBMON_MAX_READS) {
+        fprintf(stderr, "usage: %s [reads, 1..%u]\n", argv[0], WEBMON_MAX_READS);
+        return 2;
+    }
+
+    if (sensor_sim_attach_iis2mdc(WEBMON_IIS2MDC_ADDR) != ESP_OK ||
+        sensor_sim_attach_iis3dwb(WEBMON_CS_IIS3DWB) != ESP_OK ||
+        sensor_sim_attach_icm45686(WEBMON_CS_ICM45686) != ESP_OK ||
+        sensor_sim_attach_scl3300(WEBMON_CS_SCL3300) != ESP_OK) {
+        printf("FAIL: attach simulated sensors\n");
+        return 1;
+    }
+
+    host_sim_reset_bus_bytes();
+    const int64_t init_start = esp_timer_get_time();
+    if (imu_manager_init() != ESP_OK) {
+        printf("FAIL: imu_manager_init\n");
+        return 1;
+    }
+    const int64_t init_us = esp_timer_get_time() - init_start;
+    const uint8_t enabled = imu_manager_get_enabled_sensors();
+    printf("init: %.1f ms, %llu bus bytes, sensors 0x%02X\n", init_us / 1000.0,
+           (unsigned long long)host_sim_bus_bytes(), enabled);
+
+    const uint8_t all = SENSOR_MAGNETOMETER | SENSOR_ACCELEROMETER | SENSOR_IMU_6AXIS | SENSOR_INCLINOMETER;
+    int failures = (enabled == all) ? 0 : 1;
+    if (failures) {
+        printf("FAIL: sensors 0x%02X did not come up\n", all & ~enabled);
+    }
+
+    uint32_t state = WEBMON_SEED;
+    host_sim_reset_bus_bytes();
+    for (uint32_t i = 0; i < reads; i++) {
+        if (i % WEBMON_POSE_READS == 0) {
+            next_pose(&state);
+        }
+        sensor_sim_state_t pose;
+        sensor_sim_get_state(&pose);
+
+        imu_data_t d;
+        const int64_t start = esp_timer_get_time();
+        const esp_err_t ret = imu_manager_read_all(&d);
+        latency_us[i] = (uint32_t)(esp_timer_get_time() - start);
+        if (ret != ESP_OK) {
+            printf("FAIL: imu_manager_read_all: %s\n", esp_err_to_name(ret));
+            return 1;
+        }
+        check_reading(&d, &pose);
+    }
+    const uint64_t bus_bytes = host_sim_bus_bytes();
+    qsort(latency_us, reads, sizeof(latency_us[0]), compare_u32);
+
+    printf("read_all: %u reads, p50 %u us, p99 %u us, max %u us, %.1f bus bytes per read\n", reads,
+           latency_us[reads / 2], latency_us[(uint64_t)reads * 99 / 100], latency_us[reads - 1],
+           (double)bus_bytes / reads);
+    printf("  %-9s %7s %6s %12s\n", "sensor", "valid", "off", "worst/tol");
+    for (int i = 0; i < CHECK_COUNT; i++) {
+        const check_t *c = &checks[i];
+        printf("  %-9s %7u %6u %12.2f\n", c->name, c->valid, c->off, c->worst);
+        failures += (c->off > 0 || c->valid != reads) ? 1 : 0;
+    }
+
+    sensor_sim_errors_t errors;
+    sensor_sim_get_errors(&errors);
+    if (errors.scl3300_crc_errors || errors.scl3300_bad_commands || errors.icm45686_ireg_errors) {
+        printf("FAIL: protocol errors: SCL3300 crc %u, bad commands %u; ICM45686 ireg %u\n",
+               errors.scl3300_crc_errors, errors.scl3300_bad_commands, errors.icm45686_ireg_errors);
+        failures++;
+    }
+
+    imu_manager_deinit();
+    if (failures > 0) {
+        printf("FAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+"""WebSocket load generator for the /ws/data plot stream.
+
+Opens N clients against the device, each with a consumption profile, and reports
+per-client throughput, frame-sequence continuity, ring misses and latency
+histograms. Standard library only, so it runs unattended on any host.
+
+Profiles:
+  fast   read frames as soon as they arrive
+  slow   sleep --slow-ms after every frame (TCP backpressure on the device)
+  idle   connect, then stop reading (receive window fills; must not stall others)
+  churn  reconnect every --churn-s seconds
+
+Latency: frames carry the device time of their last sample ("t"), which shares no
+clock with the host. Per client, the smallest (receipt - t) seen is taken as the
+fixed offset, and latency is reported above that best case. This shows queueing
+and stalls, not the absolute sample-to-screen delay. With --echo-every N each
+client also returns every Nth frame's seq, so the device measures the absolute
+figures itself; read them from GET /api/stats under "latency".
+
+Example:
+  python3 ws_loadgen.py 192.168.1.50 --clients 4 --profiles fast:2,slow:1,idle:1 \
+      --duration 60 --json run-v1.json
+"""
+
+import argparse
+import asyncio
+import base64
+import json
+import os
+import struct
+import sys
+import time
+import urllib.request
+
+LATENCY_BUCKETS_MS = [1, 2, 5, 10, 20, 50, 100, 200, 500, 1000]
+METRICS_OF_INTEREST = (
+    "ws_frames_total",
+    "ws_send_errors_total",
+    "imu_fifo_overflows_total",
+    "imu_samples_total",
+)
+
+
+class ClientStats:
+    def __init__(self, index, profile):
+        self.index = index
+        self.profile = profile
+        self.connects = 0
+        self.frames = 0
+        self.bytes = 0
+        self.samples = 0
+        self.other_messages = 0
+        self.seq_gaps = 0          # Gap events
+        self.seq_missed = 0        # Frames skipped across all gaps
+        self.seq_backwards = 0     # Restarts or reordering
+        self.ring_missed = 0       # Samples the device ring overwrote (s.miss)
+        self.min_offset_us = None
+        self.latencies_us = []
+        self.errors = []
+        self.last_seq = None
+
+    def on_frame(self, payload, recv_us):
+        self.bytes += len(payload)
+        try:
+            msg = json.loads(payload)
+        except ValueError:
+            self.errors.append("bad json")
+            return
+        if "chunks" not in msg:
+            self.other_messages += 1
+            return
+
+        self.frames += 1
+        self.samples += len(msg["chunks"].get("x", []))
+        self.ring_missed += int(msg.get("s", {}).get("miss", 0))
+
+        seq = msg.get("seq")
+        if seq is not None:
+            if self.last_seq is not None:
+                step = (seq - self.last_seq) & 0xFFFFFFFF
+                if step == 0 or step > 0x7FFFFFFF:
+                    self.seq_backwards += 1
+                elif step > 1:
+                    self.seq_gaps += 1
+                    self.seq_missed += step - 1
+            self.last_seq = seq
+
+        t = msg.get("t")
+        if t:
+            offset = recv_us - int(t)
+            if self.min_offset_us is None or offset < self.min_offset_us:
+                self.min_offset_us = offset
+            self.latencies_us.append(offset)
+
+    def summary(self, elapsed_s):
+        lat = sorted(x - self.min_offset_us for x in self.latencies_us) if self.latencies_us else []
+        hist = [0] * (len(LATENCY_BUCKETS_MS) + 1)
+        for v in lat:
+            ms = v / 1000.0
+            for i, edge in enumerate(LATENCY_BUCKETS_MS):
+                if ms <= edge:
+                    hist[i] += 1
+                    break
+            else:
+                hist[-1] += 1
+
+        def pct(p):
+            if not lat:
+                return None
+            return round(lat[min(len(lat) - 1, int(p * len(lat)))] / 1000.0, 2)
+
+        return {
+            "client": self.index,
+            "profile": self.profile,
+            "connects": self.connects,
+            "frames": self.frames,
+            "frames_per_s": round(self.frames / elapsed_s, 2),
+            "samples_per_s": round(self.samples / elapsed_s, 1),
+            "kbytes_per_s": round(self.bytes / elapsed_s / 1024.0, 1),
+            "seq_gaps": self.seq_gaps,
+            "seq_missed": self.seq_missed,
+            "seq_backwards": self.seq_backwards,
+            "ring_missed": self.ring_missed,
+            "latency_ms": {"p50": pct(0.50), "p90": pct(0.90), "p99": pct(0.99),
+                           "max": round(lat[-1] / 1000.0, 2) if lat else None},
+            "latency_hist": {"le_ms": LATENCY_BUCKETS_MS + ["inf"], "counts": hist},
+            "errors": self.errors[:5],
+        }
+
+
+# --- Minimal RFC 6455 client -------------------------------------------------
+
+async def ws_connect(host, port, path, timeout):
+    reader, writer = await asyncio.wait_for(asyncio.open_connection(host, port), timeout)
+    key = base64.b64encode(os.urandom(16)).decode()
+    request = (
+        f"GET {path} HTTP/1.1\r\n"
+        f"Host: {host}:{port}\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        f"Sec-WebSocket-Key: {key}\r\n"
+        "Sec-WebSocket-Version: 13\r\n\r\n"
+    )
+    writer.write(request.encode())
+    await writer.drain()
+    head = await asyncio.wait_for(reader.readuntil(b"\r\n\r\n"), timeout)
+    status = head.split(b"\r\n", 1)[0]
+    if b" 101 " not in status + b" ":
+        writer.close()
+        raise ConnectionError(f"upgrade refused: {status.decode(errors='replace')}")
+    return reader, writer
+
+
+def ws_encode(opcode, payload):
+    # Client frames must be masked
+    mask = os.urandom(4)
+    header = bytes([0x80 | opcode])
+    n = len(payload)
+    if n < 126:
+        header += bytes([0x80 | n])
+    elif n < 65536:
+        header += bytes([0x80 | 126]) + struct.pack("!H", n)
+    else:
+        header += bytes([0x80 | 127]) + struct.pack("!Q", n)
+    masked = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+    return header + mask + masked
+
+
+async def ws_read_message(reader, writer):
+    """Return (opcode, payload) of the next complete data message."""
+    parts = []
+    msg_opcode = None
+    while True:
+        b0, b1 = await reader.readexactly(2)
+        fin = b0 & 0x80
+        opcode = b0 & 0x0F
+        n = b1 & 0x7F
+        if n == 126:
+            n = struct.unpack("!H", await reader.readexactly(2))[0]
+        elif n == 127:
+            n = struct.unpack("!Q", await reader.readexactly(8))[0]
+        mask = await reader.readexactly(4) if b1 & 0x80 else None
+        payload = await reader.readexactly(n)
+        if mask:
+            payload = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+
+        if opcode == 0x8:
+            return opcode, payload
+        if opcode == 0x9:
+            writer.write(ws_encode(0xA, payload))
+            continue
+        if opcode == 0xA:
+            continue
+        if opcode != 0x0:
+            msg_opcode = opcode
+        parts.append(payload)
+        if fin:
+            return msg_opcode, b"".join(parts)
+
+
+async def ws_close(writer):
+    try:
+        writer.write(ws_encode(0x8, struct.pack("!H", 1000)))
+        await writer.drain()
+    except (ConnectionError, OSError):
+        pass
+    writer.close()
+
+
+# --- Client profiles -----------------------------------------------------------
+
+async def run_client(stats, args, deadline):
+    while time.monotonic() < deadline:
+        try:
+            reader, writer = await ws_connect(args.host, args.port, args.path, args.timeout)
+        except (OSError, asyncio.TimeoutError, ConnectionError, asyncio.IncompleteReadError) as exc:
+            stats.errors.append(f"connect: {exc}")
+            await asyncio.sleep(1.0)
+            continue
+        stats.connects += 1
+        stats.last_seq = None       # Continuity is per connection
+
+        session_end = deadline
+        if stats.profile == "churn":
+            session_end = min(deadline, time.monotonic() + args.churn_s)
+
+        try:
+            if stats.profile == "idle":
+                await asyncio.sleep(max(0.0, session_end - time.monotonic()))
+            else:
+                while time.monotonic() < session_end:
+                    remaining = session_end - time.monotonic()
+                    opcode, payload = await asyncio.wait_for(ws_read_message(reader, writer),
+                                                             max(0.01, min(remaining, args.timeout)))
+                    if opcode == 0x8:
+                        stats.errors.append("closed by device")
+                        break
+                    recv_ns = time.monotonic_ns()
+                    stats.on_frame(payload, time.time_ns() // 1000)
+                    if args.echo_every and stats.last_seq is not None and stats.frames % args.echo_every == 0:
+                        hold_us = (time.monotonic_ns() - recv_ns) // 1000
+                        echo = json.dumps({"echo": stats.last_seq, "hold": hold_us}).encode()
+                        writer.write(ws_encode(0x1, echo))
+                        await writer.drain()
+                    if stats.profile == "slow":
+                        await asyncio.sleep(args.slow_ms / 1000.0)
+        except asyncio.TimeoutError:
+            if time.monotonic() < session_end:
+                stats.errors.append("receive timeout")
+        except (asyncio.IncompleteReadError, ConnectionError, OSError) as exc:
+            stats.errors.append(f"receive: {exc}")
+        finally:
+            await ws_close(writer)
+
+
+def parse_profiles(spec, clients):
+    profiles = []
+    for item in spec.split(","):
+        name, _, count = item.partition(":")
+        name = name.strip()
+        if name not in ("fast", "slow", "idle", "churn"):
+            raise SystemExit(f"unknown profile '{name}'")
+        profiles += [name] * (int(count) if count else 1)
+    if clients:
+        # Repeat or trim the profile list to the requested client count
+        profiles = (profiles * clients)[:clients]
+    return profiles
+
+
+def fetch_metrics(args):
+    url = f"http://{args.host}:{args.port}/metrics"
+    try:
+        with urllib.request.urlopen(url, timeout=args.timeout) as resp:
+            text = resp.read().decode()
+    except OSError:
+        return None
+    values = {}
+    for line in text.splitlines():
+        if line.startswith("#"):
+            continue
+        name, _, value = line.rpartition(" ")
+        if name in METRICS_OF_INTEREST:
+            values[name] = float(value)
+    return values
+
+
+def print_report(report):
+    cfg = report["config"]
+    print(f"\n{cfg['clients']} clients against ws://{cfg['host']}:{cfg['port']}{cfg['path']} "
+          f"for {report['elapsed_s']} s")
+    print(f"{'#':>2} {'profile':<6} {'conn':>4} {'fr/s':>7} {'samp/s':>8} {'KB/s':>7} "
+          f"{'gaps':>5} {'lost':>6} {'ring':>7} {'p50ms':>7} {'p99ms':>7} {'maxms':>7}")
+    for c in report["clients"]:
+        lat = c["latency_ms"]
+        fmt = lambda v: f"{v:7.1f}" if v is not None else "      -"
+        print(f"{c['client']:>2} {c['profile']:<6} {c['connects']:>4} {c['frames_per_s']:>7.1f} "
+              f"{c['samples_per_s']:>8.0f} {c['kbytes_per_s']:>7.1f} {c['seq_gaps']:>5} "
+              f"{c['seq_missed']:>6} {c['ring_missed']:>7} {fmt(lat['p50'])} {fmt(lat['p99'])} "
+              f"{fmt(lat['max'])}")
+    t = report["totals"]
+    print(f"total: {t['frames_per_s']:.1f} frames/s, {t['kbytes_per_s']:.1f} KB/s, "
+          f"{t['starved_clients']} client(s) received nothing")
+    if report.get("device"):
+        print("device deltas: " + ", ".join(f"{k}={v:.0f}" for k, v in report["device"].items()))
+    for c in report["clients"]:
+        if c["errors"]:
+            print(f"client {c['client']} errors: {'; '.join(c['errors'])}")
+
+
+async def main_async(args):
+    profiles = parse_profiles(args.profiles, args.clients)
+    clients = [ClientStats(i, p) for i, p in enumerate(profiles)]
+    before = fetch_metrics(args)
+
+    start = time.monotonic()
+    deadline = start + args.duration
+    tasks = []
+    for c in clients:
+        tasks.append(asyncio.create_task(run_client(c, args, deadline)))
+        await asyncio.sleep(args.stagger_ms / 1000.0)
+    await asyncio.gather(*tasks)
+    elapsed = time.monotonic() - start
+
+    after = fetch_metrics(args)
+    summaries = [c.summary(elapsed) for c in clients]
+    report = {
+        "tool": "ws_loadgen",
+        "started": time.strftime("%Y-%m-%dT%H:%M:%S", time.localtime(time.time() - elapsed)),
+        "elapsed_s": round(elapsed, 1),
+        "config": {
+            "host": args.host, "port": args.port, "path": args.path, "clients": len(clients),
+            "profiles": profiles, "slow_ms": args.slow_ms, "churn_s": args.churn_s,
+        },
+        "clients": summaries,
+        "totals": {
+            "frames_per_s": round(sum(s["frames_per_s"] for s in summaries), 2),
+            "kbytes_per_s": round(sum(s["kbytes_per_s"] for s in summaries), 1),
+            "seq_missed": sum(s["seq_missed"] for s in summaries),
+            "starved_clients": sum(1 for s, c in zip(summaries, clients)
+                                   if c.profile != "idle" and s["frames"] == 0),
+        },
+    }
+    if before and after:
+        report["device"] = {k: after[k] - before[k] for k in after if k in before}
+    return report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("host", help="device IP or hostname")
+    parser.add_argument("--port", type=int, default=80, help="HTTP/WebSocket server port")
+    parser.add_argument("--path", default="/ws/data")
+    parser.add_argument("--clients", type=int, default=0,
+                        help="client count (default: one per profile entry)")
+    parser.add_argument("--profiles", default="fast:4", help="e.g. fast:2,slow:1,idle:1")
+    parser.add_argument("--duration", type=float, default=30.0, help="seconds")
+    parser.add_argument("--slow-ms", type=float, default=100.0, help="per-frame delay of 'slow'")
+    parser.add_argument("--churn-s", type=float, default=5.0, help="session length of 'churn'")
+    parser.add_argument("--stagger-ms", type=float, default=200.0, help="delay between connects")
+    parser.add_argument("--timeout", type=float, default=5.0)
+    parser.add_argument("--echo-every", type=int, default=0,
+                        help="echo every Nth frame for device-side latency (0: off)")
+    parser.add_argument("--json", help="write the machine-readable report here")
+    args = parser.parse_args()
+
+    report = asyncio.run(main_async(args))
+    print_report(report)
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(report, f, indent=2)
+        print(f"report written to {args.json}")
+    return 0 if report["totals"]["starved_clients"] == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,133 @@
+#include "ble_frame.h"
+
+#include <math.h>
+#include <limits.h>
+#include <string.h>
+
+static inline int16_t clamp_i16(int32_t v)
+{
+    if (v > INT16_MAX) return INT16_MAX;
+    if (v < INT16_MIN) return INT16_MIN;
+    return (int16_t)v;
+}
+
+static inline int16_t float_to_scaled_i16(float value, float scale)
+{
+    return clamp_i16(lrintf(value * scale));
+}
+
+static bool append_u8(uint8_t *buf, size_t *offset, size_t max, uint8_t v)
+{
+    if (*offset + 1 > max) return false;
+    buf[(*offset)++] = v;
+    return true;
+}
+
+static bool append_i16(uint8_t *buf, size_t *offset, size_t max, int16_t v)
+{
+    if (*offset + sizeof(int16_t) > max) return false;
+    memcpy(&buf[*offset], &v, sizeof(int16_t));
+    *offset += sizeof(int16_t);
+    return true;
+}
+
+static bool append_vec3(uint8_t *buf, size_t *offset, size_t max, uint8_t type, int16_t x, int16_t y, int16_t z)
+{
+    if (!append_u8(buf, offset, max, type)) return false;
+    if (!append_u8(buf, offset, max, 6)) return false;
+    if (!append_i16(buf, offset, max, x)) return false;
+    if (!append_i16(buf, offset, max, y)) return false;
+    if (!append_i16(buf, offset, max, z)) return false;
+    return true;
+}
+
+static bool append_scalar(uint8_t *buf, size_t *offset, size_t max, uint8_t type, int16_t value)
+{
+    if (!append_u8(buf, offset, max, type)) return false;
+    if (!append_u8(buf, offset, max, 2)) return false;
+    if (!append_i16(buf, offset, max, value)) return false;
+    return true;
+}
+
+size_t ble_frame_build(const imu_data_t *data, const imu_ble_config_t *cfg, uint32_t sequence,
+                       uint8_t *out, size_t max_len)
+{
+    if (!data || !cfg || !out || max_len < sizeof(ble_frame_header_t)) {
+        return 0;
+    }
+
+    size_t offset = sizeof(ble_frame_header_t);
+    uint16_t mask = 0;
+
+    if (data->accelerometer.valid && cfg->enable_iis3dwb) {
+        int16_t ax = float_to_scaled_i16(data->accelerometer.x_g, 16384.0f); // 1g -> 16384
+        int16_t ay = float_to_scaled_i16(data->accelerometer.y_g, 16384.0f);
+        int16_t az = float_to_scaled_i16(data->accelerometer.z_g, 16384.0f);
+        if (!append_vec3(out, &offset, max_len, 0x01, ax, ay, az)) return 0;
+        mask |= BLE_SENSOR_IIS3_ACCEL;
+    }
+
+    if (data->imu_6axis.valid && cfg->enable_icm45686) {
+        int16_t ax = float_to_scaled_i16(data->imu_6axis.accel_x_g, 16384.0f);
+        int16_t ay = float_to_scaled_i16(data->imu_6axis.accel_y_g, 16384.0f);
+        int16_t az = float_to_scaled_i16(data->imu_6axis.accel_z_g, 16384.0f);
+        if (!append_vec3(out, &offset, max_len, 0x10, ax, ay, az)) return 0;
+        mask |= BLE_SENSOR_ICM_ACCEL;
+
+        int16_t gx = float_to_scaled_i16(data->imu_6axis.gyro_x_dps, 131.072f); // 1dps -> 131
+        int16_t gy = float_to_scaled_i16(data->imu_6axis.gyro_y_dps, 131.072f);
+        int16_t gz = float_to_scaled_i16(data->imu_6axis.gyro_z_dps, 131.072f);
+        if (!append_vec3(out, &offset, max_len, 0x11, gx, gy, gz)) return 0;
+        mask |= BLE_SENSOR_ICM_GYRO;
+
+        int16_t temp = float_to_scaled_i16(data->imu_6axis.temperature_c, 100.0f);
+        if (!append_scalar(out, &offset, max_len, 0x12, temp)) return 0;
+        mask |= BLE_SENSOR_ICM_TEMP;
+    }
+
+    if (data->magnetometer.valid && cfg->enable_iis2mdc) {
+        int16_t mx = float_to_scaled_i16(data->magnetometer.x_mg, 1.0f);  // already mg
+        int16_t my = float_to_scaled_i16(data->magnetometer.y_mg, 1.0f);
+        int16_t mz = float_to_scaled_i16(data->magnetometer.z_mg, 1.0f);
+        if (!append_vec3(out, &offset, max_len, 0x20, mx, my, mz)) return 0;
+        mask |= BLE_SENSOR_IIS2_MAG;
+
+        int16_t temp = float_to_scaled_i16(data->magnetometer.temperature_c, 100.0f);
+        if (!append_scalar(out, &offset, max_len, 0x21, temp)) return 0;
+        mask |= BLE_SENSOR_IIS2_TEMP;
+    }
+
+    if (data->inclinometer.valid && cfg->enable_scl3300) {
+        int16_t ang_x = float_to_scaled_i16(data->inclinometer.angle_x_deg, 100.0f);
+        int16_t ang_y = float_to_scaled_i16(data->inclinometer.angle_y_deg, 100.0f);
+        int16_t ang_z = float_to_scaled_i16(data->inclinometer.angle_z_deg, 100.0f);
+        if (!append_vec3(out, &offset, max_len, 0x30, ang_x, ang_y, ang_z)) return 0;
+        mask |= BLE_SENSOR_SCL_ANGLE;
+
+        int16_t acc_x = float_to_scaled_i16(data->inclinometer.accel_x_g, 16384.0f);
+        int16_t acc_y = float_to_scaled_i16(data->inclinometer.accel_y_g, 16384.0f);
+        int16_t acc_z = float_to_scaled_i16(data->inclinometer.accel_z_g, 16384.0f);
+        if (!append_vec3(out, &offset, max_len, 0x31, acc_x, acc_y, acc_z)) return 0;
+        mask |= BLE_SENSOR_SCL_ACCEL;
+
+        int16_t temp = float_to_scaled_i16(data->inclinometer.temperature_c, 100.0f);
+        if (!append_scalar(out, &offset, max_len, 0x32, temp)) return 0;
+        mask |= BLE_SENSOR_SCL_TEMP;
+    }
+
+    if (mask == 0) {
+        return 0;
+    }
+
+    ble_frame_header_t header = {
+        .frame_len = (uint16_t)offset,
+        .version = BLE_FRAME_VERSION,
+        .flags = 0,
+        .sensor_mask = mask,
+        .timestamp_us = (uint32_t)(data->timestamp_us & 0xFFFFFFFF),
+        .sequence = sequence,
+    };
+    memcpy(out, &header, sizeof(header));
+
+    return offset;
+}
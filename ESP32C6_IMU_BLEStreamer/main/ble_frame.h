@@ -0,0 +1,40 @@
+#ifndef BLE_FRAME_H
+#define BLE_FRAME_H
+
+#include "imu_ble.h"
+#include "imu_manager.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Notification frame: a packed header followed by type/length/value records, one per
+// enabled sensor reading. Parsed by ble-imu-dashboard/core/esp32_parser.py.
+#define BLE_FRAME_VERSION 1
+
+typedef struct __attribute__((packed)) {
+    uint16_t frame_len;
+    uint8_t  version;
+    uint8_t  flags;
+    uint16_t sensor_mask;
+    uint32_t timestamp_us;
+    uint32_t sequence;
+} ble_frame_header_t;
+
+enum {
+    BLE_SENSOR_IIS3_ACCEL = 1 << 0,
+    BLE_SENSOR_ICM_ACCEL  = 1 << 1,
+    BLE_SENSOR_ICM_GYRO   = 1 << 2,
+    BLE_SENSOR_ICM_TEMP   = 1 << 3,
+    BLE_SENSOR_IIS2_MAG   = 1 << 4,
+    BLE_SENSOR_IIS2_TEMP  = 1 << 5,
+    BLE_SENSOR_SCL_ANGLE  = 1 << 6,
+    BLE_SENSOR_SCL_ACCEL  = 1 << 7,
+    BLE_SENSOR_SCL_TEMP   = 1 << 8,
+};
+
+// Encode one sample into out. Returns the frame length, or 0 if no enabled sensor had
+// a valid reading or the frame does not fit in max_len. Pure, so tools can build it
+// on the host.
+size_t ble_frame_build(const imu_data_t *data, const imu_ble_config_t *cfg, uint32_t sequence,
+                       uint8_t *out, size_t max_len);
+
+#endif // BLE_FRAME_H
@@ -1,312 +0,0 @@
-0xf1,0x70,0x05,0xa6,
-0xfb,0x80,0x0e,0x1e,
-0x77,0x07,0xf1,0x40,
-0x05,0x25,0xf8,0x00,
-0xa2,0x18,0xf9,0x80,
-0x00,0x01,0xc5,0x02,
-0xf1,0xf0,0x64,0x3d,
-0x04,0xf1,0x50,0x05,
-0x08,0xf1,0x70,0x05,
-0x33,0x1f,0xfb,0x00,
-0x00,0xb7,0xc2,0xdf,
-0x73,0xc2,0xdf,0xf1,
-0x70,0x05,0xa5,0xfb,
-0x00,0xa2,0x1b,0xc2,
-0xa3,0x73,0xc2,0xab,
-0x73,0xc2,0xb3,0xb0,
-0x06,0x36,0xb0,0x0c,
-0x36,0xca,0x35,0x73,
-0xc2,0xab,0x73,0xc2,
-0xb3,0xb0,0x06,0x36,
-0xb0,0x0c,0x36,0xca,
-0x75,0x73,0xc2,0xab,
-0x73,0xc2,0xb3,0xb0,
-0x06,0x36,0xb0,0x0c,
-0x36,0xca,0xb5,0x73,
-0x73,0xc2,0xab,0xfb,
-0x00,0x00,0x50,0xc4,
-0x23,0x1f,0xc5,0x1e,
-0xc8,0x74,0x75,0xf1,
-0x50,0x05,0x83,0xc5,
-0x46,0xc8,0xb5,0x06,
-0xf1,0x50,0x05,0x83,
-0xb0,0x10,0x7f,0xfb,
-0x00,0x00,0xb7,0xc2,
-0xdf,0xc5,0x0f,0xf8,
-0x00,0xa2,0x1a,0xf9,
-0x80,0x00,0x08,0xc5,
-0xea,0xf1,0xf0,0x64,
-0x3d,0x04,0xf1,0x40,
-0x05,0x9f,0x1f,0xfb,
-0x00,0x00,0xb8,0xc2,
-0xdf,0x80,0xf8,0x00,
-0x00,0x2a,0xc1,0xc0,
-0xf9,0x80,0x00,0x32,
-0xf1,0xf0,0x64,0x32,
-0x72,0xf9,0x00,0x08,
-0xfd,0xc2,0xca,0xf8,
-0x00,0x08,0xfc,0xc2,
-0x88,0x69,0xf1,0x10,
-0x05,0xca,0x71,0xc2,
-0xc1,0x80,0xc5,0x09,
-0xc2,0xc1,0xf8,0x00,
-0x00,0x38,0xf1,0xf0,
-0x06,0x1c,0xfb,0x00,
-0x08,0xf0,0xc4,0x23,
-0xf8,0x00,0x08,0xf0,
-0xf1,0xf0,0x06,0x3c,
-0x04,0xf1,0x50,0x06,
-0x1b,0xf8,0x00,0x09,
-0x90,0x20,0xf1,0x50,
-0x06,0x02,0xc5,0x0b,
-0xf8,0x00,0x00,0xbd,
-0xf9,0xff,0xff,0x7f,
-0xc5,0x3a,0xf1,0xf0,
-0x64,0x44,0xf8,0x00,
-0x09,0x94,0x20,0xf1,
-0x50,0x06,0x1b,0xc5,
-0x0b,0xf8,0x00,0x00,
-0xbe,0xf9,0xff,0xff,
-0xfe,0xc5,0x02,0xf1,
-0xf0,0x64,0x44,0x80,
-0xc1,0xe0,0xb0,0x10,
-0x80,0xc1,0xe8,0xb0,
-0x10,0x80,0xc1,0xf0,
-0xc1,0x44,0xc1,0x4d,
-0xc1,0x56,0x1b,0xfe,
-0x00,0x08,0xfe,0xc2,
-0xb6,0xf1,0xf0,0x50,
-0x65,0x80,0x40,0x40,
-0xf9,0x00,0x09,0x74,
-0xc5,0x3a,0xc0,0x89,
-0xb0,0x13,0x19,0xc4,
-0x2b,0xb0,0x1d,0x09,
-0x76,0xf1,0x00,0x06,
-0x42,0xfb,0x00,0x08,
-0xf0,0xc0,0x93,0xfb,
-0x00,0x09,0x2c,0xc4,
-0x23,0xff,0x80,0x04,
-0xcc,0xc1,0xbf,0xfb,
-0x80,0xcc,0xcc,0xe1,
-0xdf,0xb0,0x03,0x40,
-0xb0,0x03,0x49,0xb0,
-0x03,0x52,0xfb,0x00,
-0x09,0xbc,0xc0,0x8b,
-0xb0,0x0e,0xe4,0xb0,
-0x0e,0xed,0xb0,0x0e,
-0xf6,0xe2,0x20,0xe2,
-0x69,0xe2,0xb2,0xc3,
-0x07,0xd8,0x28,0xc3,
-0x0f,0xd8,0x29,0xc3,
-0x17,0xd8,0x2a,0xc0,
-0x8b,0xe1,0x04,0xe1,
-0x4d,0xe1,0x96,0xc4,
-0x2b,0xf8,0x80,0x60,
-0x00,0xc1,0x80,0xc5,
-0x29,0xc3,0x2d,0xc3,
-0xb6,0xd9,0xfa,0x68,
-0xe9,0x6a,0xe9,0xb2,
-0x75,0xf1,0x00,0x06,
-0xa5,0xb0,0x1d,0x1b,
-0xc4,0x2b,0xf8,0x00,
-0x09,0x8c,0x24,0xf1,
-0x10,0x06,0xc8,0x71,
-0x31,0xc5,0x08,0x80,
-0xf9,0x00,0x08,0xf4,
-0xc6,0x81,0x25,0xe4,
-0x80,0xe4,0xc9,0x5b,
-0xfb,0x00,0x09,0xac,
-0x3e,0xc5,0x0a,0xfb,
-0x00,0x09,0x94,0x3e,
-0xfb,0x00,0x09,0xbc,
-0xc0,0x8b,0xf8,0x00,
-0x09,0xd8,0x24,0xf1,
-0x40,0x06,0xf7,0xfb,
-0x00,0x09,0xc8,0xc4,
-0x2b,0x19,0x31,0xfb,
-0x00,0x09,0xc8,0xc0,
-0x93,0xc3,0x29,0xc3,
-0xb2,0xd8,0x00,0xc5,
-0x09,0xfa,0x00,0x09,
-0xd4,0x39,0xf9,0x80,
-0x3f,0x07,0xc1,0x89,
-0xfa,0x80,0x17,0x19,
-0x56,0x64,0xf1,0x10,
-0x07,0x5f,0xf8,0x00,
-0x09,0xdc,0x24,0xf1,
-0x40,0x07,0x55,0xf9,
-0x00,0x08,0xf4,0x25,
-0xfa,0x00,0x09,0x08,
-0x2a,0x59,0xf1,0x10,
-0x07,0x55,0xf9,0x00,
-0x09,0x98,0x29,0x72,
-0x36,0xb0,0x1d,0x92,
-0xf1,0x30,0x07,0x55,
-0xf9,0x00,0x09,0x94,
-0x29,0x76,0x36,0x19,
-0x31,0xf8,0x00,0x09,
-0xa4,0x31,0xf8,0x00,
-0x09,0xd8,0xc5,0x09,
-0x31,0x18,0xf9,0x00,
-0x09,0xd4,0x34,0xf1,
-0x70,0x07,0x65,0x18,
-0xf9,0x00,0x09,0x98,
-0x34,0xf9,0x00,0x09,
-0xa8,0x34,0x19,0x1a,
-0xfb,0x00,0x09,0xb0,
-0xc4,0x23,0xfc,0x00,
-0x09,0x00,0xc0,0xe4,
-0x1b,0xb0,0x0f,0xe4,
-0xfd,0x00,0x09,0xb0,
-0xfe,0x00,0x09,0x2c,
-0xc5,0x1f,0xc0,0xd5,
-0xc0,0xc6,0xf4,0x00,
-0x0c,0x0e,0x25,0x61,
-0x58,0xb0,0x13,0x06,
-0xf4,0x00,0x0c,0x08,
-0x20,0x25,0x61,0x58,
-0xf4,0x00,0x06,0x06,
-0xf4,0x00,0x0c,0x08,
-0x20,0x25,0x61,0x58,
-0xf4,0x00,0x09,0x06,
-0xf4,0x00,0x0c,0x08,
-0xc0,0xc0,0xc0,0xc9,
-0x61,0x58,0xc7,0xaa,
-0xd2,0x92,0xc4,0x62,
-0xd4,0x54,0x5e,0xb0,
-0x11,0x36,0xb0,0x1f,
-0xff,0xf1,0x00,0x07,
-0x86,0xf8,0x00,0x09,
-0xa8,0x24,0x57,0xb0,
-0x0f,0x89,0x31,0x1b,
-0xf8,0x00,0x08,0xf0,
-0xc6,0x88,0xd2,0x49,
-0xfa,0x00,0x09,0x0c,
-0x2a,0x69,0xb0,0x22,
-0x0b,0xc6,0x88,0xfa,
-0x00,0x09,0x00,0x2a,
-0xc4,0x51,0xf1,0x10,
-0x08,0x04,0xfc,0x00,
-0x09,0x08,0xc0,0xe4,
-0xb0,0x0f,0xec,0xe1,
-0x2c,0xe1,0x21,0xf1,
-0x30,0x08,0x04,0x73,
-0x20,0xd2,0x00,0xb0,
-0x0e,0xca,0x56,0x64,
-0xf1,0x10,0x08,0x11,
-0x73,0xf8,0x00,0x09,
-0x9c,0x20,0xf9,0x00,
-0x09,0x10,0x25,0x64,
-0xf1,0x10,0x08,0x21,
-0x73,0xf8,0x00,0x09,
-0x90,0x33,0xf8,0x00,
-0x09,0xa8,0x20,0xf9,
-0x00,0x09,0x14,0x25,
-0xfa,0x00,0x09,0xa0,
-0x2e,0x64,0xf1,0x30,
-0x08,0x3f,0x73,0xf1,
-0x70,0x08,0x5e,0xf9,
-0x00,0x09,0x20,0x25,
-0x64,0xf1,0x10,0x08,
-0x5e,0xf8,0x00,0x09,
-0x9c,0x20,0xf9,0x00,
-0x09,0x1c,0x25,0x64,
-0x19,0xb0,0x20,0x09,
-0xf8,0x00,0x09,0xd8,
-0x31,0x1b,0x3b,0xf8,
-0x00,0x09,0x9c,0x24,
-0x71,0xfa,0x00,0x09,
-0x18,0x2a,0x6b,0x1a,
-0xd4,0x0a,0x31,0xf8,
-0x00,0x09,0xa4,0x20,
-0xf9,0x00,0x09,0x1c,
-0x25,0xfa,0x00,0x09,
-0x90,0x2e,0x73,0x64,
-0xd6,0x13,0xf8,0x00,
-0x08,0xf0,0x20,0xe4,
-0x00,0xf9,0x00,0x09,
-0xac,0x29,0x58,0x36,
-0xf8,0x00,0x09,0x90,
-0x24,0xfa,0x00,0x09,
-0xa8,0x2a,0xfb,0x00,
-0x09,0x20,0x2f,0x6e,
-0xf1,0x10,0x08,0xbe,
-0xfa,0x00,0x09,0xac,
-0x2a,0xfb,0x00,0x09,
-0x28,0x2f,0x6e,0xf1,
-0x10,0x08,0xbe,0xfb,
-0x00,0x09,0x24,0x2f,
-0x6e,0xf1,0x30,0x08,
-0xbe,0x71,0xfa,0x00,
-0x09,0xd4,0x2a,0x69,
-0xb0,0x1e,0x8a,0x31,
-0xfa,0x00,0x09,0xa4,
-0x2e,0x73,0x05,0xf1,
-0x20,0x08,0xea,0xc5,
-0x09,0xf8,0x00,0x09,
-0xd8,0x31,0xf8,0x00,
-0x09,0xdc,0x31,0xf8,
-0x00,0x09,0x94,0x31,
-0x1b,0xf8,0x00,0x09,
-0x98,0x33,0x3b,0x18,
-0x80,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x10,0x10,0x00,0x00,
-0x00,0x10,0x00,0x00,
-0x10,0xba,0x1b,0x00,
-0xbc,0x02,0x00,0x00,
-0x00,0x08,0x00,0x00,
-0x14,0x00,0x00,0x00,
-0xc8,0x00,0x00,0x00,
-0x04,0x00,0x00,0x00,
-0x32,0x00,0x00,0x00,
-0x00,0x04,0x00,0x00,
-0x10,0xfa,0xaf,0x00,
-0x10,0xfa,0x5e,0x01,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0xf8,0xff,0xff,0xff,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,
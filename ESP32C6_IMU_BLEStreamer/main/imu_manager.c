@@ -1,8 +1,17 @@
 #include "imu_manager.h"
+#include "sdkconfig.h"
+#if CONFIG_IMU_SENSORS_IIS2MDC
 #include "sensors/iis2mdc.h"
+#endif
+#if CONFIG_IMU_SENSORS_IIS3DWB
 #include "sensors/iis3dwb.h"
+#endif
+#if CONFIG_IMU_SENSORS_ICM45686
 #include "sensors/icm45686.h"
+#endif
+#if CONFIG_IMU_SENSORS_SCL3300
 #include "sensors/scl3300.h"
+#endif
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "driver/spi_master.h"
@@ -12,11 +21,33 @@
 
 static const char *TAG = "IMU_MANAGER";
 
-// Sensor handles
+// Sensor handles, for the drivers selected in menuconfig (IMU sensor drivers).
+// Sensors left out are never enabled and read as ESP_ERR_NOT_SUPPORTED.
+#if CONFIG_IMU_SENSORS_IIS2MDC
 static iis2mdc_handle_t mag_sensor;
+#define BUILT_MAGNETOMETER      SENSOR_MAGNETOMETER
+#else
+#define BUILT_MAGNETOMETER      0
+#endif
+#if CONFIG_IMU_SENSORS_IIS3DWB
 static iis3dwb_handle_t accel_sensor;
+#define BUILT_ACCELEROMETER     SENSOR_ACCELEROMETER
+#else
+#define BUILT_ACCELEROMETER     0
+#endif
+#if CONFIG_IMU_SENSORS_ICM45686
 static icm456xx_dev_t imu_6axis_sensor;
+#define BUILT_IMU_6AXIS         SENSOR_IMU_6AXIS
+#else
+#define BUILT_IMU_6AXIS         0
+#endif
+#if CONFIG_IMU_SENSORS_SCL3300
 static scl3300_t inclinometer_sensor;
+#define BUILT_INCLINOMETER      SENSOR_INCLINOMETER
+#else
+#define BUILT_INCLINOMETER      0
+#endif
+#define SENSORS_BUILT           (BUILT_MAGNETOMETER | BUILT_ACCELEROMETER | BUILT_IMU_6AXIS | BUILT_INCLINOMETER)
 
 // Configuration
 static uint32_t sampling_rate_hz = 100;
@@ -49,6 +80,9 @@ static SemaphoreHandle_t sensor_mutex = NULL;
 
 #define SPI_CLOCK_HZ            6000000
 
+#define ICM45686_ACCEL_FSR_G    16      // Full scales passed to icm456xx_start_accel/gyro
+#define ICM45686_GYRO_FSR_DPS   2000
+
 esp_err_t imu_manager_init(void)
 {
     ESP_LOGI(TAG, "Initializing IMU Manager...");
@@ -80,6 +114,7 @@ esp_err_t imu_manager_init(void)
     ESP_LOGI(TAG, "SPI bus initialized successfully (MISO=%d, MOSI=%d, CLK=%d)", 
              PIN_NUM_MISO, PIN_NUM_MOSI, PIN_NUM_CLK);
     
+#if CONFIG_IMU_SENSORS_IIS2MDC
     // Initialize IIS2MDC (Magnetometer)
     ret = iis2mdc_init(&mag_sensor, I2C_MASTER_BUS, I2C_MASTER_SDA, 
                       I2C_MASTER_SCL, I2C_MASTER_CLK_SPEED);
@@ -89,7 +124,9 @@ esp_err_t imu_manager_init(void)
         ESP_LOGI(TAG, "IIS2MDC initialized successfully");
         enabled_sensors |= SENSOR_MAGNETOMETER;
     }
+#endif
     
+#if CONFIG_IMU_SENSORS_IIS3DWB
     // Initialize IIS3DWB (Accelerometer)
     ret = iis3dwb_init_spi(&accel_sensor, SPI_HOST_1, PIN_NUM_CS_IIS3DWB);
     if (ret != ESP_OK) {
@@ -113,7 +150,9 @@ esp_err_t imu_manager_init(void)
             }
         }
     }
+#endif
     
+#if CONFIG_IMU_SENSORS_ICM45686
     // Initialize ICM45686 (IMU 6-axis)
     ret = icm456xx_init_spi(&imu_6axis_sensor, SPI_HOST_2, PIN_NUM_CS_ICM45686, SPI_CLOCK_HZ);
     if (ret != 0) {
@@ -123,8 +162,8 @@ esp_err_t imu_manager_init(void)
         if (ret != 0) {
             ESP_LOGW(TAG, "ICM45686 begin failed: %d", ret);
         } else {
-            icm456xx_start_accel(&imu_6axis_sensor, sampling_rate_hz, 16);
-            icm456xx_start_gyro(&imu_6axis_sensor, sampling_rate_hz, 2000);
+            icm456xx_start_accel(&imu_6axis_sensor, sampling_rate_hz, ICM45686_ACCEL_FSR_G);
+            icm456xx_start_gyro(&imu_6axis_sensor, sampling_rate_hz, ICM45686_GYRO_FSR_DPS);
             // Disable FIFO interrupt for now (pass GPIO_NUM_NC = -1 is causing error)
             // ret = icm456xx_enable_fifo_interrupt(&imu_6axis_sensor, PIN_NUM_INT_ICM45686, NULL, fifo_watermark);
             // if (ret != 0) {
@@ -134,7 +173,9 @@ esp_err_t imu_manager_init(void)
             enabled_sensors |= SENSOR_IMU_6AXIS;
         }
     }
+#endif
     
+#if CONFIG_IMU_SENSORS_SCL3300
     // Initialize SCL3300 (Inclinometer)
     ret = scl3300_init(SPI_HOST_3, PIN_NUM_CS_SCL3300, &inclinometer_sensor);
     if (ret != ESP_OK) {
@@ -148,6 +189,7 @@ esp_err_t imu_manager_init(void)
             enabled_sensors |= SENSOR_INCLINOMETER;
         }
     }
+#endif
     
     ESP_LOGI(TAG, "IMU Manager initialized. Enabled sensors: 0x%02X", enabled_sensors);
     return ESP_OK;
@@ -194,6 +236,7 @@ esp_err_t imu_manager_read_magnetometer(imu_data_t *data)
         return ESP_ERR_NOT_SUPPORTED;
     }
     
+#if CONFIG_IMU_SENSORS_IIS2MDC
     iis2mdc_raw_magnetometer_t raw_mag;
     int16_t temp_raw;
     
@@ -215,6 +258,9 @@ esp_err_t imu_manager_read_magnetometer(imu_data_t *data)
     }
     
     return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
 }
 
 esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
@@ -224,6 +270,7 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
         return ESP_ERR_NOT_SUPPORTED;
     }
     
+#if CONFIG_IMU_SENSORS_IIS3DWB
     float ax = 0.0f;
     float ay = 0.0f;
     float az = 0.0f;
@@ -239,6 +286,9 @@ esp_err_t imu_manager_read_accelerometer(imu_data_t *data)
     }
     
     return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
 }
 
 esp_err_t imu_manager_read_imu_6axis(imu_data_t *data)
@@ -248,25 +298,22 @@ esp_err_t imu_manager_read_imu_6axis(imu_data_t *data)
         return ESP_ERR_NOT_SUPPORTED;
     }
     
+#if CONFIG_IMU_SENSORS_ICM45686
     inv_imu_sensor_data_t sensor_data;
     int ret = icm456xx_get_data_from_registers(&imu_6axis_sensor, &sensor_data);
     
     if (ret == 0) {
-        // Convert raw data to engineering units
-        // Assuming 16-bit data and ±16g range for accel, ±2000dps for gyro
-        const float accel_scale = 16.0f / 32768.0f;  // ±16g
-        const float gyro_scale = 2000.0f / 32768.0f; // ±2000dps
+        // Convert raw data to engineering units at the full scales set in imu_manager_init
         
-        data->imu_6axis.accel_x_g = sensor_data.accel_data[0] * accel_scale;
-        data->imu_6axis.accel_y_g = sensor_data.accel_data[1] * accel_scale;
-        data->imu_6axis.accel_z_g = sensor_data.accel_data[2] * accel_scale;
+        data->imu_6axis.accel_x_g = icm456xx_accel_to_g(sensor_data.accel_data[0], ICM45686_ACCEL_FSR_G);
+        data->imu_6axis.accel_y_g = icm456xx_accel_to_g(sensor_data.accel_data[1], ICM45686_ACCEL_FSR_G);
+        data->imu_6axis.accel_z_g = icm456xx_accel_to_g(sensor_data.accel_data[2], ICM45686_ACCEL_FSR_G);
         
-        data->imu_6axis.gyro_x_dps = sensor_data.gyro_data[0] * gyro_scale;
-        data->imu_6axis.gyro_y_dps = sensor_data.gyro_data[1] * gyro_scale;
-        data->imu_6axis.gyro_z_dps = sensor_data.gyro_data[2] * gyro_scale;
+        data->imu_6axis.gyro_x_dps = icm456xx_gyro_to_dps(sensor_data.gyro_data[0], ICM45686_GYRO_FSR_DPS);
+        data->imu_6axis.gyro_y_dps = icm456xx_gyro_to_dps(sensor_data.gyro_data[1], ICM45686_GYRO_FSR_DPS);
+        data->imu_6axis.gyro_z_dps = icm456xx_gyro_to_dps(sensor_data.gyro_data[2], ICM45686_GYRO_FSR_DPS);
         
-        // Temperature conversion (assuming 8-bit temp)
-        data->imu_6axis.temperature_c = sensor_data.temp_data + 25.0f;
+        data->imu_6axis.temperature_c = icm456xx_temp_to_c(sensor_data.temp_data);
         
         data->imu_6axis.valid = true;
         return ESP_OK;
@@ -274,6 +321,9 @@ esp_err_t imu_manager_read_imu_6axis(imu_data_t *data)
         data->imu_6axis.valid = false;
         return ESP_FAIL;
     }
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
 }
 
 esp_err_t imu_manager_read_inclinometer(imu_data_t *data)
@@ -283,6 +333,7 @@ esp_err_t imu_manager_read_inclinometer(imu_data_t *data)
         return ESP_ERR_NOT_SUPPORTED;
     }
     
+#if CONFIG_IMU_SENSORS_SCL3300
     esp_err_t ret = scl3300_available(&inclinometer_sensor);
     if (ret == ESP_OK) {
         data->inclinometer.angle_x_deg = scl3300_get_angle_x(&inclinometer_sensor);
@@ -300,6 +351,9 @@ esp_err_t imu_manager_read_inclinometer(imu_data_t *data)
     }
     
     return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
 }
 
 esp_err_t imu_manager_set_sampling_rate(uint32_t rate_hz)
@@ -319,7 +373,7 @@ esp_err_t imu_manager_set_fifo_watermark(uint16_t watermark)
 esp_err_t imu_manager_enable_sensor(uint8_t sensor_id, bool enable)
 {
     if (enable) {
-        enabled_sensors |= sensor_id;
+        enabled_sensors |= sensor_id & SENSORS_BUILT;
     } else {
         enabled_sensors &= ~sensor_id;
     }
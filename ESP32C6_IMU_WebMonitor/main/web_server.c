@@ -1,6 +1,7 @@
 #include "web_server.h"
 #include "data_buffer.h"
 #include "imu_manager.h"
+#include "bus_stats.h"
 #include "led_status.h"
 #include "esp_log.h"
 #include "esp_spiffs.h"
@@ -207,6 +208,40 @@ static esp_err_t api_stats_handler(httpd_req_t *req)
     cJSON_AddNumberToObject(json, "buffer_count", data_buffer_get_count());
     cJSON_AddBoolToObject(json, "buffer_full", data_buffer_is_full());
     cJSON_AddBoolToObject(json, "buffer_empty", data_buffer_is_empty());
+
+    // Bus utilization: per-bus totals plus the devices behind them
+    cJSON *buses = cJSON_AddObjectToObject(json, "bus");
+    for (int b = 0; b < BUS_COUNT; b++) {
+        bus_summary_t summary;
+        if (bus_stats_get_bus((bus_id_t)b, &summary) != ESP_OK) {
+            continue;
+        }
+        cJSON *bus = cJSON_AddObjectToObject(buses, summary.name);
+        cJSON_AddNumberToObject(bus, "util_1s_pct", summary.util_short_pct);
+        cJSON_AddNumberToObject(bus, "util_10s_pct", summary.util_window_pct);
+        cJSON_AddNumberToObject(bus, "headroom_pct", summary.headroom_pct);
+        cJSON *devs = cJSON_AddArrayToObject(bus, "devices");
+        for (int d = 0; d < BUS_DEV_COUNT; d++) {
+            bus_device_stats_t dev;
+            if (bus_stats_get_device((bus_device_t)d, &dev) != ESP_OK || dev.bus != (bus_id_t)b) {
+                continue;
+            }
+            cJSON *item = cJSON_CreateObject();
+            cJSON_AddStringToObject(item, "name", dev.name);
+            cJSON_AddNumberToObject(item, "clock_hz", dev.clock_hz);
+            cJSON_AddNumberToObject(item, "transactions", dev.transactions);
+            cJSON_AddNumberToObject(item, "errors", dev.errors);
+            cJSON_AddNumberToObject(item, "bytes", (double)dev.bytes);
+            cJSON_AddNumberToObject(item, "busy_us", (double)dev.busy_us);
+            cJSON_AddNumberToObject(item, "wait_us", (double)dev.wait_us);
+            cJSON_AddNumberToObject(item, "max_wait_us", dev.max_wait_us);
+            cJSON_AddNumberToObject(item, "util_1s_pct", dev.util_short_pct);
+            cJSON_AddNumberToObject(item, "util_10s_pct", dev.util_window_pct);
+            cJSON_AddNumberToObject(item, "wait_10s_pct", dev.wait_window_pct);
+            cJSON_AddNumberToObject(item, "tps_10s", dev.tps_window);
+            cJSON_AddItemToArray(devs, item);
+        }
+    }
     
     char *json_string = cJSON_Print(json);
     if (json_string != NULL) {
@@ -0,0 +1,46 @@
+#include "bench.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "BENCH";
+
+static void bench_read(sensor_bench_result_t *r, esp_err_t (*read)(scl3300_t *dev), scl3300_t *dev) {
+    int64_t t0 = esp_timer_get_time();
+    esp_err_t ret = read(dev);
+    int64_t us = sensor_bench_timed(r, t0, ret == ESP_OK);
+    if (ret != ESP_OK) return;
+    r->samples++;
+    r->read_us += us;
+}
+
+static void bench_register(void *ctx, sensor_bench_result_t *r) {
+    bench_read(r, scl3300_available, ctx);
+}
+
+static void bench_burst(void *ctx, sensor_bench_result_t *r) {
+    bench_read(r, scl3300_read_accel_fast, ctx);
+}
+
+static const sensor_bench_mode_t bench_modes[BENCH_MODES] = {
+    { .name = "register", .step = bench_register },
+    { .name = "burst",    .step = bench_burst },
+};
+
+size_t bench_run(scl3300_t *dev, sensor_bench_result_t *results) {
+    const sensor_bench_t bench = {
+        .sensor = "SCL3300",
+        .odr_hz = BENCH_ODR_HZ,
+        .duration_ms = BENCH_DURATION_MS,
+        .bus_bytes = &dev->bus_bytes,
+        .ctx = dev,
+        .modes = bench_modes,
+        .mode_count = BENCH_MODES,
+    };
+    ESP_LOGI(TAG, "SCL3300 mode %d", dev->mode);
+
+    // Failed reads log from the driver; keep them out of the timing
+    esp_log_level_set("scl3300.c", ESP_LOG_NONE);
+    size_t done = sensor_bench_run(&bench, results);
+    esp_log_level_set("scl3300.c", ESP_LOG_INFO);
+    return done;
+}
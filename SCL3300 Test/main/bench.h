@@ -0,0 +1,26 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "scl3300.h"
+#include "sensor_bench.h"
+
+// Throughput benchmark of the SCL3300 driver on components/sensor_bench, built
+// instead of the print loop when BENCH_MODE is 1 in main.c. Modes:
+//   register  scl3300_available(): 7 outputs, command + dummy frame each
+//   burst     scl3300_read_accel_fast(): AccX..AccZ pipelined, 4 frames
+// The sensor has no FIFO and no data-ready flag, so every successful read counts as
+// a sample: "lost" is how far the read rate falls short of the ODR, and a rate above
+// the ODR means outputs were read more than once. Overruns are always 0 here; failed
+// reads include CRC and status errors.
+#ifndef BENCH_DURATION_MS
+#define BENCH_DURATION_MS       2000    // Per mode; stays under the task watchdog timeout
+#endif
+#define BENCH_ODR_HZ            2000    // Internal output rate, all modes
+#define BENCH_MODES             2
+
+// Bench API
+// Runs every mode on an initialized sensor into results[BENCH_MODES] and prints the
+// table. Returns the number of modes that ran.
+size_t bench_run(scl3300_t *dev, sensor_bench_result_t *results);
+
+#endif // BENCH_H
@@ -50,6 +50,7 @@ static esp_err_t scl3300_transfer(scl3300_t *dev, uint32_t cmd, uint32_t *resp)
         .rx_buffer = &rx,
     };
 
+    dev->bus_bytes += 4;
     esp_err_t ret = spi_device_transmit(dev->spi, &t);
     if (ret != ESP_OK) return ret;
 
@@ -183,6 +184,21 @@ esp_err_t scl3300_available(scl3300_t *dev) {
     return ESP_OK;
 }
 
+// Off-frame protocol: each frame returns the answer to the previous command, so the
+// next read can go out with the dummy frame that scl3300_read_reg() would waste.
+esp_err_t scl3300_read_accel_fast(scl3300_t *dev) {
+    static const uint32_t cmds[4] = { RdAccX, RdAccY, RdAccZ, SCL3300_NOP };
+    int16_t *out[3] = { &dev->data.AccX, &dev->data.AccY, &dev->data.AccZ };
+
+    for (int i = 0; i < 4; i++) {
+        ESP_RETURN_ON_ERROR(scl3300_transfer(dev, cmds[i], NULL), TAG, "transfer failed");
+        if (i == 0) continue;   // Answer to whatever was sent before
+        if (dev->crcerr || dev->statuserr) return ESP_FAIL;
+        *out[i - 1] = (int16_t)dev->last_data;
+    }
+    return ESP_OK;
+}
+
 // === Error registers ===
 uint16_t scl3300_get_errflag1(scl3300_t *dev) { uint32_t r; scl3300_transfer(dev, RdErrFlg1, &r); return dev->last_data; }
 uint16_t scl3300_get_errflag2(scl3300_t *dev) { uint32_t r; scl3300_transfer(dev, RdErrFlg2, &r); return dev->last_data; }
@@ -1,3 +1,6 @@
+#ifndef SCL3300_H
+#define SCL3300_H
+
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
 #include "esp_err.h"
@@ -61,12 +64,14 @@ typedef struct {
     uint8_t last_cmd;
     uint8_t last_crc;
     scl3300_data_t data;
+    uint32_t bus_bytes; // Bytes clocked on SPI (4 per frame)
 } scl3300_t;
 
 // === API ===
 esp_err_t scl3300_init(spi_host_device_t host, gpio_num_t cs_pin, scl3300_t *dev);
 esp_err_t scl3300_set_mode(scl3300_t *dev, uint8_t mode);
 esp_err_t scl3300_available(scl3300_t *dev);   // read all data
+esp_err_t scl3300_read_accel_fast(scl3300_t *dev); // AccX..AccZ only, pipelined (4 frames)
 bool      scl3300_is_connected(scl3300_t *dev);
 
 uint16_t  scl3300_get_errflag1(scl3300_t *dev);
@@ -88,3 +93,5 @@ double scl3300_get_accel_z(scl3300_t *dev);
 
 double scl3300_get_temp_c(scl3300_t *dev);
 double scl3300_get_temp_f(scl3300_t *dev);
+
+#endif // SCL3300_H
@@ -92,7 +92,7 @@ class ESP32FrameParser:
         
         try:
             # Parse header (14 bytes, little-endian)
-            header_data = struct.unpack('<HBBHIi', data[0:14])
+            header_data = struct.unpack('<HBBHII', data[0:14])
             header = FrameHeader(
                 frame_len=header_data[0],
                 version=header_data[1],
@@ -254,7 +254,7 @@ def parse_frame_simple(data: bytes) -> Optional[tuple[int, float, float, float]]
     
     try:
         # Parse header
-        _, _, _, _, _, sequence = struct.unpack('<HBBHIi', data[0:14])
+        _, _, _, _, _, sequence = struct.unpack('<HBBHII', data[0:14])
         
         # Parse TLV to find first accel data
         offset = 14
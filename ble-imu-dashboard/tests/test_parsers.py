@@ -0,0 +1,138 @@
+"""
+Property tests for the BLE frame parsers (core/esp32_parser.py, core/packet_parser.py).
+
+Notifications arrive from the radio as arbitrary bytes, so the parsers must never
+raise, and a frame built the way ESP32C6_IMU_BLEStreamer's ble_frame_build() builds
+it must decode to the values that went in.
+
+    pip install pytest hypothesis
+    python -m pytest tests
+"""
+import os
+import struct
+import sys
+
+from hypothesis import given, settings, strategies as st
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+from core import esp32_parser as ep  # noqa: E402
+from core.packet_parser import PacketParser  # noqa: E402
+
+HEADER = struct.Struct("<HBBHII")   # ble_frame_header_t
+I16 = st.integers(-32768, 32767)
+U32 = st.integers(0, 0xFFFFFFFF)
+
+# TLV type -> (SensorData fields, scale); two-byte values are temperatures
+TLV_FIELDS = {
+    ep.TLV_IIS3DWB_ACCEL: (("iis3dwb_accel_x", "iis3dwb_accel_y", "iis3dwb_accel_z"), ep.SCALE_ACCEL),
+    ep.TLV_ICM_ACCEL: (("icm_accel_x", "icm_accel_y", "icm_accel_z"), ep.SCALE_ACCEL),
+    ep.TLV_ICM_GYRO: (("gyro_x", "gyro_y", "gyro_z"), ep.SCALE_GYRO),
+    ep.TLV_ICM_TEMP: (("icm_temperature",), ep.SCALE_TEMP),
+    ep.TLV_MAG: (("mag_x", "mag_y", "mag_z"), ep.SCALE_MAG),
+    ep.TLV_MAG_TEMP: (("mag_temperature",), ep.SCALE_TEMP),
+    ep.TLV_SCL_ANGLE: (("angle_x", "angle_y", "angle_z"), ep.SCALE_ANGLE),
+    ep.TLV_SCL_ACCEL: (("scl_accel_x", "scl_accel_y", "scl_accel_z"), ep.SCALE_ACCEL),
+    ep.TLV_SCL_TEMP: (("scl_temperature",), ep.SCALE_TEMP),
+}
+
+
+@st.composite
+def records(draw):
+    """One TLV record per sensor, in ble_frame_build() order, each present or not."""
+    out = []
+    for tlv_type, (fields, _) in TLV_FIELDS.items():
+        if draw(st.booleans()):
+            out.append((tlv_type, draw(st.tuples(*[I16] * len(fields)))))
+    return out
+
+
+def build_frame(seq, timestamp_us, recs, flags=0):
+    payload = b"".join(bytes([t, 2 * len(v)]) + struct.pack("<%dh" % len(v), *v) for t, v in recs)
+    mask = 0
+    for t, _ in recs:
+        mask |= 1 << list(TLV_FIELDS).index(t)
+    return HEADER.pack(HEADER.size + len(payload), 1, flags, mask, timestamp_us, seq) + payload
+
+
+@settings(max_examples=2000)
+@given(st.binary(max_size=300))
+def test_esp32_parse_never_raises(data):
+    result = ep.ESP32FrameParser().parse(data)
+    assert result is None or isinstance(result[1], ep.SensorData)
+    ep.parse_frame_simple(data)
+
+
+@given(st.binary(min_size=HEADER.size, max_size=HEADER.size), st.binary(max_size=256))
+def test_esp32_parse_arbitrary_payload(header, payload):
+    # A valid header in front of garbage TLVs still yields a frame, never an exception
+    header = bytearray(header)
+    header[2] = 1
+    result = ep.ESP32FrameParser().parse(bytes(header) + payload)
+    assert result is not None
+
+
+@given(U32, U32, records())
+def test_esp32_round_trip(seq, timestamp_us, recs):
+    header, data = ep.ESP32FrameParser().parse(build_frame(seq, timestamp_us, recs))
+    assert header.sequence == seq
+    assert header.timestamp_us == timestamp_us
+    assert header.frame_len == HEADER.size + sum(2 + 2 * len(v) for _, v in recs)
+    for tlv_type, values in recs:
+        fields, scale = TLV_FIELDS[tlv_type]
+        for field, raw in zip(fields, values):
+            assert getattr(data, field) == raw / scale
+
+
+@given(U32, st.lists(records(), min_size=2, max_size=5))
+def test_esp32_sequence_tracking(first, frames):
+    # Consecutive sequence numbers, wrapping at 2^32 like the firmware's uint32_t
+    parser = ep.ESP32FrameParser()
+    for i, recs in enumerate(frames):
+        seq = (first + i) & 0xFFFFFFFF
+        header, _ = parser.parse(build_frame(seq, 0, recs))
+        assert header.sequence == seq
+    assert parser.get_stats()["last_sequence"] == (first + len(frames) - 1) & 0xFFFFFFFF
+    assert parser.get_stats()["frame_count"] == len(frames)
+
+
+@given(U32, records(), st.data())
+def test_esp32_truncated_frame(seq, recs, data):
+    # A notification cut short by the link keeps the records that arrived whole
+    frame = build_frame(seq, 0, recs)
+    cut = data.draw(st.integers(HEADER.size, len(frame)))
+    result = ep.ESP32FrameParser().parse(frame[:cut])
+    assert result is not None
+    offset = HEADER.size
+    for tlv_type, values in recs:
+        end = offset + 2 + 2 * len(values)
+        if end > cut:
+            break
+        fields, scale = TLV_FIELDS[tlv_type]
+        assert getattr(result[1], fields[0]) == values[0] / scale
+        offset = end
+
+
+@given(U32, records())
+def test_parse_frame_simple_first_accel(seq, recs):
+    accel = [v for t, v in recs if t in (ep.TLV_IIS3DWB_ACCEL, ep.TLV_ICM_ACCEL, ep.TLV_SCL_ACCEL)]
+    result = ep.parse_frame_simple(build_frame(seq, 0, recs))
+    if accel:
+        assert result == (seq,) + tuple(v / ep.SCALE_ACCEL for v in accel[0])
+    else:
+        assert result is None
+
+
+@settings(max_examples=1000)
+@given(st.binary(max_size=64))
+def test_packet_parser_never_raises(data):
+    result = PacketParser().parse(data)
+    assert len(result["values"]) == 3
+    if len(data) < 13:
+        assert result == {"sensor_id": 0, "values": (0.0, 0.0, 0.0)}
+
+
+@given(st.integers(0, 255), st.tuples(*[st.floats(width=32, allow_nan=False)] * 3), st.binary(max_size=16))
+def test_packet_parser_round_trip(sensor_id, values, trailer):
+    data = bytes([sensor_id]) + struct.pack("<3f", *values) + trailer
+    assert PacketParser().parse(data) == {"sensor_id": sensor_id, "values": values}
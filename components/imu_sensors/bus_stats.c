@@ -0,0 +1,199 @@
+#include "bus_stats.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+typedef struct {
+    uint32_t second;            // Uptime second this slot holds
+    uint32_t transactions;
+    uint32_t busy_cycles;
+    uint32_t wait_cycles;
+} bus_slot_t;
+
+typedef struct {
+    const char *name;
+    bus_id_t bus;
+    uint32_t clock_hz;
+    uint32_t transactions;
+    uint32_t errors;
+    uint64_t bytes;
+    uint64_t busy_cycles;
+    uint64_t wait_cycles;
+    uint32_t max_wait_cycles;
+    bus_slot_t slots[BUS_STATS_WINDOW_S];
+} bus_device_entry_t;
+
+static const char *const bus_names[BUS_COUNT] = {
+    [BUS_SPI2] = "spi2",
+    [BUS_I2C0] = "i2c0",
+};
+
+static bus_device_entry_t devices[BUS_DEV_COUNT] = {
+    [BUS_DEV_IIS3DWB]  = { .name = "iis3dwb",  .bus = BUS_SPI2 },
+    [BUS_DEV_ICM45686] = { .name = "icm45686", .bus = BUS_SPI2 },
+    [BUS_DEV_SCL3300]  = { .name = "scl3300",  .bus = BUS_SPI2 },
+    [BUS_DEV_IIS2MDC]  = { .name = "iis2mdc",  .bus = BUS_I2C0 },
+};
+
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void bus_stats_set_clock(bus_device_t dev, uint32_t clock_hz)
+{
+    if (dev < BUS_DEV_COUNT) {
+        devices[dev].clock_hz = clock_hz;
+    }
+}
+
+void bus_stats_begin(bus_stats_txn_t *txn)
+{
+    memset(txn, 0, sizeof(*txn));
+    txn->queued = esp_cpu_get_cycle_count();
+}
+
+void bus_stats_attach_spi(bus_stats_txn_t *txn, spi_transaction_t *t)
+{
+    t->user = txn;
+}
+
+// Called from the SPI ISR
+void IRAM_ATTR bus_stats_spi_pre_cb(spi_transaction_t *t)
+{
+    bus_stats_txn_t *txn = (bus_stats_txn_t *)t->user;
+    if (txn != NULL) {
+        txn->started = esp_cpu_get_cycle_count();
+        txn->started_valid = true;
+    }
+}
+
+void IRAM_ATTR bus_stats_spi_post_cb(spi_transaction_t *t)
+{
+    bus_stats_txn_t *txn = (bus_stats_txn_t *)t->user;
+    if (txn != NULL) {
+        txn->finished = esp_cpu_get_cycle_count();
+        txn->finished_valid = true;
+    }
+}
+
+void bus_stats_end(bus_device_t dev, bus_stats_txn_t *txn, size_t bytes, esp_err_t result)
+{
+    if (dev >= BUS_DEV_COUNT) {
+        return;
+    }
+
+    const uint32_t now = esp_cpu_get_cycle_count();
+    const uint32_t started = txn->started_valid ? txn->started : txn->queued;
+    const uint32_t finished = txn->finished_valid ? txn->finished : now;
+    const uint32_t wait = started - txn->queued;
+    const uint32_t busy = finished - started;
+    const uint32_t second = (uint32_t)(esp_timer_get_time() / 1000000);
+
+    bus_device_entry_t *d = &devices[dev];
+    bus_slot_t *slot = &d->slots[second % BUS_STATS_WINDOW_S];
+
+    taskENTER_CRITICAL(&stats_lock);
+    if (slot->second != second) {
+        memset(slot, 0, sizeof(*slot));
+        slot->second = second;
+    }
+    slot->transactions++;
+    slot->busy_cycles += busy;
+    slot->wait_cycles += wait;
+    d->transactions++;
+    d->bytes += bytes;
+    d->busy_cycles += busy;
+    d->wait_cycles += wait;
+    if (wait > d->max_wait_cycles) {
+        d->max_wait_cycles = wait;
+    }
+    if (result != ESP_OK) {
+        d->errors++;
+    }
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+// Sum the slots of the last `seconds` complete seconds (the current one is still
+// filling); returns how many seconds of uptime the sum actually covers
+static uint32_t sum_window(const bus_device_entry_t *d, uint32_t now_s, uint32_t seconds,
+                           uint64_t *busy, uint64_t *wait, uint32_t *transactions)
+{
+    *busy = 0;
+    *wait = 0;
+    *transactions = 0;
+    const uint32_t covered = (now_s < seconds) ? now_s : seconds;
+    for (uint32_t i = 0; i < BUS_STATS_WINDOW_S; i++) {
+        const bus_slot_t *slot = &d->slots[i];
+        if (slot->second < now_s && now_s - slot->second <= covered) {
+            *busy += slot->busy_cycles;
+            *wait += slot->wait_cycles;
+            *transactions += slot->transactions;
+        }
+    }
+    return covered;
+}
+
+static float pct_of(uint64_t cycles, uint32_t seconds, uint32_t cycles_per_us)
+{
+    if (seconds == 0) {
+        return 0.0f;
+    }
+    return (float)cycles * 100.0f / ((float)seconds * 1e6f * (float)cycles_per_us);
+}
+
+esp_err_t bus_stats_get_device(bus_device_t dev, bus_device_stats_t *stats)
+{
+    if (dev >= BUS_DEV_COUNT || stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const uint32_t cycles_per_us = esp_rom_get_cpu_ticks_per_us();
+    const uint32_t now_s = (uint32_t)(esp_timer_get_time() / 1000000);
+    bus_device_entry_t snapshot;
+    taskENTER_CRITICAL(&stats_lock);
+    snapshot = devices[dev];
+    taskEXIT_CRITICAL(&stats_lock);
+
+    uint64_t busy;
+    uint64_t wait;
+    uint32_t transactions;
+    const uint32_t short_s = sum_window(&snapshot, now_s, BUS_STATS_SHORT_S, &busy, &wait, &transactions);
+    stats->util_short_pct = pct_of(busy, short_s, cycles_per_us);
+    const uint32_t window_s = sum_window(&snapshot, now_s, BUS_STATS_WINDOW_S, &busy, &wait, &transactions);
+    stats->util_window_pct = pct_of(busy, window_s, cycles_per_us);
+    stats->wait_window_pct = pct_of(wait, window_s, cycles_per_us);
+    stats->tps_window = window_s ? (float)transactions / (float)window_s : 0.0f;
+
+    stats->name = snapshot.name;
+    stats->bus = snapshot.bus;
+    stats->clock_hz = snapshot.clock_hz;
+    stats->transactions = snapshot.transactions;
+    stats->errors = snapshot.errors;
+    stats->bytes = snapshot.bytes;
+    stats->busy_us = snapshot.busy_cycles / cycles_per_us;
+    stats->wait_us = snapshot.wait_cycles / cycles_per_us;
+    stats->max_wait_us = snapshot.max_wait_cycles / cycles_per_us;
+    return ESP_OK;
+}
+
+esp_err_t bus_stats_get_bus(bus_id_t bus, bus_summary_t *summary)
+{
+    if (bus >= BUS_COUNT || summary == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    summary->name = bus_names[bus];
+    summary->util_short_pct = 0.0f;
+    summary->util_window_pct = 0.0f;
+    for (int i = 0; i < BUS_DEV_COUNT; i++) {
+        bus_device_stats_t dev;
+        if (devices[i].bus == bus && bus_stats_get_device((bus_device_t)i, &dev) == ESP_OK) {
+            summary->util_short_pct += dev.util_short_pct;
+            summary->util_window_pct += dev.util_window_pct;
+        }
+    }
+    summary->headroom_pct = (summary->util_window_pct < 100.0f) ? 100.0f - summary->util_window_pct : 0.0f;
+    return ESP_OK;
+}
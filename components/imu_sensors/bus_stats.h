@@ -0,0 +1,100 @@
+#ifndef BUS_STATS_H
+#define BUS_STATS_H
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "driver/spi_master.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Per-device SPI/I2C accounting. Each transport wraps its transfer in
+// bus_stats_begin()/bus_stats_end(); on SPI the driver's pre/post callbacks stamp
+// the moment the transaction reaches the wire, which splits queue wait (another
+// device holds SPI2) from bus time. The I2C master driver has no such hook, so
+// I2C time is all counted as bus time. With CONFIG_IMU_SENSORS_BUS_STATS off the
+// hooks below compile to nothing and the getters return ESP_ERR_NOT_SUPPORTED.
+#define BUS_STATS_WINDOW_S      10      // Longest utilization window, in 1 s slots
+#define BUS_STATS_SHORT_S       1
+
+typedef enum {
+    BUS_DEV_IIS3DWB = 0,
+    BUS_DEV_ICM45686,
+    BUS_DEV_SCL3300,
+    BUS_DEV_IIS2MDC,
+    BUS_DEV_COUNT
+} bus_device_t;
+
+typedef enum {
+    BUS_SPI2 = 0,
+    BUS_I2C0,
+    BUS_COUNT
+} bus_id_t;
+
+// Per-transaction stamps; lives on the caller's stack
+typedef struct {
+    uint32_t queued;            // CPU cycles when the transfer was submitted
+    uint32_t started;           // When it reached the wire (SPI pre_cb)
+    uint32_t finished;          // When the wire went idle (SPI post_cb)
+    bool started_valid;
+    bool finished_valid;
+} bus_stats_txn_t;
+
+typedef struct {
+    const char *name;
+    bus_id_t bus;
+    uint32_t clock_hz;
+    uint32_t transactions;      // Since boot
+    uint32_t errors;
+    uint64_t bytes;
+    uint64_t busy_us;
+    uint64_t wait_us;
+    uint32_t max_wait_us;
+    float util_short_pct;       // Bus time over the last BUS_STATS_SHORT_S seconds
+    float util_window_pct;      // ... over the last BUS_STATS_WINDOW_S seconds
+    float wait_window_pct;      // Queue wait over the window, share of wall time
+    float tps_window;           // Transactions per second over the window
+} bus_device_stats_t;
+
+typedef struct {
+    const char *name;
+    float util_short_pct;       // Sum over the devices on the bus
+    float util_window_pct;
+    float headroom_pct;         // 100 - util_window_pct
+} bus_summary_t;
+
+// Bus stats API
+#if CONFIG_IMU_SENSORS_BUS_STATS
+// Record the device clock once its bus device is added
+void bus_stats_set_clock(bus_device_t dev, uint32_t clock_hz);
+void bus_stats_begin(bus_stats_txn_t *txn);
+// SPI only: route the transaction's callbacks to txn (sets t->user)
+void bus_stats_attach_spi(bus_stats_txn_t *txn, spi_transaction_t *t);
+void bus_stats_end(bus_device_t dev, bus_stats_txn_t *txn, size_t bytes, esp_err_t result);
+// spi_device_interface_config_t pre_cb/post_cb for devices using bus_stats_attach_spi()
+void bus_stats_spi_pre_cb(spi_transaction_t *t);
+void bus_stats_spi_post_cb(spi_transaction_t *t);
+esp_err_t bus_stats_get_device(bus_device_t dev, bus_device_stats_t *stats);
+esp_err_t bus_stats_get_bus(bus_id_t bus, bus_summary_t *summary);
+#else
+static inline void bus_stats_set_clock(bus_device_t dev, uint32_t clock_hz) { (void)dev; (void)clock_hz; }
+static inline void bus_stats_begin(bus_stats_txn_t *txn) { (void)txn; }
+static inline void bus_stats_attach_spi(bus_stats_txn_t *txn, spi_transaction_t *t) { (void)txn; (void)t; }
+static inline void bus_stats_end(bus_device_t dev, bus_stats_txn_t *txn, size_t bytes, esp_err_t result)
+{
+    (void)dev; (void)txn; (void)bytes; (void)result;
+}
+#define bus_stats_spi_pre_cb    NULL
+#define bus_stats_spi_post_cb   NULL
+static inline esp_err_t bus_stats_get_device(bus_device_t dev, bus_device_stats_t *stats)
+{
+    (void)dev; (void)stats;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+static inline esp_err_t bus_stats_get_bus(bus_id_t bus, bus_summary_t *summary)
+{
+    (void)bus; (void)summary;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif // CONFIG_IMU_SENSORS_BUS_STATS
+
+#endif // BUS_STATS_H
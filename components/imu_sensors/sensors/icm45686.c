@@ -7,12 +7,12 @@
 #include "esp_err.h"
 #include "esp_rom_sys.h"
 #include "driver/gpio.h"
+#include "bus_stats.h"
 
 static const char *TAG = "ICM45686_C";
 
 #define SPI_READ_BIT (0x80)
 #define DEFAULT_SPI_CLOCK_HZ 6000000
-#define GYR_STARTUP_TIME_US 5000
 #define DEFAULT_WOM_THS_MG (52 >> 2) /* matches Arduino code */
 
 /* single global pointer used by the inv driver callbacks (matches original design) */
@@ -34,7 +34,11 @@ static esp_err_t icm456xx_spi_transmit(icm456xx_dev_t *dev, const uint8_t *txbuf
     t.length = len_bits; /* in bits */
     t.tx_buffer = txbuf;
     t.rx_buffer = rxbuf;
+    bus_stats_txn_t txn;
+    bus_stats_begin(&txn);
+    bus_stats_attach_spi(&txn, &t);
     esp_err_t ret = spi_device_transmit(dev->spi_handle, &t);
+    bus_stats_end(BUS_DEV_ICM45686, &txn, len_bits / 8, ret);
     return ret;
 }
 
@@ -129,7 +133,10 @@ int icm456xx_begin(icm456xx_dev_t *dev)
         .mode = 3, /* SPI_MODE3 to match Arduino code */
         .spics_io_num = dev->cs_gpio,
         .queue_size = 1,
+        .pre_cb = bus_stats_spi_pre_cb,
+        .post_cb = bus_stats_spi_post_cb,
     };
+    bus_stats_set_clock(BUS_DEV_ICM45686, dev->clk_hz);
 
     esp_err_t ret = spi_bus_add_device(dev->spi_host, &devcfg, &dev->spi_handle);
     if (ret != ESP_OK) {
@@ -144,7 +151,8 @@ int icm456xx_begin(icm456xx_dev_t *dev)
     dev->icm_driver.transport.sleep_us = transport_sleep_us;
 
     /* set FIFO callback */
-    ((inv_imu_adv_var_t *)&dev->icm_driver.adv_var)->sensor_event_cb = fifo_sensor_event_cb;
+    inv_imu_adv_var_t *adv = (inv_imu_adv_var_t *)dev->icm_driver.adv_var;
+    adv->sensor_event_cb = fifo_sensor_event_cb;
 
     /* set global pointer used by callbacks */
     icm_dev_ptr = dev;
@@ -198,6 +206,57 @@ static gyro_config0_gyro_ui_fs_sel_t gyro_fsr_dps_to_param(uint16_t gyro_fsr_dps
     return ret;
 }
 
+/* full scale actually selected by the mapping functions above, in g / dps */
+static float accel_fsr_g_value(uint16_t accel_fsr_g)
+{
+    switch(accel_fsr_g) {
+    case 2:
+    case 4:
+    case 8:
+#if INV_IMU_HIGH_FSR_SUPPORTED
+    case 32:
+#endif
+        return (float)accel_fsr_g;
+    default:
+        return 16.0f;
+    }
+}
+
+static float gyro_fsr_dps_value(uint16_t gyro_fsr_dps)
+{
+    switch(gyro_fsr_dps) {
+    case 15:  return 15.625f;
+    case 31:  return 31.25f;
+    case 62:  return 62.5f;
+    case 125:
+    case 250:
+    case 500:
+    case 1000:
+#if INV_IMU_HIGH_FSR_SUPPORTED
+    case 4000:
+#endif
+        return (float)gyro_fsr_dps;
+    default:
+        return 2000.0f;
+    }
+}
+
+float icm456xx_accel_to_g(int16_t raw, uint16_t fsr_g)
+{
+    return (float)raw * (accel_fsr_g_value(fsr_g) / 32768.0f);
+}
+
+float icm456xx_gyro_to_dps(int16_t raw, uint16_t fsr_dps)
+{
+    return (float)raw * (gyro_fsr_dps_value(fsr_dps) / 32768.0f);
+}
+
+/* 128 LSB/degC around 25 degC (the FIFO's 8-bit value is 2 LSB/degC) */
+float icm456xx_temp_to_c(int16_t raw)
+{
+    return (float)raw / 128.0f + 25.0f;
+}
+
 static accel_config0_accel_odr_t accel_freq_to_param(uint16_t accel_freq_hz)
 {
     accel_config0_accel_odr_t ret = ACCEL_CONFIG0_ACCEL_ODR_100_HZ;
@@ -283,13 +342,6 @@ int icm456xx_get_data_from_registers(icm456xx_dev_t *dev, inv_imu_sensor_data_t
 /* Setup IRQ: configure gpio + isr handler (user_isr gets called from ISR context)
    user_isr signature: void (*user_isr)(void*)
 */
-static void gpio_isr_trampoline(void* arg)
-{
-    /* arg is icm456xx_dev_t* and trampoline stored user handler in dev->icm_driver... we store handler pointer via gpio's arg */
-    void (*user_handler)(void*) = (void(*)(void*))arg;
-    if (user_handler) user_handler(NULL);
-}
-
 int icm456xx_enable_fifo_interrupt(icm456xx_dev_t *dev, int int_gpio, void (*user_isr)(void*), uint8_t fifo_watermark)
 {
     if (!dev) return -1;
@@ -446,6 +498,7 @@ int icm456xx_get_gaf_quat(icm456xx_dev_t *dev, float *w, float *x, float *y, flo
 }
 #endif /* GAF */
 
+#if CONFIG_IMU_SENSORS_ICM45686_APEX
 /* APEX convenience functions: mostly wrappers of the original logic */
 int icm456xx_set_apex_interrupt(icm456xx_dev_t *dev, int int_gpio, void (*user_isr)(void*))
 {
@@ -709,6 +762,8 @@ int icm456xx_get_raise_to_wake(icm456xx_dev_t *dev)
     }
 }
 
+#endif /* CONFIG_IMU_SENSORS_ICM45686_APEX */
+
 /* deinit: remove spi device */
 int icm456xx_deinit(icm456xx_dev_t *dev)
 {
@@ -1,18 +1,28 @@
 #include "iis2mdc.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "bus_stats.h"
 
 static const char *TAG = "IIS2MDC";
 
 static esp_err_t iis2mdc_write_reg(iis2mdc_handle_t *sensor, uint8_t reg, uint8_t data) {
     uint8_t buf[2] = { reg, data };
-    return i2c_master_transmit(sensor->dev_handle, buf, 2, -1);
+    bus_stats_txn_t txn;
+    bus_stats_begin(&txn);
+    esp_err_t ret = i2c_master_transmit(sensor->dev_handle, buf, 2, -1);
+    bus_stats_end(BUS_DEV_IIS2MDC, &txn, 2, ret);
+    return ret;
 }
 
 static esp_err_t iis2mdc_read_reg(iis2mdc_handle_t *sensor, uint8_t reg, uint8_t *data, size_t len) {
+    bus_stats_txn_t txn;
+    bus_stats_begin(&txn);
     esp_err_t ret = i2c_master_transmit(sensor->dev_handle, &reg, 1, -1);
-    if (ret != ESP_OK) return ret;
-    return i2c_master_receive(sensor->dev_handle, data, len, -1);
+    if (ret == ESP_OK) {
+        ret = i2c_master_receive(sensor->dev_handle, data, len, -1);
+    }
+    bus_stats_end(BUS_DEV_IIS2MDC, &txn, 1 + len, ret);
+    return ret;
 }
 
 esp_err_t iis2mdc_init(iis2mdc_handle_t *sensor, i2c_port_t port, gpio_num_t sda, gpio_num_t scl, uint32_t clk_speed_hz) {
@@ -32,6 +42,7 @@ esp_err_t iis2mdc_init(iis2mdc_handle_t *sensor, i2c_port_t port, gpio_num_t sda
         .device_address = IIS2MDC_I2C_ADDR,
         .scl_speed_hz = clk_speed_hz
     };
+    bus_stats_set_clock(BUS_DEV_IIS2MDC, clk_speed_hz);
 
     ESP_RETURN_ON_ERROR(i2c_master_bus_add_device(sensor->bus_handle, &dev_cfg, &sensor->dev_handle), TAG, "Failed to add I2C device");
 
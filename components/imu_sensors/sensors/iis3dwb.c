@@ -1,4 +1,5 @@
 #include "iis3dwb.h"
+#include "bus_stats.h"
 #include "esp_log.h"
 #include <string.h>
 
@@ -10,7 +11,12 @@ static esp_err_t spi_transfer(iis3dwb_handle_t *dev, const uint8_t *tx, uint8_t
         .tx_buffer = tx,
         .rx_buffer = rx
     };
-    return spi_device_transmit(dev->spi, &t);
+    bus_stats_txn_t txn;
+    bus_stats_begin(&txn);
+    bus_stats_attach_spi(&txn, &t);
+    esp_err_t ret = spi_device_transmit(dev->spi, &t);
+    bus_stats_end(BUS_DEV_IIS3DWB, &txn, len, ret);
+    return ret;
 }
 
 esp_err_t iis3dwb_init_spi(iis3dwb_handle_t *dev, spi_host_device_t host, gpio_num_t cs_pin) {
@@ -18,8 +24,11 @@ esp_err_t iis3dwb_init_spi(iis3dwb_handle_t *dev, spi_host_device_t host, gpio_n
         .clock_speed_hz = 10 * 1000 * 1000,
         .mode = 3,
         .spics_io_num = cs_pin,
-        .queue_size = 1
+        .queue_size = 1,
+        .pre_cb = bus_stats_spi_pre_cb,
+        .post_cb = bus_stats_spi_post_cb
     };
+    bus_stats_set_clock(BUS_DEV_IIS3DWB, devcfg.clock_speed_hz);
     return spi_bus_add_device(host, &devcfg, &dev->spi);
 }
 
@@ -53,7 +62,7 @@ esp_err_t iis3dwb_device_init(iis3dwb_handle_t *dev) {
 }
 
 esp_err_t iis3dwb_configure(iis3dwb_handle_t *dev, iis3dwb_fs_t fs, iis3dwb_odr_t odr) {
-    uint8_t ctrl1 = (uint8_t)fs | (uint8_t)odr | 0x05; // XL_EN=101
+    uint8_t ctrl1 = (uint8_t)fs | (uint8_t)odr; // ODR field [7:5] is XL_EN; bits [1:0] must stay 0
     return iis3dwb_write_reg(dev, IIS3DWB_CTRL1_XL, &ctrl1, 1);
 }
 
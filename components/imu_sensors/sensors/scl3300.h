@@ -49,11 +49,15 @@ typedef struct {
     uint16_t WHOAMI;
 } scl3300_data_t;
 
+// Acceleration in g from a raw AccX/Y/Z reading, specialized per mode
+typedef double (*scl3300_accel_fn_t)(int16_t raw);
+
 // === Device context ===
 typedef struct {
     spi_device_handle_t spi;
     gpio_num_t cs_pin;
     uint8_t mode;       // 1..4
+    scl3300_accel_fn_t accel_to_g;  // Selected by scl3300_set_mode()
     bool fast_read;
     bool crcerr;
     bool statuserr;
@@ -77,6 +81,10 @@ uint16_t  scl3300_powerdown(scl3300_t *dev);
 uint16_t  scl3300_wakeup(scl3300_t *dev);
 uint16_t  scl3300_reset(scl3300_t *dev);
 
+// CRC-8 (poly 0x1D, init 0xFF, inverted) of bits [31:8] of a 32-bit SPI frame;
+// a response is valid when it equals the frame's low byte
+uint8_t   scl3300_calculate_crc(uint32_t frame);
+
 // === Calculated values ===
 double scl3300_get_angle_x(scl3300_t *dev);
 double scl3300_get_angle_y(scl3300_t *dev);
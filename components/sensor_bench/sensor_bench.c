@@ -0,0 +1,76 @@
+#include "sensor_bench.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+
+static const char *TAG = "BENCH";
+
+int64_t sensor_bench_timed(sensor_bench_result_t *r, int64_t t0, bool ok)
+{
+    int64_t us = esp_timer_get_time() - t0;
+    r->busy_us += us;
+    if (!ok) r->errors++;
+    return us;
+}
+
+static void bench_mode(const sensor_bench_t *bench, const sensor_bench_mode_t *mode, sensor_bench_result_t *r)
+{
+    *r = (sensor_bench_result_t){ .mode = mode->name };
+    uint32_t bytes0 = *bench->bus_bytes;
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + bench->duration_ms * 1000LL;
+    while (esp_timer_get_time() < end) {
+        mode->step(bench->ctx, r);
+    }
+    uint32_t queued = mode->queued ? mode->queued(bench->ctx, r) : 0;
+    r->elapsed_us = esp_timer_get_time() - start;
+    r->bus_bytes = *bench->bus_bytes - bytes0;
+    uint32_t produced = (uint32_t)(r->elapsed_us * bench->odr_hz / 1000000);
+    r->expected = (produced > queued) ? produced - queued : 0;
+}
+
+size_t sensor_bench_run(const sensor_bench_t *bench, sensor_bench_result_t *results)
+{
+    size_t done = 0;
+    ESP_LOGI(TAG, "%s throughput, %lu ms per mode, ODR %lu Hz", bench->sensor,
+             (unsigned long)bench->duration_ms, (unsigned long)bench->odr_hz);
+
+    for (size_t i = 0; i < bench->mode_count; i++) {
+        const sensor_bench_mode_t *mode = &bench->modes[i];
+        if (i > 0) {
+            vTaskDelay(pdMS_TO_TICKS(100));     // Let the idle task feed the watchdog
+        }
+        if (mode->setup != NULL && mode->setup(bench->ctx) != ESP_OK) {
+            ESP_LOGE(TAG, "%s: setup failed", mode->name);
+            break;
+        }
+        bench_mode(bench, mode, &results[i]);
+        done++;
+    }
+
+    sensor_bench_print(results, done);
+    return done;
+}
+
+void sensor_bench_print(const sensor_bench_result_t *results, size_t count)
+{
+    printf("\n%-11s %8s %8s %8s %9s %8s %6s %7s %5s %5s\n",
+           "mode", "samples", "rate/s", "max/s", "us/sample", "B/sample", "busy%", "lost", "ovr", "err");
+    for (size_t i = 0; i < count; i++) {
+        const sensor_bench_result_t *r = &results[i];
+        float seconds = r->elapsed_us / 1e6f;
+        float read_s = r->read_us / 1e6f;
+        uint32_t lost = (r->expected > r->samples) ? r->expected - r->samples : 0;
+        printf("%-11s %8lu %8.0f %8.0f %9.2f %8.1f %6.1f %7lu %5lu %5lu\n",
+               r->mode, (unsigned long)r->samples,
+               (seconds > 0) ? r->samples / seconds : 0.0f,
+               (read_s > 0) ? r->samples / read_s : 0.0f,
+               r->samples ? (float)r->read_us / r->samples : 0.0f,
+               r->samples ? (float)r->bus_bytes / r->samples : 0.0f,
+               (r->elapsed_us > 0) ? 100.0f * r->busy_us / r->elapsed_us : 0.0f,
+               (unsigned long)lost, (unsigned long)r->overruns, (unsigned long)r->errors);
+    }
+    printf("\n");
+}
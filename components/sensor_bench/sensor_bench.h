@@ -0,0 +1,60 @@
+#ifndef SENSOR_BENCH_H
+#define SENSOR_BENCH_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Throughput benchmark shared by the single-sensor test projects. A project lists
+// its read paths in a mode table; sensor_bench_run() runs each one as fast as it
+// can for duration_ms and prints the results as one table. Columns: delivered rate;
+// the rate the read path could sustain, from the time spent in the transactions
+// that returned data; that time per sample; bus bytes per sample, status polls and
+// address bytes included; share of the run spent in driver calls; samples lost
+// against the ODR; overrun flags the sensor reported; failed transactions. The SPI
+// and I2C drivers block while the transfer runs, so the times are an upper bound on
+// the CPU cost of the read path.
+
+typedef struct {
+    const char *mode;
+    uint32_t samples;           // Samples received
+    uint32_t expected;          // ODR x run time, less what was still queued at the end
+    uint32_t overruns;          // Overrun flags reported by the sensor
+    uint32_t errors;            // Failed transactions
+    uint32_t bus_bytes;
+    int64_t elapsed_us;
+    int64_t busy_us;            // Time inside driver calls
+    int64_t read_us;            // Part of busy_us spent in transactions that returned data
+} sensor_bench_result_t;
+
+typedef struct {
+    const char *name;
+    // Optional; runs before the timed loop, e.g. to flush a FIFO. A failure ends the run.
+    esp_err_t (*setup)(void *ctx);
+    // One pass of the read loop: read whatever is ready, time the driver calls with
+    // sensor_bench_timed() and count samples, read_us and overruns in r
+    void (*step)(void *ctx, sensor_bench_result_t *r);
+    // Optional; samples still queued in the sensor when the run ends
+    uint32_t (*queued)(void *ctx, sensor_bench_result_t *r);
+} sensor_bench_mode_t;
+
+typedef struct {
+    const char *sensor;         // For the log line
+    uint32_t odr_hz;
+    uint32_t duration_ms;       // Per mode; keep it under the task watchdog timeout
+    const uint32_t *bus_bytes;  // The driver's running count of bytes on the bus
+    void *ctx;                  // Passed to every mode callback
+    const sensor_bench_mode_t *modes;
+    size_t mode_count;
+} sensor_bench_t;
+
+// Sensor bench API
+// Runs the modes in order into results[mode_count] and prints the table. Returns the
+// number of modes that ran; a failed setup stops the run there.
+size_t sensor_bench_run(const sensor_bench_t *bench, sensor_bench_result_t *results);
+void sensor_bench_print(const sensor_bench_result_t *results, size_t count);
+// Adds the time since t0 to r->busy_us, counts an error unless ok, and returns that time
+int64_t sensor_bench_timed(sensor_bench_result_t *r, int64_t t0, bool ok);
+
+#endif // SENSOR_BENCH_H
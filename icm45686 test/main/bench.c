@@ -0,0 +1,123 @@
+#include "bench.h"
+#include <stdbool.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_rom_sys.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "bench";
+
+/* accel_bit set, ext_header clear: an accel+gyro frame rather than an empty/invalid one */
+#define FRAME_VALID(header)     (((header) & 0xC0) == 0x40)
+
+static uint8_t fifo_buf[BENCH_FIFO_CHUNK * BENCH_FIFO_FRAME_BYTES];
+
+static void bench_register(void *ctx, sensor_bench_result_t *r)
+{
+    icm456xx_dev_t *dev = ctx;
+    inv_imu_sensor_data_t data;
+    int64_t t0 = esp_timer_get_time();
+    int rc = icm456xx_get_data_from_registers(dev, &data);
+    int64_t us = sensor_bench_timed(r, t0, rc == 0);
+    if (rc != 0) return;
+    r->samples++;
+    r->read_us += us;
+}
+
+static esp_err_t fifo_restart(void *ctx)
+{
+    icm456xx_dev_t *dev = ctx;
+    inv_imu_fifo_config_t cfg = {
+        .gyro_en = true,
+        .accel_en = true,
+        .hires_en = false,
+        .fifo_wm_th = BENCH_FIFO_CHUNK,
+        .fifo_mode = FIFO_CONFIG0_FIFO_MODE_BYPASS,     /* flushes the FIFO */
+        .fifo_depth = FIFO_CONFIG0_FIFO_DEPTH_MAX
+    };
+    int rc = inv_imu_set_fifo_config(&dev->icm_driver, &cfg);
+    cfg.fifo_mode = FIFO_CONFIG0_FIFO_MODE_STREAM;
+    rc |= inv_imu_set_fifo_config(&dev->icm_driver, &cfg);
+    return (rc == 0) ? ESP_OK : ESP_FAIL;
+}
+
+static void bench_fifo(icm456xx_dev_t *dev, sensor_bench_result_t *r, bool burst)
+{
+    uint16_t level = 0;
+    int64_t t0 = esp_timer_get_time();
+    int rc = icm456xx_get_fifo_count(dev, &level);
+    int64_t count_us = sensor_bench_timed(r, t0, rc == 0);
+    if (rc != 0) return;
+    if (level < BENCH_FIFO_CHUNK) {
+        /* wait off the bus for the rest of the chunk instead of polling the count */
+        esp_rom_delay_us((BENCH_FIFO_CHUNK - level) * 1000000 / BENCH_ODR_HZ + 1);
+        return;
+    }
+
+    r->read_us += count_us;
+    if (burst) {
+        t0 = esp_timer_get_time();
+        rc = icm456xx_read_fifo_burst(dev, fifo_buf, BENCH_FIFO_CHUNK);
+        r->read_us += sensor_bench_timed(r, t0, rc == 0);
+        if (rc != 0) return;
+        for (int i = 0; i < BENCH_FIFO_CHUNK; i++) {
+            if (FRAME_VALID(fifo_buf[i * BENCH_FIFO_FRAME_BYTES])) r->samples++;
+        }
+    } else {
+        for (int i = 0; i < BENCH_FIFO_CHUNK; i++) {
+            inv_imu_fifo_data_t frame;
+            t0 = esp_timer_get_time();
+            rc = icm456xx_get_data_from_fifo(dev, &frame);
+            r->read_us += sensor_bench_timed(r, t0, rc == 0);
+            if (rc != 0) break;
+            if (FRAME_VALID(frame.header.Byte)) r->samples++;
+        }
+    }
+}
+
+static void bench_fifo_frame(void *ctx, sensor_bench_result_t *r)
+{
+    bench_fifo(ctx, r, false);
+}
+
+static void bench_fifo_burst(void *ctx, sensor_bench_result_t *r)
+{
+    bench_fifo(ctx, r, true);
+}
+
+static uint32_t fifo_queued(void *ctx, sensor_bench_result_t *r)
+{
+    uint16_t level = 0;
+    if (icm456xx_get_fifo_count(ctx, &level) != 0) level = 0;
+    return level;
+}
+
+static const sensor_bench_mode_t bench_modes[BENCH_MODES] = {
+    { .name = "register", .step = bench_register },
+    { .name = "fifo",  .setup = fifo_restart, .step = bench_fifo_frame, .queued = fifo_queued },
+    { .name = "burst", .setup = fifo_restart, .step = bench_fifo_burst, .queued = fifo_queued },
+};
+
+size_t bench_run(icm456xx_dev_t *dev, sensor_bench_result_t *results)
+{
+    const sensor_bench_t bench = {
+        .sensor = "ICM45686",
+        .odr_hz = BENCH_ODR_HZ,
+        .duration_ms = BENCH_DURATION_MS,
+        .bus_bytes = &dev->bus_bytes,
+        .ctx = dev,
+        .modes = bench_modes,
+        .mode_count = BENCH_MODES,
+    };
+
+    int rc = icm456xx_start_accel(dev, BENCH_ODR_HZ, 16);
+    rc |= icm456xx_start_gyro(dev, BENCH_ODR_HZ, 2000);
+    if (rc != 0) {
+        ESP_LOGE(TAG, "failed to set ODR: %d", rc);
+        return 0;
+    }
+    vTaskDelay(pdMS_TO_TICKS(50));      /* gyro start-up */
+
+    return sensor_bench_run(&bench, results);
+}
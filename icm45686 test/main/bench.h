@@ -0,0 +1,32 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "icm45686.h"
+#include "sensor_bench.h"
+
+/* Throughput benchmark of the ICM45686 driver on components/sensor_bench, built
+ * instead of the polling demo when BENCH_MODE is 1 in main.c. Accel and gyro run at
+ * BENCH_ODR_HZ. Modes:
+ *   register  icm456xx_get_data_from_registers(), no data-ready check
+ *   fifo      FIFO count, then one icm456xx_get_data_from_fifo() per frame
+ *   burst     FIFO count, then BENCH_FIFO_CHUNK frames in one transaction
+ * In register mode every successful read counts as a sample, so "lost" is how far
+ * the read rate falls short of the ODR and a rate above it means duplicate reads.
+ * FIFO modes run in stream mode; frames dropped on a full FIFO show up as lost.
+ * Bytes include the FIFO count reads; overruns are always 0 here.
+ */
+#ifndef BENCH_DURATION_MS
+#define BENCH_DURATION_MS       2000    /* per mode; stays under the task watchdog timeout */
+#endif
+#define BENCH_ODR_HZ            6400
+#define BENCH_FIFO_CHUNK        32      /* frames per burst transaction */
+#define BENCH_FIFO_FRAME_BYTES  16      /* accel + gyro, 16-bit */
+#define BENCH_MODES             3
+
+/* Runs every mode on a started device into results[BENCH_MODES] and prints the
+ * table; returns the number of modes that ran. The SPI bus needs max_transfer_sz >=
+ * BENCH_FIFO_CHUNK * BENCH_FIFO_FRAME_BYTES + 1. Leaves accel and gyro at
+ * BENCH_ODR_HZ with the FIFO in stream mode. */
+size_t bench_run(icm456xx_dev_t *dev, sensor_bench_result_t *results);
+
+#endif /* BENCH_H */
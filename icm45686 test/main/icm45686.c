@@ -14,7 +14,6 @@ static const char *TAG = "ICM45686_C";
 
 #define SPI_READ_BIT (0x80)
 #define DEFAULT_SPI_CLOCK_HZ 6000000
-#define GYR_STARTUP_TIME_US 5000
 #define DEFAULT_WOM_THS_MG (52 >> 2) /* matches Arduino code */
 
 /* single global pointer used by the inv driver callbacks (matches original design) */
@@ -52,6 +51,7 @@ static int transport_spi_write(uint8_t reg, const uint8_t * wbuffer, uint32_t wl
     buf[0] = reg & 0x7F; /* write bit = 0 */
     if (wlen && wbuffer) memcpy(&buf[1], wbuffer, wlen);
 
+    dev->bus_bytes += total;
     esp_err_t r = icm456xx_spi_transmit(dev, buf, NULL, total * 8);
     heap_caps_free(buf);
     return (r == ESP_OK) ? 0 : -1;
@@ -74,6 +74,7 @@ static int transport_spi_read(uint8_t reg, uint8_t * rbuffer, uint32_t rlen)
     tx[0] = (reg | SPI_READ_BIT);
     memset(&tx[1], 0, rlen);
 
+    dev->bus_bytes += total;
     esp_err_t r = icm456xx_spi_transmit(dev, tx, rx, total * 8);
     if (r == ESP_OK) {
         /* rx[0] is garbage (response to tx[0]), subsequent bytes are data */
@@ -146,7 +147,8 @@ int icm456xx_begin(icm456xx_dev_t *dev)
     dev->icm_driver.transport.sleep_us = transport_sleep_us;
 
     /* set FIFO callback */
-    ((inv_imu_adv_var_t *)&dev->icm_driver.adv_var)->sensor_event_cb = fifo_sensor_event_cb;
+    inv_imu_adv_var_t *adv = (inv_imu_adv_var_t *)dev->icm_driver.adv_var;
+    adv->sensor_event_cb = fifo_sensor_event_cb;
 
     /* set global pointer used by callbacks */
     icm_dev_ptr = dev;
@@ -285,13 +287,6 @@ int icm456xx_get_data_from_registers(icm456xx_dev_t *dev, inv_imu_sensor_data_t
 /* Setup IRQ: configure gpio + isr handler (user_isr gets called from ISR context)
    user_isr signature: void (*user_isr)(void*)
 */
-static void gpio_isr_trampoline(void* arg)
-{
-    /* arg is icm456xx_dev_t* and trampoline stored user handler in dev->icm_driver... we store handler pointer via gpio's arg */
-    void (*user_handler)(void*) = (void(*)(void*))arg;
-    if (user_handler) user_handler(NULL);
-}
-
 int icm456xx_enable_fifo_interrupt(icm456xx_dev_t *dev, int int_gpio, void (*user_isr)(void*), uint8_t fifo_watermark)
 {
     if (!dev) return -1;
@@ -347,6 +342,18 @@ int icm456xx_get_data_from_fifo(icm456xx_dev_t *dev, inv_imu_fifo_data_t *data)
     return inv_imu_get_fifo_frame(&dev->icm_driver, data);
 }
 
+int icm456xx_get_fifo_count(icm456xx_dev_t *dev, uint16_t *frames)
+{
+    if (!dev || !frames) return -1;
+    return inv_imu_get_frame_count(&dev->icm_driver, frames);
+}
+
+int icm456xx_read_fifo_burst(icm456xx_dev_t *dev, uint8_t *buf, uint16_t frames)
+{
+    if (!dev || !buf || dev->icm_driver.fifo_frame_size == 0) return -1;
+    return inv_imu_read_reg(&dev->icm_driver, FIFO_DATA, (uint32_t)frames * dev->icm_driver.fifo_frame_size, buf);
+}
+
 /* APEX/GAF wrappers (partial port of original logic) */
 #if defined(ICM45686S) || defined(ICM45605S)
 int icm456xx_start_gaf(icm456xx_dev_t *dev, int int_gpio, void (*user_isr)(void*))
@@ -23,6 +23,7 @@ typedef struct icm456xx_dev_t {
     spi_host_device_t spi_host;           /* SPI peripheral used */
     int cs_gpio;                          /* chip select gpio */
     uint32_t clk_hz;                      /* spi clock */
+    uint32_t bus_bytes;                   /* bytes clocked on SPI, register byte included */
     /* internal state */
     uint32_t step_cnt_ovflw;
     bool apex_enable[5];
@@ -71,6 +72,9 @@ int icm456xx_get_data_from_registers(icm456xx_dev_t *dev, inv_imu_sensor_data_t
 /* FIFO functions */
 int icm456xx_enable_fifo_interrupt(icm456xx_dev_t *dev, int int_gpio, void (*user_isr)(void*), uint8_t fifo_watermark);
 int icm456xx_get_data_from_fifo(icm456xx_dev_t *dev, inv_imu_fifo_data_t *data);
+int icm456xx_get_fifo_count(icm456xx_dev_t *dev, uint16_t *frames);
+/* Reads `frames` raw FIFO frames (header + data, current frame size each) in one transaction */
+int icm456xx_read_fifo_burst(icm456xx_dev_t *dev, uint8_t *buf, uint16_t frames);
 
 /* APEX / GAF (only available when compiled with appropriate defines) */
 #if defined(ICM45686S) || defined(ICM45605S)
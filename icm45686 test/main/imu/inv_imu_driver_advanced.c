@@ -877,6 +877,12 @@ int inv_imu_adv_get_data_from_fifo(inv_imu_device_t *s, uint8_t fifo_data[FIFO_M
 	return status;
 }
 
+/* Longest frame parse_fifo_frame() can walk: every optional field present */
+#define FIFO_PARSE_FRAME_SIZE                                                                     \
+	(2 * FIFO_HEADER_SIZE + ACCEL_DATA_SIZE + GYRO_DATA_SIZE + FIFO_ES0_9B_DATA_SIZE +              \
+	 FIFO_ES1_DATA_SIZE + FIFO_TEMP_DATA_SIZE + FIFO_TEMP_HIGH_RES_SIZE + FIFO_TS_FSYNC_SIZE +       \
+	 FIFO_ACCEL_GYRO_HIGH_RES_SIZE)
+
 int inv_imu_adv_parse_fifo_data(inv_imu_device_t *s, const uint8_t fifo_data[FIFO_MIRRORING_SIZE],
                                 const uint16_t fifo_count)
 {
@@ -886,7 +892,9 @@ int inv_imu_adv_parse_fifo_data(inv_imu_device_t *s, const uint8_t fifo_data[FIF
 
 	/* Foreach packet in the FIFO */
 	for (uint16_t i = 0; i < fifo_count; i++) {
-		uint8_t frame[32] = { 0 };
+		/* Sized for FIFO_PARSE_FRAME_SIZE, not fifo_frame_size: the parsers follow the header
+		 * bits, and a corrupt header can set all of them */
+		uint8_t frame[FIFO_PARSE_FRAME_SIZE] = { 0 };
 
 		/* Create frame */
 		for (int j = 0; j < s->fifo_frame_size; j++)
@@ -14,6 +14,7 @@
 #include "esp_err.h"
 
 #include "icm45686.h"    // wrapper bạn đã có (icm456xx_*)
+#include "bench.h"
 
 // ---------- TÙY CHỈNH PHẦN CẤU HÌNH ----------
 #define SPI_HOST_USED      SPI2_HOST
@@ -29,6 +30,9 @@
 
 /* Chọn định dạng FIFO hiện tại: 8, 16 hoặc 20 (bit per sample layout) */
 #define FIFO_FORMAT_BITS   16
+
+/* 1: chạy benchmark throughput (bench.h) thay cho demo polling */
+#define BENCH_MODE         0
 // ------------------------------------------------
 
 static const char *TAG = "main_poll_struct";
@@ -169,6 +173,12 @@ void app_main(void)
         return;
     }
 
+#if BENCH_MODE
+    sensor_bench_result_t results[BENCH_MODES];
+    bench_run(&imu_dev, results);
+    return;
+#endif
+
     xTaskCreate(imu_poll_task, "imu_poll", 4096, NULL, 5, NULL);
 
     // vòng chính chỉ để log trạng thái, bạn có thể bỏ hoặc thêm kiểm tra khác